@@ -42,6 +42,8 @@
 
 // special case semirings:
 
+#define GB_SEMIRING_HAS_AVX_SAXPY4_DOT4 1
+
 // monoid properties:
 #define GB_Z_TYPE double
 #define GB_DECLARE_IDENTITY(z) double z = ((double) INFINITY)
@@ -118,6 +120,10 @@ GrB_Info GB (_Adot3B__min_plus_fp64)
 // GB_Adot4B:  C+=A'*B: dense dot product
 //------------------------------------------------------------------------------
 
+#if !GB_DISABLE
+#include "mxm/template/GB_AxB_dot4_avx.c"
+#endif
+
 GrB_Info GB (_Adot4B__min_plus_fp64)
 (
     GrB_Matrix C,
@@ -135,6 +141,22 @@ GrB_Info GB (_Adot4B__min_plus_fp64)
     #if GB_DISABLE
     return (GrB_NO_VALUE) ;
     #else
+    #if GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global_cpu_features_avx512f ( ))
+    { 
+        // x86_64 with AVX512f
+        return (GB_AxB_dot4_avx512f (C, C_in_iso, A, B, A_slice, B_slice,
+            naslice, nbslice, nthreads, Werk)) ;
+    }
+    #endif
+    #if GB_COMPILER_SUPPORTS_AVX2
+    if (GB_Global_cpu_features_avx2 ( ))
+    { 
+        // x86_64 with AVX2
+        return (GB_AxB_dot4_avx2 (C, C_in_iso, A, B, A_slice, B_slice,
+            naslice, nbslice, nthreads, Werk)) ;
+    }
+    #endif
     #include "mxm/template/GB_AxB_dot4_meta.c"
     return (GrB_SUCCESS) ;
     #endif
@@ -182,6 +204,10 @@ GrB_Info GB (_AsaxbitB__min_plus_fp64)
 // GB_Asaxpy4B: C += A*B when C is full
 //------------------------------------------------------------------------------
 
+#if !GB_DISABLE
+#include "mxm/template/GB_AxB_saxpy4_avx.c"
+#endif
+
 GrB_Info GB (_Asaxpy4B__min_plus_fp64)
 (
     GrB_Matrix C,
@@ -201,6 +227,26 @@ GrB_Info GB (_Asaxpy4B__min_plus_fp64)
     #if GB_DISABLE
     return (GrB_NO_VALUE) ;
     #else
+    #if GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global_cpu_features_avx512f ( ))
+    { 
+        // x86_64 with AVX512f
+        GB_AxB_saxpy4_avx512f (C, A, B, ntasks, nthreads,
+            nfine_tasks_per_vector, use_coarse_tasks, use_atomics,
+            A_slice, H_slice, Wcx, Wf) ;
+        return (GrB_SUCCESS) ;
+    }
+    #endif
+    #if GB_COMPILER_SUPPORTS_AVX2
+    if (GB_Global_cpu_features_avx2 ( ))
+    { 
+        // x86_64 with AVX2
+        GB_AxB_saxpy4_avx2 (C, A, B, ntasks, nthreads,
+            nfine_tasks_per_vector, use_coarse_tasks, use_atomics,
+            A_slice, H_slice, Wcx, Wf) ;
+        return (GrB_SUCCESS) ;
+    }
+    #endif
     #include "mxm/template/GB_AxB_saxpy4_meta.c"
     return (GrB_SUCCESS) ;
     #endif
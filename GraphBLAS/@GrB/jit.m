@@ -17,6 +17,8 @@ function [s,path] = jit (s,path)
 %   'run'       run JIT kernels if already loaded; no load/compile.
 %   'load'      able to load and run JIT kernels; may not compile.
 %   'on'        full JIT: able to compile, load, and run.
+%   'async'     full JIT, but new kernels are compiled in the background;
+%               the generic kernels are used until they are ready.
 %   'flush'     clear all loaded JIT kernels, then turn the JIT on;
 %               (the same as GrB.jit ('off') ; GrB.jit ('on')).
 %
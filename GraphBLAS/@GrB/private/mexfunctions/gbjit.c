@@ -49,6 +49,7 @@ void mexFunction
         else if (MATCH (s, "run"  )) JIT (GxB_JIT_RUN)
         else if (MATCH (s, "load" )) JIT (GxB_JIT_LOAD)
         else if (MATCH (s, "on"   )) JIT (GxB_JIT_ON)
+        else if (MATCH (s, "async")) JIT (GxB_JIT_ASYNC)
         else if (MATCH (s, "flush")) { JIT (GxB_JIT_OFF) ; JIT (GxB_JIT_ON) ; }
         else ERROR2 ("unknown option: %s", s) ;
     }
@@ -79,6 +80,7 @@ void mexFunction
             case GxB_JIT_RUN  : pargout [0] = mxCreateString ("run"  ) ; break ;
             case GxB_JIT_LOAD : pargout [0] = mxCreateString ("load" ) ; break ;
             case GxB_JIT_ON   : pargout [0] = mxCreateString ("on"   ) ; break ;
+            case GxB_JIT_ASYNC: pargout [0] = mxCreateString ("async") ; break ;
             default           : pargout [0] = mxCreateString ("unknown") ;
                                 break ;
         }
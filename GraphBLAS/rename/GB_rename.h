@@ -24,13 +24,24 @@
 #define GB_assign_zombie3 GM_assign_zombie3
 #define GB_assign_zombie4 GM_assign_zombie4
 #define GB_assign_zombie5 GM_assign_zombie5
+#define GB_AxB_autotune_finalize GM_AxB_autotune_finalize
+#define GB_AxB_autotune_get GM_AxB_autotune_get
+#define GB_AxB_autotune_record GM_AxB_autotune_record
+#define GB_AxB_autotune_select GM_AxB_autotune_select
+#define GB_AxB_autotune_set GM_AxB_autotune_set
 #define GB_AxB_dot2_control GM_AxB_dot2_control
 #define GB_AxB_dot2 GM_AxB_dot2
+#define GB_AxB_dot2_fine GM_AxB_dot2_fine
+#define GB_AxB_dot2_fine_jit GM_AxB_dot2_fine_jit
 #define GB_AxB_dot2_jit GM_AxB_dot2_jit
 #define GB_AxB_dot2n_jit GM_AxB_dot2n_jit
 #define GB_AxB_dot3 GM_AxB_dot3
 #define GB_AxB_dot3_jit GM_AxB_dot3_jit
 #define GB_AxB_dot3_one_slice GM_AxB_dot3_one_slice
+#define GB_AxB_dot3_reduce GM_AxB_dot3_reduce
+#define GB_AxB_dot3_reduce_jit GM_AxB_dot3_reduce_jit
+#define GB_AxB_dot3_rowreduce GM_AxB_dot3_rowreduce
+#define GB_AxB_dot3_rowreduce_jit GM_AxB_dot3_rowreduce_jit
 #define GB_AxB_dot3_slice GM_AxB_dot3_slice
 #define GB_AxB_dot4 GM_AxB_dot4
 #define GB_AxB_dot4_jit GM_AxB_dot4_jit
@@ -353,6 +364,7 @@
 #define GB_file_dlclose GM_file_dlclose
 #define GB_file_dlopen GM_file_dlopen
 #define GB_file_dlsym GM_file_dlsym
+#define GB_file_exists GM_file_exists
 #define GB_file_mkdir GM_file_mkdir
 #define GB_file_open_and_lock GM_file_open_and_lock
 #define GB_file_unlock_and_close GM_file_unlock_and_close
@@ -377,6 +389,7 @@
 #define GB_FSE_readNCount GM_FSE_readNCount
 #define GB_FSE_versionNumber GM_FSE_versionNumber
 #define GB_FSE_writeNCount GM_FSE_writeNCount
+#define GB_fusedmm GM_fusedmm
 #define GB_Global_abort GM_Global_abort
 #define GB_Global_abort_set GM_Global_abort_set
 #define GB_Global_bitmap_switch_default GM_Global_bitmap_switch_default
@@ -1006,6 +1019,10 @@
 #define GB_msort_3_create_merge_tasks GM_msort_3_create_merge_tasks
 #define GB_msort_3 GM_msort_3
 #define GB_mxm GM_mxm
+#define GB_MxmPlan_clear GM_MxmPlan_clear
+#define GB_MxmPlan_match GM_MxmPlan_match
+#define GB_MxmPlan_save GM_MxmPlan_save
+#define GB_mxm_reduce GM_mxm_reduce
 #define GB_new_bix GM_new_bix
 #define GB_new GM_new
 #define GB_nnz_full GM_nnz_full
@@ -3211,6 +3228,7 @@
 #define GxB_FREXPE_FP64 GxM_FREXPE_FP64
 #define GxB_FREXPX_FP32 GxM_FREXPX_FP32
 #define GxB_FREXPX_FP64 GxM_FREXPX_FP64
+#define GxB_fusedmm GxM_fusedmm
 #define GxB_GE_THUNK GxM_GE_THUNK
 #define GxB_GE_ZERO GxM_GE_ZERO
 #define GxB_Global_Option_get_CHAR GxM_Global_Option_get_CHAR
@@ -3240,6 +3258,7 @@
 #define GxB_IndexUnaryOp_ytype_name GxM_IndexUnaryOp_ytype_name
 #define GxB_IndexUnaryOp_ztype_name GxM_IndexUnaryOp_ztype_name
 #define GxB_init GxM_init
+#define GxB_innerProduct GxM_innerProduct
 #define GxB_ISEQ_BOOL GxM_ISEQ_BOOL
 #define GxB_ISEQ_FC32 GxM_ISEQ_FC32
 #define GxB_ISEQ_FC64 GxM_ISEQ_FC64
@@ -4182,6 +4201,11 @@
 #define GxB_Monoid_terminal_new_UINT32 GxM_Monoid_terminal_new_UINT32
 #define GxB_Monoid_terminal_new_UINT64 GxM_Monoid_terminal_new_UINT64
 #define GxB_Monoid_terminal_new_UINT8 GxM_Monoid_terminal_new_UINT8
+#define GxB_MxmPlan_execute GxM_MxmPlan_execute
+#define GxB_MxmPlan_free GxM_MxmPlan_free
+#define GxB_MxmPlan_new GxM_MxmPlan_new
+#define GxB_mxm_reduce GxM_mxm_reduce
+#define GxB_mxm_reduce_Vector GxM_mxm_reduce_Vector
 #define GxB_NE_FC32 GxM_NE_FC32
 #define GxB_NE_FC64 GxM_NE_FC64
 #define GxB_NE_THUNK GxM_NE_THUNK
@@ -4204,6 +4228,7 @@
 #define GxB_ONE_UINT32 GxM_ONE_UINT32
 #define GxB_ONE_UINT64 GxM_ONE_UINT64
 #define GxB_ONE_UINT8 GxM_ONE_UINT8
+#define GxB_outerProduct GxM_outerProduct
 #define GxB_pack_HyperHash GxM_pack_HyperHash
 #define GxB_PAIR_BOOL GxM_PAIR_BOOL
 #define GxB_PAIR_FC32 GxM_PAIR_FC32
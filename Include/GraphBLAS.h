@@ -190,7 +190,19 @@
 /* #undef GxB_HAVE_COMPLEX_MSVC */
     #endif
 
-    #if defined (GxB_HAVE_COMPLEX_MSVC)
+    #if defined (__TINYC__)
+
+        // The Tiny C Compiler (used by the JIT with GxB_JIT_USE_LIBTCC) has
+        // no complex type, so a struct with the same layout is used instead.
+        // JIT kernels that do complex arithmetic cannot be compiled by tcc;
+        // they are compiled with the C compiler instead.
+        typedef struct { float  re, im ; } GxB_FC32_t ;
+        typedef struct { double re, im ; } GxB_FC64_t ;
+        #define GxB_CMPLXF(r,i) ((GxB_FC32_t) { (float)  (r), (float)  (i) })
+        #define GxB_CMPLX(r,i)  ((GxB_FC64_t) { (double) (r), (double) (i) })
+        #define GB_HAS_CMPLX_MACROS 1
+
+    #elif defined (GxB_HAVE_COMPLEX_MSVC)
 
         // Microsoft Windows complex types for C
         #include <complex.h>
@@ -1429,6 +1441,9 @@ typedef enum            // for global options or matrix options
     GxB_PRINTF = 7020,               // printf function diagnostic output
     GxB_FLUSH = 7021,                // flush function diagnostic output
     GxB_MEMORY_POOL = 7022,          // no longer used
+    GxB_MEMORY_POOL_MAX_SIZE = 7058, // max size of the memory pool (bytes)
+    GxB_MEMORY_POOL_SIZE = 7059,     // size of the memory pool (bytes)
+    GxB_HUGE_PAGES = 7062,           // huge pages for blocks this large (bytes)
     GxB_PRINT_1BASED = 7023,         // print matrices as 0-based or 1-based
 
     GxB_JIT_C_COMPILER_NAME = 7024,  // CPU JIT C compiler name
@@ -1441,6 +1456,14 @@ typedef enum            // for global options or matrix options
     GxB_JIT_C_CMAKE_LIBS = 7031,     // CPU JIT C libraries when using cmake
     GxB_JIT_USE_CMAKE = 7032,        // CPU JIT: use cmake or direct compile
     GxB_JIT_ERROR_LOG = 7033,        // CPU JIT: error log file
+    GxB_JIT_MANIFEST = 7050,         // CPU JIT: record loaded kernels in a file
+    GxB_JIT_PROFILE = 7051,          // CPU JIT: record per-kernel calls and time
+    GxB_JIT_PROFILE_REPORT = 7052,   // CPU JIT: report of the JIT profile
+    GxB_JIT_MAX_LOADED = 7053,       // CPU JIT: max # of kernels loaded
+    GxB_JIT_CACHE_MAX_SIZE = 7054,   // CPU JIT: max size of cache (bytes)
+    GxB_JIT_SPECIALIZE_DIM = 7055,   // CPU JIT: max dimension fixed in kernels
+    GxB_JIT_USE_LIBTCC = 7057,       // CPU JIT: compile in-process with libtcc
+    GxB_AUTOTUNE = 7049,             // autotune the C=A*B method selection
 
     GxB_JIT_CUDA_PREFACE = 7100,     // CUDA JIT C++ preface
 
@@ -1456,20 +1479,44 @@ typedef enum            // for global options or matrix options
     //------------------------------------------------------------
 
     GxB_SPARSITY_CONTROL = 7036,    // sparsity control: 0 to 15; see below
+    GxB_PENDING_SHARDS = 7063,      // # of shards for concurrent setElement
 
 } GxB_Option_Field ;
 
 // for GxB_JIT_C_CONTROL:
 typedef enum
 {
+    GxB_JIT_DEFAULT = -1, // type, op, or semiring: use the global control
     GxB_JIT_OFF = 0,    // do not use the JIT: free all JIT kernels if loaded
     GxB_JIT_PAUSE = 1,  // do not run JIT kernels but keep any loaded
     GxB_JIT_RUN = 2,    // run JIT kernels if already loaded; no load/compile
     GxB_JIT_LOAD = 3,   // able to load and run JIT kernels; may not compile
     GxB_JIT_ON = 4,     // full JIT: able to compile, load, and run
+    GxB_JIT_ASYNC = 5,  // full JIT, but compile new kernels in the background
 }
 GxB_JIT_Control ;
 
+// GxB_JIT_warmup compiles all the kernels listed in a manifest file (written
+// by a prior run with GxB_JIT_MANIFEST set) that are not already in the JIT
+// cache.  Up to GxB_NTHREADS compiler processes are used at the same time.
+GrB_Info GxB_JIT_warmup         // compile the kernels in a JIT manifest
+(
+    const char *manifest        // manifest file
+) ;
+
+// GxB_JIT_pack links all the compiled CPU kernels in the JIT cache into a
+// single library, which is loaded with all of its kernels when GraphBLAS
+// starts, or when the cache path is set.
+GrB_Info GxB_JIT_pack (void) ;
+
+// GxB_JIT_register registers all the kernels in a library created by
+// GxB_JIT_pack, which may have been copied to any location, so that an
+// application can ship its own pack of kernels.
+GrB_Info GxB_JIT_register       // register a bundle of JIT kernels
+(
+    const char *library         // library created by GxB_JIT_pack
+) ;
+
 // GxB_FORMAT is historical, but it can be by row or by column:
 typedef enum
 {
@@ -1580,6 +1627,10 @@ typedef enum
 
     // GPU control (DRAFT: in progress, do not use)
     GxB_CONTEXT_GPU_ID      = GxB_GPU_ID,
+
+    GxB_CONTEXT_WERK_MAX_SIZE = 7060,   // max size of the Werk arena (bytes)
+                    // of a user Context.  If <= 0, there is no arena.
+    GxB_CONTEXT_WERK_SIZE = 7061,       // size of the Werk arena (read-only)
 }
 GxB_Context_Field ;
 
@@ -1641,6 +1692,9 @@ typedef enum
     GxB_JIT_C_NAME = 7041,          // C type or function name
     GxB_JIT_C_DEFINITION = 7042,    // C typedef or function definition
 
+    // GrB_BinaryOp only:
+    GxB_JIT_C_OBJECT = 7056,        // object or bitcode file of the function
+
     // GrB_Monoid and GrB_Semiring:
     GxB_MONOID_IDENTITY = 7043,     // monoid identity value
     GxB_MONOID_TERMINAL = 7044,     // monoid terminal value
@@ -1689,13 +1743,17 @@ typedef enum
     GrB_COMPLETE = 0,       // establishes a happens-before relation; work may
                             // remain to compute the object but this can now
                             // be done safely by any user thread.
-    GrB_MATERIALIZE = 1     // all work on the object is finished (also
+    GrB_MATERIALIZE = 1,    // all work on the object is finished (also
                             // establishes a happens-before relation).  The
                             // object can be safely be used as an input to a
                             // GraphBLAS method by multiple user threads at
                             // the same time.  For example, the A or B matrices
                             // of GrB_mxm can be shared by 2 user threads, but
                             // their output matrices C must be different.
+    GxB_BACKGROUND = 2      // start the work on a matrix or vector in a
+                            // background thread, and return at once.  The
+                            // work is finished by the next method that needs
+                            // the finished object.
 }
 GrB_WaitMode ;
 
@@ -5651,6 +5709,7 @@ GrB_Info GxB_Context_set_VOID   (GxB_Context, void *    , GrB_Field, size_t) ;
             GrB_Matrix       *: GrB_Matrix_free       , \
             GrB_Descriptor   *: GrB_Descriptor_free   , \
             GxB_Context      *: GxB_Context_free      , \
+            GxB_MxmPlan      *: GxB_MxmPlan_free      , \
             GxB_Iterator     *: GxB_Iterator_free       \
     )                                                   \
     (object)
@@ -5779,6 +5838,138 @@ GrB_Info GrB_mxv                    // w<Mask> = accum (w, A*u)
     const GrB_Descriptor desc       // descriptor for w, mask, and A
 ) ;
 
+// GxB_mxm_reduce computes s = accum (s, reduce (C<Mask>=A*B)), where the
+// reduction to the scalar s uses the additive monoid of the semiring.  The
+// result is the same as GrB_mxm followed by GrB_reduce, but if the Mask is
+// present, not complemented, and sparse or hypersparse, the matrix C is not
+// constructed.  GrB_REPLACE is ignored.  For example, the number of triangles
+// in a graph with a lower triangular adjacency matrix L is
+// GxB_mxm_reduce (s, NULL, L, GxB_PLUS_PAIR_INT64, L, L, GrB_DESC_ST1).
+
+GrB_Info GxB_mxm_reduce             // s = accum (s, reduce (C<M>=A*B))
+(
+    GrB_Scalar s,                   // input/output scalar for the result
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B, and the
+                                    // monoid '+' for the reduction to s
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for Mask, A, and B
+) ;
+
+// GxB_mxm_reduce_Vector computes w = accum (w, t), where t(i) is the reduction
+// of the ith row of C<Mask>=A*B, using the additive monoid of the semiring.
+// The result is the same as GrB_mxm followed by GrB_Matrix_reduce_Monoid, and
+// the matrix C is not constructed for the same cases as GxB_mxm_reduce.  For
+// example, the # of triangles incident on each node of an undirected graph
+// with a symmetric adjacency matrix A is 1/2 of t=sum(A.*(A*A'),2), computed
+// by GxB_mxm_reduce_Vector (t, NULL, A, GxB_PLUS_PAIR_INT64, A, A,
+// GrB_DESC_ST1).
+
+GrB_Info GxB_mxm_reduce_Vector      // w = accum (w, rowreduce (C<M>=A*B))
+(
+    GrB_Vector w,                   // input/output vector for the result
+    const GrB_BinaryOp accum,       // optional accum for w=accum(w,t)
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B, and the
+                                    // monoid '+' for the reduction to w
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for Mask, A, and B
+) ;
+
+// GxB_fusedmm computes Z = accum (Z, (C<S>=X*Y')*W), a sampled dense-dense
+// matrix product (SDDMM) with the sddmm semiring, followed by a sparse-dense
+// matrix product (SpMM) with the spmm semiring.  The result is the same as
+// two calls to GrB_mxm, but if S is present, not complemented, and sparse or
+// hypersparse, and W is full, the two products are blocked by rows of S: each
+// block of C is computed by the SDDMM and then used by the SpMM, so C is never
+// constructed in its entirety.  The two products are not fused.  The
+// descriptor applies to the mask S; GrB_REPLACE, GrB_INP0, and GrB_INP1 are
+// ignored.  For example, a graph attention layer with an adjacency matrix S
+// and node features H computes GxB_fusedmm (Z, NULL, S,
+// GrB_PLUS_TIMES_SEMIRING_FP32, H, H, GrB_PLUS_TIMES_SEMIRING_FP32, H,
+// GrB_DESC_S).
+
+GrB_Info GxB_fusedmm                // Z = accum (Z, (C<S>=X*Y')*W)
+(
+    GrB_Matrix Z,                   // input/output matrix for results
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(Z,T)
+    const GrB_Matrix S,             // optional mask for C=X*Y'
+    const GrB_Semiring sddmm,       // defines '+' and '*' for C=X*Y'
+    const GrB_Matrix X,             // first input:  matrix X
+    const GrB_Matrix Y,             // second input: matrix Y
+    const GrB_Semiring spmm,        // defines '+' and '*' for T=C*W
+    const GrB_Matrix W,             // third input:  matrix W
+    const GrB_Descriptor desc       // descriptor for S
+) ;
+
+// GxB_innerProduct computes the scalar s = accum (s, u'*v), and
+// GxB_outerProduct computes the matrix C<M> = accum (C, u*v').  The results
+// are the same as GrB_mxm with u and v treated as n-by-1 matrices.  The inner
+// product is always computed with a dot product, which is split across all
+// the threads.  The descriptor of GxB_innerProduct is not used.  GrB_INP0
+// and GrB_INP1 are ignored by GxB_outerProduct.
+
+GrB_Info GxB_innerProduct           // s = accum (s, u'*v)
+(
+    GrB_Scalar s,                   // input/output scalar for the result
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for u'*v
+    const GrB_Vector u,             // first input:  vector u
+    const GrB_Vector v,             // second input: vector v
+    const GrB_Descriptor desc       // descriptor (unused)
+) ;
+
+GrB_Info GxB_outerProduct           // C<M> = accum (C, u*v')
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for u*v'
+    const GrB_Vector u,             // first input:  vector u
+    const GrB_Vector v,             // second input: vector v
+    const GrB_Descriptor desc       // descriptor for C and Mask
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_MxmPlan: reuse the symbolic analysis of C=A*B
+//------------------------------------------------------------------------------
+
+// GxB_MxmPlan_execute computes C<M> = accum (C, A*B), just like GrB_mxm, but
+// it saves the symbolic analysis of T=A*B in the plan.  When the plan is used
+// again for a product whose matrices A and B have the same patterns (but with
+// any values), the analysis is reused and only the numeric phase is done.  If
+// the patterns differ, the analysis is redone.  The plan holds a copy of the
+// patterns of A and B.  The analysis is kept only when A and B are sparse or
+// hypersparse and T is computed with the saxpy method.  The mask is not used
+// to compute T, but is applied when T is accumulated into C.
+
+typedef struct GB_MxmPlan_opaque *GxB_MxmPlan ;
+
+GrB_Info GxB_MxmPlan_new            // create a new plan
+(
+    GxB_MxmPlan *plan               // handle of plan to create
+) ;
+
+GrB_Info GxB_MxmPlan_free           // free a plan
+(
+    GxB_MxmPlan *plan               // handle of plan to free
+) ;
+
+GrB_Info GxB_MxmPlan_execute        // C<M> = accum (C, A*B), using a plan
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for T=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc,      // descriptor for C, Mask, A, and B
+    GxB_MxmPlan plan                // analysis of T=A*B, updated on output
+) ;
+
 //==============================================================================
 // GrB_eWiseMult: element-wise matrix and vector operations, set intersection
 //==============================================================================
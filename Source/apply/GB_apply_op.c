@@ -453,6 +453,7 @@ GrB_Info GB_apply_op        // apply a unary op, idxunop, or binop, Cx = op (A)
 
         if (info == GrB_NO_VALUE)
         { 
+            GB_JIT_GENERIC (GB_jit_apply_family) ;
             GB_BURBLE_N (anz, "(generic unop apply: %s) ", op->name) ;
 
             size_t asize = Atype->size ;
@@ -662,6 +663,7 @@ GrB_Info GB_apply_op        // apply a unary op, idxunop, or binop, Cx = op (A)
         if (info == GrB_NO_VALUE)
         {
 
+            GB_JIT_GENERIC (GB_jit_ewise_family) ;
             GB_BURBLE_N (anz, "(generic binop apply: %s) ", op->name) ;
 
             GB_Type_code acode = Atype->code ;
@@ -749,6 +751,7 @@ GrB_Info GB_apply_op        // apply a unary op, idxunop, or binop, Cx = op (A)
 
         if (info == GrB_NO_VALUE)
         { 
+            GB_JIT_GENERIC (GB_jit_apply_family) ;
             GB_BURBLE_N (anz, "(generic apply: user-defined idxunop) ") ;
 
             // get A and C
@@ -184,6 +184,9 @@ GrB_Info GB_assign_prep
     GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (M) ;
     GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;
 
+    // C is about to be modified, so finish any background wait of C
+    GB_WAIT_BACKGROUND (C) ;
+
     // some kernels allow for M and A to be jumbled
     ASSERT (GB_JUMBLED_OK (M)) ;
     ASSERT (GB_JUMBLED_OK (A)) ;
@@ -661,9 +664,11 @@ GrB_Info GB_assign_prep
             return (GB_block (C, Werk)) ;
         }
 
-        // free pending tuples early but do not clear C.  If it is
-        // already dense then its pattern can be reused.
+        // free pending tuples early (including any in the shards of C) but
+        // do not clear C.  If it is already dense then its pattern can be
+        // reused.
         GB_Pending_free (&(C->Pending)) ;
+        GB_Pending_shards_free (C) ;
     }
 
     //--------------------------------------------------------------------------
@@ -1111,7 +1116,14 @@ GrB_Info GB_assign_prep
         // Thus all prior pending tuples must be assembled first if
         // action: ( delete ) can occur.
 
-        if (*C_replace)
+        if (C->shards_anchored)
+        { 
+            // tuples from concurrent setElement are held in the shards of C,
+            // not in C->Pending.  They must be assembled first, so that they
+            // are not overwritten out of order by this assignment.
+            wait = true ;
+        }
+        else if (*C_replace)
         { 
             // C_replace must use the action: ( delete )
             wait = true ;
@@ -164,6 +164,7 @@ GrB_Info GB_subassign_05d
     if (info == GrB_NO_VALUE)
     { 
         #include "generic/GB_generic.h"
+        GB_JIT_GENERIC (GB_jit_assign_family) ;
         GB_BURBLE_MATRIX (M, "(generic C(:,:)<M>=x assign) ") ;
 
         // Cx [pC] = cwork
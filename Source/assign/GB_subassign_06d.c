@@ -178,6 +178,7 @@ GrB_Info GB_subassign_06d
         if (info == GrB_NO_VALUE)
         { 
             #include "generic/GB_generic.h"
+            GB_JIT_GENERIC (GB_jit_assign_family) ;
             GB_BURBLE_MATRIX (A, "(generic C(:,:)<A>=A assign) ") ;
 
             const size_t csize = C->type->size ;
@@ -97,6 +97,7 @@ GrB_Info GB_subassign_24    // C = A, copy A into an existing matrix C
         // make C full, if not full already
         C->nzombies = 0 ;                   // overwrite any zombies
         GB_Pending_free (&(C->Pending)) ;   // abandon all pending tuples
+        GB_Pending_shards_free (C) ;        // including those in any shards
         C->iso = C_iso ;
         GB_convert_any_to_full (C) ;        // ensure C is full
 
@@ -201,6 +201,7 @@ GrB_Info GB_subassign_25
         if (info == GrB_NO_VALUE)
         { 
             #include "generic/GB_generic.h"
+            GB_JIT_GENERIC (GB_jit_assign_family) ;
             GB_BURBLE_MATRIX (A, "(generic C(:,:)<M,struct>=A assign, "
                 "method 25) ") ;
 
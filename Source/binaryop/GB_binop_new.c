@@ -54,6 +54,12 @@ GrB_Info GB_binop_new
     op->idxunop_function = NULL ;
     op->binop_function = function ;       // NULL for GB_reduce_to_vector
     op->opcode = opcode ;
+    op->jit_C_flags = NULL ;
+    op->jit_C_flags_size = 0 ;
+    op->jit_control = GxB_JIT_DEFAULT ;
+    op->jit_control_set = false ;
+    op->jit_C_object = NULL ;
+    op->jit_C_object_size = 0 ;
 
     //--------------------------------------------------------------------------
     // get the binary op name and defn
@@ -1267,6 +1267,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
 
             if (info == GrB_NO_VALUE)
             {
+                GB_JIT_GENERIC (GB_jit_build_family) ;
                 if (do_burble) GBURBLE ("(generic build) ") ;
 
                 //--------------------------------------------------------------
@@ -1339,6 +1340,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
             if (info == GrB_NO_VALUE)
             {
 
+                GB_JIT_GENERIC (GB_jit_build_family) ;
                 if (do_burble)
                 {
                     GBURBLE ("(generic build with typecast) ") ;
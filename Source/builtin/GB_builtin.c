@@ -1026,6 +1026,8 @@ struct GB_Context_opaque GB_OPAQUE (CONTEXT_WORLD) =
     (double) GB_CHUNK_DEFAULT,      // chunk
     1,                              // nthreads_max
     -1,                             // gpu_id
+    // no Werk arena for GxB_CONTEXT_WORLD:
+    NULL, 0, 0, 0, 0,               // werk_arena, size, top, need, max_size
 } ;
 
 GxB_Context GxB_CONTEXT_WORLD = & GB_OPAQUE (CONTEXT_WORLD) ;
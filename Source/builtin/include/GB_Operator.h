@@ -35,3 +35,12 @@
 
     uint64_t hash ;         // if 0, operator uses only builtin ops and types
 
+    // JIT options for kernels that use this operator (binary ops only):
+    char *jit_C_flags ;     // C flags appended to GxB_JIT_C_COMPILER_FLAGS
+    size_t jit_C_flags_size ;   // allocated size of jit_C_flags
+    GxB_JIT_Control jit_control ;   // limit on GxB_JIT_C_CONTROL
+    bool jit_control_set ;  // if false, jit_control is not used
+    char *jit_C_object ;    // object or bitcode file with the function,
+                            // linked into kernels if defn is NULL
+    size_t jit_C_object_size ;  // allocated size of jit_C_object
+
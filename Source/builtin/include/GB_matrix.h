@@ -514,6 +514,39 @@ bool jumbled ;          // true if the matrix may be jumbled.  bitmap and full
 
 bool iso ;              // true if all entries have the same value
 
+//------------------------------------------------------------------------------
+// concurrent setElement
+//------------------------------------------------------------------------------
+
+// If A->nshards > 0, many user threads can call GrB_setElement on A at the
+// same time (and no other method may be used on A while they do so).  Each
+// thread appends its tuples to one of the A->nshards shards in A->Shards,
+// not to A->Pending.  The first such tuple also ensures that A->Pending exists
+// (with no tuples of its own, if needed), and sets A->shards_anchored, so that
+// GB_PENDING (A) is true and the next GB_wait (A) appends all the shards to
+// A->Pending and assembles them.  A->nshards is set by GrB_set (A, nshards,
+// GxB_PENDING_SHARDS).  The A->Shards array is content of A: it is freed by
+// GB_bix_free and allocated again when needed.
+
+int32_t nshards ;           // # of shards of pending tuples; 0 if disabled
+int32_t shards_anchored ;   // 1 if A->Shards and A->Pending exist for the
+                            // shards; accessed atomically
+GB_Shard *Shards ;          // array of size A->nshards, or NULL
+size_t Shards_size ;
+
+//------------------------------------------------------------------------------
+// background wait
+//------------------------------------------------------------------------------
+
+// GrB_wait (A, GxB_BACKGROUND) starts a thread that finishes a private copy of
+// A.  The content of A is not modified while the thread runs; it may be read
+// by methods that do not need A to be finished.  The next GB_wait (A), or any
+// method that modifies A, waits for the thread and transplants its result
+// into A.  A->Background is NULL if no background wait is in progress.  See
+// wait/GB_wait_background.c.
+
+GB_Background Background ;  // background wait of A, or NULL
+
 //------------------------------------------------------------------------------
 // iterating through a matrix
 //------------------------------------------------------------------------------
@@ -377,6 +377,11 @@ struct GB_Type_opaque       // content of GrB_Type
     size_t defn_size ;      // allocated size of the definition
     uint64_t hash ;         // if 0, type is builtin.
                             // if UINT64_MAX, the type cannot be JIT'd.
+    // JIT options for kernels that use this type:
+    char *jit_C_flags ;     // C flags appended to GxB_JIT_C_COMPILER_FLAGS
+    size_t jit_C_flags_size ;   // allocated size of jit_C_flags
+    GxB_JIT_Control jit_control ;   // limit on GxB_JIT_C_CONTROL
+    bool jit_control_set ;  // if false, jit_control is not used
 } ;
 
 struct GB_UnaryOp_opaque    // content of GrB_UnaryOp
@@ -439,6 +444,11 @@ struct GB_Semiring_opaque   // content of GrB_Semiring
     int32_t name_len ;      // length of name; 0 for builtin
     size_t name_size ;      // allocated size of the name
     uint64_t hash ;         // if 0, semiring uses only builtin ops and types
+    // JIT options for kernels that use this semiring:
+    char *jit_C_flags ;     // C flags appended to GxB_JIT_C_COMPILER_FLAGS
+    size_t jit_C_flags_size ;   // allocated size of jit_C_flags
+    GxB_JIT_Control jit_control ;   // limit on GxB_JIT_C_CONTROL
+    bool jit_control_set ;  // if false, jit_control is not used
 } ;
 
 struct GB_Descriptor_opaque // content of GrB_Descriptor
@@ -478,6 +488,12 @@ struct GB_Context_opaque    // content of GxB_Context
     // GPU:
     int gpu_id ;            // if negative: use the CPU only; do not use a GPU
                             // if >= 0: then use GPU gpu_id
+    // Werk arena:
+    GB_void *werk_arena ;   // werkspace for the user thread, beyond Werk->Stack
+    size_t werk_size ;      // allocated size of werk_arena
+    size_t werk_top ;       // top of the werk_arena stack, initially zero
+    size_t werk_need ;      // largest size of werk_arena needed so far
+    size_t werk_max_size ;  // max size of werk_arena; 0 if disabled
 } ;
 
 //------------------------------------------------------------------------------
@@ -493,6 +509,7 @@ struct GB_Pending_struct    // list of pending tuples for a matrix
     int64_t n ;         // number of pending tuples to add to matrix
     int64_t nmax ;      // size of i,j,x
     bool sorted ;       // true if pending tuples are in sorted order
+    bool overlap ;      // true if some tuples may be entries already in A
     int64_t *i ;        // row indices of pending tuples
     size_t i_size ;
     int64_t *j ;        // col indices of pending tuples; NULL if A->vdim <= 1
@@ -506,6 +523,28 @@ struct GB_Pending_struct    // list of pending tuples for a matrix
 
 typedef struct GB_Pending_struct *GB_Pending ;
 
+// A matrix with A->nshards > 0 has an array of A->nshards shards, each with
+// its own list of pending tuples.  Each user thread calling GrB_setElement
+// appends to one shard, guarded by the spin lock of that shard.  A shard is
+// padded to 64 bytes so that threads on different shards do not share a
+// cache line.  See pending/GB_Pending_shards_*.c.
+
+struct GB_Shard_struct      // one shard of pending tuples
+{
+    GB_Pending Pending ;    // list of pending tuples of this shard
+    int32_t lock ;          // 1 if a thread holds the shard, 0 otherwise
+    int32_t unused ;        // unused (for padding)
+    int64_t pad [6] ;       // unused (for padding)
+} ;
+
+typedef struct GB_Shard_struct GB_Shard ;
+
+// A matrix with a background wait in progress (see GrB_wait with the
+// GxB_BACKGROUND mode) holds the state of its thread in A->Background.  The
+// struct is private to wait/GB_wait_background.c.
+
+typedef struct GB_Background_struct *GB_Background ;
+
 //------------------------------------------------------------------------------
 // scalar, vector, and matrix types
 //------------------------------------------------------------------------------
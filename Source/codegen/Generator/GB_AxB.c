@@ -52,6 +52,7 @@ GB_is_plus_pair_big_semiring
 GB_is_min_firstj_semiring
 GB_is_max_firstj_semiring
 GB_semiring_has_avx
+GB_semiring_has_avx_saxpy4_dot4
 
 // monoid properties:
 GB_ztype
@@ -144,6 +145,12 @@ m4_divert(if_dot4_enabled)
 // GB_Adot4B:  C+=A'*B: dense dot product
 //------------------------------------------------------------------------------
 
+m4_divert(if_semiring_has_avx_saxpy4_dot4)
+#if !GB_DISABLE
+#include "mxm/template/GB_AxB_dot4_avx.c"
+#endif
+
+m4_divert(if_dot4_enabled)
 GrB_Info GB (_Adot4B)
 (
     GrB_Matrix C,
@@ -161,6 +168,24 @@ GrB_Info GB (_Adot4B)
     #if GB_DISABLE
     return (GrB_NO_VALUE) ;
     #else
+m4_divert(if_semiring_has_avx_saxpy4_dot4)
+    #if GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global_cpu_features_avx512f ( ))
+    { 
+        // x86_64 with AVX512f
+        return (GB_AxB_dot4_avx512f (C, C_in_iso, A, B, A_slice, B_slice,
+            naslice, nbslice, nthreads, Werk)) ;
+    }
+    #endif
+    #if GB_COMPILER_SUPPORTS_AVX2
+    if (GB_Global_cpu_features_avx2 ( ))
+    { 
+        // x86_64 with AVX2
+        return (GB_AxB_dot4_avx2 (C, C_in_iso, A, B, A_slice, B_slice,
+            naslice, nbslice, nthreads, Werk)) ;
+    }
+    #endif
+m4_divert(if_dot4_enabled)
     #include "mxm/template/GB_AxB_dot4_meta.c"
     return (GrB_SUCCESS) ;
     #endif
@@ -210,6 +235,12 @@ m4_divert(if_saxpy4_enabled)
 // GB_Asaxpy4B: C += A*B when C is full
 //------------------------------------------------------------------------------
 
+m4_divert(if_semiring_has_avx_saxpy4_dot4)
+#if !GB_DISABLE
+#include "mxm/template/GB_AxB_saxpy4_avx.c"
+#endif
+
+m4_divert(if_saxpy4_enabled)
 GrB_Info GB (_Asaxpy4B)
 (
     GrB_Matrix C,
@@ -229,6 +260,28 @@ GrB_Info GB (_Asaxpy4B)
     #if GB_DISABLE
     return (GrB_NO_VALUE) ;
     #else
+m4_divert(if_semiring_has_avx_saxpy4_dot4)
+    #if GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global_cpu_features_avx512f ( ))
+    { 
+        // x86_64 with AVX512f
+        GB_AxB_saxpy4_avx512f (C, A, B, ntasks, nthreads,
+            nfine_tasks_per_vector, use_coarse_tasks, use_atomics,
+            A_slice, H_slice, Wcx, Wf) ;
+        return (GrB_SUCCESS) ;
+    }
+    #endif
+    #if GB_COMPILER_SUPPORTS_AVX2
+    if (GB_Global_cpu_features_avx2 ( ))
+    { 
+        // x86_64 with AVX2
+        GB_AxB_saxpy4_avx2 (C, A, B, ntasks, nthreads,
+            nfine_tasks_per_vector, use_coarse_tasks, use_atomics,
+            A_slice, H_slice, Wcx, Wf) ;
+        return (GrB_SUCCESS) ;
+    }
+    #endif
+m4_divert(if_saxpy4_enabled)
     #include "mxm/template/GB_AxB_saxpy4_meta.c"
     return (GrB_SUCCESS) ;
     #endif
@@ -58,6 +58,8 @@ ztype_is_fp = isequal (ztype, 'float') || isequal (ztype, 'double') ;
 is_any_complex = is_any && ~ztype_is_real ;
 is_plus_pair_real = is_plus && is_pair && (is_integer || ztype_is_fp) ;
 is_plus_times_fp = is_plus && isequal (multop, 'times') && ztype_is_fp ;
+is_plus_times_or_min_plus = (is_plus && isequal (multop, 'times')) || ...
+    (is_min && isequal (multop, 'plus')) ;
 
 t_is_simple = is_pair || codegen_contains (multop, 'first') || codegen_contains (multop, 'second') ;
 t_is_nonnan = isequal (multop (1:2), 'is') || (multop (1) == 'l') ;
@@ -306,6 +308,15 @@ else
     fprintf (f, 'm4_define(`GB_semiring_has_avx'', `'')\n') ;
 end
 
+if (is_plus_times_or_min_plus && (ztype_is_fp || isequal (ztype, 'int64_t')))
+    % compile saxpy4 and dot4 for AVX512F and AVX2, with run-time dispatch
+    fprintf (f, 'm4_define(`if_semiring_has_avx_saxpy4_dot4'', `0'')\n') ;
+    fprintf (f, 'm4_define(`GB_semiring_has_avx_saxpy4_dot4'', `#define GB_SEMIRING_HAS_AVX_SAXPY4_DOT4 1'')\n') ;
+else
+    fprintf (f, 'm4_define(`if_semiring_has_avx_saxpy4_dot4'', `-1'')\n') ;
+    fprintf (f, 'm4_define(`GB_semiring_has_avx_saxpy4_dot4'', `'')\n') ;
+end
+
 one = '' ;
 if (is_pair)
     fprintf (f, 'm4_define(`GB_is_pair_multiplier'', `%s'')\n', ...
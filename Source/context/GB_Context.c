@@ -247,3 +247,148 @@ void GB_Context_gpu_id_set
     }
 }
 
+
+//------------------------------------------------------------------------------
+// Context->werk_arena: werkspace for the user thread, beyond the Werk stack
+//------------------------------------------------------------------------------
+
+// The Werk->Stack is a small fixed-size array on the C stack of each
+// user-callable GraphBLAS function.  Werkspace that does not fit there is
+// allocated by malloc.  If the user thread has engaged a Context with a
+// nonzero werk_max_size, that werkspace is instead taken from the werk_arena
+// of the Context, and released in LIFO order, just like the Werk->Stack.
+// The arena is not freed when the user-callable function returns, so the next
+// call to GraphBLAS from the same user thread gets its werkspace at almost no
+// cost.
+
+// The arena cannot be reallocated while any werkspace is taken from it.  If
+// a request does not fit, it is allocated by malloc instead, and the size the
+// arena would have needed is recorded in werk_need.  The arena is grown to
+// that size (up to werk_max_size) the next time it is empty, which is the
+// first GB_werk_push of the next call to GraphBLAS.  Requests that could
+// never fit in werk_max_size are ignored.
+
+// GxB_CONTEXT_WORLD is shared by all user threads, so it has no arena.  A
+// Context with an arena may be engaged by only one user thread at a time.
+
+//  GB_Context_werk_max_size_get: get the max size of the arena of a Context
+int64_t GB_Context_werk_max_size_get (GxB_Context Context)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        return (0) ;
+    }
+    else
+    { 
+        return ((int64_t) Context->werk_max_size) ;
+    }
+}
+
+//  GB_Context_werk_size_get: get the allocated size of the arena of a Context
+int64_t GB_Context_werk_size_get (GxB_Context Context)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        return (0) ;
+    }
+    else
+    { 
+        return ((int64_t) Context->werk_size) ;
+    }
+}
+
+//  GB_Context_werk_max_size_set: set the max size of the arena of a Context
+GrB_Info GB_Context_werk_max_size_set
+(
+    GxB_Context Context,
+    int64_t werk_max_size
+)
+{
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        // GxB_CONTEXT_WORLD has no arena
+        return (GrB_INVALID_VALUE) ;
+    }
+    ASSERT (Context->werk_top == 0) ;
+    Context->werk_max_size = (size_t) GB_IMAX (werk_max_size, 0) ;
+    Context->werk_need = GB_IMIN (Context->werk_need, Context->werk_max_size) ;
+    if (Context->werk_size > Context->werk_max_size)
+    { 
+        // the arena is too large; it is reallocated when next needed
+        GB_Context_werk_free (Context) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//  GB_Context_werk_free: free the arena of a Context
+void GB_Context_werk_free (GxB_Context Context)
+{
+    if (Context != NULL && Context != GxB_CONTEXT_WORLD)
+    { 
+        ASSERT (Context->werk_top == 0) ;
+        GB_FREE (&(Context->werk_arena), Context->werk_size) ;
+        Context->werk_size = 0 ;
+        Context->werk_top = 0 ;
+    }
+}
+
+//  GB_Context_werk_push: get werkspace from the arena of this user thread
+void *GB_Context_werk_push      // return werkspace, or NULL if none
+(
+    size_t size                 // size to allocate; a multiple of 8
+)
+{
+
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    if (Context == NULL || Context->werk_max_size == 0)
+    { 
+        // no Context engaged, or the Context has no arena
+        return (NULL) ;
+    }
+    ASSERT (size % 8 == 0) ;
+
+    size_t top = Context->werk_top ;
+    if (top == 0 && Context->werk_need > Context->werk_size)
+    {
+        // the arena is empty and too small; grow it to the size needed
+        GB_Context_werk_free (Context) ;
+        Context->werk_arena = GB_MALLOC (Context->werk_need, GB_void,
+            &(Context->werk_size)) ;
+        if (Context->werk_arena == NULL)
+        { 
+            // out of memory; try again the next time the arena is empty
+            Context->werk_size = 0 ;
+        }
+    }
+
+    if (size <= Context->werk_size - top)
+    { 
+        // take the werkspace from the top of the arena
+        Context->werk_top = top + size ;
+        return ((void *) (Context->werk_arena + top)) ;
+    }
+    else
+    {
+        if (top + size <= Context->werk_max_size)
+        { 
+            // record the size the arena should have had, for the next call
+            Context->werk_need = GB_IMAX (Context->werk_need, top + size) ;
+        }
+        return (NULL) ;
+    }
+}
+
+//  GB_Context_werk_pop: return werkspace to the arena of this user thread
+void GB_Context_werk_pop
+(
+    void *p,                    // werkspace to free, at the top of the arena
+    size_t size                 // size of the werkspace
+)
+{ 
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    ASSERT (Context != NULL && Context->werk_arena != NULL) ;
+    // werkspace is freed in LIFO order
+    ASSERT (((GB_void *) p) + size ==
+        Context->werk_arena + Context->werk_top) ;
+    Context->werk_top = ((GB_void *) p) - Context->werk_arena ;
+}
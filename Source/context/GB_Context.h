@@ -25,4 +25,12 @@ int    GB_Context_gpu_id (void) ;
 int    GB_Context_gpu_id_get (GxB_Context Context) ;
 void   GB_Context_gpu_id_set (GxB_Context Context, int gpu_id) ;
 
+int64_t GB_Context_werk_max_size_get (GxB_Context Context) ;
+int64_t GB_Context_werk_size_get (GxB_Context Context) ;
+GrB_Info GB_Context_werk_max_size_set (GxB_Context Context,
+    int64_t werk_max_size) ;
+void   GB_Context_werk_free (GxB_Context Context) ;
+void  *GB_Context_werk_push (size_t size) ;
+void   GB_Context_werk_pop (void *p, size_t size) ;
+
 #endif
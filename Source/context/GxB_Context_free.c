@@ -38,6 +38,8 @@ GrB_Info GxB_Context_free           // free a Context
             GB_FREE (&(Context->user_name), Context->user_name_size) ;
             if (header_size > 0)
             { 
+                // free the Werk arena
+                GB_Context_werk_free (Context) ;
                 Context->magic = GB_FREED ;  // to help detect dangling pointers
                 Context->header_size = 0 ;
                 GB_FREE (Context_handle, header_size) ;
@@ -49,6 +49,13 @@ GrB_Info GxB_Context_new            // create a new Context
     Context->chunk = GB_Context_chunk_get (NULL) ;
     Context->gpu_id = GB_Context_gpu_id_get (NULL) ;
 
+    // the Werk arena is disabled until GxB_CONTEXT_WERK_MAX_SIZE is set
+    Context->werk_arena = NULL ;
+    Context->werk_size = 0 ;
+    Context->werk_top = 0 ;
+    Context->werk_need = 0 ;
+    Context->werk_max_size = 0 ;
+
     // return the result
     (*Context_handle) = Context ;
     return (GrB_SUCCESS) ;
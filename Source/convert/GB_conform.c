@@ -127,6 +127,7 @@ GrB_Info GB_conform     // conform a matrix to its desired sparsity structure
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
+    GB_WAIT_BACKGROUND (A) ;    // A is about to be modified
     ASSERT_MATRIX_OK (A, "A to conform", GB0) ;
     ASSERT (GB_ZOMBIES_OK (A)) ;
     ASSERT (GB_JUMBLED_OK (A)) ;
@@ -25,6 +25,7 @@ GrB_Info GB_convert_any_to_bitmap   // convert to bitmap
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
+    GB_WAIT_BACKGROUND (A) ;    // A is about to be modified
     ASSERT_MATRIX_OK (A, "A being converted to bitmap", GB0) ;
     ASSERT (GB_ZOMBIES_OK (A)) ;    // A can have zombies
     ASSERT (GB_JUMBLED_OK (A)) ;    // A can be jumbled
@@ -22,6 +22,7 @@ GrB_Info GB_convert_any_to_hyper // convert to hypersparse
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
+    GB_WAIT_BACKGROUND (A) ;    // A is about to be modified
     ASSERT_MATRIX_OK (A, "A being converted to hyper", GB0) ;
     ASSERT (GB_ZOMBIES_OK (A)) ;
     ASSERT (GB_JUMBLED_OK (A)) ;
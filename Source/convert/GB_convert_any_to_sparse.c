@@ -22,6 +22,7 @@ GrB_Info GB_convert_any_to_sparse // convert to sparse
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
+    GB_WAIT_BACKGROUND (A) ;    // A is about to be modified
     ASSERT_MATRIX_OK (A, "A being converted to sparse", GB0) ;
     ASSERT (GB_ZOMBIES_OK (A)) ;
     ASSERT (GB_JUMBLED_OK (A)) ;
@@ -53,6 +53,7 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
     GrB_Info info ;
     ASSERT (C != NULL) ;
     GB_RETURN_IF_NULL (scalar) ;
+    GB_WAIT_BACKGROUND (C) ;    // C is about to be modified
 
     if (row >= GB_NROWS (C))
     { 
@@ -102,6 +103,12 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
     { 
         GB_OK (GB_wait (C, "C (setElement:jumbled)", Werk)) ;
     }
+    else if (C->shards_anchored)
+    { 
+        // tuples from concurrent setElement must be assembled first, so that
+        // they are not overwritten out of order by this entry
+        GB_OK (GB_wait (C, "C (setElement:shards)", Werk)) ;
+    }
 
     // zombies and pending tuples are still OK, but C is no longer jumbled
     ASSERT (!GB_JUMBLED (C)) ;
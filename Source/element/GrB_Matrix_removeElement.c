@@ -149,13 +149,23 @@ GrB_Info GB_Matrix_removeElement
 )
 {
 
+    //--------------------------------------------------------------------------
+    // finish any background wait of C, since C is about to be modified
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_WAIT_BACKGROUND (C) ;
+
     //--------------------------------------------------------------------------
     // if C is jumbled, wait on the matrix first.  If full, convert to nonfull
     //--------------------------------------------------------------------------
 
-    if (C->jumbled || GB_IS_FULL (C))
+    // Tuples from concurrent setElement are held in the shards of C, and they
+    // may include C(i,j) even if C(i,j) is already an entry in C.  They must
+    // be assembled first, as if C were jumbled.
+
+    if (C->jumbled || C->shards_anchored || GB_IS_FULL (C))
     {
-        GrB_Info info ;
         if (GB_IS_FULL (C))
         { 
             // convert C from full to sparse
@@ -163,7 +173,7 @@ GrB_Info GB_Matrix_removeElement
         }
         else
         { 
-            // C is sparse or hypersparse, and jumbled
+            // C is sparse or hypersparse, and jumbled or with shards
             GB_OK (GB_wait (C, "C (removeElement:jumbled)", Werk)) ;
         }
         ASSERT (!GB_IS_FULL (C)) ;
@@ -232,7 +242,6 @@ GrB_Info GB_Matrix_removeElement
     // assemble any pending tuples; zombies are OK
     if (C_is_pending)
     { 
-        GrB_Info info ;
         GB_OK (GB_wait (C, "C (removeElement:pending tuples)", Werk)) ;
         ASSERT (!GB_ZOMBIES (C)) ;
         ASSERT (!GB_JUMBLED (C)) ;
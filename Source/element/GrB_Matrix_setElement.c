@@ -11,7 +11,7 @@
 // typecasting from the type of x to the type of C, as needed.
 
 #define GB_FREE_ALL ;
-#include "GB.h"
+#include "pending/GB_Pending.h"
 
 #define GB_SET(prefix,type,T,ampersand)                                     \
 GrB_Info GB_EVAL3 (prefix, _Matrix_setElement_, T) /* C (row,col) = x */    \
@@ -22,6 +22,12 @@ GrB_Info GB_EVAL3 (prefix, _Matrix_setElement_, T) /* C (row,col) = x */    \
     GrB_Index col                       /* column index                   */\
 )                                                                           \
 {                                                                           \
+    if (C != NULL && C->nshards > 0)                                        \
+    {                                                                       \
+        /* concurrent setElement: append to the shard of this thread */     \
+        return (GB_Pending_shards_add (C, ampersand x, row, col,            \
+            GB_ ## T ## _code)) ;                                           \
+    }                                                                       \
     GB_WHERE (C, GB_STR(prefix) "_Matrix_setElement_" GB_STR(T)             \
         " (C, row, col, x)") ;                                              \
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;                                       \
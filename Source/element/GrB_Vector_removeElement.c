@@ -110,13 +110,23 @@ GrB_Info GB_Vector_removeElement
 )
 {
 
+    //--------------------------------------------------------------------------
+    // finish any background wait of V, since V is about to be modified
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_WAIT_BACKGROUND (V) ;
+
     //--------------------------------------------------------------------------
     // if V is jumbled, wait on the vector first.  If full, convert to nonfull
     //--------------------------------------------------------------------------
 
-    if (V->jumbled || GB_IS_FULL (V))
+    // Tuples from concurrent setElement are held in the shards of V, and they
+    // may include V(i) even if V(i) is already an entry in V.  They must be
+    // assembled first, as if V were jumbled.
+
+    if (V->jumbled || V->shards_anchored || GB_IS_FULL (V))
     {
-        GrB_Info info ;
         if (GB_IS_FULL (V))
         { 
             // convert V from full to sparse
@@ -124,7 +134,7 @@ GrB_Info GB_Vector_removeElement
         }
         else
         { 
-            // V is sparse and jumbled
+            // V is sparse, and jumbled or with shards
             GB_OK (GB_wait ((GrB_Matrix) V, "v (removeElement:jumbled",
                 Werk)) ;
         }
@@ -170,7 +180,6 @@ GrB_Info GB_Vector_removeElement
     // assemble any pending tuples; zombies are OK
     if (V_is_pending)
     { 
-        GrB_Info info ;
         GB_OK (GB_wait ((GrB_Matrix) V, "v (removeElement:pending tuples)",
             Werk)) ;
         ASSERT (!GB_ZOMBIES (V)) ;
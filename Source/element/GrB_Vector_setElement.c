@@ -11,7 +11,7 @@
 // the type of w as needed.
 
 #define GB_FREE_ALL ;
-#include "GB.h"
+#include "pending/GB_Pending.h"
 
 #define GB_SET(prefix,type,T,ampersand)                                     \
 GrB_Info GB_EVAL3 (prefix, _Vector_setElement_, T)    /* w(row) = x */      \
@@ -21,6 +21,12 @@ GrB_Info GB_EVAL3 (prefix, _Vector_setElement_, T)    /* w(row) = x */      \
     GrB_Index row                       /* row index                  */    \
 )                                                                           \
 {                                                                           \
+    if (w != NULL && w->nshards > 0)                                        \
+    {                                                                       \
+        /* concurrent setElement: append to the shard of this thread */     \
+        return (GB_Pending_shards_add ((GrB_Matrix) w, ampersand x, row, 0, \
+            GB_ ## T ## _code)) ;                                           \
+    }                                                                       \
     GB_WHERE (w, "GrB_Vector_setElement_" GB_STR(T) " (w, x, row)") ;       \
     GB_RETURN_IF_NULL_OR_FAULTY (w) ;                                       \
     ASSERT (GB_VECTOR_OK (w)) ;                                             \
@@ -458,6 +458,7 @@ GrB_Info GB_add_phase2      // C=A+B, C<M>=A+B, or C<!M>=A+B
     {
 
         #include "generic/GB_generic.h"
+        GB_JIT_GENERIC (GB_jit_ewise_family) ;
         GB_BURBLE_MATRIX (C, "(generic add: %s) ", op->name) ;
 
         // C(i,j) = (ctype) A(i,j), located in Ax [pA]
@@ -312,6 +312,7 @@ GrB_Info GB_emult_02        // C=A.*B when A is sparse/hyper, B bitmap/full
 
     if (info == GrB_NO_VALUE)
     { 
+        GB_JIT_GENERIC (GB_jit_ewise_family) ;
         GB_BURBLE_MATRIX (C, "(generic emult_02: %s) ", op->name) ;
         info = GB_emult_generic (C, op, NULL, 0, 0,
             NULL, NULL, NULL, C_sparsity, GB_EMULT_METHOD2, Cp_kfirst,
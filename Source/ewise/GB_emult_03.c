@@ -313,6 +313,7 @@ GrB_Info GB_emult_03        // C=A.*B when A bitmap/full, B is sparse/hyper
 
     if (info == GrB_NO_VALUE)
     { 
+        GB_JIT_GENERIC (GB_jit_ewise_family) ;
         GB_BURBLE_MATRIX (C, "(generic emult_03: %s) ", op->name) ;
         info = GB_emult_generic (C, op, NULL, 0, 0,
             NULL, NULL, NULL, C_sparsity, GB_EMULT_METHOD3, Cp_kfirst,
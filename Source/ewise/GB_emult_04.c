@@ -347,6 +347,7 @@ GrB_Info GB_emult_04        // C<M>=A.*B, M sparse/hyper, A and B bitmap/full
 
     if (info == GrB_NO_VALUE)
     { 
+        GB_JIT_GENERIC (GB_jit_ewise_family) ;
         GB_BURBLE_MATRIX (C, "(generic emult_04: %s) ", op->name) ;
         info = GB_emult_generic (C, op, NULL, 0, 0,
             NULL, NULL, NULL, C_sparsity, GB_EMULT_METHOD4, Cp_kfirst,
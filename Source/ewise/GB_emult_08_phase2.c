@@ -263,6 +263,7 @@ GrB_Info GB_emult_08_phase2             // C=A.*B or C<M>=A.*B
 
     if (info == GrB_NO_VALUE)
     { 
+        GB_JIT_GENERIC (GB_jit_ewise_family) ;
         GB_BURBLE_MATRIX (C, "(generic emult: %s) ", op->name) ;
         info = GB_emult_generic (C, op, TaskList, C_ntasks, C_nthreads,
             C_to_M, C_to_A, C_to_B, C_sparsity, ewise_method, NULL,
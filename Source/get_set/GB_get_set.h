@@ -88,6 +88,15 @@ GrB_Info GB_user_name_set
                                     // only be set once
 ) ;
 
+void GB_jit_control_set
+(
+    // output:
+    GxB_JIT_Control *jit_control,   // JIT control of the object
+    bool *jit_control_set,          // true if jit_control is in use
+    // input:
+    int32_t value                   // new JIT control
+) ;
+
 
 #endif
 
@@ -0,0 +1,40 @@
+//------------------------------------------------------------------------------
+// GB_jit_control_set: set the JIT control of a type, operator, or semiring
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The JIT control of a user-defined type, binary operator, or semiring limits
+// the global JIT control (GxB_JIT_C_CONTROL) for all JIT kernels that use the
+// object.  GxB_JIT_DEFAULT (or any negative value) clears the setting, so that
+// the kernels revert to the global JIT control.
+
+#include "get_set/GB_get_set.h"
+
+void GB_jit_control_set
+(
+    // output:
+    GxB_JIT_Control *jit_control,   // JIT control of the object
+    bool *jit_control_set,          // true if jit_control is in use
+    // input:
+    int32_t value                   // new JIT control
+)
+{ 
+
+    if (value < (int32_t) GxB_JIT_OFF)
+    { 
+        // use the global JIT control for this object
+        (*jit_control) = GxB_JIT_DEFAULT ;
+        (*jit_control_set) = false ;
+    }
+    else
+    { 
+        // limit the global JIT control for this object
+        value = GB_IMIN (value, (int32_t) GxB_JIT_ASYNC) ;
+        (*jit_control) = (GxB_JIT_Control) value ;
+        (*jit_control_set) = true ;
+    }
+}
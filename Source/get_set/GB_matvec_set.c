@@ -9,6 +9,7 @@
 
 #include "get_set/GB_get_set.h"
 #include "transpose/GB_transpose.h"
+#include "pending/GB_Pending.h"
 #define GB_FREE_ALL ;
 
 GrB_Info GB_matvec_set
@@ -24,6 +25,7 @@ GrB_Info GB_matvec_set
 
     GrB_Info info ;
     GB_BURBLE_START ("GrB_set") ;
+    GB_WAIT_BACKGROUND (A) ;    // A may be modified or moved below
 
     int format = ivalue ;
 
@@ -49,6 +51,25 @@ GrB_Info GB_matvec_set
             A->bitmap_switch = (float) dvalue ;
             break ;
 
+        case GxB_HUGE_PAGES : 
+
+            if (ivalue != 0)
+            { 
+                // place the large arrays of A on huge pages, touched in
+                // parallel; no need to conform A afterwards
+                GB_OK (GB_memory_place_matrix (A)) ;
+            }
+            GB_BURBLE_END ;
+            return (GrB_SUCCESS) ;
+
+        case GxB_PENDING_SHARDS : 
+
+            // finish A and set the # of shards for concurrent setElement;
+            // no need to conform A afterwards
+            GB_OK (GB_Pending_shards_set (A, ivalue, Werk)) ;
+            GB_BURBLE_END ;
+            return (GrB_SUCCESS) ;
+
         case GxB_SPARSITY_CONTROL : 
 
             A->sparsity_control = GB_sparsity_control (ivalue, (int64_t) (-1)) ;
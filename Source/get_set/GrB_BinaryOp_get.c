@@ -68,6 +68,28 @@ GrB_Info GrB_BinaryOp_get_String
     // get the field
     //--------------------------------------------------------------------------
 
+    if (field == GxB_JIT_C_COMPILER_FLAGS)
+    { 
+        (*value) = '\0' ;
+        if (op->jit_C_flags != NULL)
+        { 
+            strcpy (value, op->jit_C_flags) ;
+        }
+        #pragma omp flush
+        return (GrB_SUCCESS) ;
+    }
+
+    if (field == GxB_JIT_C_OBJECT)
+    { 
+        (*value) = '\0' ;
+        if (op->jit_C_object != NULL)
+        { 
+            strcpy (value, op->jit_C_object) ;
+        }
+        #pragma omp flush
+        return (GrB_SUCCESS) ;
+    }
+
     return (GB_op_string_get ((GB_Operator) op, value, field)) ;
 }
 
@@ -99,6 +121,14 @@ GrB_Info GrB_BinaryOp_get_INT32
     // get the field
     //--------------------------------------------------------------------------
 
+    if (field == GxB_JIT_C_CONTROL)
+    { 
+        (*value) = (int32_t) (op->jit_control_set ? op->jit_control :
+            GxB_JIT_DEFAULT) ;
+        #pragma omp flush
+        return (GrB_SUCCESS) ;
+    }
+
     return (GB_op_enum_get ((GB_Operator) op, value, field)) ;
 }
 
@@ -130,6 +160,22 @@ GrB_Info GrB_BinaryOp_get_SIZE
     // get the field
     //--------------------------------------------------------------------------
 
+    if (field == GxB_JIT_C_COMPILER_FLAGS)
+    { 
+        (*value) = (op->jit_C_flags == NULL) ? 1 :
+            (strlen (op->jit_C_flags) + 1) ;
+        #pragma omp flush
+        return (GrB_SUCCESS) ;
+    }
+
+    if (field == GxB_JIT_C_OBJECT)
+    { 
+        (*value) = (op->jit_C_object == NULL) ? 1 :
+            (strlen (op->jit_C_object) + 1) ;
+        #pragma omp flush
+        return (GrB_SUCCESS) ;
+    }
+
     return (GB_op_size_get ((GB_Operator) op, value, field)) ;
 }
 
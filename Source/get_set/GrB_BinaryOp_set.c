@@ -8,6 +8,8 @@
 //------------------------------------------------------------------------------
 
 #include "get_set/GB_get_set.h"
+#include "jitifyer/GB_jitifyer.h"
+#include "jitifyer/GB_file.h"
 
 //------------------------------------------------------------------------------
 // GrB_BinaryOp_set_Scalar
@@ -47,6 +49,66 @@ GrB_Info GrB_BinaryOp_set_String
     }
     GB_RETURN_IF_NULL (value) ;
 
+    //--------------------------------------------------------------------------
+    // set the JIT C flags of a user-defined operator
+    //--------------------------------------------------------------------------
+
+    if (field == GxB_JIT_C_COMPILER_FLAGS)
+    { 
+        if (op->header_size == 0)
+        { 
+            // built-in operators may not be modified
+            return (GrB_INVALID_VALUE) ;
+        }
+        return (GB_user_name_set (&(op->jit_C_flags), &(op->jit_C_flags_size),
+            value, false)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // set the object file of a user-defined operator
+    //--------------------------------------------------------------------------
+
+    if (field == GxB_JIT_C_OBJECT)
+    { 
+        if (op->opcode != GB_USER_binop_code)
+        { 
+            // only a user-defined operator can have an object file
+            return (GrB_INVALID_VALUE) ;
+        }
+        GrB_Info info = GB_user_name_set (&(op->jit_C_object),
+            &(op->jit_C_object_size), value, false) ;
+        if (info != GrB_SUCCESS) return (info) ;
+        // the path is placed in the compile command, so remove any quotes
+        // and other characters the shell would interpret
+        if (op->jit_C_object != NULL)
+        { 
+            GB_jitifyer_sanitize (op->jit_C_object, op->jit_C_object_size) ;
+        }
+        // the operator can be JIT'd if it has a name, its types can be JIT'd,
+        // and its function is given by a definition or an object file
+        bool jitable = (op->name_len > 0) &&
+            (op->defn != NULL || op->jit_C_object != NULL) &&
+            (op->ztype->hash != UINT64_MAX) &&
+            (op->xtype->hash != UINT64_MAX) &&
+            (op->ytype->hash != UINT64_MAX) ;
+        op->hash = GB_jitifyer_hash (op->name, op->name_len, jitable) ;
+        if (jitable && op->defn == NULL)
+        { 
+            // Fold the path of the object file and its modification time into
+            // the hash, so that a kernel compiled with an older object file is
+            // not used; it is recompiled instead.
+            int64_t size, mtime ;
+            GB_file_stat (op->jit_C_object, &size, &mtime) ;
+            uint64_t hashes [3] ;
+            hashes [0] = op->hash ;
+            hashes [1] = GB_jitifyer_hash (op->jit_C_object,
+                strlen (op->jit_C_object), true) ;
+            hashes [2] = (uint64_t) mtime ;
+            op->hash = GB_jitifyer_hash (hashes, 3 * sizeof (uint64_t), true) ;
+        }
+        return (GrB_SUCCESS) ;
+    }
+
     //--------------------------------------------------------------------------
     // set the field
     //--------------------------------------------------------------------------
@@ -65,7 +127,31 @@ GrB_Info GrB_BinaryOp_set_INT32
     GrB_Field field
 )
 { 
-    return (GrB_INVALID_VALUE) ;
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GrB_BinaryOp_set_INT32 (op, value, field)") ;
+    if (op == GxB_IGNORE_DUP)
+    { 
+        return (GrB_INVALID_VALUE) ;
+    }
+    GB_RETURN_IF_NULL_OR_FAULTY (op) ;
+    ASSERT_BINARYOP_OK (op, "binaryop for set", GB0) ;
+
+    if (op->header_size == 0 || field != GxB_JIT_C_CONTROL)
+    { 
+        // built-in operators may not be modified
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // set the JIT control of a user-defined operator
+    //--------------------------------------------------------------------------
+
+    GB_jit_control_set (&(op->jit_control), &(op->jit_control_set), value) ;
+    return (GrB_SUCCESS) ;
 }
 
 //------------------------------------------------------------------------------
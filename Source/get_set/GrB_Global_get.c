@@ -9,6 +9,7 @@
 
 #include "get_set/GB_get_set.h"
 #include "jitifyer/GB_jitifyer.h"
+#include "mxm/GB_AxB_autotune.h"
 
 //------------------------------------------------------------------------------
 // GrB_Global: an object defining the global state
@@ -127,6 +128,32 @@ static GrB_Info GB_global_enum_get (int32_t *value, int field)
             (*value) = (int) GB_jitifyer_get_use_cmake ( ) ;
             break ;
 
+        case GxB_AUTOTUNE : 
+
+            (*value) = (int) GB_AxB_autotune_get ( ) ;
+            break ;
+
+        case GxB_JIT_PROFILE : 
+
+            (*value) = (int) GB_jitifyer_get_profile ( ) ;
+            break ;
+
+        case GxB_JIT_MAX_LOADED : 
+
+            (*value) = (int) GB_IMIN (GB_jitifyer_get_max_loaded ( ),
+                INT32_MAX) ;
+            break ;
+
+        case GxB_JIT_SPECIALIZE_DIM : 
+
+            (*value) = (int) GB_jitifyer_get_specialize_dim ( ) ;
+            break ;
+
+        case GxB_JIT_USE_LIBTCC : 
+
+            (*value) = (int) GB_jitifyer_get_use_libtcc ( ) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -201,6 +228,34 @@ GrB_Info GrB_Global_get_Scalar
                         GB_INT64_code, Werk) ;
                     break ;
 
+                case GxB_JIT_CACHE_MAX_SIZE : 
+
+                    i64 = GB_jitifyer_get_cache_max_size ( ) ;
+                    info = GB_setElement ((GrB_Matrix) value, NULL, &i64, 0, 0,
+                        GB_INT64_code, Werk) ;
+                    break ;
+
+                case GxB_MEMORY_POOL_MAX_SIZE : 
+
+                    i64 = GB_memory_pool_get_max_size ( ) ;
+                    info = GB_setElement ((GrB_Matrix) value, NULL, &i64, 0, 0,
+                        GB_INT64_code, Werk) ;
+                    break ;
+
+                case GxB_MEMORY_POOL_SIZE : 
+
+                    i64 = GB_memory_pool_size ( ) ;
+                    info = GB_setElement ((GrB_Matrix) value, NULL, &i64, 0, 0,
+                        GB_INT64_code, Werk) ;
+                    break ;
+
+                case GxB_HUGE_PAGES : 
+
+                    i64 = GB_Global_huge_pages_get ( ) ;
+                    info = GB_setElement ((GrB_Matrix) value, NULL, &i64, 0, 0,
+                        GB_INT64_code, Werk) ;
+                    break ;
+
                 default : 
 
                     info = GrB_INVALID_VALUE ;
@@ -321,6 +376,16 @@ static GrB_Info GB_global_string_get (const char **value, int field)
             (*value) = GB_jitifyer_get_error_log ( ) ;
             break ;
 
+        case GxB_JIT_MANIFEST : 
+
+            (*value) = GB_jitifyer_get_manifest ( ) ;
+            break ;
+
+        case GxB_JIT_PROFILE_REPORT : 
+
+            (*value) = GB_jitifyer_get_profile_report (false) ;
+            break ;
+
         case GxB_JIT_CACHE_PATH : 
 
             (*value) = GB_jitifyer_get_cache_path ( ) ;
@@ -439,6 +504,12 @@ GrB_Info GrB_Global_get_SIZE
 
     #pragma omp critical (GB_global_get_set)
     {
+        if (field == GxB_JIT_PROFILE_REPORT)
+        { 
+            // rebuild the report, so that a subsequent GrB_get of the
+            // string returns the report of this size
+            GB_jitifyer_get_profile_report (true) ;
+        }
         info = GB_global_string_get (&s, field) ;
         if (info == GrB_SUCCESS)
         { 
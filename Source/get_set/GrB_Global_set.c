@@ -9,6 +9,7 @@
 
 #include "get_set/GB_get_set.h"
 #include "jitifyer/GB_jitifyer.h"
+#include "mxm/GB_AxB_autotune.h"
 
 //------------------------------------------------------------------------------
 // GB_global_enum_set: get an enum value from the global state
@@ -71,6 +72,30 @@ static GrB_Info GB_global_enum_set (int32_t value, int field)
             GB_jitifyer_set_control (value) ;
             break ;
 
+        case GxB_AUTOTUNE : 
+
+            GB_AxB_autotune_set ((bool) value) ;
+            break ;
+
+        case GxB_JIT_PROFILE : 
+
+            GB_jitifyer_set_profile ((bool) value) ;
+            break ;
+
+        case GxB_JIT_MAX_LOADED : 
+
+            GB_jitifyer_set_max_loaded (value) ;
+            break ;
+
+        case GxB_JIT_SPECIALIZE_DIM : 
+
+            GB_jitifyer_set_specialize_dim (value) ;
+            break ;
+
+        case GxB_JIT_USE_LIBTCC : 
+
+            return (GB_jitifyer_set_use_libtcc ((bool) value)) ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -140,6 +165,33 @@ GrB_Info GrB_Global_set_Scalar
                 }
                 break ;
 
+            case GxB_JIT_CACHE_MAX_SIZE : 
+
+                info = GrB_Scalar_extractElement_INT64 (&i64value, value) ;
+                if (info == GrB_SUCCESS)
+                {
+                    GB_jitifyer_set_cache_max_size (i64value) ;
+                }
+                break ;
+
+            case GxB_MEMORY_POOL_MAX_SIZE : 
+
+                info = GrB_Scalar_extractElement_INT64 (&i64value, value) ;
+                if (info == GrB_SUCCESS)
+                {
+                    GB_memory_pool_set_max_size (i64value) ;
+                }
+                break ;
+
+            case GxB_HUGE_PAGES : 
+
+                info = GrB_Scalar_extractElement_INT64 (&i64value, value) ;
+                if (info == GrB_SUCCESS)
+                {
+                    GB_Global_huge_pages_set (i64value) ;
+                }
+                break ;
+
             default : 
 
                 info = GrB_Scalar_extractElement_INT32 (&ivalue, value) ;
@@ -225,6 +277,11 @@ GrB_Info GrB_Global_set_String
                 info = GB_jitifyer_set_error_log (value) ;
                 break ;
 
+            case GxB_JIT_MANIFEST : 
+
+                info = GB_jitifyer_set_manifest (value) ;
+                break ;
+
             case GxB_JIT_CACHE_PATH : 
 
                 info = GB_jitifyer_set_cache_path (value) ;
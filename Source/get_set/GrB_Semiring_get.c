@@ -92,6 +92,15 @@ GrB_Info GrB_Semiring_get_String
             return (GB_op_string_get ((GB_Operator) (semiring->multiply),
                 value, field)) ;
 
+        case GxB_JIT_C_COMPILER_FLAGS : 
+
+            if (semiring->jit_C_flags != NULL)
+            { 
+                strcpy (value, semiring->jit_C_flags) ;
+            }
+            #pragma omp flush
+            return (GrB_SUCCESS) ;
+
         default : ;
             return (GrB_INVALID_VALUE) ;
     }
@@ -122,6 +131,14 @@ GrB_Info GrB_Semiring_get_INT32
     // get the field
     //--------------------------------------------------------------------------
 
+    if (field == GxB_JIT_C_CONTROL)
+    { 
+        (*value) = (int32_t) (semiring->jit_control_set ?
+            semiring->jit_control : GxB_JIT_DEFAULT) ;
+        #pragma omp flush
+        return (GrB_SUCCESS) ;
+    }
+
     return (GB_op_enum_get ((GB_Operator) (semiring->multiply), value, field)) ;
 }
 
@@ -173,6 +190,10 @@ GrB_Info GrB_Semiring_get_SIZE
             name = GB_type_name_get (semiring->multiply->ztype) ;
             break ;
 
+        case GxB_JIT_C_COMPILER_FLAGS : 
+            name = semiring->jit_C_flags ;
+            break ;
+
         case GxB_MONOID_OPERATOR : 
         case GxB_SEMIRING_MULTIPLY : 
             (*value) = sizeof (GrB_BinaryOp) ;
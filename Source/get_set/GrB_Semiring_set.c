@@ -44,7 +44,8 @@ GrB_Info GrB_Semiring_set_String
     GB_RETURN_IF_NULL (value) ;
     ASSERT_SEMIRING_OK (semiring, "semiring to get option", GB0) ;
 
-    if (semiring->header_size == 0 || field != GrB_NAME)
+    if (semiring->header_size == 0 ||
+        (field != GrB_NAME && field != GxB_JIT_C_COMPILER_FLAGS))
     { 
         // built-in semirings may not be modified
         return (GrB_INVALID_VALUE) ;
@@ -54,6 +55,13 @@ GrB_Info GrB_Semiring_set_String
     // set the field
     //--------------------------------------------------------------------------
 
+    if (field == GxB_JIT_C_COMPILER_FLAGS)
+    { 
+        // the JIT C flags can be changed at any time
+        return (GB_user_name_set (&(semiring->jit_C_flags),
+            &(semiring->jit_C_flags_size), value, false)) ;
+    }
+
     return (GB_user_name_set (&(semiring->user_name),
         &(semiring->user_name_size), value, true)) ;
 }
@@ -69,7 +77,28 @@ GrB_Info GrB_Semiring_set_INT32
     GrB_Field field
 )
 { 
-    return (GrB_INVALID_VALUE) ;
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GrB_Semiring_set_INT32 (semiring, value, field)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring to set option", GB0) ;
+
+    if (semiring->header_size == 0 || field != GxB_JIT_C_CONTROL)
+    { 
+        // built-in semirings may not be modified
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // set the JIT control of a user-defined semiring
+    //--------------------------------------------------------------------------
+
+    GB_jit_control_set (&(semiring->jit_control), &(semiring->jit_control_set),
+        value) ;
+    return (GrB_SUCCESS) ;
 }
 
 //------------------------------------------------------------------------------
@@ -110,6 +110,14 @@ GrB_Info GrB_Type_get_String
             }
             break ;
 
+        case GxB_JIT_C_COMPILER_FLAGS : 
+
+            if (type->jit_C_flags != NULL)
+            { 
+                strcpy (value, type->jit_C_flags) ;
+            }
+            break ;
+
         default : 
             return (GrB_INVALID_VALUE) ;
     }
@@ -151,6 +159,12 @@ GrB_Info GrB_Type_get_INT32
             (*value) = (int32_t) GB_type_code_get (type->code) ;
             break ;
 
+        case GxB_JIT_C_CONTROL : 
+
+            (*value) = (int32_t) (type->jit_control_set ?
+                type->jit_control : GxB_JIT_DEFAULT) ;
+            break ;
+
         default : 
             return (GrB_INVALID_VALUE) ;
     }
@@ -210,6 +224,11 @@ GrB_Info GrB_Type_get_SIZE
             s = type->defn ;
             break ;
 
+        case GxB_JIT_C_COMPILER_FLAGS : 
+
+            s = type->jit_C_flags ;
+            break ;
+
         default : 
             return (GrB_INVALID_VALUE) ;
     }
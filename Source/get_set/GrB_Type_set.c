@@ -44,6 +44,21 @@ GrB_Info GrB_Type_set_String
     GB_RETURN_IF_NULL (value) ;
     ASSERT_TYPE_OK (type, "unaryop for get", GB0) ;
 
+    //--------------------------------------------------------------------------
+    // set the JIT C flags of a user-defined type
+    //--------------------------------------------------------------------------
+
+    if (field == GxB_JIT_C_COMPILER_FLAGS)
+    { 
+        if (type->header_size == 0)
+        { 
+            // built-in types may not be modified
+            return (GrB_INVALID_VALUE) ;
+        }
+        return (GB_user_name_set (&(type->jit_C_flags),
+            &(type->jit_C_flags_size), value, false)) ;
+    }
+
     //--------------------------------------------------------------------------
     // set the name or defn of a user-defined type
     //--------------------------------------------------------------------------
@@ -67,7 +82,27 @@ GrB_Info GrB_Type_set_INT32
     GrB_Field field
 )
 { 
-    return (GrB_INVALID_VALUE) ;
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GrB_Type_set_INT32 (type, value, field)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (type) ;
+    ASSERT_TYPE_OK (type, "type for set", GB0) ;
+
+    if (type->header_size == 0 || field != GxB_JIT_C_CONTROL)
+    { 
+        // built-in types may not be modified
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // set the JIT control of a user-defined type
+    //--------------------------------------------------------------------------
+
+    GB_jit_control_set (&(type->jit_control), &(type->jit_control_set), value) ;
+    return (GrB_SUCCESS) ;
 }
 
 //------------------------------------------------------------------------------
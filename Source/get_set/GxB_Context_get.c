@@ -157,6 +157,28 @@ GrB_Info GxB_Context_get            // get a parameter in a Context
             }
             break ;
 
+        case GxB_CONTEXT_WERK_MAX_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *value = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = GB_Context_werk_max_size_get (Context) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_WERK_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *value = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = GB_Context_werk_size_get (Context) ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -36,6 +36,7 @@ GrB_Info GxB_Context_get_Scalar
 
     double dvalue = 0 ;
     int32_t ivalue = 0 ;
+    int64_t i64value = 0 ;
     GrB_Info info ;
 
     switch ((int) field)
@@ -56,6 +57,16 @@ GrB_Info GxB_Context_get_Scalar
             ivalue= GB_Context_gpu_id_get (Context) ;
             break ;
 
+        case GxB_CONTEXT_WERK_MAX_SIZE : 
+
+            i64value = GB_Context_werk_max_size_get (Context) ;
+            break ;
+
+        case GxB_CONTEXT_WERK_SIZE : 
+
+            i64value = GB_Context_werk_size_get (Context) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -70,6 +81,13 @@ GrB_Info GxB_Context_get_Scalar
                 GB_FP64_code, Werk) ;
             break ;
 
+        case GxB_CONTEXT_WERK_MAX_SIZE : 
+        case GxB_CONTEXT_WERK_SIZE : 
+
+            info = GB_setElement ((GrB_Matrix) value, NULL, &i64value, 0, 0,
+                GB_INT64_code, Werk) ;
+            break ;
+
         default : 
             info = GB_setElement ((GrB_Matrix) value, NULL, &ivalue, 0, 0,
                 GB_INT32_code, Werk) ;
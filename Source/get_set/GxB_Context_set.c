@@ -150,6 +150,16 @@ GrB_Info GxB_Context_set            // set a parameter in a Context
             }
             break ;
 
+        case GxB_CONTEXT_WERK_MAX_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t value = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                return (GB_Context_werk_max_size_set (Context, value)) ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
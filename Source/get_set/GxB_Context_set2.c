@@ -36,6 +36,7 @@ GrB_Info GxB_Context_set_Scalar
 
     GrB_Info info ;
     int32_t ivalue = 0 ;
+    int64_t i64value = 0 ;
     double dvalue = 0 ;
 
     switch ((int) field)
@@ -50,6 +51,10 @@ GrB_Info GxB_Context_set_Scalar
             info = GrB_Scalar_extractElement_FP64 (&dvalue, value) ;
             break ;
 
+        case GxB_CONTEXT_WERK_MAX_SIZE : 
+            info = GrB_Scalar_extractElement_INT64 (&i64value, value) ;
+            break ;
+
         default : 
             info = GrB_INVALID_VALUE ;
             break ;
@@ -78,6 +83,10 @@ GrB_Info GxB_Context_set_Scalar
 
             GB_Context_chunk_set (Context, dvalue) ;
             break ;
+
+        case GxB_CONTEXT_WERK_MAX_SIZE : 
+
+            return (GB_Context_werk_max_size_set (Context, i64value)) ;
     }
 
     return (GrB_SUCCESS) ;
@@ -155,6 +164,10 @@ GrB_Info GxB_Context_set_INT
             GB_Context_gpu_id_set (Context, value) ;
             break ;
 
+        case GxB_CONTEXT_WERK_MAX_SIZE : 
+
+            return (GB_Context_werk_max_size_set (Context, value)) ;
+
         default : 
             return (GrB_INVALID_VALUE) ;
     }
@@ -19,6 +19,7 @@
 
 #include "GB.h"
 #include "jitifyer/GB_jitifyer.h"
+#include "mxm/GB_AxB_autotune.h"
 
 //------------------------------------------------------------------------------
 // GxB_Global_Option_get_INT32: get global options (int32_t scalars or arrays)
@@ -116,6 +117,32 @@ GrB_Info GxB_Global_Option_get_INT32    // gets the current global option
             (*value) = (int32_t) GB_jitifyer_get_use_cmake ( ) ;
             break ;
 
+        case GxB_AUTOTUNE : 
+
+            (*value) = (int32_t) GB_AxB_autotune_get ( ) ;
+            break ;
+
+        case GxB_JIT_PROFILE : 
+
+            (*value) = (int32_t) GB_jitifyer_get_profile ( ) ;
+            break ;
+
+        case GxB_JIT_MAX_LOADED : 
+
+            (*value) = (int32_t) GB_IMIN (GB_jitifyer_get_max_loaded ( ),
+                INT32_MAX) ;
+            break ;
+
+        case GxB_JIT_SPECIALIZE_DIM : 
+
+            (*value) = GB_jitifyer_get_specialize_dim ( ) ;
+            break ;
+
+        case GxB_JIT_USE_LIBTCC : 
+
+            (*value) = (int32_t) GB_jitifyer_get_use_libtcc ( ) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -211,6 +238,26 @@ GrB_Info GxB_Global_Option_get_INT64    // gets the current global option
             }
             break ;
 
+        case GxB_JIT_CACHE_MAX_SIZE : 
+
+            (*value) = GB_jitifyer_get_cache_max_size ( ) ;
+            break ;
+
+        case GxB_MEMORY_POOL_MAX_SIZE : 
+
+            (*value) = GB_memory_pool_get_max_size ( ) ;
+            break ;
+
+        case GxB_MEMORY_POOL_SIZE : 
+
+            (*value) = GB_memory_pool_size ( ) ;
+            break ;
+
+        case GxB_HUGE_PAGES : 
+
+            (*value) = GB_Global_huge_pages_get ( ) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -344,6 +391,16 @@ GrB_Info GxB_Global_Option_get_CHAR     // gets the current global option
             (*value) = GB_jitifyer_get_error_log ( ) ;
             break ;
 
+        case GxB_JIT_MANIFEST : 
+
+            (*value) = GB_jitifyer_get_manifest ( ) ;
+            break ;
+
+        case GxB_JIT_PROFILE_REPORT : 
+
+            (*value) = GB_jitifyer_get_profile_report (true) ;
+            break ;
+
         case GxB_JIT_CACHE_PATH : 
 
             (*value) = GB_jitifyer_get_cache_path ( ) ;
@@ -948,6 +1005,117 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_AUTOTUNE : 
+
+            {
+                va_start (ap, field) ;
+                bool *autotune = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (autotune) ;
+                (*autotune) = GB_AxB_autotune_get ( ) ;
+            }
+            break ;
+
+        case GxB_JIT_PROFILE : 
+
+            {
+                va_start (ap, field) ;
+                bool *profile = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (profile) ;
+                (*profile) = GB_jitifyer_get_profile ( ) ;
+            }
+            break ;
+
+        case GxB_JIT_MAX_LOADED : 
+
+            {
+                va_start (ap, field) ;
+                int *max_loaded = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (max_loaded) ;
+                (*max_loaded) = (int) GB_IMIN (GB_jitifyer_get_max_loaded ( ),
+                    INT32_MAX) ;
+            }
+            break ;
+
+        case GxB_JIT_SPECIALIZE_DIM : 
+
+            {
+                va_start (ap, field) ;
+                int *dim = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (dim) ;
+                (*dim) = (int) GB_jitifyer_get_specialize_dim ( ) ;
+            }
+            break ;
+
+        case GxB_JIT_USE_LIBTCC : 
+
+            {
+                va_start (ap, field) ;
+                bool *use_libtcc = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (use_libtcc) ;
+                (*use_libtcc) = GB_jitifyer_get_use_libtcc ( ) ;
+            }
+            break ;
+
+        case GxB_JIT_CACHE_MAX_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *max_size = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (max_size) ;
+                (*max_size) = GB_jitifyer_get_cache_max_size ( ) ;
+            }
+            break ;
+
+        case GxB_MEMORY_POOL_MAX_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *max_size = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (max_size) ;
+                (*max_size) = GB_memory_pool_get_max_size ( ) ;
+            }
+            break ;
+
+        case GxB_MEMORY_POOL_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *size = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (size) ;
+                (*size) = GB_memory_pool_size ( ) ;
+            }
+            break ;
+
+        case GxB_HUGE_PAGES : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *huge_pages = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (huge_pages) ;
+                (*huge_pages) = GB_Global_huge_pages_get ( ) ;
+            }
+            break ;
+
+        case GxB_JIT_PROFILE_REPORT : 
+
+            {
+                va_start (ap, field) ;
+                const char **report = va_arg (ap, const char **) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (report) ;
+                (*report) = GB_jitifyer_get_profile_report (true) ;
+            }
+            break ;
+
         case GxB_JIT_ERROR_LOG : 
 
             {
@@ -959,6 +1127,17 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_JIT_MANIFEST : 
+
+            {
+                va_start (ap, field) ;
+                const char **manifest = va_arg (ap, const char **) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (manifest) ;
+                (*manifest) = GB_jitifyer_get_manifest ( ) ;
+            }
+            break ;
+
         case GxB_JIT_CACHE_PATH : 
 
             {
@@ -20,6 +20,7 @@
 
 #include "GB.h"
 #include "jitifyer/GB_jitifyer.h"
+#include "mxm/GB_AxB_autotune.h"
 
 //------------------------------------------------------------------------------
 // GxB_Global_Option_set_INT32: set a global option (int32_t)
@@ -84,6 +85,30 @@ GrB_Info GxB_Global_Option_set_INT32      // set a global default option
             GB_jitifyer_set_control ((int) value) ;
             break ;
 
+        case GxB_AUTOTUNE : 
+
+            GB_AxB_autotune_set ((bool) value) ;
+            break ;
+
+        case GxB_JIT_PROFILE : 
+
+            GB_jitifyer_set_profile ((bool) value) ;
+            break ;
+
+        case GxB_JIT_MAX_LOADED : 
+
+            GB_jitifyer_set_max_loaded (value) ;
+            break ;
+
+        case GxB_JIT_SPECIALIZE_DIM : 
+
+            GB_jitifyer_set_specialize_dim (value) ;
+            break ;
+
+        case GxB_JIT_USE_LIBTCC : 
+
+            return (GB_jitifyer_set_use_libtcc ((bool) value)) ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -275,6 +300,10 @@ GrB_Info GxB_Global_Option_set_CHAR      // set a global default option
 
             return (GB_jitifyer_set_error_log (value)) ;
 
+        case GxB_JIT_MANIFEST : 
+
+            return (GB_jitifyer_set_manifest (value)) ;
+
         case GxB_JIT_CACHE_PATH : 
 
             return (GB_jitifyer_set_cache_path (value)) ;
@@ -577,6 +606,85 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        case GxB_AUTOTUNE : 
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_AxB_autotune_set ((bool) value) ;
+            }
+            break ;
+
+        case GxB_JIT_PROFILE : 
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_jitifyer_set_profile ((bool) value) ;
+            }
+            break ;
+
+        case GxB_JIT_MAX_LOADED : 
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_jitifyer_set_max_loaded (value) ;
+            }
+            break ;
+
+        case GxB_JIT_SPECIALIZE_DIM : 
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_jitifyer_set_specialize_dim (value) ;
+            }
+            break ;
+
+        case GxB_JIT_USE_LIBTCC : 
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                va_end (ap) ;
+                return (GB_jitifyer_set_use_libtcc ((bool) value)) ;
+            }
+
+        case GxB_JIT_CACHE_MAX_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t value = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                GB_jitifyer_set_cache_max_size (value) ;
+            }
+            break ;
+
+        case GxB_MEMORY_POOL_MAX_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t value = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                GB_memory_pool_set_max_size (value) ;
+            }
+            break ;
+
+        case GxB_HUGE_PAGES : 
+
+            {
+                va_start (ap, field) ;
+                int64_t value = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                GB_Global_huge_pages_set (value) ;
+            }
+            break ;
+
         case GxB_JIT_ERROR_LOG : 
 
             {
@@ -586,6 +694,15 @@ GrB_Info GxB_Global_Option_set      // set a global default option
                 return (GB_jitifyer_set_error_log (error_log)) ;
             }
 
+        case GxB_JIT_MANIFEST : 
+
+            {
+                va_start (ap, field) ;
+                char *manifest = va_arg (ap, char *) ;
+                va_end (ap) ;
+                return (GB_jitifyer_set_manifest (manifest)) ;
+            }
+
         case GxB_JIT_CACHE_PATH : 
 
             {
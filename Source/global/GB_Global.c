@@ -40,6 +40,13 @@ typedef struct
     bool is_csc ;               // default CSR/CSC format for new matrices
     int64_t hyper_hash ;        // controls when A->Y hyper_hash is created
 
+    //--------------------------------------------------------------------------
+    // placement of large blocks of memory
+    //--------------------------------------------------------------------------
+
+    int64_t huge_pages ;        // blocks this large or larger use huge pages
+                                // and parallel first-touch; 0 if disabled
+
     //--------------------------------------------------------------------------
     // abort function: only used for debugging
     //--------------------------------------------------------------------------
@@ -178,6 +185,8 @@ static GB_Global_struct GB_Global =
 
     .hyper_hash = GB_HYPER_HASH_DEFAULT,
 
+    .huge_pages = 0,    // large blocks are not placed
+
     // abort function for debugging only
     .abort_function   = abort,
 
@@ -359,6 +368,20 @@ int64_t GB_Global_hyper_hash_get (void)
     return (GB_Global.hyper_hash) ;
 }
 
+//------------------------------------------------------------------------------
+// huge_pages
+//------------------------------------------------------------------------------
+
+void GB_Global_huge_pages_set (int64_t huge_pages)
+{ 
+    GB_Global.huge_pages = GB_IMAX (huge_pages, 0) ;
+}
+
+int64_t GB_Global_huge_pages_get (void)
+{ 
+    return (GB_Global.huge_pages) ;
+}
+
 //------------------------------------------------------------------------------
 // bitmap_switch
 //------------------------------------------------------------------------------
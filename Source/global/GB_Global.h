@@ -33,6 +33,9 @@ float    GB_Global_hyper_switch_get (void) ;
 void     GB_Global_hyper_hash_set (int64_t hyper_hash) ;
 int64_t  GB_Global_hyper_hash_get (void) ;
 
+void     GB_Global_huge_pages_set (int64_t huge_pages) ;
+int64_t  GB_Global_huge_pages_get (void) ;
+
 void     GB_Global_bitmap_switch_set (int k, float b) ;
 float    GB_Global_bitmap_switch_get (int k) ;
 float    GB_Global_bitmap_switch_matrix_get
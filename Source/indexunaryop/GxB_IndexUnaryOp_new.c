@@ -74,6 +74,12 @@ GrB_Info GxB_IndexUnaryOp_new   // create a named user-created IndexUnaryOp
     op->binop_function = NULL ;
 
     op->opcode = GB_USER_idxunop_code ;
+    op->jit_C_flags = NULL ;
+    op->jit_C_flags_size = 0 ;
+    op->jit_control = GxB_JIT_DEFAULT ;
+    op->jit_control_set = false ;
+    op->jit_C_object = NULL ;
+    op->jit_C_object_size = 0 ;
 
     //--------------------------------------------------------------------------
     // get the index_unary op name and defn
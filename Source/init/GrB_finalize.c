@@ -14,10 +14,15 @@
 
 #include "GB.h"
 #include "jitifyer/GB_jitifyer.h"
+#include "mxm/GB_AxB_autotune.h"
 
 GrB_Info GrB_finalize ( )
 { 
+    // save the autotuning table in the JIT cache before the JIT is finalized
+    GB_AxB_autotune_finalize ( ) ;
     GB_jitifyer_finalize ( ) ;
+    // free all blocks in the memory pool
+    GB_memory_pool_flush ( ) ;
     return (GrB_SUCCESS) ;
 }
 
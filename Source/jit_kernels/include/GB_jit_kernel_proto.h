@@ -98,6 +98,18 @@ GrB_Info GB_jit_kernel_AxB_dot2                                         \
     const int nbslice                                                   \
 )
 
+#define GB_JIT_KERNEL_AXB_DOT2_FINE_PROTO(GB_jit_kernel_AxB_dot2_fine) \
+GrB_Info GB_jit_kernel_AxB_dot2_fine                                    \
+(                                                                       \
+    GB_void *restrict W,                                                \
+    int8_t *restrict Wb,                                                \
+    const GrB_Matrix A,                                                 \
+    const GrB_Matrix B,                                                 \
+    const int nfine,                                                    \
+    const int ntasks,                                                   \
+    const int nthreads                                                  \
+)
+
 #define GB_JIT_KERNEL_AXB_DOT2N_PROTO(GB_jit_kernel_AxB_dot2n)          \
 GrB_Info GB_jit_kernel_AxB_dot2n                                        \
 (                                                                       \
@@ -124,6 +136,33 @@ GrB_Info GB_jit_kernel_AxB_dot3                                         \
     const int nthreads                                                  \
 )
 
+#define GB_JIT_KERNEL_AXB_DOT3_REDUCE_PROTO(GB_jit_kernel_AxB_dot3_reduce) \
+GrB_Info GB_jit_kernel_AxB_dot3_reduce                                  \
+(                                                                       \
+    GB_void *restrict W,                                                \
+    int64_t *restrict Wcount,                                           \
+    const GrB_Matrix M,                                                 \
+    const GrB_Matrix A,                                                 \
+    const GrB_Matrix B,                                                 \
+    const GB_task_struct *restrict TaskList,                            \
+    const int ntasks,                                                   \
+    const int nthreads                                                  \
+)
+
+#define GB_JIT_KERNEL_AXB_DOT3_ROWREDUCE_PROTO(GB_jit_kernel_AxB_dot3_rowreduce) \
+GrB_Info GB_jit_kernel_AxB_dot3_rowreduce                               \
+(                                                                       \
+    GrB_Matrix T,                                                       \
+    GB_void *restrict W,                                                \
+    int64_t *restrict Wcount,                                           \
+    const GrB_Matrix M,                                                 \
+    const GrB_Matrix A,                                                 \
+    const GrB_Matrix B,                                                 \
+    const GB_task_struct *restrict TaskList,                            \
+    const int ntasks,                                                   \
+    const int nthreads                                                  \
+)
+
 #define GB_JIT_KERNEL_AXB_DOT4_PROTO(GB_jit_kernel_AxB_dot4)            \
 GrB_Info GB_jit_kernel_AxB_dot4                                         \
 (                                                                       \
@@ -136,7 +175,9 @@ GrB_Info GB_jit_kernel_AxB_dot4                                         \
     const int nbslice,                                                  \
     const int nthreads,                                                 \
     GB_Werk Werk,                                                       \
-    const GB_callback_struct *restrict my_callback                      \
+    const GB_callback_struct *restrict my_callback,                     \
+    bool cpu_has_avx2,                                                  \
+    bool cpu_has_avx512f                                                \
 )
 
 #define GB_JIT_KERNEL_AXB_SAXBIT_PROTO(GB_jit_kernel_AxB_saxbit)        \
@@ -196,7 +237,9 @@ GrB_Info GB_jit_kernel_AxB_saxpy4                                       \
     const int64_t *restrict A_slice,                                    \
     const int64_t *restrict H_slice,                                    \
     GB_void *restrict Wcx,                                              \
-    int8_t *restrict Wf                                                 \
+    int8_t *restrict Wf,                                                \
+    bool cpu_has_avx2,                                                  \
+    bool cpu_has_avx512f                                                \
 )
 
 #define GB_JIT_KERNEL_AXB_SAXPY5_PROTO(GB_jit_kernel_AxB_saxpy5)        \
@@ -658,7 +701,10 @@ GrB_Info GB_jit_kernel_AxB_dot3                                         \
 
 #define JIT_DOT2(g) GB_JIT_KERNEL_AXB_DOT2_PROTO(g) ;
 #define JIT_DO2N(g) GB_JIT_KERNEL_AXB_DOT2N_PROTO(g) ;
+#define JIT_DO2F(g) GB_JIT_KERNEL_AXB_DOT2_FINE_PROTO(g) ;
 #define JIT_DOT3(g) GB_JIT_KERNEL_AXB_DOT3_PROTO(g) ;
+#define JIT_DO3R(g) GB_JIT_KERNEL_AXB_DOT3_REDUCE_PROTO(g) ;
+#define JIT_DO3V(g) GB_JIT_KERNEL_AXB_DOT3_ROWREDUCE_PROTO(g) ;
 #define JIT_DOT4(g) GB_JIT_KERNEL_AXB_DOT4_PROTO(g) ;
 #define JIT_SAXB(g) GB_JIT_KERNEL_AXB_SAXBIT_PROTO(g) ;
 #define JIT_SAX3(g) GB_JIT_KERNEL_AXB_SAXPY3_PROTO(g) ;
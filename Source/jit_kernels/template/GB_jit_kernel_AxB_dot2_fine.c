@@ -0,0 +1,23 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_AxB_dot2_fine.c: JIT kernel for C=A'*B with fine dot products
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A'*B: each dot product is split across fine tasks, and the partial result
+// of each task is saved in W.  C is not accessed.  The ctype of C is the
+// monoid ztype, so GB_C_TYPE and GB_Z_TYPE are the same.
+
+// W [tid] = z
+#define GB_DOT_REDUCE_SAVE(W,tid,z) ((GB_Z_TYPE *) (W)) [tid] = z
+
+GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_DOT2_FINE_PROTO (GB_jit_kernel) ;
+GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_DOT2_FINE_PROTO (GB_jit_kernel)
+{
+    #include "template/GB_AxB_dot2_fine_meta.c"
+    return (GrB_SUCCESS) ;
+}
+
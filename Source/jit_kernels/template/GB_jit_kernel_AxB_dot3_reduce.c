@@ -0,0 +1,27 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_AxB_dot3_reduce.c: JIT kernel for s = reduce (C<M>=A'*B)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// s = reduce (C<M>=A'*B): masked dot products summed by the monoid, where M
+// is sparse or hyper, and C is not formed.  The ctype of C is the monoid
+// ztype, so GB_C_TYPE and GB_Z_TYPE are the same.
+
+// z = identity
+#define GB_DOT_REDUCE_DECLARE(z) GB_DECLARE_IDENTITY (z)
+// z += cij
+#define GB_DOT_REDUCE_UPDATE(z,cij) GB_UPDATE (z, cij)
+// W [tid] = z
+#define GB_DOT_REDUCE_SAVE(W,tid,z) ((GB_Z_TYPE *) (W)) [tid] = z
+
+GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_DOT3_REDUCE_PROTO (GB_jit_kernel) ;
+GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_DOT3_REDUCE_PROTO (GB_jit_kernel)
+{
+    #include "template/GB_AxB_dot3_reduce_meta.c"
+    return (GrB_SUCCESS) ;
+}
+
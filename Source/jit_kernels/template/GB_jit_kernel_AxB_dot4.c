@@ -9,15 +9,42 @@
 
 // C+=A'*B: dot product, C is full, dot4 method
 
+#include "template/GB_AxB_dot4_avx.c"
+
 GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_DOT4_PROTO (GB_jit_kernel) ;
 GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_DOT4_PROTO (GB_jit_kernel)
 {
+
+    #if GB_SEMIRING_HAS_AVX_SAXPY4_DOT4
+    {
+
+        #if GB_COMPILER_SUPPORTS_AVX512F
+        if (cpu_has_avx512f)
+        {
+            // x86_64 with AVX512f
+            return (GB_AxB_dot4_avx512f (C, A, B, A_slice, B_slice,
+                naslice, nbslice, nthreads, Werk, my_callback)) ;
+        }
+        #endif
+
+        #if GB_COMPILER_SUPPORTS_AVX2
+        if (cpu_has_avx2)
+        {
+            // x86_64 with AVX2
+            return (GB_AxB_dot4_avx2 (C, A, B, A_slice, B_slice,
+                naslice, nbslice, nthreads, Werk, my_callback)) ;
+        }
+        #endif
+    }
+    #endif
+
     #ifdef GB_JIT_RUNTIME
     // get callback functions
     GB_free_memory_f GB_free_memory = my_callback->GB_free_memory_func ;
     GB_malloc_memory_f GB_malloc_memory = my_callback->GB_malloc_memory_func ;
     #endif
 
+    // any architecture and any semiring
     #include "template/GB_AxB_dot4_meta.c"
     return (GrB_SUCCESS) ;
 }
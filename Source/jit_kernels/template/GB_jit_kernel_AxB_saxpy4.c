@@ -10,10 +10,40 @@
 // C+=A*B: C is full, saxpy4 method
 
 #include "include/GB_AxB_saxpy3_template.h"
+#include "template/GB_AxB_saxpy4_avx.c"
 
 GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_SAXPY4_PROTO (GB_jit_kernel) ;
 GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_SAXPY4_PROTO (GB_jit_kernel)
 {
+
+    #if GB_SEMIRING_HAS_AVX_SAXPY4_DOT4
+    {
+
+        #if GB_COMPILER_SUPPORTS_AVX512F
+        if (cpu_has_avx512f)
+        {
+            // x86_64 with AVX512f
+            GB_AxB_saxpy4_avx512f (C, A, B, ntasks, nthreads,
+                nfine_tasks_per_vector, use_coarse_tasks, use_atomics,
+                A_slice, H_slice, Wcx, Wf) ;
+            return (GrB_SUCCESS) ;
+        }
+        #endif
+
+        #if GB_COMPILER_SUPPORTS_AVX2
+        if (cpu_has_avx2)
+        {
+            // x86_64 with AVX2
+            GB_AxB_saxpy4_avx2 (C, A, B, ntasks, nthreads,
+                nfine_tasks_per_vector, use_coarse_tasks, use_atomics,
+                A_slice, H_slice, Wcx, Wf) ;
+            return (GrB_SUCCESS) ;
+        }
+        #endif
+    }
+    #endif
+
+    // any architecture and any semiring
     #include "template/GB_AxB_saxpy4_meta.c"
     return (GrB_SUCCESS) ;
 }
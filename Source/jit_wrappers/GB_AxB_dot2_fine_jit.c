@@ -0,0 +1,65 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot2_fine_jit: C=A'*B via fine-grain dot products, via the JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+#include "jitifyer/GB_stringify.h"
+
+typedef GB_JIT_KERNEL_AXB_DOT2_FINE_PROTO ((*GB_jit_dl_function)) ;
+
+GrB_Info GB_AxB_dot2_fine_jit   // C=A'*B, dot2 fine tasks, via the JIT
+(
+    // output:
+    GB_void *restrict W,        // partial results, of size ntasks
+    int8_t *restrict Wb,        // Wb [tid] true if W [tid] exists
+    // input:
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    const int nfine,
+    const int ntasks,
+    const int nthreads
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // encodify the problem
+    //--------------------------------------------------------------------------
+
+    // C is not accessed.  Its type is the monoid ztype and it is bitmap.
+
+    GrB_Type ztype = semiring->add->op->ztype ;
+    GB_jit_encoding encoding ;
+    char *suffix ;
+    uint64_t hash = GB_encodify_mxm (&encoding, &suffix,
+        GB_JIT_KERNEL_AXB_DOT2_FINE,
+        false, false, GxB_BITMAP, ztype,
+        NULL, false, false, semiring, flipxy, A, B) ;
+
+    //--------------------------------------------------------------------------
+    // get the kernel function pointer, loading or compiling it if needed
+    //--------------------------------------------------------------------------
+
+    void *dl_function ;
+    GrB_Info info = GB_jitifyer_load (&dl_function,
+        GB_jit_mxm_family, "AxB_dot2_fine",
+        hash, &encoding, suffix, semiring, NULL,
+        NULL, ztype, A->type, B->type) ;
+    if (info != GrB_SUCCESS) return (info) ;
+
+    //--------------------------------------------------------------------------
+    // call the jit kernel and return result
+    //--------------------------------------------------------------------------
+
+    GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (W, Wb, A, B, nfine, ntasks, nthreads)) ;
+    return (info) ;
+}
+
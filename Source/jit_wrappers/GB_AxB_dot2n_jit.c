@@ -59,7 +59,9 @@ GrB_Info GB_AxB_dot2n_jit        // C<M>=A*B, dot2n method, via the JIT
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, M, A, A_slice, B, B_slice, nthreads, naslice,
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, M, A, A_slice, B, B_slice, nthreads, naslice,
         nbslice)) ;
+    return (info) ;
 }
 
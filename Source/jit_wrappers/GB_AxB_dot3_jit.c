@@ -55,6 +55,8 @@ GrB_Info GB_AxB_dot3_jit        // C<M>=A'B, dot3, via the JIT
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, M, A, B, TaskList, ntasks, nthreads)) ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, M, A, B, TaskList, ntasks, nthreads)) ;
+    return (info) ;
 }
 
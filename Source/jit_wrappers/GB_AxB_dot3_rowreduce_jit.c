@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot3_rowreduce_jit: T = rowreduce (C<M>=A'*B) via the JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+#include "jitifyer/GB_stringify.h"
+
+typedef GB_JIT_KERNEL_AXB_DOT3_ROWREDUCE_PROTO ((*GB_jit_dl_function)) ;
+
+GrB_Info GB_AxB_dot3_rowreduce_jit  // T = rowreduce (C<M>=A'B), via the JIT
+(
+    // output:
+    GrB_Matrix T,               // bitmap vector, T(j) = reduce (C(:,j))
+    GB_void *restrict W,        // partial results of fine tasks
+    int64_t *restrict Wcount,   // # of entries computed by each task
+    // input:
+    const GrB_Matrix M, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
+    const int nthreads
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // encodify the problem
+    //--------------------------------------------------------------------------
+
+    // C is not formed.  Its type is the monoid ztype and it has the same
+    // sparsity as M.
+
+    GrB_Type ztype = semiring->add->op->ztype ;
+    GB_jit_encoding encoding ;
+    char *suffix ;
+    uint64_t hash = GB_encodify_mxm (&encoding, &suffix,
+        GB_JIT_KERNEL_AXB_DOT3_ROWREDUCE,
+        false, false, GB_sparsity (M), ztype,
+        M, Mask_struct, false, semiring, flipxy, A, B) ;
+
+    //--------------------------------------------------------------------------
+    // get the kernel function pointer, loading or compiling it if needed
+    //--------------------------------------------------------------------------
+
+    void *dl_function ;
+    GrB_Info info = GB_jitifyer_load (&dl_function,
+        GB_jit_mxm_family, "AxB_dot3_rowreduce",
+        hash, &encoding, suffix, semiring, NULL,
+        NULL, ztype, A->type, B->type) ;
+    if (info != GrB_SUCCESS) return (info) ;
+
+    //--------------------------------------------------------------------------
+    // call the jit kernel and return result
+    //--------------------------------------------------------------------------
+
+    GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (T, W, Wcount, M, A, B, TaskList, ntasks,
+        nthreads)) ;
+    return (info) ;
+}
+
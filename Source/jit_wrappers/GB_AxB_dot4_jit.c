@@ -57,8 +57,12 @@ GrB_Info GB_AxB_dot4_jit            // C+=A'*B, dot4 method, via the JIT
     // call the jit kernel and return result
     //--------------------------------------------------------------------------
 
+    bool cpu_has_avx2 = GB_Global_cpu_features_avx2 ( ) ;
+    bool cpu_has_avx512f = GB_Global_cpu_features_avx512f ( ) ;
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, A, B, A_slice, B_slice, naslice, nbslice,
-        nthreads, Werk, &GB_callback)) ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, A, B, A_slice, B_slice, naslice, nbslice,
+        nthreads, Werk, &GB_callback, cpu_has_avx2, cpu_has_avx512f)) ;
+    return (info) ;
 }
 
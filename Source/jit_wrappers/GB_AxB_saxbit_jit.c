@@ -69,9 +69,11 @@ GrB_Info GB_AxB_saxbit_jit      // C<M>=A*B, saxbit, via the JIT
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, M, A, B, ntasks, nthreads,
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, M, A, B, ntasks, nthreads,
         nfine_tasks_per_vector, use_coarse_tasks, use_atomics,
         M_ek_slicing, M_nthreads, M_ntasks, A_slice, H_slice, Wcx, Wf,
         nthreads_max, chunk, &GB_callback)) ;
+    return (info) ;
 }
 
@@ -64,8 +64,10 @@ GrB_Info GB_AxB_saxpy3_jit      // C<M>=A*B, saxpy3, via the JIT
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, M, M_in_place, A, B,
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, M, M_in_place, A, B,
         (GB_saxpy3task_struct *) SaxpyTasks, ntasks, nfine, nthreads, do_sort,
         nthreads_max, chunk, Werk, &GB_callback)) ;
+    return (info) ;
 }
 
@@ -61,8 +61,13 @@ GrB_Info GB_AxB_saxpy4_jit          // C+=A*B, saxpy4 method, via the JIT
     // call the jit kernel and return result
     //--------------------------------------------------------------------------
 
+    bool cpu_has_avx2 = GB_Global_cpu_features_avx2 ( ) ;
+    bool cpu_has_avx512f = GB_Global_cpu_features_avx512f ( ) ;
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, A, B, ntasks, nthreads, nfine_tasks_per_vector,
-        use_coarse_tasks, use_atomics, A_slice, H_slice, Wcx, Wf)) ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, A, B, ntasks, nthreads, nfine_tasks_per_vector,
+        use_coarse_tasks, use_atomics, A_slice, H_slice, Wcx, Wf,
+        cpu_has_avx2, cpu_has_avx512f)) ;
+    return (info) ;
 }
 
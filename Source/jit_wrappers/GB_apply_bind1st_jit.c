@@ -52,7 +52,9 @@ GrB_Info GB_apply_bind1st_jit   // Cx = op (x,B), apply bind1st via the JIT
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (Cx, xscalar, B->x, B->b, GB_nnz_held (B),
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (Cx, xscalar, B->x, B->b, GB_nnz_held (B),
         nthreads)) ;
+    return (info) ;
 }
 
@@ -53,6 +53,8 @@ GrB_Info GB_apply_unop_jit      // Cx = op (A), apply unop via the JIT
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (Cx, A, ythunk, A_ek_slicing, A_ntasks, A_nthreads)) ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (Cx, A, ythunk, A_ek_slicing, A_ntasks, A_nthreads)) ;
+    return (info) ;
 }
 
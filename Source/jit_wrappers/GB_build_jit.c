@@ -57,7 +57,9 @@ GrB_Info GB_build_jit               // GB_builder JIT kernel
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (Tx, Ti, Sx, nvals, ndupl, I_work, K_work,
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (Tx, Ti, Sx, nvals, ndupl, I_work, K_work,
         tstart_slice, tnz_slice, nthreads)) ;
+    return (info) ;
 }
 
@@ -54,6 +54,8 @@ GrB_Info GB_colscale_jit      // C=A*D, colscale, via the JIT
     //------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, A, D, A_ek_slicing, A_ntasks, A_nthreads)) ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, A, D, A_ek_slicing, A_ntasks, A_nthreads)) ;
+    return (info) ;
 }
 
@@ -53,7 +53,9 @@ GrB_Info GB_concat_bitmap_jit      // concatenate A into a bitmap matrix C
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, cistart, cvstart, A, nthreads_max, chunk, Werk,
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, cistart, cvstart, A, nthreads_max, chunk, Werk,
         &GB_callback)) ;
+    return (info) ;
 }
 
@@ -50,6 +50,8 @@ GrB_Info GB_concat_full_jit      // concatenate A into a full matrix C
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, cistart, cvstart, A, A_nthreads)) ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, cistart, cvstart, A, A_nthreads)) ;
+    return (info) ;
 }
 
@@ -52,7 +52,9 @@ GrB_Info GB_concat_sparse_jit      // concatenate A into a sparse matrix C
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, cistart, A, W, A_ek_slicing, A_ntasks,
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, cistart, A, W, A_ek_slicing, A_ntasks,
         A_nthreads)) ;
+    return (info) ;
 }
 
@@ -58,7 +58,9 @@ GrB_Info GB_emult_02_jit      // C<#M>=A.*B, emult_02, via the JIT
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, M, Mask_struct, Mask_comp, A, B,
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, M, Mask_struct, Mask_comp, A, B,
         Cp_kfirst, A_ek_slicing, A_ntasks, A_nthreads)) ;
+    return (info) ;
 }
 
@@ -58,7 +58,9 @@ GrB_Info GB_emult_03_jit      // C<#M>=A.*B, emult_03, via the JIT
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, M, Mask_struct, Mask_comp, A, B, Cp_kfirst,
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, M, Mask_struct, Mask_comp, A, B, Cp_kfirst,
         B_ek_slicing, B_ntasks, B_nthreads)) ;
+    return (info) ;
 }
 
@@ -57,7 +57,9 @@ GrB_Info GB_emult_bitmap_jit      // C<#M>=A.*B, emult_bitmap, via the JIT
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, M, Mask_struct, Mask_comp, A, B, M_ek_slicing,
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, M, Mask_struct, Mask_comp, A, B, M_ek_slicing,
         M_ntasks, M_nthreads, C_nthreads, &GB_callback)) ;
+    return (info) ;
 }
 
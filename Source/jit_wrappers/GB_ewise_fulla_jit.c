@@ -52,6 +52,8 @@ GrB_Info GB_ewise_fulla_jit    // C+=A+B via the JIT
 
     bool A_is_B = GB_all_aliased (A, B) ;
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, A, B, nthreads, A_is_B)) ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, A, B, nthreads, A_is_B)) ;
+    return (info) ;
 }
 
@@ -51,6 +51,8 @@ GrB_Info GB_ewise_fulln_jit  // C=A+B via the JIT
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, A, B, nthreads)) ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, A, B, nthreads)) ;
+    return (info) ;
 }
 
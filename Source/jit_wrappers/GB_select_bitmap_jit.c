@@ -52,6 +52,8 @@ GrB_Info GB_select_bitmap_jit      // select bitmap
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (Cb, cnvals_handle, A, ythunk, nthreads)) ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (Cb, cnvals_handle, A, ythunk, nthreads)) ;
+    return (info) ;
 }
 
@@ -56,7 +56,9 @@ GrB_Info GB_select_phase1_jit      // select phase1
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (Cp, Wfirst, Wlast, A, ythunk, A_ek_slicing,
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (Cp, Wfirst, Wlast, A, ythunk, A_ek_slicing,
         A_ntasks, A_nthreads, &GB_callback)) ;
+    return (info) ;
 }
 
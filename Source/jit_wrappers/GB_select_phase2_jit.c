@@ -57,7 +57,9 @@ GrB_Info GB_select_phase2_jit      // select phase2
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (Ci, Cx, Cp, Cp_kfirst, A, ythunk, A_ek_slicing,
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (Ci, Cx, Cp, Cp_kfirst, A, ythunk, A_ek_slicing,
         A_ntasks, A_nthreads)) ;
+    return (info) ;
 }
 
@@ -50,6 +50,8 @@ GrB_Info GB_split_bitmap_jit      // split A into a bitmap tile C
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, A, avstart, aistart, C_nthreads)) ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, A, avstart, aistart, C_nthreads)) ;
+    return (info) ;
 }
 
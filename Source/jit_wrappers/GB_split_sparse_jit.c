@@ -53,7 +53,9 @@ GrB_Info GB_split_sparse_jit      // split A into a sparse tile C
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, A, akstart, aistart, Wp, C_ek_slicing, C_ntasks,
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, A, akstart, aistart, Wp, C_ek_slicing, C_ntasks,
         C_nthreads)) ;
+    return (info) ;
 }
 
@@ -79,7 +79,9 @@ GrB_Info GB_subassign_jit
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, I, ni, nI, Icolon, J, nj, nJ, Jcolon, M, A,
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, I, ni, nI, Icolon, J, nj, nJ, Jcolon, M, A,
         scalar, nthreads_max, chunk, Werk, &GB_callback)) ;
+    return (info) ;
 }
 
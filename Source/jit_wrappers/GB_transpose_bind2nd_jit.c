@@ -54,7 +54,9 @@ GrB_Info GB_transpose_bind2nd_jit
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, A, yscalar, Workspaces, A_slice, nworkspaces,
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, A, yscalar, Workspaces, A_slice, nworkspaces,
         nthreads)) ;
+    return (info) ;
 }
 
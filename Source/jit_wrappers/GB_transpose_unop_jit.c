@@ -51,6 +51,8 @@ GrB_Info GB_transpose_unop_jit  // C = op (A'), transpose unop via the JIT
     //--------------------------------------------------------------------------
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
-    return (GB_jit_kernel (C, A, Workspaces, A_slice, nworkspaces, nthreads)) ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (C, A, Workspaces, A_slice, nworkspaces, nthreads)) ;
+    return (info) ;
 }
 
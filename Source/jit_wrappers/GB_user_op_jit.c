@@ -46,6 +46,8 @@ GrB_Info GB_user_op_jit         // construct a user operator in a JIT kernel
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
     char *ignore ;
-    return (GB_jit_kernel (user_function, &ignore)) ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (user_function, &ignore)) ;
+    return (info) ;
 }
 
@@ -46,6 +46,8 @@ GrB_Info GB_user_type_jit       // construct a user type in a JIT kernel
 
     GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
     char *ignore ;
-    return (GB_jit_kernel (user_type_size, &ignore)) ;
+    GB_JIT_CALL (info, hash, &encoding, suffix,
+        GB_jit_kernel (user_type_size, &ignore)) ;
+    return (info) ;
 }
 
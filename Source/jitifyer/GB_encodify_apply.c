@@ -44,6 +44,7 @@ uint64_t GB_encodify_apply      // encode an apply problem
     //--------------------------------------------------------------------------
 
     encoding->kcode = kcode ;
+    encoding->dim = 0 ;
     GB_enumify_apply (&encoding->code, C_sparsity, C_is_matrix, ctype, op,
         flipij, A) ;
 
@@ -55,6 +55,7 @@ uint64_t GB_encodify_assign     // encode an assign problem
     //--------------------------------------------------------------------------
 
     encoding->kcode = kcode ;
+    encoding->dim = 0 ;
     GB_enumify_assign (&encoding->code, C, C_replace, Ikind, Jkind,
         M, Mask_struct, Mask_comp, accum, A, scalar_type, assign_kind) ;
 
@@ -41,6 +41,7 @@ uint64_t GB_encodify_build      // encode an build problem
     //--------------------------------------------------------------------------
 
     encoding->kcode = kcode ;
+    encoding->dim = 0 ;
     GB_enumify_build (&encoding->code, dup, ttype, stype) ;
 
     //--------------------------------------------------------------------------
@@ -54,6 +54,7 @@ uint64_t GB_encodify_ewise      // encode an ewise problem
     bool is_eWiseUnion = (kcode == GB_JIT_KERNEL_UNION) ;
 
     encoding->kcode = kcode ;
+    encoding->dim = 0 ;
     GB_enumify_ewise (&encoding->code, is_eWiseMult, is_eWiseUnion,
         can_copy_to_C, C_iso, C_in_iso, C_sparsity, ctype, M, Mask_struct,
         Mask_comp, binaryop, flipxy, A, B) ;
@@ -52,6 +52,25 @@ uint64_t GB_encodify_mxm        // encode a GrB_mxm problem
     GB_enumify_mxm (&encoding->code, C_iso, C_in_iso, C_sparsity, ctype,
         M, Mask_struct, Mask_comp, semiring, flipxy, A, B) ;
 
+    //--------------------------------------------------------------------------
+    // fixed dimension of the kernel
+    //--------------------------------------------------------------------------
+
+    // The dot2n and saxpy5 kernels compute C=A*B or C+=A*B where A is bitmap
+    // or full and B is sparse.  If C and A have just a few rows (as when a
+    // matrix with a few columns held by row is multiplied by a sparse matrix),
+    // the kernel can be compiled for that exact number of rows.
+
+    encoding->dim = 0 ;
+    if (kcode == GB_JIT_KERNEL_AXB_DOT2N || kcode == GB_JIT_KERNEL_AXB_SAXPY5)
+    {
+        int64_t cnrows = A->vlen ;
+        if (cnrows > 0 && cnrows <= GB_jitifyer_get_specialize_dim ( ))
+        { 
+            encoding->dim = (uint16_t) cnrows ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // determine the suffix and its length
     //--------------------------------------------------------------------------
@@ -42,6 +42,7 @@ uint64_t GB_encodify_reduce // encode a GrB_reduce problem
     GB_enumify_reduce (&encoding->code, monoid, A) ;
     bool builtin = (monoid->hash == 0) ;
     encoding->kcode = kcode ;
+    encoding->dim = 0 ;
 
     //--------------------------------------------------------------------------
     // determine the suffix and its length
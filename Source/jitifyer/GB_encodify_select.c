@@ -43,6 +43,7 @@ uint64_t GB_encodify_select     // encode an select problem
     //--------------------------------------------------------------------------
 
     encoding->kcode = kcode ;
+    encoding->dim = 0 ;
     GB_enumify_select (&encoding->code, C_iso, in_place_A, op, flipij, A) ;
 
     //--------------------------------------------------------------------------
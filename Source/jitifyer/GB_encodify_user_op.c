@@ -38,6 +38,7 @@ uint64_t GB_encodify_user_op      // encode a user defined op
     //--------------------------------------------------------------------------
 
     encoding->kcode = GB_JIT_KERNEL_USEROP ;
+    encoding->dim = 0 ;
     encoding->code = 0 ;
 
     //--------------------------------------------------------------------------
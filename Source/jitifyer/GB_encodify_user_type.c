@@ -38,6 +38,7 @@ uint64_t GB_encodify_user_type      // encode a user defined type
     //--------------------------------------------------------------------------
 
     encoding->kcode = GB_JIT_KERNEL_USERTYPE ;
+    encoding->dim = 0 ;
     encoding->code = 0 ;
 
     //--------------------------------------------------------------------------
@@ -35,6 +35,7 @@
         #include <io.h>
         #include <direct.h>
         #include <windows.h>
+        #include <sys/utime.h>
         #define GB_OPEN         _open
         #define GB_CLOSE        _close
         #define GB_FDOPEN       _fdopen
@@ -49,6 +50,8 @@
         // POSIX
         #include <unistd.h>
         #include <dlfcn.h>
+        #include <dirent.h>
+        #include <utime.h>
         #define GB_OPEN         open
         #define GB_CLOSE        close
         #define GB_FDOPEN       fdopen
@@ -296,6 +299,97 @@ bool GB_file_mkdir (char *path)
     #endif
 }
 
+//------------------------------------------------------------------------------
+// GB_file_exists: check if a file exists
+//------------------------------------------------------------------------------
+
+// Returns true if the file exists, or false otherwise.  Returns false if the
+// JIT is disabled.
+
+bool GB_file_exists (char *filename)
+{ 
+    #ifdef NJIT
+    {
+        // JIT disabled
+        return (false) ;
+    }
+    #elif GB_WINDOWS
+    {
+        // check for a file in Windows
+        struct _stat statbuf ;
+        return (_stat (filename, &statbuf) == 0) ;
+    }
+    #else
+    {
+        // check for a POSIX file
+        struct stat statbuf ;
+        return (stat (filename, &statbuf) == 0) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_file_stat: get the size and modification time of a file
+//------------------------------------------------------------------------------
+
+// Returns true if the file exists, or false otherwise.  Returns false if the
+// JIT is disabled.  The modification time is in seconds.
+
+bool GB_file_stat (char *filename, int64_t *size, int64_t *mtime)
+{ 
+    (*size) = 0 ;
+    (*mtime) = 0 ;
+    #ifdef NJIT
+    {
+        // JIT disabled
+        return (false) ;
+    }
+    #elif GB_WINDOWS
+    {
+        // stat a file in Windows
+        struct __stat64 statbuf ;
+        if (_stat64 (filename, &statbuf) != 0) return (false) ;
+        (*size) = (int64_t) statbuf.st_size ;
+        (*mtime) = (int64_t) statbuf.st_mtime ;
+        return (true) ;
+    }
+    #else
+    {
+        // stat a POSIX file
+        struct stat statbuf ;
+        if (stat (filename, &statbuf) != 0) return (false) ;
+        (*size) = (int64_t) statbuf.st_size ;
+        (*mtime) = (int64_t) statbuf.st_mtime ;
+        return (true) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_file_touch: set the modification time of a file to the current time
+//------------------------------------------------------------------------------
+
+// Errors are ignored.
+
+void GB_file_touch (char *filename)
+{ 
+    #ifdef NJIT
+    {
+        // JIT disabled: do nothing
+    }
+    #elif GB_WINDOWS
+    {
+        // touch a file in Windows
+        _utime (filename, NULL) ;
+    }
+    #else
+    {
+        // touch a POSIX file
+        utime (filename, NULL) ;
+    }
+    #endif
+}
+
 //------------------------------------------------------------------------------
 // GB_file_dlopen: open a dynamic library
 //------------------------------------------------------------------------------
@@ -372,3 +466,118 @@ void GB_file_dlclose (void *dl_handle)
     }
 }
 
+//------------------------------------------------------------------------------
+// GB_file_opendir: open a folder to list its files
+//------------------------------------------------------------------------------
+
+// Returns NULL if the folder cannot be opened, or if the JIT is disabled.
+
+#if !defined (NJIT) && GB_WINDOWS
+typedef struct
+{
+    intptr_t handle ;           // handle from _findfirst
+    struct _finddata_t data ;   // current file
+    bool first ;                // true if data holds the first file
+}
+GB_file_dir_struct ;
+#endif
+
+void *GB_file_opendir (char *path)
+{ 
+    #ifdef NJIT
+    {
+        // JIT disabled
+        return (NULL) ;
+    }
+    #elif GB_WINDOWS
+    {
+        // open a Windows folder
+        char pattern [4096] ;
+        snprintf (pattern, 4096, "%s/*", path) ;
+        GB_file_dir_struct *dir =
+            GB_Global_persistent_malloc (sizeof (GB_file_dir_struct)) ;
+        if (dir == NULL) return (NULL) ;
+        dir->handle = _findfirst (pattern, &(dir->data)) ;
+        if (dir->handle == -1)
+        { 
+            GB_Global_persistent_free ((void **) &dir) ;
+            return (NULL) ;
+        }
+        dir->first = true ;
+        return ((void *) dir) ;
+    }
+    #else
+    {
+        // open a POSIX folder
+        return ((void *) opendir (path)) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_file_readdir: get the name of the next file in a folder
+//------------------------------------------------------------------------------
+
+// Returns NULL when there are no more files in the folder.  The name is
+// overwritten by the next call to GB_file_readdir.
+
+const char *GB_file_readdir (void *dir)
+{ 
+    if (dir == NULL)
+    { 
+        return (NULL) ;
+    }
+    #ifdef NJIT
+    {
+        // JIT disabled
+        return (NULL) ;
+    }
+    #elif GB_WINDOWS
+    {
+        // get the next file in a Windows folder
+        GB_file_dir_struct *d = (GB_file_dir_struct *) dir ;
+        if (d->first)
+        { 
+            d->first = false ;
+            return (d->data.name) ;
+        }
+        return ((_findnext (d->handle, &(d->data)) == 0) ?
+            d->data.name : NULL) ;
+    }
+    #else
+    {
+        // get the next file in a POSIX folder
+        struct dirent *entry = readdir ((DIR *) dir) ;
+        return ((entry == NULL) ? NULL : entry->d_name) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_file_closedir: close a folder
+//------------------------------------------------------------------------------
+
+void GB_file_closedir (void *dir)
+{ 
+    if (dir != NULL)
+    {
+        #ifdef NJIT
+        {
+            // JIT disabled: do nothing
+        }
+        #elif GB_WINDOWS
+        {
+            // close a Windows folder
+            GB_file_dir_struct *d = (GB_file_dir_struct *) dir ;
+            _findclose (d->handle) ;
+            GB_Global_persistent_free ((void **) &d) ;
+        }
+        #else
+        {
+            // close a POSIX folder
+            closedir ((DIR *) dir) ;
+        }
+        #endif
+    }
+}
+
@@ -41,11 +41,23 @@ bool GB_file_unlock_and_close   // true if successful, false on error
 
 bool GB_file_mkdir (char *path) ;
 
+bool GB_file_exists (char *filename) ;
+
+bool GB_file_stat (char *filename, int64_t *size, int64_t *mtime) ;
+
+void GB_file_touch (char *filename) ;
+
 void *GB_file_dlopen (char *library_name) ;
 
 void *GB_file_dlsym (void *dl_handle, char *symbol) ;
 
 void GB_file_dlclose (void *dl_handle) ;
 
+void *GB_file_opendir (char *path) ;
+
+const char *GB_file_readdir (void *dir) ;
+
+void GB_file_closedir (void *dir) ;
+
 #endif
 
@@ -13,6 +13,10 @@
 #include "zstd_wrapper/GB_zstd.h"
 #include "JITpackage/GB_JITpackage.h"
 #include "jitifyer/GB_file.h"
+#include <time.h>
+#ifdef GRAPHBLAS_HAS_LIBTCC
+#include "libtcc.h"
+#endif
 
 typedef GB_JIT_KERNEL_USER_OP_PROTO ((*GB_user_op_f)) ;
 typedef GB_JIT_KERNEL_USER_TYPE_PROTO ((*GB_user_type_f)) ;
@@ -26,6 +30,21 @@ typedef GB_JIT_KERNEL_USER_TYPE_PROTO ((*GB_user_type_f)) ;
 // is either zero (at the beginning), or a power of two (of size
 // GB_JITIFIER_INITIAL_SIZE or more).
 
+// The hash table is modified only inside the GB_jitifyer_worker critical
+// section, but GB_jitifyer_lookup can search it without the critical section
+// (see GB_jitifyer_load).  To allow this, GB_jitifyer_insert fills in each new
+// entry before it sets e->dl_function with an atomic write, and the lookup
+// reads e->dl_function with an atomic read.  When the table grows, the
+// new table is published before its larger GB_jit_table_bits, and
+// GB_jitifyer_lookup reads GB_jit_table_bits before GB_jit_table.  A reader
+// that sees the old bits and the new table may miss an entry, and then it
+// searches the table again inside the critical section.  The old table is not
+// freed, since a reader may still be searching it.  It is kept in
+// GB_jit_retired until no reader can still be using it (see
+// GB_jitifyer_reclaim), or until GrB_finalize.  Setting the JIT control to
+// GxB_JIT_OFF evicts all JIT kernels and retires the table in the same way,
+// so it can be done while other user threads are using GraphBLAS.
+
 // The strings are used to create filenames and JIT compilation commands.
 
 #ifdef GBCOVER
@@ -41,6 +60,21 @@ static uint64_t GB_jit_table_bits = 0 ;  // hash mask (0xFFFF if size is 2^16)
 static int64_t  GB_jit_table_populated = 0 ;
 static size_t   GB_jit_table_allocated = 0 ;
 
+// size of the largest table retired when the JIT was turned off.  A new table
+// is never smaller than this, so that the hash mask read by GB_jitifyer_find
+// is never too large for the table it reads next (see GB_jitifyer_insert).
+static int64_t  GB_jit_table_size_retired = 0 ;
+
+// old hash tables, no longer in use but perhaps still being read, until they
+// are freed by GB_jitifyer_reclaim.  If GB_JIT_RETIRED_MAX tables are still
+// waiting to be freed, the table is not rebuilt, and a new kernel is not added
+// to it (see GB_jitifyer_insert).
+#define GB_JIT_RETIRED_MAX 32
+static GB_jit_entry *GB_jit_retired [GB_JIT_RETIRED_MAX] ;
+static size_t   GB_jit_retired_allocated [GB_JIT_RETIRED_MAX] ;
+static int      GB_jit_nretired = 0 ;
+static int      GB_jit_nretired_old = 0 ;   // # retired in prior epochs
+
 static bool GB_jit_use_cmake =
     #if defined (_MSC_VER)
     true ;      // MSVC requires cmake
@@ -48,6 +82,12 @@ static bool GB_jit_use_cmake =
     false ;     // otherwise, default is to skip cmake and compile directly
     #endif
 
+// If GraphBLAS is compiled with libtcc, CPU kernels can be compiled inside the
+// user process (GxB_JIT_USE_LIBTCC), with no compiler or cmake.  This is off
+// by default, since tcc cannot compile all kernels (see
+// GB_jitifyer_libtcc_compile).
+static bool GB_jit_use_libtcc = false ;
+
 // path to user cache folder:
 static char    *GB_jit_cache_path = NULL ;
 static size_t   GB_jit_cache_path_allocated = 0 ;
@@ -56,6 +96,10 @@ static size_t   GB_jit_cache_path_allocated = 0 ;
 static char    *GB_jit_error_log = NULL ;
 static size_t   GB_jit_error_log_allocated = 0 ;
 
+// manifest file that records each kernel loaded (GxB_JIT_MANIFEST):
+static char    *GB_jit_manifest = NULL ;
+static size_t   GB_jit_manifest_allocated = 0 ;
+
 // name of the C compiler:
 static char    *GB_jit_C_compiler = NULL ;
 static size_t   GB_jit_C_compiler_allocated = 0 ;
@@ -64,6 +108,16 @@ static size_t   GB_jit_C_compiler_allocated = 0 ;
 static char    *GB_jit_C_flags = NULL ;
 static size_t   GB_jit_C_flags_allocated = 0 ;
 
+// C flags of the types, operators, and semiring of the kernel being compiled
+// (see GB_jitifyer_kernel_C_flags), appended to GB_jit_C_flags:
+static char    *GB_jit_kernel_C_flags = NULL ;
+static size_t   GB_jit_kernel_C_flags_allocated = 0 ;
+
+// object files of the operators of the kernel being compiled (see
+// GxB_JIT_C_OBJECT), each in single quotes, linked into the kernel:
+static char    *GB_jit_kernel_C_objects = NULL ;
+static size_t   GB_jit_kernel_C_objects_allocated = 0 ;
+
 // link flags for the C compiler:
 static char    *GB_jit_C_link_flags = NULL ;
 static size_t   GB_jit_C_link_flags_allocated = 0 ;
@@ -88,6 +142,31 @@ static size_t   GB_jit_CUDA_preface_allocated = 0 ;
 static char    *GB_jit_temp = NULL ;
 static size_t   GB_jit_temp_allocated = 0 ;
 
+// bundles of JIT kernels, each in a single library (GxB_JIT_pack), loaded
+// from the cache or by GxB_JIT_register.  The bundled kernels are held in the
+// hash table as unchecked kernels, just like the PreJIT kernels.  Their
+// prejit_index is GB_jit_bundle_offset (the # of PreJIT kernels) plus their
+// position in GB_jit_bundle_queries, which holds the query functions of the
+// kernels from all bundles.
+static void   **GB_jit_bundle_handles = NULL ;
+static size_t   GB_jit_bundle_handles_allocated = 0 ;
+static int32_t  GB_jit_nbundles = 0 ;
+static void   **GB_jit_bundle_queries = NULL ;
+static size_t   GB_jit_bundle_queries_allocated = 0 ;
+static int32_t  GB_jit_bundle_nqueries = 0 ;
+static int32_t  GB_jit_bundle_offset = 0 ;
+static bool     GB_jit_cache_bundle_loaded = false ;
+
+// kernels being compiled in the background (GxB_JIT_ASYNC).  If the compiler
+// fails, the background process writes its exit status to a *.status file.
+// If neither the lib*.so file nor the *.status file appears within
+// GB_JIT_ASYNC_TIMEOUT seconds, the compilation is assumed to have failed.
+#define GB_JIT_ASYNC_TIMEOUT 600
+static GB_jit_entry *GB_jit_pending = NULL ;
+static int64_t  GB_jit_pending_n = 0 ;      // # of kernels being compiled
+static int64_t  GB_jit_pending_size = 0 ;   // size of GB_jit_pending array
+static size_t   GB_jit_pending_allocated = 0 ;
+
 // compile with -DJITINIT=4 (for example) to set the initial JIT C control
 #ifdef JITINIT
 #define GB_JIT_C_CONTROL_INIT JITINIT
@@ -98,6 +177,80 @@ static size_t   GB_jit_temp_allocated = 0 ;
 
 static GxB_JIT_Control GB_jit_control = GB_JIT_C_CONTROL_INIT ;
 
+// JIT kernel profile (GxB_JIT_PROFILE): the # of calls and run time of each
+// kernel are kept in its hash table entry, and the # of generic kernels used
+// in place of a JIT kernel are counted for each family.
+static bool     GB_jit_profile = false ;
+#define GB_JIT_NFAMILIES 10
+static int64_t  GB_jit_generic_calls [GB_JIT_NFAMILIES] ;
+static char    *GB_jit_profile_report = NULL ;
+static size_t   GB_jit_profile_report_allocated = 0 ;
+
+// limits on the # of JIT kernels loaded (GxB_JIT_MAX_LOADED) and the size of
+// the JIT cache folder (GxB_JIT_CACHE_MAX_SIZE); zero means no limit.  When
+// too many kernels are loaded, the least recently used ones are evicted from
+// the hash table.  They are kept in GB_jit_evicted, and unloaded once no user
+// thread can still be using them.  Retired hash tables are freed in the same
+// way (see GB_jitifyer_reclaim).
+static int64_t  GB_jit_max_loaded = 0 ;
+static int64_t  GB_jit_cache_max_size = 0 ;
+static int64_t  GB_jit_nloaded = 0 ;        // # of kernels that can be evicted
+static int64_t  GB_jit_clock = 0 ;          // LRU clock
+static int64_t  GB_jit_epoch = 0 ;          // current epoch
+static int64_t  GB_jit_nusers [2] ;         // # of kernels in use, for even
+                                            // and odd epochs
+static GB_jit_entry *GB_jit_evicted = NULL ;
+static int64_t  GB_jit_nevicted = 0 ;
+static int64_t  GB_jit_nevicted_old = 0 ;   // # evicted in prior epochs
+static int64_t  GB_jit_evicted_size = 0 ;
+static size_t   GB_jit_evicted_allocated = 0 ;
+static bool     GB_jit_reclaim_pending = false ;
+
+// GB_jit_slots: the epochs of the kernels in use by this user thread (one bit
+// each, most recent in the lowest bit).  A user thread can use more than one
+// kernel at a time only if a kernel calls GraphBLAS itself, so 64 is ample.
+
+#if defined ( _OPENMP )
+
+    // OpenMP threadprivate is preferred
+    static uint64_t GB_jit_slots = 0 ;
+    #pragma omp threadprivate (GB_jit_slots)
+
+#elif defined ( HAVE_KEYWORD__THREAD )
+
+    // gcc and many other compilers support the __thread keyword
+    static __thread uint64_t GB_jit_slots = 0 ;
+
+#elif defined ( HAVE_KEYWORD__DECLSPEC_THREAD )
+
+    // Windows: __declspec (thread)
+    static __declspec ( thread ) uint64_t GB_jit_slots = 0 ;
+
+#elif defined ( HAVE_KEYWORD__THREAD_LOCAL )
+
+    // C11 threads
+    #include <threads.h>
+    static _Thread_local uint64_t GB_jit_slots = 0 ;
+
+#else
+
+    // no thread-local storage: the epoch never advances, and evicted kernels
+    // and retired tables are freed only when no kernel is in use at all
+    #define GB_JIT_NO_EPOCHS
+
+#endif
+
+// JIT kernels for C=A*B where C has no more than GB_jit_specialize_dim rows
+// (GxB_JIT_SPECIALIZE_DIM) are compiled for that exact number of rows.  Zero
+// means no kernel is specialized.
+static int32_t  GB_jit_specialize_dim = 0 ;
+
+static inline void GB_jitifyer_acquire (void) ;
+static void GB_jitifyer_reclaim (bool force) ;
+static void GB_jitifyer_evict (void) ;
+static bool GB_jitifyer_evict_entry (GB_jit_entry *e) ;
+static void GB_jitifyer_cache_trim (void) ;
+
 //------------------------------------------------------------------------------
 // check_table: check if the hash table is OK
 //------------------------------------------------------------------------------
@@ -210,16 +363,23 @@ static void check_table (void)
 void GB_jitifyer_finalize (void)
 { 
     GB_jitifyer_table_free (true) ;
+    GB_jitifyer_bundle_free ( ) ;
     GB_FREE_STUFF (GB_jit_cache_path) ;
     GB_FREE_STUFF (GB_jit_error_log) ;
+    GB_FREE_STUFF (GB_jit_manifest) ;
     GB_FREE_STUFF (GB_jit_C_compiler) ;
     GB_FREE_STUFF (GB_jit_C_flags) ;
+    GB_FREE_STUFF (GB_jit_kernel_C_flags) ;
+    GB_FREE_STUFF (GB_jit_kernel_C_objects) ;
     GB_FREE_STUFF (GB_jit_C_link_flags) ;
     GB_FREE_STUFF (GB_jit_C_libraries) ;
     GB_FREE_STUFF (GB_jit_C_cmake_libs) ;
     GB_FREE_STUFF (GB_jit_C_preface) ;
     GB_FREE_STUFF (GB_jit_CUDA_preface) ;
     GB_FREE_STUFF (GB_jit_temp) ;
+    GB_FREE_STUFF (GB_jit_profile_report) ;
+    GB_FREE_STUFF (GB_jit_evicted) ;
+    GB_jit_evicted_size = 0 ;
 }
 
 //------------------------------------------------------------------------------
@@ -270,6 +430,239 @@ void GB_jitifyer_sanitize (char *string, size_t len)
     }
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_kcode and GB_jitifyer_kname: convert between kname and kcode
+//------------------------------------------------------------------------------
+
+// The kname of each kernel appears in its kernel_name.  The scode of the
+// kernel_name is printed with the # of hexadecimal digits for its family.
+
+static const char *GB_jit_family_names [GB_JIT_NFAMILIES] = { "none",
+    "reduce", "mxm", "ewise", "apply", "build", "select", "user_op",
+    "user_type", "assign" } ;
+
+static const int GB_jit_scode_digits [GB_JIT_NFAMILIES] =
+    { 0, 7, 16, 13, 10, 7, 10, 1, 1, 12 } ;
+
+static const struct
+{
+    const char *kname ;
+    GB_jit_kcode kcode ;
+    GB_jit_family family ;
+}
+GB_jit_knames [ ] =
+{
+    { "add", GB_JIT_KERNEL_ADD, GB_jit_ewise_family },
+    { "apply_bind1st", GB_JIT_KERNEL_APPLYBIND1, GB_jit_ewise_family },
+    { "apply_bind2nd", GB_JIT_KERNEL_APPLYBIND2, GB_jit_ewise_family },
+    { "apply_unop", GB_JIT_KERNEL_APPLYUNOP, GB_jit_apply_family },
+    { "AxB_dot2", GB_JIT_KERNEL_AXB_DOT2, GB_jit_mxm_family },
+    { "AxB_dot2n", GB_JIT_KERNEL_AXB_DOT2N, GB_jit_mxm_family },
+    { "AxB_dot3", GB_JIT_KERNEL_AXB_DOT3, GB_jit_mxm_family },
+    { "AxB_dot3_reduce", GB_JIT_KERNEL_AXB_DOT3_REDUCE, GB_jit_mxm_family },
+    { "AxB_dot3_rowreduce", GB_JIT_KERNEL_AXB_DOT3_ROWREDUCE,
+        GB_jit_mxm_family },
+    { "AxB_dot2_fine", GB_JIT_KERNEL_AXB_DOT2_FINE, GB_jit_mxm_family },
+    { "AxB_dot4", GB_JIT_KERNEL_AXB_DOT4, GB_jit_mxm_family },
+    { "AxB_saxbit", GB_JIT_KERNEL_AXB_SAXBIT, GB_jit_mxm_family },
+    { "AxB_saxpy3", GB_JIT_KERNEL_AXB_SAXPY3, GB_jit_mxm_family },
+    { "AxB_saxpy4", GB_JIT_KERNEL_AXB_SAXPY4, GB_jit_mxm_family },
+    { "AxB_saxpy5", GB_JIT_KERNEL_AXB_SAXPY5, GB_jit_mxm_family },
+    { "build", GB_JIT_KERNEL_BUILD, GB_jit_build_family },
+    { "colscale", GB_JIT_KERNEL_COLSCALE, GB_jit_ewise_family },
+    { "concat_bitmap", GB_JIT_KERNEL_CONCAT_BITMAP, GB_jit_apply_family },
+    { "concat_full", GB_JIT_KERNEL_CONCAT_FULL, GB_jit_apply_family },
+    { "concat_sparse", GB_JIT_KERNEL_CONCAT_SPARSE, GB_jit_apply_family },
+    { "convert_s2b", GB_JIT_KERNEL_CONVERTS2B, GB_jit_apply_family },
+    { "emult_02", GB_JIT_KERNEL_EMULT2, GB_jit_ewise_family },
+    { "emult_03", GB_JIT_KERNEL_EMULT3, GB_jit_ewise_family },
+    { "emult_04", GB_JIT_KERNEL_EMULT4, GB_jit_ewise_family },
+    { "emult_08", GB_JIT_KERNEL_EMULT8, GB_jit_ewise_family },
+    { "emult_bitmap", GB_JIT_KERNEL_EMULT_BITMAP, GB_jit_ewise_family },
+    { "ewise_fulla", GB_JIT_KERNEL_EWISEFA, GB_jit_ewise_family },
+    { "ewise_fulln", GB_JIT_KERNEL_EWISEFN, GB_jit_ewise_family },
+    { "reduce", GB_JIT_KERNEL_REDUCE, GB_jit_reduce_family },
+    { "rowscale", GB_JIT_KERNEL_ROWSCALE, GB_jit_ewise_family },
+    { "select_bitmap", GB_JIT_KERNEL_SELECT_BITMAP, GB_jit_select_family },
+    { "select_phase1", GB_JIT_KERNEL_SELECT1, GB_jit_select_family },
+    { "select_phase2", GB_JIT_KERNEL_SELECT2, GB_jit_select_family },
+    { "split_bitmap", GB_JIT_KERNEL_SPLIT_BITMAP, GB_jit_apply_family },
+    { "split_full", GB_JIT_KERNEL_SPLIT_FULL, GB_jit_apply_family },
+    { "split_sparse", GB_JIT_KERNEL_SPLIT_SPARSE, GB_jit_apply_family },
+    { "subassign_05d", GB_JIT_KERNEL_SUBASSIGN_05d, GB_jit_assign_family },
+    { "subassign_06d", GB_JIT_KERNEL_SUBASSIGN_06d, GB_jit_assign_family },
+    { "subassign_22", GB_JIT_KERNEL_SUBASSIGN_22, GB_jit_assign_family },
+    { "subassign_23", GB_JIT_KERNEL_SUBASSIGN_23, GB_jit_assign_family },
+    { "subassign_25", GB_JIT_KERNEL_SUBASSIGN_25, GB_jit_assign_family },
+    { "trans_bind1st", GB_JIT_KERNEL_TRANSBIND1, GB_jit_ewise_family },
+    { "trans_bind2nd", GB_JIT_KERNEL_TRANSBIND2, GB_jit_ewise_family },
+    { "trans_unop", GB_JIT_KERNEL_TRANSUNOP, GB_jit_apply_family },
+    { "union", GB_JIT_KERNEL_UNION, GB_jit_ewise_family },
+    { "user_op", GB_JIT_KERNEL_USEROP, GB_jit_user_op_family },
+    { "user_type", GB_JIT_KERNEL_USERTYPE, GB_jit_user_type_family },
+    { "cuda_reduce", GB_JIT_CUDA_KERNEL_REDUCE, GB_jit_reduce_family },
+} ;
+
+#define GB_JIT_NKNAMES (sizeof (GB_jit_knames) / sizeof (GB_jit_knames [0]))
+
+static GB_jit_kcode GB_jitifyer_kcode
+(
+    char *kname,            // kname; the fixed dimension is removed, if any
+    uint32_t *dim           // fixed dimension of the kernel (0 if none)
+)
+{
+    // A kernel compiled for a fixed dimension has a kname of the form
+    // kname_d16 (see GB_macrofy_name).
+    (*dim) = 0 ;
+    char *p = strrchr (kname, '_') ;
+    if (p != NULL && p [1] == 'd' && p [2] >= '0' && p [2] <= '9')
+    {
+        char *p_end = NULL ;
+        unsigned long d = strtoul (p+2, &p_end, 10) ;
+        if (p_end != NULL && (*p_end) == '\0' && d > 0 &&
+            d <= GB_JIT_SPECIALIZE_DIM_MAX)
+        { 
+            (*dim) = (uint32_t) d ;
+            (*p) = '\0' ;
+        }
+    }
+
+    for (int k = 0 ; k < GB_JIT_NKNAMES ; k++)
+    {
+        if (GB_STRING_MATCH (kname, GB_jit_knames [k].kname))
+        { 
+            return (GB_jit_knames [k].kcode) ;
+        }
+    }
+    return (GB_JIT_KERNEL_NONE) ;
+}
+
+static const char *GB_jitifyer_kname (GB_jit_kcode kcode, int *scode_digits)
+{
+    for (int k = 0 ; k < GB_JIT_NKNAMES ; k++)
+    {
+        if (GB_jit_knames [k].kcode == kcode)
+        { 
+            (*scode_digits) = GB_jit_scode_digits [GB_jit_knames [k].family] ;
+            return (GB_jit_knames [k].kname) ;
+        }
+    }
+    (*scode_digits) = 16 ;
+    return ("unknown") ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_register_kernel: add an unchecked kernel to the hash table
+//------------------------------------------------------------------------------
+
+// The kernel is a PreJIT kernel, or a kernel from a bundle of JIT kernels
+// (see GB_jitifyer_bundle_register).  The kernel_name is parsed to find its
+// encoding, and the query function provides its hash.  Kernels that have an
+// invalid name, are stale, or already appear in the hash table are ignored.
+// The kernel is checked the first time it is used.  Returns false only if
+// out of memory.
+
+static bool GB_jitifyer_register_kernel
+(
+    const char *name,           // name of the kernel
+    void *dl_function,          // the kernel itself
+    GB_jit_query_func dl_query, // its query function
+    int32_t k                   // prejit_index of the kernel
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the name of the kernel
+    //--------------------------------------------------------------------------
+
+    char kernel_name [GB_KLEN+1] ;
+    strncpy (kernel_name, name, GB_KLEN) ;
+    kernel_name [GB_KLEN] = '\0' ;
+
+    //--------------------------------------------------------------------------
+    // parse the kernel name
+    //--------------------------------------------------------------------------
+
+    char *name_space = NULL ;
+    char *kname = NULL ;
+    uint64_t scode = 0 ;
+    char *suffix = NULL ;
+    GrB_Info info = GB_demacrofy_name (kernel_name, &name_space, &kname,
+        &scode, &suffix) ;
+
+    if (info != GrB_SUCCESS || !GB_STRING_MATCH (name_space, "GB_jit"))
+    {
+        // kernel_name is invalid; ignore this kernel
+        return (true) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the kcode of the kname
+    //--------------------------------------------------------------------------
+
+    GB_jit_encoding encoding_struct ;
+    GB_jit_encoding *encoding = &encoding_struct ;
+    memset (encoding, 0, sizeof (GB_jit_encoding)) ;
+
+    uint32_t dim ;
+    GB_jit_kcode c = GB_jitifyer_kcode (kname, &dim) ;
+    if (c == GB_JIT_KERNEL_NONE)
+    {
+        // kernel_name is invalid; ignore this kernel
+        return (true) ;
+    }
+
+    encoding->kcode = c ;
+    encoding->dim = dim ;
+    encoding->code = scode ;
+    encoding->suffix_len = (int32_t) GB_STRLEN (suffix) ;
+
+    //--------------------------------------------------------------------------
+    // get the hash of this kernel
+    //--------------------------------------------------------------------------
+
+    // Query the kernel for its hash and version number.  The hash is
+    // needed now so the kernel can be added to the hash table.
+
+    // The type/op definitions and monoid id/term values for user-defined
+    // types/ops/ monoids are ignored, because the user-defined objects
+    // may not yet have been created during this use of GraphBLAS (this
+    // method is called by GrB_init, or when the cache path is set).  These
+    // definitions are checked the first time the kernel is run.
+
+    uint64_t hash = 0 ;
+    const char *ignored [5] ;
+    int version [3] ;
+    (void) dl_query (&hash, version, ignored, NULL, NULL, 0, 0) ;
+
+    if (hash == 0 || hash == UINT64_MAX ||
+        (version [0] != GxB_IMPLEMENTATION_MAJOR) ||
+        (version [1] != GxB_IMPLEMENTATION_MINOR) ||
+        (version [2] != GxB_IMPLEMENTATION_SUB))
+    {
+        // the kernel is stale; ignore it
+        return (true) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // make sure this kernel is not a duplicate
+    //--------------------------------------------------------------------------
+
+    int64_t k1 = -1, kk = -1 ;
+    if (GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) != NULL)
+    {
+        // the kernel is a duplicate; ignore it
+        return (true) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // insert the kernel in the hash table
+    //--------------------------------------------------------------------------
+
+    return (GB_jitifyer_insert (hash, encoding, suffix, NULL, dl_function,
+        k)) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_init: initialize the JIT folders, flags, etc
 //------------------------------------------------------------------------------
@@ -290,7 +683,7 @@ GrB_Info GB_jitifyer_init (void)
     control = GB_IMAX (control, (int) GxB_JIT_OFF) ;
     #ifndef NJIT
     // The full JIT is available.
-    control = GB_IMIN (control, (int) GxB_JIT_ON) ;
+    control = GB_IMIN (control, (int) GxB_JIT_ASYNC) ;
     #else
     // The JIT is restricted; only OFF, PAUSE, and RUN settings can be
     // used.  No JIT kernels can be loaded or compiled.  Only PreJIT kernels
@@ -358,6 +751,7 @@ GrB_Info GB_jitifyer_init (void)
     //--------------------------------------------------------------------------
 
     GB_COPY_STUFF (GB_jit_error_log,    "") ;
+    GB_COPY_STUFF (GB_jit_manifest,     "") ;
     GB_COPY_STUFF (GB_jit_C_compiler,   GB_C_COMPILER) ;
     GB_COPY_STUFF (GB_jit_C_flags,      GB_C_FLAGS) ;
     GB_COPY_STUFF (GB_jit_C_link_flags, GB_C_LINK_FLAGS) ;
@@ -411,145 +805,11 @@ GrB_Info GB_jitifyer_init (void)
 
     for (int k = 0 ; k < nkernels ; k++)
     {
-
-        //----------------------------------------------------------------------
-        // get the name and function pointer of the PreJIT kernel
-        //----------------------------------------------------------------------
-
-        void *dl_function = Kernels [k] ;
-        GB_jit_query_func dl_query = (GB_jit_query_func) Queries [k] ;
-        ASSERT (dl_function != NULL && dl_query != NULL && Names [k] != NULL) ;
-        char kernel_name [GB_KLEN+1] ;
-        strncpy (kernel_name, Names [k], GB_KLEN) ;
-        kernel_name [GB_KLEN] = '\0' ;
-
-        //----------------------------------------------------------------------
-        // parse the kernel name
-        //----------------------------------------------------------------------
-
-        char *name_space = NULL ;
-        char *kname = NULL ;
-        uint64_t scode = 0 ;
-        char *suffix = NULL ;
-        GrB_Info info = GB_demacrofy_name (kernel_name, &name_space, &kname,
-            &scode, &suffix) ;
-
-        if (info != GrB_SUCCESS || !GB_STRING_MATCH (name_space, "GB_jit"))
-        {
-            // PreJIT error: kernel_name is invalid; ignore this kernel
-            continue ;
-        }
-
-        //----------------------------------------------------------------------
-        // find the kcode of the kname
-        //----------------------------------------------------------------------
-
-        GB_jit_encoding encoding_struct ;
-        GB_jit_encoding *encoding = &encoding_struct ;
-        memset (encoding, 0, sizeof (GB_jit_encoding)) ;
-
-        #define IS(kernel) GB_STRING_MATCH (kname, kernel)
-
-        GB_jit_kcode c = 0 ;
-        if      (IS ("add"          )) c = GB_JIT_KERNEL_ADD ;
-        else if (IS ("apply_bind1st")) c = GB_JIT_KERNEL_APPLYBIND1 ;
-        else if (IS ("apply_bind2nd")) c = GB_JIT_KERNEL_APPLYBIND2 ;
-        else if (IS ("apply_unop"   )) c = GB_JIT_KERNEL_APPLYUNOP ;
-        else if (IS ("AxB_dot2"     )) c = GB_JIT_KERNEL_AXB_DOT2 ;
-        else if (IS ("AxB_dot2n"    )) c = GB_JIT_KERNEL_AXB_DOT2N ;
-        else if (IS ("AxB_dot3"     )) c = GB_JIT_KERNEL_AXB_DOT3 ;
-        else if (IS ("AxB_dot4"     )) c = GB_JIT_KERNEL_AXB_DOT4 ;
-        else if (IS ("AxB_saxbit"   )) c = GB_JIT_KERNEL_AXB_SAXBIT ;
-        else if (IS ("AxB_saxpy3"   )) c = GB_JIT_KERNEL_AXB_SAXPY3 ;
-        else if (IS ("AxB_saxpy4"   )) c = GB_JIT_KERNEL_AXB_SAXPY4 ;
-        else if (IS ("AxB_saxpy5"   )) c = GB_JIT_KERNEL_AXB_SAXPY5 ;
-        else if (IS ("build"        )) c = GB_JIT_KERNEL_BUILD ;
-        else if (IS ("colscale"     )) c = GB_JIT_KERNEL_COLSCALE ;
-        else if (IS ("concat_bitmap")) c = GB_JIT_KERNEL_CONCAT_BITMAP ;
-        else if (IS ("concat_full"  )) c = GB_JIT_KERNEL_CONCAT_FULL ;
-        else if (IS ("concat_sparse")) c = GB_JIT_KERNEL_CONCAT_SPARSE ;
-        else if (IS ("convert_s2b"  )) c = GB_JIT_KERNEL_CONVERTS2B ;
-        else if (IS ("emult_02"     )) c = GB_JIT_KERNEL_EMULT2 ;
-        else if (IS ("emult_03"     )) c = GB_JIT_KERNEL_EMULT3 ;
-        else if (IS ("emult_04"     )) c = GB_JIT_KERNEL_EMULT4 ;
-        else if (IS ("emult_08"     )) c = GB_JIT_KERNEL_EMULT8 ;
-        else if (IS ("emult_bitmap" )) c = GB_JIT_KERNEL_EMULT_BITMAP ;
-        else if (IS ("ewise_fulla"  )) c = GB_JIT_KERNEL_EWISEFA ;
-        else if (IS ("ewise_fulln"  )) c = GB_JIT_KERNEL_EWISEFN ;
-        else if (IS ("reduce"       )) c = GB_JIT_KERNEL_REDUCE ;
-        else if (IS ("rowscale"     )) c = GB_JIT_KERNEL_ROWSCALE ;
-        else if (IS ("select_bitmap")) c = GB_JIT_KERNEL_SELECT_BITMAP ;
-        else if (IS ("select_phase1")) c = GB_JIT_KERNEL_SELECT1 ;
-        else if (IS ("select_phase2")) c = GB_JIT_KERNEL_SELECT2 ;
-        else if (IS ("split_bitmap" )) c = GB_JIT_KERNEL_SPLIT_BITMAP ;
-        else if (IS ("split_full"   )) c = GB_JIT_KERNEL_SPLIT_FULL ;
-        else if (IS ("split_sparse" )) c = GB_JIT_KERNEL_SPLIT_SPARSE ;
-        else if (IS ("subassign_05d")) c = GB_JIT_KERNEL_SUBASSIGN_05d ;
-        else if (IS ("subassign_06d")) c = GB_JIT_KERNEL_SUBASSIGN_06d ;
-        else if (IS ("subassign_22" )) c = GB_JIT_KERNEL_SUBASSIGN_22 ;
-        else if (IS ("subassign_23" )) c = GB_JIT_KERNEL_SUBASSIGN_23 ;
-        else if (IS ("subassign_25" )) c = GB_JIT_KERNEL_SUBASSIGN_25 ;
-        else if (IS ("trans_bind1st")) c = GB_JIT_KERNEL_TRANSBIND1 ;
-        else if (IS ("trans_bind2nd")) c = GB_JIT_KERNEL_TRANSBIND2 ;
-        else if (IS ("trans_unop"   )) c = GB_JIT_KERNEL_TRANSUNOP ;
-        else if (IS ("union"        )) c = GB_JIT_KERNEL_UNION ;
-        else if (IS ("user_op"      )) c = GB_JIT_KERNEL_USEROP ;
-        else if (IS ("user_type"    )) c = GB_JIT_KERNEL_USERTYPE ;
-        else if (IS ("cuda_reduce"  )) c = GB_JIT_CUDA_KERNEL_REDUCE ;
-        else
-        {
-            // PreJIT error: kernel_name is invalid; ignore this kernel
-            continue ;
-        }
-
-        #undef IS
-        encoding->kcode = c ;
-        encoding->code = scode ;
-        encoding->suffix_len = (int32_t) GB_STRLEN (suffix) ;
-
-        //----------------------------------------------------------------------
-        // get the hash of this PreJIT kernel
-        //----------------------------------------------------------------------
-
-        // Query the kernel for its hash and version number.  The hash is
-        // needed now so the PreJIT kernel can be added to the hash table.
-
-        // The type/op definitions and monoid id/term values for user-defined
-        // types/ops/ monoids are ignored, because the user-defined objects
-        // have not yet been created during this use of GraphBLAS (this method
-        // is called by GrB_init).  These definitions are checked the first
-        // time the kernel is run.
-
-        uint64_t hash = 0 ;
-        const char *ignored [5] ;
-        int version [3] ;
-        (void) dl_query (&hash, version, ignored, NULL, NULL, 0, 0) ;
-
-        if (hash == 0 || hash == UINT64_MAX ||
-            (version [0] != GxB_IMPLEMENTATION_MAJOR) ||
-            (version [1] != GxB_IMPLEMENTATION_MINOR) ||
-            (version [2] != GxB_IMPLEMENTATION_SUB))
-        {
-            // PreJIT error: the kernel is stale; ignore it
-            continue ;
-        }
-
-        //----------------------------------------------------------------------
-        // make sure this kernel is not a duplicate
-        //----------------------------------------------------------------------
-
-        int64_t k1 = -1, kk = -1 ;
-        if (GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) != NULL)
-        {
-            // PreJIT error: the kernel is a duplicate; ignore it
-            continue ;
-        }
-
-        //----------------------------------------------------------------------
-        // insert the PreJIT kernel in the hash table
-        //----------------------------------------------------------------------
-
-        if (!GB_jitifyer_insert (hash, encoding, suffix, NULL, dl_function, k))
+        // add the PreJIT kernel to the hash table, as an unchecked kernel
+        ASSERT (Kernels [k] != NULL && Queries [k] != NULL) ;
+        ASSERT (Names [k] != NULL) ;
+        if (!GB_jitifyer_register_kernel (Names [k], Kernels [k],
+            (GB_jit_query_func) Queries [k], k))
         {
             // PreJIT error: out of memory
             GB_jit_control = GxB_JIT_PAUSE ;
@@ -557,6 +817,16 @@ GrB_Info GB_jitifyer_init (void)
         }
     }
 
+    //--------------------------------------------------------------------------
+    // load the bundle of JIT kernels from the cache, if it exists
+    //--------------------------------------------------------------------------
+
+    GB_jit_bundle_offset = nkernels ;
+    if (GB_jit_control >= GxB_JIT_LOAD)
+    {
+        OK (GB_jitifyer_bundle_load ( )) ;
+    }
+
     //--------------------------------------------------------------------------
     // uncompress all the source files into the user source folder
     //--------------------------------------------------------------------------
@@ -809,7 +1079,7 @@ void GB_jitifyer_set_control (int control)
         control = GB_IMAX (control, (int) GxB_JIT_OFF) ;
         #ifndef NJIT
         // The full JIT is available.
-        control = GB_IMIN (control, (int) GxB_JIT_ON) ;
+        control = GB_IMIN (control, (int) GxB_JIT_ASYNC) ;
         #else
         // The JIT is restricted; only OFF, PAUSE, and RUN settings can be
         // used.  No JIT kernels can be loaded or compiled.
@@ -818,8 +1088,8 @@ void GB_jitifyer_set_control (int control)
         GB_jit_control = (GxB_JIT_Control) control ;
         if (GB_jit_control == GxB_JIT_OFF)
         { 
-            // free all loaded JIT kernels but do not free the JIT hash table,
-            // and do not free the PreJIT kernels
+            // evict all loaded JIT kernels, and flag the PreJIT kernels as
+            // unchecked; they are unloaded once no user thread is using them
             GB_jitifyer_table_free (false) ;
         }
     }
@@ -857,9 +1127,11 @@ GrB_Info GB_jitifyer_alloc_space (void)
     size_t len =
         2 * GB_jit_C_compiler_allocated +
         2 * GB_jit_C_flags_allocated +
+        2 * GB_jit_kernel_C_flags_allocated +
+        GB_jit_kernel_C_objects_allocated +
         GB_jit_C_link_flags_allocated +
         strlen (GB_OMP_INC) +
-        5 * GB_jit_cache_path_allocated + 7 * GB_KLEN +
+        14 * GB_jit_cache_path_allocated + 14 * GB_KLEN +
         GB_jit_C_libraries_allocated +
         GB_jit_C_cmake_libs_allocated +
         GB_jit_error_log_allocated +
@@ -932,6 +1204,8 @@ GrB_Info GB_jitifyer_set_cache_path_worker (const char *new_cache_path)
     OK (GB_jitifyer_alloc_space ( )) ;
     // set the src path and make sure cache and src paths are accessible
     OK (GB_jitifyer_establish_paths (GrB_INVALID_VALUE)) ;
+    // load the bundle of JIT kernels, if not yet loaded
+    OK (GB_jitifyer_bundle_load ( )) ;
     // uncompress all the source files into the user source folder
     return (GB_jitifyer_extract_JITpackage (GrB_INVALID_VALUE)) ;
 }
@@ -988,6 +1262,73 @@ GrB_Info GB_jitifyer_set_error_log_worker (const char *new_error_log)
     return (GB_jitifyer_alloc_space ( )) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_manifest: return the current manifest file
+//------------------------------------------------------------------------------
+
+const char *GB_jitifyer_get_manifest (void)
+{ 
+    const char *s ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        s = GB_jit_manifest ;
+    }
+    return (s) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_manifest: set a new manifest file
+//------------------------------------------------------------------------------
+
+// If the new_manifest is NULL or the empty string, no manifest is recorded.
+// Otherwise, the file is created (or truncated if it already exists), and
+// each JIT kernel subsequently loaded is appended to it; see
+// GB_jitifyer_record.
+
+GrB_Info GB_jitifyer_set_manifest (const char *new_manifest)
+{ 
+
+    //--------------------------------------------------------------------------
+    // set the manifest file in a critical section
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        info = GB_jitifyer_set_manifest_worker
+            ((new_manifest == NULL) ? "" : new_manifest) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_manifest_worker: set manifest file in a critical section
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jitifyer_set_manifest_worker (const char *new_manifest)
+{ 
+    // free the old manifest file
+    GB_FREE_STUFF (GB_jit_manifest) ;
+    // allocate the new GB_jit_manifest
+    GB_COPY_STUFF (GB_jit_manifest, new_manifest) ;
+    // sanitize the manifest file name
+    GB_jitifyer_sanitize (GB_jit_manifest, GB_jit_manifest_allocated) ;
+    if (GB_STRLEN (GB_jit_manifest) > 0)
+    {
+        // create the manifest, or truncate it if it already exists
+        FILE *fp = fopen (GB_jit_manifest, "w") ;
+        if (fp == NULL)
+        { 
+            // unable to create the manifest: do not record one
+            GB_FREE_STUFF (GB_jit_manifest) ;
+            GB_COPY_STUFF (GB_jit_manifest, "") ;
+            return (GrB_INVALID_VALUE) ;
+        }
+        fclose (fp) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_get_C_compiler: return the current C compiler
 //------------------------------------------------------------------------------
@@ -1248,98 +1589,316 @@ void GB_jitifyer_set_use_cmake (bool use_cmake)
 }
 
 //------------------------------------------------------------------------------
-// GB_jitifyer_get_C_cmake_libs: return the current cmake libs
+// GB_jitifyer_get_use_libtcc: return true/false if libtcc is in use
 //------------------------------------------------------------------------------
 
-const char *GB_jitifyer_get_C_cmake_libs (void)
+bool GB_jitifyer_get_use_libtcc (void)
 { 
-    const char *s ;
+    bool use_libtcc ;
     #pragma omp critical (GB_jitifyer_worker)
     {
-        s = GB_jit_C_cmake_libs ;
+        use_libtcc = GB_jit_use_libtcc ;
     }
-    return (s) ;
+    return (use_libtcc) ;
 }
 
 //------------------------------------------------------------------------------
-// GB_jitifyer_set_C_cmake_libs: set new cmake libs
+// GB_jitifyer_set_use_libtcc: set controls true/false to use libtcc
 //------------------------------------------------------------------------------
 
-GrB_Info GB_jitifyer_set_C_cmake_libs (const char *new_cmake_libs)
-{ 
-
-    //--------------------------------------------------------------------------
-    // check inputs
-    //--------------------------------------------------------------------------
-
-    if (new_cmake_libs == NULL)
-    { 
-        return (GrB_NULL_POINTER) ;
-    }
-
-    //--------------------------------------------------------------------------
-    // set the cmake libs in a critical section
-    //--------------------------------------------------------------------------
+// libtcc can only be used if GraphBLAS was compiled with it.  If not, the
+// kernels are always compiled with the C compiler or with cmake.
 
-    GrB_Info info ;
+GrB_Info GB_jitifyer_set_use_libtcc (bool use_libtcc)
+{ 
+    #if defined ( GRAPHBLAS_HAS_LIBTCC )
     #pragma omp critical (GB_jitifyer_worker)
     {
-        info = GB_jitifyer_set_C_cmake_libs_worker (new_cmake_libs) ;
+        GB_jit_use_libtcc = use_libtcc ;
     }
-    return (info) ;
+    return (GrB_SUCCESS) ;
+    #else
+    return (use_libtcc ? GrB_NOT_IMPLEMENTED : GrB_SUCCESS) ;
+    #endif
 }
 
+static GB_jit_entry *GB_jitifyer_find
+(
+    uint64_t hash,
+    GB_jit_encoding *encoding,
+    const char *suffix,
+    void **dl_function,
+    GB_jit_entry **table_handle
+) ;
+
 //------------------------------------------------------------------------------
-// GB_jitifyer_set_C_cmake_libs_worker: set cmake libs in a critical section
+// GB_jitifyer_get_profile: return true if the JIT profile is enabled
 //------------------------------------------------------------------------------
 
-GrB_Info GB_jitifyer_set_C_cmake_libs_worker (const char *new_cmake_libs)
+// This is called for each JIT kernel call (see GB_JIT_CALL), so it does not
+// use the critical section.
+
+bool GB_jitifyer_get_profile (void)
 { 
-    // free the old C_cmake_libs string
-    GB_FREE_STUFF (GB_jit_C_cmake_libs) ;
-    // allocate the new GB_jit_C_cmake_libs
-    GB_COPY_STUFF (GB_jit_C_cmake_libs, new_cmake_libs) ;
-    // allocate workspace
-    return (GB_jitifyer_alloc_space ( )) ;
+    bool profile ;
+    GB_ATOMIC_READ
+    profile = GB_jit_profile ;
+    return (profile) ;
 }
 
 //------------------------------------------------------------------------------
-// GB_jitifyer_get_C_preface: return the current C preface
+// GB_jitifyer_set_profile: enable/disable the JIT profile, and clear it
 //------------------------------------------------------------------------------
 
-const char *GB_jitifyer_get_C_preface (void)
+// The # of calls and run time of each kernel, and the counts of generic
+// kernels, are cleared.  The load time of each kernel is kept.
+
+void GB_jitifyer_set_profile (bool profile)
 { 
-    const char *s ;
     #pragma omp critical (GB_jitifyer_worker)
     {
-        s = GB_jit_C_preface ;
+        for (int64_t k = 0 ; k < GB_jit_table_size ; k++)
+        {
+            GB_jit_entry *e = &(GB_jit_table [k]) ;
+            e->ncalls = 0 ;
+            e->run_time = 0 ;
+        }
+        memset (GB_jit_generic_calls, 0, sizeof (GB_jit_generic_calls)) ;
+        GB_ATOMIC_WRITE
+        GB_jit_profile = profile ;
     }
-    return (s) ;
 }
 
 //------------------------------------------------------------------------------
-// GB_jitifyer_set_C_preface: set new C preface
+// GB_jitifyer_profile: record the run time of one call to a JIT kernel
 //------------------------------------------------------------------------------
 
-GrB_Info GB_jitifyer_set_C_preface (const char *new_C_preface)
-{ 
-
-    //--------------------------------------------------------------------------
-    // check inputs
-    //--------------------------------------------------------------------------
+// The kernel is found in the hash table without the critical section, and its
+// counters are updated atomically.  If the hash table grows at the same time,
+// the update may be made in a table just retired, and lost, so the profile is
+// approximate.
 
-    if (new_C_preface == NULL)
+void GB_jitifyer_profile        // record the run time of a JIT kernel
+(
+    uint64_t hash,              // hash code for the kernel
+    GB_jit_encoding *encoding,  // encoding of the problem
+    const char *suffix,         // suffix for the kernel_name (NULL if none)
+    double t                    // time taken by one call to the kernel
+)
+{
+    void *dl_function ;
+    GB_jit_entry *table ;
+    GB_jit_entry *e = GB_jitifyer_find (hash, encoding, suffix, &dl_function,
+        &table) ;
+    if (e != NULL)
     { 
-        return (GrB_NULL_POINTER) ;
+        GB_ATOMIC_UPDATE
+        e->ncalls++ ;
+        GB_ATOMIC_UPDATE
+        e->run_time += t ;
     }
+}
 
-    //--------------------------------------------------------------------------
-    // set the C preface in a critical section
-    //--------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+// GB_jitifyer_generic: count a generic kernel used in place of a JIT kernel
+//------------------------------------------------------------------------------
 
-    GrB_Info info ;
-    #pragma omp critical (GB_jitifyer_worker)
-    {
+void GB_jitifyer_generic        // count a generic kernel of a JIT family
+(
+    GB_jit_family family
+)
+{
+    if (family > 0 && family < GB_JIT_NFAMILIES)
+    { 
+        GB_ATOMIC_UPDATE
+        GB_jit_generic_calls [family]++ ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_profile_report: return a report of the JIT profile
+//------------------------------------------------------------------------------
+
+// The report is a table with one line for each kernel in the hash table, with
+// the # of calls, total run time, and load time of each kernel, in that order,
+// followed by its kernel_name.  It is followed by the # of generic kernels
+// used for each family.  Lines starting with '#' are comments.  If refresh is
+// true, or if no report has yet been created, a new report is created (this
+// is done by GrB_get (GrB_GLOBAL, &size, GxB_JIT_PROFILE_REPORT), so that the
+// report that is then returned by GrB_get as a string has the same size).
+// Otherwise, the last report is returned.
+
+const char *GB_jitifyer_get_profile_report (bool refresh)
+{
+    const char *s ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        if (refresh || GB_jit_profile_report == NULL)
+        { 
+            GB_jitifyer_profile_report_worker ( ) ;
+        }
+        s = (GB_jit_profile_report == NULL) ? "" : GB_jit_profile_report ;
+    }
+    return (s) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_profile_report_worker: create the profile report
+//------------------------------------------------------------------------------
+
+#define GB_PROFILE_LINE (GB_KLEN + 128)
+
+void GB_jitifyer_profile_report_worker (void)
+{
+
+    //--------------------------------------------------------------------------
+    // allocate the report
+    //--------------------------------------------------------------------------
+
+    GB_FREE_STUFF (GB_jit_profile_report) ;
+    size_t len = (GB_jit_table_populated + GB_JIT_NFAMILIES + 4) *
+        GB_PROFILE_LINE ;
+    GB_MALLOC_PERSISTENT (GB_jit_profile_report, len) ;
+    if (GB_jit_profile_report == NULL)
+    { 
+        // out of memory; no report
+        return ;
+    }
+    GB_jit_profile_report_allocated = len ;
+    char *p = GB_jit_profile_report ;
+    char *pend = p + len ;
+    #define GB_REPORT(...)                          \
+    {                                               \
+        p += snprintf (p, pend - p, __VA_ARGS__) ;  \
+    }
+
+    //--------------------------------------------------------------------------
+    // one line for each JIT kernel
+    //--------------------------------------------------------------------------
+
+    GB_REPORT ("# JIT profile: %s\n", GB_jit_profile ? "on" : "off") ;
+    GB_REPORT ("# %10s %14s %14s %s\n", "calls", "run time (s)",
+        "load time (s)", "kernel") ;
+    for (int64_t k = 0 ; k < GB_jit_table_size ; k++)
+    {
+        GB_jit_entry *e = &(GB_jit_table [k]) ;
+        if (e->dl_function == NULL || e->hash == 0) continue ;
+        int scode_digits ;
+        const char *kname = GB_jitifyer_kname (e->encoding.kcode,
+            &scode_digits) ;
+        char kernel_name [GB_KLEN] ;
+        GB_macrofy_name (kernel_name, "GB_jit", kname, e->encoding.dim,
+            scode_digits, e->encoding.code, e->suffix) ;
+        GB_REPORT ("  %10" PRId64 " %14.6e %14.6e %s\n", e->ncalls,
+            e->run_time, e->load_time, kernel_name) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // generic kernels used for each family
+    //--------------------------------------------------------------------------
+
+    GB_REPORT ("# %10s %s\n", "generic", "family") ;
+    for (int family = 1 ; family < GB_JIT_NFAMILIES ; family++)
+    { 
+        GB_REPORT ("# %10" PRId64 " %s\n", GB_jit_generic_calls [family],
+            GB_jit_family_names [family]) ;
+    }
+    #undef GB_REPORT
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_C_cmake_libs: return the current cmake libs
+//------------------------------------------------------------------------------
+
+const char *GB_jitifyer_get_C_cmake_libs (void)
+{ 
+    const char *s ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        s = GB_jit_C_cmake_libs ;
+    }
+    return (s) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_C_cmake_libs: set new cmake libs
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jitifyer_set_C_cmake_libs (const char *new_cmake_libs)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (new_cmake_libs == NULL)
+    { 
+        return (GrB_NULL_POINTER) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // set the cmake libs in a critical section
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        info = GB_jitifyer_set_C_cmake_libs_worker (new_cmake_libs) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_C_cmake_libs_worker: set cmake libs in a critical section
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jitifyer_set_C_cmake_libs_worker (const char *new_cmake_libs)
+{ 
+    // free the old C_cmake_libs string
+    GB_FREE_STUFF (GB_jit_C_cmake_libs) ;
+    // allocate the new GB_jit_C_cmake_libs
+    GB_COPY_STUFF (GB_jit_C_cmake_libs, new_cmake_libs) ;
+    // allocate workspace
+    return (GB_jitifyer_alloc_space ( )) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_C_preface: return the current C preface
+//------------------------------------------------------------------------------
+
+const char *GB_jitifyer_get_C_preface (void)
+{ 
+    const char *s ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        s = GB_jit_C_preface ;
+    }
+    return (s) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_C_preface: set new C preface
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jitifyer_set_C_preface (const char *new_C_preface)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (new_C_preface == NULL)
+    { 
+        return (GrB_NULL_POINTER) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // set the C preface in a critical section
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
         info = GB_jitifyer_set_C_preface_worker (new_C_preface) ;
     }
     return (info) ;
@@ -1504,26 +2063,28 @@ bool GB_jitifyer_query
 }
 
 //------------------------------------------------------------------------------
-// GB_jitifyer_load: load a JIT kernel, compiling it if needed
+// GB_jitifyer_kernel_options: get the JIT control and C flags of a kernel
 //------------------------------------------------------------------------------
 
-// Returns GrB_SUCCESS if kernel is found (already loaded, or just now loaded,
-// or just now compiled and loaded).
+// A user-defined GrB_Type, GrB_BinaryOp, or GrB_Semiring can have its own JIT
+// control and C flags (GxB_JIT_C_CONTROL and GxB_JIT_C_COMPILER_FLAGS, set by
+// GrB_set).  The JIT control of a kernel is the smallest JIT control of all
+// of its objects and the global JIT control, so an object can only restrict
+// the use of the JIT.  The C flags of each object used by the kernel are
+// returned in Flags, if not NULL, with duplicates removed.  Likewise, the
+// object files of its operators without a definition (GxB_JIT_C_OBJECT) are
+// returned in Objects.
 
-// Returns GrB_NO_VALUE if the kernel is not found and cannot be loaded or
-// compiled.  This tells the caller that a generic method must be used.
+#define GB_JIT_KERNEL_NOBJECTS 20
 
-GrB_Info GB_jitifyer_load
+static GxB_JIT_Control GB_jitifyer_kernel_options
 (
     // output:
-    void **dl_function,         // pointer to JIT kernel
+    const char **Flags,         // size GB_JIT_KERNEL_NOBJECTS, or NULL
+    int *nflags,                // # of entries in Flags
+    const char **Objects,       // size GB_JIT_KERNEL_NOBJECTS, or NULL
+    int *nobjects,              // # of entries in Objects
     // input:
-    GB_jit_family family,       // kernel family
-    const char *kname,          // kname for the kernel_name
-    uint64_t hash,              // hash code for the kernel
-    GB_jit_encoding *encoding,  // encoding of the problem
-    const char *suffix,         // suffix for the kernel_name (NULL if none)
-    // operator and type definitions
     GrB_Semiring semiring,
     GrB_Monoid monoid,
     GB_Operator op,
@@ -1533,94 +2094,89 @@ GrB_Info GB_jitifyer_load
 )
 {
 
-    //--------------------------------------------------------------------------
-    // check for quick return
-    //--------------------------------------------------------------------------
-
-    #ifdef GBMATLAB
-    if (GB_Global_hack_get (3) != 0)
-    {
-        // the JIT can be disabled for testing, to test error handling
-        GBURBLE ("(jit: test error handling) ") ;
-        return (GrB_NOT_IMPLEMENTED) ;
+    GxB_JIT_Control control = GB_jit_control ;
+    int n = 0, nobj = 0 ;
+
+    #define GB_OBJECT_OPTIONS(object)                                       \
+    if ((object) != NULL)                                                   \
+    {                                                                       \
+        if ((object)->jit_control_set)                                      \
+        {                                                                   \
+            control = GB_IMIN (control, (object)->jit_control) ;            \
+        }                                                                   \
+        const char *flags = (object)->jit_C_flags ;                         \
+        if (Flags != NULL && flags != NULL)                                 \
+        {                                                                   \
+            bool found = false ;                                            \
+            for (int k = 0 ; k < n && !found ; k++)                         \
+            {                                                               \
+                found = (Flags [k] == flags) ;                              \
+            }                                                               \
+            if (!found) Flags [n++] = flags ;                               \
+        }                                                                   \
     }
-    #endif
 
-    GrB_Info info ;
-    if (hash == UINT64_MAX)
-    { 
-        // The kernel may not be compiled; it does not have a valid definition.
-        GBURBLE ("(jit: undefined) ") ;
-        return (GrB_NO_VALUE) ;
+    #define GB_OPERATOR_OPTIONS(op)                                         \
+    if ((op) != NULL)                                                       \
+    {                                                                       \
+        GB_OBJECT_OPTIONS (op) ;                                            \
+        const char *object = (op)->jit_C_object ;                           \
+        if (Objects != NULL && object != NULL && (op)->defn == NULL)        \
+        {                                                                   \
+            bool found = false ;                                            \
+            for (int k = 0 ; k < nobj && !found ; k++)                      \
+            {                                                               \
+                found = (Objects [k] == object) ;                           \
+            }                                                               \
+            if (!found) Objects [nobj++] = object ;                         \
+        }                                                                   \
+        GB_OBJECT_OPTIONS ((op)->ztype) ;                                   \
+        GB_OBJECT_OPTIONS ((op)->xtype) ;                                   \
+        GB_OBJECT_OPTIONS ((op)->ytype) ;                                   \
     }
 
-    if ((GB_jit_control == GxB_JIT_OFF) || (GB_jit_control == GxB_JIT_PAUSE))
+    if (semiring != NULL)
     { 
-        // The JIT control has disabled all JIT kernels.  Punt to generic.
-        return (GrB_NO_VALUE) ;
-    }
-
-    //--------------------------------------------------------------------------
-    // handle the GxB_JIT_RUN case: critical section not required
-    //--------------------------------------------------------------------------
-
-    if ((GB_jit_control == GxB_JIT_RUN) &&
-        (family != GB_jit_user_op_family) &&
-        (family != GB_jit_user_type_family))
-    {
-
-        //----------------------------------------------------------------------
-        // look up the kernel in the hash table
-        //----------------------------------------------------------------------
-
-        int64_t k1 = -1, kk = -1 ;
-        (*dl_function) = GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) ;
-        if (k1 >= 0)
-        { 
-            // an unchecked PreJIT kernel; check it inside critical section
-        }
-        else if ((*dl_function) != NULL)
-        { 
-            // found the kernel in the hash table
-            return (GrB_SUCCESS) ;
-        }
-        else
-        { 
-            // No kernels may be loaded or compiled, but existing kernels
-            // already loaded may be run (handled above if dl_function was
-            // found).  This kernel was not loaded, so punt to generic.
-            return (GrB_NO_VALUE) ;
-        }
+        GB_OBJECT_OPTIONS (semiring) ;
+        GB_OPERATOR_OPTIONS (semiring->add->op) ;
+        GB_OPERATOR_OPTIONS (semiring->multiply) ;
     }
-
-    //--------------------------------------------------------------------------
-    // do the rest inside a critical section
-    //--------------------------------------------------------------------------
-
-    #pragma omp critical (GB_jitifyer_worker)
+    if (monoid != NULL)
     { 
-        info = GB_jitifyer_load2_worker (dl_function, family, kname, hash,
-            encoding, suffix, semiring, monoid, op, type1, type2, type3) ;
+        GB_OPERATOR_OPTIONS (monoid->op) ;
     }
+    GB_OPERATOR_OPTIONS (op) ;
+    GB_OBJECT_OPTIONS (type1) ;
+    GB_OBJECT_OPTIONS (type2) ;
+    GB_OBJECT_OPTIONS (type3) ;
 
-    return (info) ;
+    #undef GB_OBJECT_OPTIONS
+    #undef GB_OPERATOR_OPTIONS
+
+    if (nflags != NULL) (*nflags) = n ;
+    if (nobjects != NULL) (*nobjects) = nobj ;
+    return (control) ;
 }
 
 //------------------------------------------------------------------------------
-// GB_jitifyer_load2_worker: do the work for GB_jitifyer_load in a critical section
+// GB_jitifyer_kernel_C_flags: set the C flags for compiling a kernel
 //------------------------------------------------------------------------------
 
-GrB_Info GB_jitifyer_load2_worker
+// Concatenates the C flags of the objects used by a kernel into
+// GB_jit_kernel_C_flags, which the compile commands append to the global C
+// flags.  This is only done just before a kernel is compiled, inside the
+// critical section, and GB_jit_kernel_C_flags is cleared once the compile
+// command has been constructed.  A kernel already in the cache is not
+// recompiled if these flags change, just like the global C flags.
+
+// The object files of its operators are placed in GB_jit_kernel_C_objects,
+// and linked into the kernel.  The kernel is then compiled and linked with
+// -flto, so that an object file compiled with -flto (or LLVM bitcode, with
+// clang) is optimized together with the kernel, and the operator can be
+// inlined into its inner loops.
+
+static GrB_Info GB_jitifyer_kernel_C_flags
 (
-    // output:
-    void **dl_function,         // pointer to JIT kernel
-    // input:
-    GB_jit_family family,       // kernel family
-    const char *kname,          // kname for the kernel_name
-    uint64_t hash,              // hash code for the kernel
-    GB_jit_encoding *encoding,  // encoding of the problem
-    const char *suffix,         // suffix for the kernel_name (NULL if none)
-    // operator and type definitions
     GrB_Semiring semiring,
     GrB_Monoid monoid,
     GB_Operator op,
@@ -1631,1015 +2187,3844 @@ GrB_Info GB_jitifyer_load2_worker
 {
 
     //--------------------------------------------------------------------------
-    // look up the kernel in the hash table
+    // get the C flags of the objects of the kernel
     //--------------------------------------------------------------------------
 
-    int64_t k1 = -1, kk = -1 ;
-    (*dl_function) = GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) ;
-    if ((*dl_function) != NULL)
+    const char *Flags [GB_JIT_KERNEL_NOBJECTS] ;
+    const char *Objects [GB_JIT_KERNEL_NOBJECTS] ;
+    int nflags = 0, nobjects = 0 ;
+    GB_jitifyer_kernel_options (Flags, &nflags, Objects, &nobjects,
+        semiring, monoid, op, type1, type2, type3) ;
+    size_t len = 0 ;
+    for (int k = 0 ; k < nflags ; k++)
     { 
-        // found the kernel in the hash table
-        GB_jit_entry *e = &(GB_jit_table [kk]) ;
-        if (k1 >= 0)
-        {
-            // unchecked PreJIT kernel; check it now
-            void **Kernels = NULL ;
-            void **Queries = NULL ;
-            char **Names = NULL ;
-            int32_t nkernels = 0 ;
-            GB_prejit (&nkernels, &Kernels, &Queries, &Names) ;
-            GB_jit_query_func dl_query = (GB_jit_query_func) Queries [k1] ;
-            bool builtin = (encoding->suffix_len == 0) ;
-            bool ok = GB_jitifyer_query (dl_query, builtin, hash, semiring,
-                monoid, op, type1, type2, type3) ;
-            if (ok)
-            { 
-                // PreJIT kernel is fine; flag it as checked by flipping
-                // its prejit_index.
-                GBURBLE ("(prejit: ok) ") ;
-                e->prejit_index = GB_FLIP (k1) ;
-                return (GrB_SUCCESS) ;
-            }
-            else
-            { 
-                // remove the PreJIT kernel from the hash table; do not return.
-                // Instead, keep going and compile a JIT kernel.
-                GBURBLE ("(prejit: disabled) ") ;
-                GB_jitifyer_entry_free (e) ;
-            }
-        }
-        else if (family == GB_jit_user_op_family)
-        {
-            // user-defined operator; check it now
-            GB_user_op_f GB_user_op = (GB_user_op_f) (*dl_function) ;
-            void *ignore ;
-            char *defn ;
-            GB_user_op (&ignore, &defn) ;
-            if (strcmp (defn, op->defn) == 0)
-            { 
-                return (GrB_SUCCESS) ;
-            }
-            else
-            { 
-                // the op has changed; need to re-JIT the kernel; do not return.
-                // Instead, keep going and compile a JIT kernel.
-                GBURBLE ("(jit: op changed) ") ;
-                GB_jitifyer_entry_free (e) ;
-            }
-        }
-        else if (family == GB_jit_user_type_family)
-        {
-            // user-defined type; check it now
-            GB_user_type_f GB_user_type = (GB_user_type_f) (*dl_function) ;
-            size_t ignore ;
-            char *defn ;
-            GB_user_type (&ignore, &defn) ;
-            if (strcmp (defn, type1->defn) == 0)
-            { 
-                return (GrB_SUCCESS) ;
-            }
-            else
-            { 
-                // type has changed; need to re-JIT the kernel; do not return.
-                // Instead, keep going and compile a JIT kernel.
-                GBURBLE ("(jit: type changed) ") ;
-                GB_jitifyer_entry_free (e) ;
-            }
-        }
-        else
-        { 
-            // JIT kernel, or checked PreJIT kernel
-            return (GrB_SUCCESS) ;
-        }
+        len += strlen (Flags [k]) + 1 ;
+    }
+    if (nobjects > 0)
+    { 
+        len += strlen (" -flto") ;
+    }
+    size_t objects_len = 0 ;
+    for (int k = 0 ; k < nobjects ; k++)
+    { 
+        objects_len += strlen (Objects [k]) + 3 ;
     }
 
     //--------------------------------------------------------------------------
-    // quick return if not in the hash table and load/compile is disabled
+    // make sure GB_jit_kernel_C_flags, *_objects, and GB_jit_temp are large
     //--------------------------------------------------------------------------
 
-    #ifndef NJIT
-    if (GB_jit_control <= GxB_JIT_RUN)
-    #endif
+    if (len + 1 > GB_jit_kernel_C_flags_allocated ||
+        objects_len + 1 > GB_jit_kernel_C_objects_allocated)
     { 
-        // No kernels may be loaded or compiled, but existing kernels already
-        // loaded may be run (handled above if dl_function was found).  This
-        // kernel was not loaded, so punt to generic.
-        return (GrB_NO_VALUE) ;
+        GB_FREE_STUFF (GB_jit_kernel_C_flags) ;
+        GB_MALLOC_STUFF (GB_jit_kernel_C_flags, len) ;
+        GB_FREE_STUFF (GB_jit_kernel_C_objects) ;
+        GB_MALLOC_STUFF (GB_jit_kernel_C_objects, objects_len) ;
+        GrB_Info info = GB_jitifyer_alloc_space ( ) ;
+        if (info != GrB_SUCCESS) return (info) ;
     }
 
     //--------------------------------------------------------------------------
-    // construct the kernel name
+    // concatenate the C flags
     //--------------------------------------------------------------------------
 
-    #ifndef NJIT
-    GB_Operator op1 = NULL ;
-    GB_Operator op2 = NULL ;
-    int scode_digits = 0 ;
+    char *p = GB_jit_kernel_C_flags ;
+    p [0] = '\0' ;
+    for (int k = 0 ; k < nflags ; k++)
+    { 
+        p += sprintf (p, (k == 0) ? "%s" : " %s", Flags [k]) ;
+    }
+    if (nobjects > 0)
+    { 
+        // compile and link the kernel with link-time optimization
+        sprintf (p, (nflags == 0) ? "-flto" : " -flto") ;
+    }
 
-    switch (family)
-    {
-        case GB_jit_apply_family  : 
-            op1 = op ;
-            scode_digits = 10 ;
-            break ;
+    //--------------------------------------------------------------------------
+    // concatenate the object files, each in single quotes
+    //--------------------------------------------------------------------------
 
-        case GB_jit_assign_family : 
-            op1 = op ;
-            scode_digits = 12 ;
-            break ;
+    p = GB_jit_kernel_C_objects ;
+    p [0] = '\0' ;
+    for (int k = 0 ; k < nobjects ; k++)
+    { 
+        p += sprintf (p, (k == 0) ? "'%s'" : " '%s'", Objects [k]) ;
+    }
+    return (GrB_SUCCESS) ;
+}
 
-        case GB_jit_build_family  : 
-            op1 = op ;
-            scode_digits = 7 ;
-            break ;
+//------------------------------------------------------------------------------
+// GB_jitifyer_kernel_C_flags_clear: clear the C flags of a kernel
+//------------------------------------------------------------------------------
 
-        case GB_jit_ewise_family  : 
-            op1 = op ;
-            scode_digits = 13 ;
-            break ;
+static inline void GB_jitifyer_kernel_C_flags_clear (void)
+{
+    if (GB_jit_kernel_C_flags != NULL)
+    { 
+        GB_jit_kernel_C_flags [0] = '\0' ;
+    }
+    if (GB_jit_kernel_C_objects != NULL)
+    { 
+        GB_jit_kernel_C_objects [0] = '\0' ;
+    }
+}
 
-        case GB_jit_mxm_family    : 
-            monoid = semiring->add ;
-            op1 = (GB_Operator) semiring->add->op ;
-            op2 = (GB_Operator) semiring->multiply ;
-            scode_digits = 16 ;
-            break ;
+//------------------------------------------------------------------------------
+// GB_jitifyer_kernel_C_flags_read: get the C flags of a cached kernel
+//------------------------------------------------------------------------------
 
-        case GB_jit_reduce_family : 
-            op1 = (GB_Operator) monoid->op ;
-            scode_digits = 7 ;
-            break ;
+// GB_jitifyer_load2_worker records the C flags of the objects of a kernel
+// (from GB_jit_kernel_C_flags), and the object files linked into it (from
+// GB_jit_kernel_C_objects), each in a single line of its source:
+//
+//      // GB_jit_kernel_C_flags: -O3 -flto
+//      // GB_jit_kernel_C_objects: '/path/to/op1.o' '/path/to/op2.o'
+//
+// GB_jitifyer_warmup_worker and GB_jitifyer_pack_worker compile a kernel from
+// its source alone, without its types, operators, or semiring, so this
+// function reads the lines back into GB_jit_kernel_C_flags and
+// GB_jit_kernel_C_objects.  The source may come from a manifest, and both
+// appear in the compile command.  The C flags may not contain any character
+// that the shell interprets inside double quotes, or that ends a command.
+// Each object file must be a path in single quotes, with only the characters
+// that GB_jitifyer_sanitize permits, and not starting with a hyphen.
+// GrB_INVALID_VALUE is returned otherwise.  GB_jitifyer_kernel_C_flags_clear
+// must be used once the compile command has been constructed.  GB_jit_temp
+// may be reallocated.
+
+#define GB_FLAGS_MARKER   "\n// GB_jit_kernel_C_flags: "
+#define GB_OBJECTS_MARKER "\n// GB_jit_kernel_C_objects: "
+
+static GrB_Info GB_jitifyer_kernel_C_flags_read
+(
+    char *kernel_name,          // kernel file name (excluding the path)
+    uint32_t bucket             // hash & 0xFF
+)
+{
 
-        case GB_jit_select_family : 
-            op1 = op ;
-            scode_digits = 10 ;
-            break ;
+    //--------------------------------------------------------------------------
+    // read the kernel source
+    //--------------------------------------------------------------------------
 
-        case GB_jit_user_type_family : 
-            scode_digits = 1 ;
-            break ;
+    GB_jitifyer_kernel_C_flags_clear ( ) ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.c",
+        GB_jit_cache_path, bucket, kernel_name) ;
+    FILE *fp = fopen (GB_jit_temp, "r") ;
+    if (fp == NULL)
+    { 
+        // no source, so the kernel cannot be compiled anyway
+        return (GrB_SUCCESS) ;
+    }
+    int64_t nbytes = 0 ;
+    if (fseek (fp, 0, SEEK_END) == 0)
+    { 
+        nbytes = GB_IMAX ((int64_t) ftell (fp), 0) ;
+        rewind (fp) ;
+    }
+    char *source = NULL ;
+    GB_MALLOC_PERSISTENT (source, nbytes + 1) ;
+    if (source == NULL)
+    { 
+        // out of memory
+        fclose (fp) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    nbytes = fread (source, 1, nbytes, fp) ;
+    source [nbytes] = '\0' ;
+    fclose (fp) ;
 
-        case GB_jit_user_op_family : 
-            scode_digits = 1 ;
-            op1 = op ;
-            break ;
+    //--------------------------------------------------------------------------
+    // find the C flags and the list of object files
+    //--------------------------------------------------------------------------
 
-        default: ;
+    char *flags = strstr (source, GB_FLAGS_MARKER) ;
+    char *objects = strstr (source, GB_OBJECTS_MARKER) ;
+    if (flags == NULL && objects == NULL)
+    { 
+        // the kernel has no C flags of its own, and no object files
+        GB_FREE_PERSISTENT (source) ;
+        return (GrB_SUCCESS) ;
     }
-
-    char kernel_name [GB_KLEN] ;
-    GB_macrofy_name (kernel_name, "GB_jit", kname, scode_digits,
-        encoding->code, suffix) ;
+    if (flags != NULL)
+    { 
+        flags += strlen (GB_FLAGS_MARKER) ;
+    }
+    if (objects != NULL)
+    { 
+        objects += strlen (GB_OBJECTS_MARKER) ;
+    }
+    // terminate each line, now that both have been found
+    char *eol = (flags == NULL) ? NULL : strchr (flags, '\n') ;
+    if (eol != NULL) (*eol) = '\0' ;
+    eol = (objects == NULL) ? NULL : strchr (objects, '\n') ;
+    if (eol != NULL) (*eol) = '\0' ;
 
     //--------------------------------------------------------------------------
-    // lock the kernel
+    // check the C flags
     //--------------------------------------------------------------------------
 
-    // FIXME: add kernel_name to the lock filename.  If the lock fails,
-    // sleep for 1 second and try again repeatedly, with a timeout limit of
-    // (say) 60 seconds.
+    bool ok = true ;
+    size_t len = (flags == NULL) ? strlen ("-flto") : strlen (flags) ;
+    for (size_t k = 0 ; ok && flags != NULL && k < len ; k++)
+    { 
+        ok = (strchr ("\"`$\\;&|<>\r", flags [k]) == NULL) ;
+    }
 
-    uint32_t bucket = hash & 0xFF ;
-    snprintf (GB_jit_temp, GB_jit_temp_allocated,
-        "%s/lock/%02x/%016" PRIx64 "_lock", GB_jit_cache_path, bucket, hash) ;
-    FILE *fp_klock = NULL ;
-    int fd_klock = -1 ;
-    if (!GB_file_open_and_lock (GB_jit_temp, &fp_klock, &fd_klock))
-    {
-        // JIT error: unable to lock the kernel
-        // disable the JIT to avoid repeated load errors
-        GB_jit_control = GxB_JIT_RUN ;
-        return (GrB_NO_VALUE) ;
+    //--------------------------------------------------------------------------
+    // check the list of object files
+    //--------------------------------------------------------------------------
+
+    size_t objects_len = (objects == NULL) ? 0 : strlen (objects) ;
+    ok = ok && (objects == NULL || objects_len > 0) ;
+    bool quoted = false ;
+    for (size_t k = 0 ; ok && k < objects_len ; k++)
+    { 
+        char c = objects [k] ;
+        if (!quoted)
+        { 
+            // each object file starts with a quote, preceded by a space
+            ok = (c == '\'') && (k == 0 || objects [k-1] == ' ') &&
+                (k+1 < objects_len) && (objects [k+1] != '-') ;
+            quoted = true ;
+        }
+        else if (c == '\'')
+        { 
+            // the object file ends with a quote, followed by a space
+            ok = (k+1 == objects_len) || (objects [k+1] == ' ') ;
+            quoted = false ;
+            k++ ;
+        }
+        else
+        { 
+            ok = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                 (c >= '0' && c <= '9') || (c == ' ') || (c == '.') ||
+                 (c == '-') || (c == '_') || (c == '/') ;
+        }
+    }
+    if (!ok || quoted)
+    { 
+        // the list of object files is invalid
+        GB_FREE_PERSISTENT (source) ;
+        return (GrB_INVALID_VALUE) ;
     }
 
     //--------------------------------------------------------------------------
-    // load the kernel, compiling it if needed
+    // make sure GB_jit_kernel_C_flags, *_objects, and GB_jit_temp are large
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_jitifyer_load_worker (dl_function, kernel_name, family,
-        kname, hash, encoding, suffix, semiring, monoid, op, op1, op2,
-        type1, type2, type3) ;
+    if (len + 1 > GB_jit_kernel_C_flags_allocated ||
+        objects_len + 1 > GB_jit_kernel_C_objects_allocated)
+    { 
+        GB_FREE_STUFF (GB_jit_kernel_C_flags) ;
+        GB_FREE_STUFF (GB_jit_kernel_C_objects) ;
+        GB_MALLOC_PERSISTENT (GB_jit_kernel_C_flags, len + 2) ;
+        GB_MALLOC_PERSISTENT (GB_jit_kernel_C_objects, objects_len + 2) ;
+        if (GB_jit_kernel_C_flags == NULL || GB_jit_kernel_C_objects == NULL)
+        { 
+            // out of memory
+            GB_FREE_STUFF (GB_jit_kernel_C_flags) ;
+            GB_FREE_STUFF (GB_jit_kernel_C_objects) ;
+            GB_FREE_PERSISTENT (source) ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        GB_jit_kernel_C_flags_allocated = len + 2 ;
+        GB_jit_kernel_C_objects_allocated = objects_len + 2 ;
+        GrB_Info info = GB_jitifyer_alloc_space ( ) ;
+        if (info != GrB_SUCCESS)
+        { 
+            GB_FREE_PERSISTENT (source) ;
+            return (info) ;
+        }
+    }
 
     //--------------------------------------------------------------------------
-    // unlock the kernel
+    // compile the kernel with its C flags, and link it with its object files
     //--------------------------------------------------------------------------
 
-    GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
-    return (info) ;
-    #endif
+    // a kernel with object files but no C flags (recorded before the C flags
+    // were) is compiled and linked with -flto
+    strcpy (GB_jit_kernel_C_flags, (flags == NULL) ? "-flto" : flags) ;
+    strcpy (GB_jit_kernel_C_objects, (objects == NULL) ? "" : objects) ;
+    GB_FREE_PERSISTENT (source) ;
+    return (GrB_SUCCESS) ;
 }
 
 //------------------------------------------------------------------------------
-// GB_jitifyer_load_worker: load/compile a kernel
+// GB_jitifyer_async: determine if a kernel can be compiled in the background
 //------------------------------------------------------------------------------
 
-// This work is done inside a critical section for this process, and inside a
-// file lock/unlock section (fp_klock) to guard against access from other
-// processes.
+// With the GxB_JIT_ASYNC control, new CPU kernels are compiled in a background
+// process, and the generic methods are used until the compiled kernel is
+// ready.  This is only done with the direct compile; compiling a kernel with
+// cmake (required for MSVC), libtcc, or nvcc is always done in the foreground.
+// The user_op and user_type kernels are also compiled in the foreground,
+// since GxB_*Op_new and GxB_Type_new require them right away.
 
-GrB_Info GB_jitifyer_load_worker
+static bool GB_jitifyer_async
 (
-    // output:
-    void **dl_function,         // pointer to JIT kernel
-    // input:
-    char *kernel_name,          // kernel file name (excluding the path)
-    GB_jit_family family,       // kernel family
-    const char *kname,          // kname for the kernel_name
-    uint64_t hash,              // hash code for the kernel
-    GB_jit_encoding *encoding,  // encoding of the problem
-    const char *suffix,         // suffix for the kernel_name (NULL if none)
-    // operator and type definitions
-    GrB_Semiring semiring,
-    GrB_Monoid monoid,
-    GB_Operator op,
-    GB_Operator op1,
-    GB_Operator op2,
-    GrB_Type type1,
-    GrB_Type type2,
-    GrB_Type type3
+    GxB_JIT_Control control,    // JIT control for this kernel
+    GB_jit_family family,
+    GB_jit_kcode kcode
+)
+{ 
+    return (control == GxB_JIT_ASYNC && !GB_jit_use_cmake &&
+        !GB_jit_use_libtcc && kcode < GB_JIT_CUDA_KERNEL &&
+        family != GB_jit_user_op_family &&
+        family != GB_jit_user_type_family) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_pending_find: find a kernel being compiled in the background
+//------------------------------------------------------------------------------
+
+// Returns the position of the kernel in the GB_jit_pending list, or -1 if not
+// found.  The list is short (it only holds the kernels currently being
+// compiled), so a linear search is used.
+
+static int64_t GB_jitifyer_pending_find
+(
+    uint64_t hash,
+    GB_jit_encoding *encoding,
+    const char *suffix
 )
 {
+    uint32_t suffix_len = encoding->suffix_len ;
+    bool builtin = (bool) (suffix_len == 0) ;
+    for (int64_t k = 0 ; k < GB_jit_pending_n ; k++)
+    {
+        GB_jit_entry *e = &(GB_jit_pending [k]) ;
+        if (e->hash == hash &&
+            e->encoding.code == encoding->code &&
+            e->encoding.kcode == encoding->kcode &&
+            e->encoding.dim == encoding->dim &&
+            e->encoding.suffix_len == suffix_len &&
+            (builtin || (memcmp (e->suffix, suffix, suffix_len) == 0)))
+        { 
+            return (k) ;
+        }
+    }
+    return (-1) ;
+}
 
-    #ifndef NJIT
+//------------------------------------------------------------------------------
+// GB_jitifyer_pending_add: add a kernel to the GB_jit_pending list
+//------------------------------------------------------------------------------
 
-    //--------------------------------------------------------------------------
-    // try to load the lib*.so from the user's library folder
-    //--------------------------------------------------------------------------
+// Returns true if successful, false if out of memory.
 
-    uint32_t bucket = hash & 0xFF ;
-    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%02x/%s%s%s",
-        GB_jit_cache_path, bucket, GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX) ;
-    void *dl_handle = GB_file_dlopen (GB_jit_temp) ;
-    GB_jit_kcode kcode = encoding->kcode ;
+static bool GB_jitifyer_pending_add
+(
+    uint64_t hash,
+    GB_jit_encoding *encoding,
+    const char *suffix
+)
+{
 
     //--------------------------------------------------------------------------
-    // check if the kernel was found, but needs to be compiled anyway
+    // ensure the list is large enough
     //--------------------------------------------------------------------------
 
-    if (dl_handle != NULL)
-    { 
-        // library is loaded but make sure the defn match
-        GB_jit_query_func dl_query = (GB_jit_query_func)
-            GB_file_dlsym (dl_handle, "GB_jit_query") ;
-        bool ok = (dl_query != NULL) ;
-        if (ok)
-        { 
-            bool builtin = (encoding->suffix_len == 0) ;
-            ok = GB_jitifyer_query (dl_query, builtin, hash, semiring,
-                monoid, op, type1, type2, type3) ;
+    if (GB_jit_pending_n == GB_jit_pending_size)
+    {
+        int64_t new_size = GB_IMAX (16, 2 * GB_jit_pending_size) ;
+        size_t siz = new_size * sizeof (struct GB_jit_entry_struct) ;
+        GB_jit_entry *new_pending ;
+        GB_MALLOC_PERSISTENT (new_pending, siz) ;
+        if (new_pending == NULL)
+        {
+            // JIT error: out of memory
+            return (false) ;
         }
-        if (!ok)
+        if (GB_jit_pending_n > 0)
         { 
-            // library is loaded but needs to change, so close it
-            GB_file_dlclose (dl_handle) ; dl_handle = NULL ;
-            // remove the library itself so it doesn't cause the error again
-            remove (GB_jit_temp) ;
-            GBURBLE ("(jit: loaded but must recompile) ") ;
+            memcpy (new_pending, GB_jit_pending,
+                GB_jit_pending_n * sizeof (struct GB_jit_entry_struct)) ;
         }
+        GB_FREE_STUFF (GB_jit_pending) ;
+        GB_jit_pending = new_pending ;
+        GB_jit_pending_size = new_size ;
+        GB_jit_pending_allocated = siz ;
     }
 
     //--------------------------------------------------------------------------
-    // create and compile source file, if needed
+    // add the kernel to the end of the list
     //--------------------------------------------------------------------------
 
-    if (dl_handle == NULL)
-    { 
-
-        //----------------------------------------------------------------------
-        // quick return if the JIT is not permitted to compile new kernels
-        //----------------------------------------------------------------------
-
-        if (GB_jit_control < GxB_JIT_ON)
-        { 
-            // No new kernels may be compiled, so punt to generic.
-            GBURBLE ("(jit: not compiled) ") ;
-            return (GrB_NO_VALUE) ;
+    uint64_t suffix_len = (uint64_t) (encoding->suffix_len) ;
+    GB_jit_entry *e = &(GB_jit_pending [GB_jit_pending_n]) ;
+    memset (e, 0, sizeof (struct GB_jit_entry_struct)) ;
+    if (suffix_len > 0)
+    {
+        GB_MALLOC_PERSISTENT (e->suffix, suffix_len+2) ;
+        if (e->suffix == NULL)
+        {
+            // JIT error: out of memory
+            return (false) ;
         }
+        strncpy (e->suffix, suffix, suffix_len+1) ;
+    }
+    e->hash = hash ;
+    memcpy (&(e->encoding), encoding, sizeof (GB_jit_encoding)) ;
+    e->prejit_index = -1 ;
+    e->last_used = (int64_t) time (NULL) ;  // when the compilation started
+    GB_jit_pending_n++ ;
+    return (true) ;
+}
 
-        //----------------------------------------------------------------------
-        // create the source, compile it, and load it
-        //----------------------------------------------------------------------
-
-        GBURBLE ("(jit: compile and load) ") ;
-        const char *kernel_filetype =
-            (kcode < GB_JIT_CUDA_KERNEL) ? "c" : "cu" ;
-
-        // create (or recreate) the kernel source, compile it, and load it
-        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.%s",
-            GB_jit_cache_path, bucket, kernel_name, kernel_filetype) ;
-        FILE *fp = fopen (GB_jit_temp, "w") ;
-        if (fp != NULL)
-        { 
-            // create the preface
-            GB_macrofy_preface (fp, kernel_name,
-                GB_jit_C_preface, GB_jit_CUDA_preface, kcode) ;
-            // macrofy the kernel operators, types, and matrix formats
-            GB_macrofy_family (fp, family, encoding->code, semiring,
-                monoid, op, type1, type2, type3) ;
-            // #include the kernel, renaming it for the PreJIT
-            fprintf (fp, "#ifndef GB_JIT_RUNTIME\n"
-                         "#define GB_jit_kernel %s\n"
-                         "#define GB_jit_query  %s_query\n"
-                         "#endif\n"
-                         "#include \"template/GB_jit_kernel_%s.%s\"\n",
-                         kernel_name, kernel_name, kname,
-                         kernel_filetype) ;
+//------------------------------------------------------------------------------
+// GB_jitifyer_pending_remove: remove a kernel from the GB_jit_pending list
+//------------------------------------------------------------------------------
 
-            // macrofy the query function
-            bool builtin = (encoding->suffix_len == 0) ;
-            GB_macrofy_query (fp, builtin, monoid, op1, op2, type1, type2,
-                type3, hash, kcode) ;
-            fclose (fp) ;
-        }
+static void GB_jitifyer_pending_remove (int64_t k)
+{ 
+    ASSERT (k >= 0 && k < GB_jit_pending_n) ;
+    GB_FREE_PERSISTENT (GB_jit_pending [k].suffix) ;
+    GB_jit_pending_n-- ;
+    GB_jit_pending [k] = GB_jit_pending [GB_jit_pending_n] ;
+}
 
-        // if the source file was not created above, the compilation will
-        // gracefully fail.
+//------------------------------------------------------------------------------
+// GB_jitifyer_pending_free: free the GB_jit_pending list
+//------------------------------------------------------------------------------
 
-        // compile the kernel to get the lib*.so file
-        if (kcode >= GB_JIT_CUDA_KERNEL)
-        {
-            // use NVCC to directly compile the CUDA kernel
-            GB_jitifyer_nvcc_compile (kernel_name, bucket) ;
-        }
-        else if (GB_jit_use_cmake)
-        { 
-            // use cmake to compile the CPU kernel
-            GB_jitifyer_cmake_compile (kernel_name, hash) ;
-        }
-        else
-        { 
-            // use the compiler to directly compile the CPU kernel
-            GB_jitifyer_direct_compile (kernel_name, bucket) ;
-        }
+static void GB_jitifyer_pending_free (void)
+{
+    for (int64_t k = 0 ; k < GB_jit_pending_n ; k++)
+    { 
+        GB_FREE_PERSISTENT (GB_jit_pending [k].suffix) ;
+    }
+    GB_FREE_STUFF (GB_jit_pending) ;
+    GB_jit_pending_n = 0 ;
+    GB_jit_pending_size = 0 ;
+}
 
-        // load the kernel from the lib*.so file
-        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%02x/%s%s%s",
-            GB_jit_cache_path, bucket, GB_LIB_PREFIX, kernel_name,
-            GB_LIB_SUFFIX) ;
-        dl_handle = GB_file_dlopen (GB_jit_temp) ;
+//------------------------------------------------------------------------------
+// GB_jitifyer_load: load a JIT kernel, compiling it if needed
+//------------------------------------------------------------------------------
 
-        //----------------------------------------------------------------------
-        // handle any error conditions
-        //----------------------------------------------------------------------
+// Returns GrB_SUCCESS if kernel is found (already loaded, or just now loaded,
+// or just now compiled and loaded).
 
-        if (dl_handle == NULL)
-        { 
-            // unable to create the kernel source or open lib*.so file
-            GBURBLE ("(jit: compiler error; compilation disabled) ") ;
-            // disable the JIT to avoid repeated compilation errors
-            GB_jit_control = GxB_JIT_LOAD ;
-            // remove the compiled library
-            remove (GB_jit_temp) ;
-            return (GrB_NO_VALUE) ;     // FIXME: use another error code?
-        }
+// Returns GrB_NO_VALUE if the kernel is not found and cannot be loaded or
+// compiled.  This tells the caller that a generic method must be used.
 
-    }
-    else
-    { 
-        if (kcode >= GB_JIT_CUDA_KERNEL)
-        {
-            GBURBLE ("(jit: cuda load) ") ;
-        }
-        else
-        {
-            GBURBLE ("(jit: cpu load) ") ;
-        }
-    }
+GrB_Info GB_jitifyer_load
+(
+    // output:
+    void **dl_function,         // pointer to JIT kernel
+    // input:
+    GB_jit_family family,       // kernel family
+    const char *kname,          // kname for the kernel_name
+    uint64_t hash,              // hash code for the kernel
+    GB_jit_encoding *encoding,  // encoding of the problem
+    const char *suffix,         // suffix for the kernel_name (NULL if none)
+    // operator and type definitions
+    GrB_Semiring semiring,
+    GrB_Monoid monoid,
+    GB_Operator op,
+    GrB_Type type1,
+    GrB_Type type2,
+    GrB_Type type3
+)
+{
 
     //--------------------------------------------------------------------------
-    // get the GB_jit_kernel function pointer
+    // check for quick return
     //--------------------------------------------------------------------------
 
-    (*dl_function) = GB_file_dlsym (dl_handle, "GB_jit_kernel") ;
-    if ((*dl_function) == NULL)
+    #ifdef GBMATLAB
+    if (GB_Global_hack_get (3) != 0)
     {
-        // JIT error: dlsym unable to find GB_jit_kernel: punt to generic
-        GBURBLE ("(jit: load error; JIT loading disabled) ") ;
-        GB_file_dlclose (dl_handle) ; dl_handle = NULL ;
-        // disable the JIT to avoid repeated loading errors
-        GB_jit_control = GxB_JIT_RUN ;
-        // remove the compiled library
-        remove (GB_jit_temp) ;
-        return (GrB_NO_VALUE) ;     // FIXME: use another error code?
+        // the JIT can be disabled for testing, to test error handling
+        GBURBLE ("(jit: test error handling) ") ;
+        return (GrB_NOT_IMPLEMENTED) ;
     }
+    #endif
 
-    // insert the new kernel into the hash table
-    if (!GB_jitifyer_insert (hash, encoding, suffix, dl_handle, (*dl_function),
-        -1))
-    {
-        // JIT error: unable to add kernel to hash table: punt to generic
-        GB_file_dlclose (dl_handle) ; dl_handle = NULL ;
-        // disable the JIT to avoid repeated errors
-        GB_jit_control = GxB_JIT_PAUSE ;
-        // remove the compiled library
-        remove (GB_jit_temp) ;
+    GrB_Info info ;
+    if (hash == UINT64_MAX)
+    { 
+        // The kernel may not be compiled; it does not have a valid definition.
+        GBURBLE ("(jit: undefined) ") ;
         return (GrB_NO_VALUE) ;
     }
 
-    return (GrB_SUCCESS) ;
-    #else
-    (*dl_function) = NULL ;
-    return (GrB_INVALID_VALUE) ;
-    #endif
-}
+    // The JIT control for this kernel is the global JIT control, limited by
+    // the JIT control of any type, operator, or semiring it uses.
+    GxB_JIT_Control control = GB_jitifyer_kernel_options (NULL, NULL, NULL, NULL,
+        semiring, monoid, op, type1, type2, type3) ;
+    if ((control == GxB_JIT_OFF) || (control == GxB_JIT_PAUSE))
+    { 
+        // The JIT control has disabled this JIT kernel.  Punt to generic.
+        return (GrB_NO_VALUE) ;
+    }
 
-//------------------------------------------------------------------------------
-// GB_jitifyer_lookup:  find a jit entry in the hash table
-//------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------
+    // mark the kernel as in use
+    //--------------------------------------------------------------------------
 
-void *GB_jitifyer_lookup    // return dl_function pointer, or NULL if not found
-(
-    // input:
-    uint64_t hash,          // hash = GB_jitifyer_hash_encoding (encoding) ;
-    GB_jit_encoding *encoding,
-    const char *suffix,
-    // output
-    int64_t *k1,            // location of unchecked kernel in PreJIT table
-    int64_t *kk             // location of hash entry in hash table
-)
-{
+    // No kernel evicted from the hash table (see GB_jitifyer_evict) and no
+    // retired hash table is freed while this thread may be using it, which
+    // starts here before the hash table is searched.  If the kernel is found (or
+    // loaded), the CPU kernel is released by GB_JIT_CALL when the kernel
+    // returns.  CUDA kernels are never evicted, so they are released once
+    // they have been found.
 
-    (*k1) = -1 ;
+    GB_jitifyer_acquire ( ) ;
 
-    if (GB_jit_table == NULL)
-    { 
-        // no table yet so it isn't present
-        return (NULL) ;
-    }
+    //--------------------------------------------------------------------------
+    // look up the kernel in the hash table: critical section not required
+    //--------------------------------------------------------------------------
 
-    uint32_t suffix_len = encoding->suffix_len ;
-    bool builtin = (bool) (suffix_len == 0) ;
+    // Kernels for user-defined types and operators must be checked inside
+    // the critical section, as must unchecked PreJIT kernels.  All other
+    // kernels already in the hash table are returned here.  The critical
+    // section is only required to load or compile a kernel not yet in the
+    // table.
 
-    // look up the entry in the hash table
-    for (uint64_t k = hash ; ; k++)
+    bool done = false ;
+    if ((family != GB_jit_user_op_family) &&
+        (family != GB_jit_user_type_family))
     {
-        k = k & GB_jit_table_bits ;
-        GB_jit_entry *e = &(GB_jit_table [k]) ;
-        if (e->dl_function == NULL)
+        int64_t k1 = -1, kk = -1 ;
+        (*dl_function) = GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) ;
+        if (k1 >= 0)
         { 
-            // found an empty entry, so the entry is not in the table
-            return (NULL) ;
+            // an unchecked PreJIT kernel; check it inside critical section
         }
-        else if (e->hash == hash &&
-            e->encoding.code == encoding->code &&
-            e->encoding.kcode == encoding->kcode &&
-            e->encoding.suffix_len == suffix_len &&
-            (builtin || (memcmp (e->suffix, suffix, suffix_len) == 0)))
+        else if ((*dl_function) != NULL)
         { 
-            // found the right entry: return the corresponding dl_function
-            int64_t my_k1 ;
-            GB_ATOMIC_READ
-            my_k1 = e->prejit_index ;   // >= 0: unchecked JIT kernel
-            (*k1) = my_k1 ;
-            (*kk) = k ;
-            return (e->dl_function) ;
+            // found the kernel in the hash table
+            info = GrB_SUCCESS ;
+            done = true ;
+        }
+        else if (control == GxB_JIT_RUN)
+        { 
+            // No kernels may be loaded or compiled, but existing kernels
+            // already loaded may be run (handled above if dl_function was
+            // found).  This kernel was not loaded, so punt to generic.
+            info = GrB_NO_VALUE ;
+            done = true ;
         }
-        // otherwise, keep looking
     }
-}
-
-//------------------------------------------------------------------------------
-// GB_jitifyer_insert:  insert a jit entry in the hash table
-//------------------------------------------------------------------------------
 
-bool GB_jitifyer_insert         // return true if successful, false if failure
-(
-    // input:
-    uint64_t hash,              // hash for the problem
-    GB_jit_encoding *encoding,  // primary encoding
-    const char *suffix,         // suffix for user-defined types/operators
-    void *dl_handle,            // library handle from GB_file_dlopen;
-                                // NULL for PreJIT
-    void *dl_function,          // function handle from GB_file_dlsym
-    int32_t prejit_index        // index into PreJIT table; =>0 if unchecked.
-)
-{
+    //--------------------------------------------------------------------------
+    // do the rest inside a critical section
+    //--------------------------------------------------------------------------
 
-    size_t siz = 0 ;
-    ASSERT_TABLE_OK ;
+    if (!done)
+    {
+        #pragma omp critical (GB_jitifyer_worker)
+        { 
+            info = GB_jitifyer_load2_worker (dl_function, family, kname, hash,
+                encoding, suffix, semiring, monoid, op, type1, type2, type3) ;
+        }
+    }
 
     //--------------------------------------------------------------------------
-    // ensure the hash table is large enough
+    // release the kernel if it is not a CPU kernel that will be used
     //--------------------------------------------------------------------------
 
-    if (GB_jit_table == NULL)
+    if (info != GrB_SUCCESS || encoding->kcode >= GB_JIT_CUDA_KERNEL)
     { 
+        GB_jitifyer_release ( ) ;
+    }
+    return (info) ;
+}
 
-        //----------------------------------------------------------------------
-        // allocate the initial hash table
-        //----------------------------------------------------------------------
-
-        siz = GB_JITIFIER_INITIAL_SIZE * sizeof (struct GB_jit_entry_struct) ;
-        GB_MALLOC_PERSISTENT (GB_jit_table, siz) ;
-        if (GB_jit_table == NULL)
-        {
-            // JIT error: out of memory
-            return (false) ;
-        }
-        memset (GB_jit_table, 0, siz) ;
-        GB_jit_table_size = GB_JITIFIER_INITIAL_SIZE ;
-        GB_jit_table_bits = GB_JITIFIER_INITIAL_SIZE - 1 ; 
-        GB_jit_table_allocated = siz ;
+//------------------------------------------------------------------------------
+// GB_jitifyer_load2_worker: do the work for GB_jitifyer_load in a critical section
+//------------------------------------------------------------------------------
 
-    }
-    else if (4 * GB_jit_table_populated >= GB_jit_table_size)
-    {
+GrB_Info GB_jitifyer_load2_worker
+(
+    // output:
+    void **dl_function,         // pointer to JIT kernel
+    // input:
+    GB_jit_family family,       // kernel family
+    const char *kname,          // kname for the kernel_name
+    uint64_t hash,              // hash code for the kernel
+    GB_jit_encoding *encoding,  // encoding of the problem
+    const char *suffix,         // suffix for the kernel_name (NULL if none)
+    // operator and type definitions
+    GrB_Semiring semiring,
+    GrB_Monoid monoid,
+    GB_Operator op,
+    GrB_Type type1,
+    GrB_Type type2,
+    GrB_Type type3
+)
+{
 
-        //----------------------------------------------------------------------
-        // expand the existing hash table by a factor of 4 and rehash
-        //----------------------------------------------------------------------
+    //--------------------------------------------------------------------------
+    // look up the kernel in the hash table
+    //--------------------------------------------------------------------------
 
-        ASSERT_TABLE_OK ;
-        // create a new table that is four times the size
-        int64_t new_size = 4 * GB_jit_table_size ;
-        int64_t new_bits = new_size - 1 ;
-        siz = new_size * sizeof (struct GB_jit_entry_struct) ;
-        GB_jit_entry *new_table ;
-        GB_MALLOC_PERSISTENT (new_table, siz) ;
-        if (new_table == NULL)
+    int64_t k1 = -1, kk = -1 ;
+    (*dl_function) = GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) ;
+    if ((*dl_function) != NULL)
+    { 
+        // found the kernel in the hash table
+        GB_jit_entry *e = &(GB_jit_table [kk]) ;
+        if (k1 >= 0)
         {
-            // JIT error: out of memory; leave the existing table as-is
-            return (false) ;
+            // unchecked PreJIT kernel, or kernel from the bundle of JIT
+            // kernels; check it now
+            GB_jit_query_func dl_query ;
+            if (k1 < GB_jit_bundle_offset)
+            { 
+                // PreJIT kernel
+                void **Kernels = NULL ;
+                void **Queries = NULL ;
+                char **Names = NULL ;
+                int32_t nkernels = 0 ;
+                GB_prejit (&nkernels, &Kernels, &Queries, &Names) ;
+                dl_query = (GB_jit_query_func) Queries [k1] ;
+            }
+            else
+            { 
+                // kernel from the bundle
+                dl_query = (GB_jit_query_func)
+                    GB_jit_bundle_queries [k1 - GB_jit_bundle_offset] ;
+            }
+            bool builtin = (encoding->suffix_len == 0) ;
+            bool ok = GB_jitifyer_query (dl_query, builtin, hash, semiring,
+                monoid, op, type1, type2, type3) ;
+            if (ok)
+            { 
+                // PreJIT kernel is fine; flag it as checked by flipping
+                // its prejit_index.
+                GBURBLE ((k1 < GB_jit_bundle_offset) ? "(prejit: ok) " :
+                    "(jit bundle: ok) ") ;
+                GB_ATOMIC_WRITE
+                e->prejit_index = GB_FLIP (k1) ;
+                return (GrB_SUCCESS) ;
+            }
+            else
+            { 
+                // remove the PreJIT kernel from the hash table; do not return.
+                // Instead, keep going and compile a JIT kernel.
+                GBURBLE ((k1 < GB_jit_bundle_offset) ? "(prejit: disabled) " :
+                    "(jit bundle: disabled) ") ;
+                GB_jitifyer_entry_free (e) ;
+            }
         }
-
-        // rehash into the new table
-        memset (new_table, 0, siz) ;
-        for (uint64_t k = 0 ; k < GB_jit_table_size ; k++)
+        else if (family == GB_jit_user_op_family)
         {
-            if (GB_jit_table [k].dl_function != NULL)
+            // user-defined operator; check it now
+            GB_user_op_f GB_user_op = (GB_user_op_f) (*dl_function) ;
+            void *ignore ;
+            char *defn ;
+            GB_user_op (&ignore, &defn) ;
+            if (strcmp (defn, op->defn) == 0)
             { 
-                // rehash the entry to the larger hash table
-                uint64_t hash = GB_jit_table [k].hash ;
-                for (uint64_t knew = hash ; ; knew++)
-                {
-                    knew = knew & new_bits ;
-                    GB_jit_entry *e = &(new_table [knew]) ;
-                    if (e->dl_function == NULL)
-                    { 
-                        // found an empty slot in the new table
-                        new_table [knew] = GB_jit_table [k] ;
-                        break ;
-                    }
-                }
+                return (GrB_SUCCESS) ;
+            }
+            else
+            { 
+                // the op has changed; need to re-JIT the kernel; do not return.
+                // Instead, keep going and compile a JIT kernel.
+                GBURBLE ("(jit: op changed) ") ;
+                GB_jitifyer_entry_free (e) ;
+            }
+        }
+        else if (family == GB_jit_user_type_family)
+        {
+            // user-defined type; check it now
+            GB_user_type_f GB_user_type = (GB_user_type_f) (*dl_function) ;
+            size_t ignore ;
+            char *defn ;
+            GB_user_type (&ignore, &defn) ;
+            if (strcmp (defn, type1->defn) == 0)
+            { 
+                return (GrB_SUCCESS) ;
+            }
+            else
+            { 
+                // type has changed; need to re-JIT the kernel; do not return.
+                // Instead, keep going and compile a JIT kernel.
+                GBURBLE ("(jit: type changed) ") ;
+                GB_jitifyer_entry_free (e) ;
             }
         }
+        else
+        { 
+            // JIT kernel, or checked PreJIT kernel
+            return (GrB_SUCCESS) ;
+        }
+    }
 
-        // free the old table
-        GB_FREE_STUFF (GB_jit_table) ;
+    //--------------------------------------------------------------------------
+    // quick return if not in the hash table and load/compile is disabled
+    //--------------------------------------------------------------------------
 
-        // use the new table
-        GB_jit_table = new_table ;
-        GB_jit_table_size = new_size ;
-        GB_jit_table_bits = new_bits ;
-        GB_jit_table_allocated = siz ;
-        ASSERT_TABLE_OK ;
+    #ifndef NJIT
+    if (GB_jitifyer_kernel_options (NULL, NULL, NULL, NULL, semiring, monoid, op,
+        type1, type2, type3) <= GxB_JIT_RUN)
+    #endif
+    { 
+        // No kernels may be loaded or compiled, but existing kernels already
+        // loaded may be run (handled above if dl_function was found).  This
+        // kernel was not loaded, so punt to generic.
+        return (GrB_NO_VALUE) ;
     }
 
     //--------------------------------------------------------------------------
-    // insert the jit entry in the hash table
+    // construct the kernel name
     //--------------------------------------------------------------------------
 
-    uint64_t suffix_len = (uint64_t) (encoding->suffix_len) ;
-    bool builtin = (bool) (suffix_len == 0) ;
-    ASSERT_TABLE_OK ;
+    #ifndef NJIT
+    GB_Operator op1 = NULL ;
+    GB_Operator op2 = NULL ;
+    int scode_digits = GB_jit_scode_digits [family] ;
 
-    for (uint64_t k = hash ; ; k++)
+    switch (family)
     {
-        k = k & GB_jit_table_bits ;
-        GB_jit_entry *e = &(GB_jit_table [k]) ;
-        if (e->dl_function == NULL)
+        case GB_jit_apply_family  : 
+            op1 = op ;
+            break ;
+
+        case GB_jit_assign_family : 
+            op1 = op ;
+            break ;
+
+        case GB_jit_build_family  : 
+            op1 = op ;
+            break ;
+
+        case GB_jit_ewise_family  : 
+            op1 = op ;
+            break ;
+
+        case GB_jit_mxm_family    : 
+            monoid = semiring->add ;
+            op1 = (GB_Operator) semiring->add->op ;
+            op2 = (GB_Operator) semiring->multiply ;
+            break ;
+
+        case GB_jit_reduce_family : 
+            op1 = (GB_Operator) monoid->op ;
+            break ;
+
+        case GB_jit_select_family : 
+            op1 = op ;
+            break ;
+
+        case GB_jit_user_type_family : 
+            break ;
+
+        case GB_jit_user_op_family : 
+            op1 = op ;
+            break ;
+
+        default: ;
+    }
+
+    char kernel_name [GB_KLEN] ;
+    GB_macrofy_name (kernel_name, "GB_jit", kname, encoding->dim,
+        scode_digits, encoding->code, suffix) ;
+
+    //--------------------------------------------------------------------------
+    // check if the kernel is still being compiled in the background
+    //--------------------------------------------------------------------------
+
+    uint32_t bucket = hash & 0xFF ;
+    int64_t kpending = GB_jitifyer_pending_find (hash, encoding, suffix) ;
+    if (kpending >= 0)
+    {
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%02x/%s%s%s",
+            GB_jit_cache_path, bucket, GB_LIB_PREFIX, kernel_name,
+            GB_LIB_SUFFIX) ;
+        bool lib_exists = GB_file_exists (GB_jit_temp) ;
+        // get the exit status of the background compilation, if it is done
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.status",
+            GB_jit_cache_path, bucket, kernel_name) ;
+        int status = -1 ;
+        bool done = lib_exists ;
+        if (!done)
         { 
-            // found an empty slot
-            e->suffix = NULL ;
-            if (!builtin)
+            FILE *fp = fopen (GB_jit_temp, "r") ;
+            if (fp != NULL)
             { 
-                // allocate the suffix if the kernel is not builtin
-                GB_MALLOC_PERSISTENT (e->suffix, suffix_len+2) ;
-                if (e->suffix == NULL)
-                {
-                    // JIT error: out of memory
-                    return (false) ;
-                }
-                strncpy (e->suffix, suffix, suffix_len+1) ;
+                done = (fscanf (fp, "%d", &status) == 1) ;
+                fclose (fp) ;
             }
-            e->hash = hash ;
-            memcpy (&(e->encoding), encoding, sizeof (GB_jit_encoding)) ;
-            e->dl_handle = dl_handle ;              // NULL for PreJIT
-            e->dl_function = dl_function ;
-            GB_jit_table_populated++ ;
-            e->prejit_index = prejit_index ;        // -1 for JIT kernels
-            ASSERT_TABLE_OK ;
-            return (true) ;
         }
-        // otherwise, keep looking
+        if (!done)
+        {
+            int64_t elapsed = (int64_t) time (NULL) -
+                GB_jit_pending [kpending].last_used ;
+            if (elapsed < GB_JIT_ASYNC_TIMEOUT)
+            { 
+                // the kernel is not yet ready, so punt to generic
+                GBURBLE ("(jit: compiling in background) ") ;
+                return (GrB_NO_VALUE) ;
+            }
+        }
+        // The background compilation has finished, failed, or timed out.
+        GB_jitifyer_pending_remove (kpending) ;
+        remove (GB_jit_temp) ;
+        if (!lib_exists && status != 0)
+        { 
+            // the compilation failed, or has not finished in time, so punt to
+            // generic; the compiler errors are in GxB_JIT_ERROR_LOG, if set
+            GBURBLE (done ? "(jit: compiler error; compilation disabled) " :
+                "(jit: compiler timeout; compilation disabled) ") ;
+            // disable the JIT to avoid repeated compilation errors
+            GB_jit_control = GxB_JIT_LOAD ;
+            return (GrB_NO_VALUE) ;
+        }
+        // Load the kernel below, which also inserts it into the hash table.
+        // If the lib*.so file has since been removed from the cache, it is
+        // compiled again.
+    }
+
+    //--------------------------------------------------------------------------
+    // lock the kernel
+    //--------------------------------------------------------------------------
+
+    // FIXME: add kernel_name to the lock filename.  If the lock fails,
+    // sleep for 1 second and try again repeatedly, with a timeout limit of
+    // (say) 60 seconds.
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+        "%s/lock/%02x/%016" PRIx64 "_lock", GB_jit_cache_path, bucket, hash) ;
+    FILE *fp_klock = NULL ;
+    int fd_klock = -1 ;
+    if (!GB_file_open_and_lock (GB_jit_temp, &fp_klock, &fd_klock))
+    {
+        // JIT error: unable to lock the kernel
+        // disable the JIT to avoid repeated load errors
+        GB_jit_control = GxB_JIT_RUN ;
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // load the kernel, compiling it if needed
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_jitifyer_load_worker (dl_function, kernel_name, family,
+        kname, hash, encoding, suffix, semiring, monoid, op, op1, op2,
+        type1, type2, type3) ;
+
+    //--------------------------------------------------------------------------
+    // unlock the kernel
+    //--------------------------------------------------------------------------
+
+    GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
+    return (info) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_copy: copy bytes from one file to another
+//------------------------------------------------------------------------------
+
+// Copies nbytes from src to dst, and returns the # of bytes read from src.
+// If dst is NULL, the bytes are read from src and discarded.
+
+static int64_t GB_jitifyer_copy (FILE *dst, FILE *src, int64_t nbytes)
+{
+    char buf [4096] ;
+    int64_t nread = 0 ;
+    while (nread < nbytes)
+    {
+        size_t n = (size_t) GB_IMIN (nbytes - nread, 4096) ;
+        n = fread (buf, 1, n, src) ;
+        if (n == 0) break ;
+        if (dst != NULL) fwrite (buf, 1, n, dst) ;
+        nread += (int64_t) n ;
+    }
+    return (nread) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_record: append a kernel to the manifest file
+//------------------------------------------------------------------------------
+
+// If GxB_JIT_MANIFEST has been set, each CPU kernel loaded by
+// GB_jitifyer_load_worker is appended to the manifest, as a single header
+// line followed by the nbytes of the kernel source from the cache:
+//
+//      GB_jit_manifest hash kernel_name nbytes
+//
+// The source is held in the manifest so that GB_jitifyer_warmup can compile
+// the kernel in an empty cache, since the operators and types used to create
+// the source are not available there.  If the source is no longer in the
+// cache, nbytes is zero.  Any error is ignored; the manifest is only a hint.
+
+static void GB_jitifyer_record
+(
+    char *kernel_name,          // kernel file name (excluding the path)
+    uint64_t hash               // hash code for the kernel
+)
+{
+
+    if (GB_STRLEN (GB_jit_manifest) == 0)
+    { 
+        // no manifest is being recorded
+        return ;
+    }
+
+    FILE *fm = fopen (GB_jit_manifest, "a") ;
+    if (fm == NULL)
+    { 
+        return ;
+    }
+
+    // find the size of the kernel source
+    uint32_t bucket = hash & 0xFF ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.c",
+        GB_jit_cache_path, bucket, kernel_name) ;
+    FILE *fp = fopen (GB_jit_temp, "r") ;
+    int64_t nbytes = 0 ;
+    if (fp != NULL && fseek (fp, 0, SEEK_END) == 0)
+    { 
+        nbytes = GB_IMAX ((int64_t) ftell (fp), 0) ;
+        rewind (fp) ;
+    }
+
+    // append the header and the source to the manifest
+    fprintf (fm, "GB_jit_manifest %016" PRIx64 " %s %" PRId64 "\n",
+        hash, kernel_name, nbytes) ;
+    int64_t nread = (fp == NULL) ? 0 : GB_jitifyer_copy (fm, fp, nbytes) ;
+    for ( ; nread < nbytes ; nread++)
+    { 
+        // the source file was truncated; pad the manifest to nbytes
+        fputc ('\n', fm) ;
+    }
+
+    if (fp != NULL) fclose (fp) ;
+    fclose (fm) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_load_worker: load/compile a kernel
+//------------------------------------------------------------------------------
+
+// This work is done inside a critical section for this process, and inside a
+// file lock/unlock section (fp_klock) to guard against access from other
+// processes.
+
+GrB_Info GB_jitifyer_load_worker
+(
+    // output:
+    void **dl_function,         // pointer to JIT kernel
+    // input:
+    char *kernel_name,          // kernel file name (excluding the path)
+    GB_jit_family family,       // kernel family
+    const char *kname,          // kname for the kernel_name
+    uint64_t hash,              // hash code for the kernel
+    GB_jit_encoding *encoding,  // encoding of the problem
+    const char *suffix,         // suffix for the kernel_name (NULL if none)
+    // operator and type definitions
+    GrB_Semiring semiring,
+    GrB_Monoid monoid,
+    GB_Operator op,
+    GB_Operator op1,
+    GB_Operator op2,
+    GrB_Type type1,
+    GrB_Type type2,
+    GrB_Type type3
+)
+{
+
+    #ifndef NJIT
+
+    double t_load = GB_omp_get_wtime ( ) ;
+    bool compiled = false ;
+    GxB_JIT_Control control = GB_jitifyer_kernel_options (NULL, NULL, NULL, NULL,
+        semiring, monoid, op, type1, type2, type3) ;
+
+    //--------------------------------------------------------------------------
+    // try to load the lib*.so from the user's library folder
+    //--------------------------------------------------------------------------
+
+    uint32_t bucket = hash & 0xFF ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%02x/%s%s%s",
+        GB_jit_cache_path, bucket, GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX) ;
+    void *dl_handle = GB_file_dlopen (GB_jit_temp) ;
+    GB_jit_kcode kcode = encoding->kcode ;
+
+    //--------------------------------------------------------------------------
+    // check if the kernel was found, but needs to be compiled anyway
+    //--------------------------------------------------------------------------
+
+    if (dl_handle != NULL)
+    { 
+        // library is loaded but make sure the defn match
+        GB_jit_query_func dl_query = (GB_jit_query_func)
+            GB_file_dlsym (dl_handle, "GB_jit_query") ;
+        bool ok = (dl_query != NULL) ;
+        if (ok)
+        { 
+            bool builtin = (encoding->suffix_len == 0) ;
+            ok = GB_jitifyer_query (dl_query, builtin, hash, semiring,
+                monoid, op, type1, type2, type3) ;
+        }
+        if (!ok)
+        { 
+            // library is loaded but needs to change, so close it
+            GB_file_dlclose (dl_handle) ; dl_handle = NULL ;
+            // remove the library itself so it doesn't cause the error again
+            remove (GB_jit_temp) ;
+            GBURBLE ("(jit: loaded but must recompile) ") ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // create and compile source file, if needed
+    //--------------------------------------------------------------------------
+
+    if (dl_handle == NULL)
+    { 
+
+        //----------------------------------------------------------------------
+        // quick return if the JIT is not permitted to compile new kernels
+        //----------------------------------------------------------------------
+
+        if (control < GxB_JIT_ON)
+        { 
+            // No new kernels may be compiled, so punt to generic.
+            GBURBLE ("(jit: not compiled) ") ;
+            return (GrB_NO_VALUE) ;
+        }
+
+        //----------------------------------------------------------------------
+        // create the source, compile it, and load it
+        //----------------------------------------------------------------------
+
+        bool async = GB_jitifyer_async (control, family, kcode) ;
+        GBURBLE (async ? "(jit: compile in background) " :
+            "(jit: compile and load) ") ;
+        const char *kernel_filetype =
+            (kcode < GB_JIT_CUDA_KERNEL) ? "c" : "cu" ;
+
+        // get the C flags of the types, operators, and semiring of the kernel
+        if (GB_jitifyer_kernel_C_flags (semiring, monoid, op, type1, type2,
+            type3) != GrB_SUCCESS)
+        { 
+            // JIT error: out of memory
+            GB_jit_control = GxB_JIT_PAUSE ;
+            return (GrB_NO_VALUE) ;
+        }
+
+        // create (or recreate) the kernel source, compile it, and load it.
+        // The source is written to a temporary file and then renamed, since
+        // another process may still be compiling it in the background.
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.%s.tmp",
+            GB_jit_cache_path, bucket, kernel_name, kernel_filetype) ;
+        FILE *fp = fopen (GB_jit_temp, "w") ;
+        if (fp != NULL)
+        { 
+            // create the preface
+            GB_macrofy_preface (fp, kernel_name,
+                GB_jit_C_preface, GB_jit_CUDA_preface, kcode) ;
+            // record the C flags of the kernel, and the object files linked
+            // into it, so that it can be compiled again from its source alone
+            // (see GB_jitifyer_kernel_C_flags_read)
+            if (GB_STRLEN (GB_jit_kernel_C_flags) > 0)
+            { 
+                fprintf (fp, GB_FLAGS_MARKER "%s\n", GB_jit_kernel_C_flags) ;
+            }
+            if (GB_STRLEN (GB_jit_kernel_C_objects) > 0)
+            { 
+                fprintf (fp, GB_OBJECTS_MARKER "%s\n",
+                    GB_jit_kernel_C_objects) ;
+            }
+            // macrofy the kernel operators, types, and matrix formats
+            GB_macrofy_family (fp, family, encoding->code, semiring,
+                monoid, op, type1, type2, type3) ;
+            if (encoding->dim > 0)
+            { 
+                // the kernel is specialized for a fixed # of rows of C
+                fprintf (fp, "\n// fixed dimension:\n#define GB_C_NROWS %d\n",
+                    (int) encoding->dim) ;
+            }
+            // #include the kernel, renaming it for the PreJIT
+            fprintf (fp, "#ifndef GB_JIT_RUNTIME\n"
+                         "#define GB_jit_kernel %s\n"
+                         "#define GB_jit_query  %s_query\n"
+                         "#endif\n"
+                         "#include \"template/GB_jit_kernel_%s.%s\"\n",
+                         kernel_name, kernel_name, kname,
+                         kernel_filetype) ;
+
+            // macrofy the query function
+            bool builtin = (encoding->suffix_len == 0) ;
+            GB_macrofy_query (fp, builtin, monoid, op1, op2, type1, type2,
+                type3, hash, kcode) ;
+            fclose (fp) ;
+            // rename the source file; rename fails on Windows if the file
+            // already exists, so remove it first in that case
+            size_t len = strlen (GB_jit_temp) + 1 ;
+            char *source = GB_jit_temp + len ;
+            snprintf (source, GB_jit_temp_allocated - len, "%s/c/%02x/%s.%s",
+                GB_jit_cache_path, bucket, kernel_name, kernel_filetype) ;
+            if (rename (GB_jit_temp, source) != 0)
+            { 
+                remove (source) ;
+                rename (GB_jit_temp, source) ;
+            }
+        }
+
+        // if the source file was not created above, the compilation will
+        // gracefully fail.
+
+        if (async)
+        {
+            // Compile the kernel in a background process and punt to generic
+            // for now.  A subsequent call to GB_jitifyer_load2_worker loads
+            // the kernel into the hash table once the lib*.so file exists.
+            if (!GB_jitifyer_pending_add (hash, encoding, suffix))
+            { 
+                // JIT error: out of memory
+                GB_jitifyer_kernel_C_flags_clear ( ) ;
+                GB_jit_control = GxB_JIT_PAUSE ;
+                return (GrB_NO_VALUE) ;
+            }
+            // remove the exit status of any prior compilation
+            snprintf (GB_jit_temp, GB_jit_temp_allocated,
+                "%s/c/%02x/%s.status", GB_jit_cache_path, bucket, kernel_name);
+            remove (GB_jit_temp) ;
+            GB_jitifyer_direct_compile (kernel_name, bucket, true) ;
+            GB_jitifyer_kernel_C_flags_clear ( ) ;
+            return (GrB_NO_VALUE) ;
+        }
+
+        // compile the kernel to get the lib*.so file
+        if (kcode >= GB_JIT_CUDA_KERNEL)
+        {
+            // use NVCC to directly compile the CUDA kernel
+            GB_jitifyer_nvcc_compile (kernel_name, bucket) ;
+        }
+        else if (GB_jit_use_libtcc && GB_STRLEN (GB_jit_kernel_C_objects) == 0
+            && GB_jitifyer_libtcc_compile (kernel_name, bucket))
+        { 
+            // the CPU kernel has been compiled in this process with libtcc.
+            // tcc cannot link the object files of operators
+            // (GxB_JIT_C_OBJECT), and it cannot compile kernels that do
+            // complex arithmetic, so those kernels are compiled with cmake or
+            // the C compiler instead.
+        }
+        else if (GB_jit_use_cmake)
+        { 
+            // use cmake to compile the CPU kernel
+            GB_jitifyer_cmake_compile (kernel_name, hash) ;
+        }
+        else
+        { 
+            // use the compiler to directly compile the CPU kernel
+            GB_jitifyer_direct_compile (kernel_name, bucket, false) ;
+        }
+        GB_jitifyer_kernel_C_flags_clear ( ) ;
+        compiled = true ;
+
+        // load the kernel from the lib*.so file
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%02x/%s%s%s",
+            GB_jit_cache_path, bucket, GB_LIB_PREFIX, kernel_name,
+            GB_LIB_SUFFIX) ;
+        dl_handle = GB_file_dlopen (GB_jit_temp) ;
+
+        //----------------------------------------------------------------------
+        // handle any error conditions
+        //----------------------------------------------------------------------
+
+        if (dl_handle == NULL)
+        { 
+            // unable to create the kernel source or open lib*.so file
+            GBURBLE ("(jit: compiler error; compilation disabled) ") ;
+            // disable the JIT to avoid repeated compilation errors
+            GB_jit_control = GxB_JIT_LOAD ;
+            // remove the compiled library
+            remove (GB_jit_temp) ;
+            return (GrB_NO_VALUE) ;     // FIXME: use another error code?
+        }
+
+    }
+    else
+    { 
+        if (kcode >= GB_JIT_CUDA_KERNEL)
+        {
+            GBURBLE ("(jit: cuda load) ") ;
+        }
+        else
+        {
+            GBURBLE ("(jit: cpu load) ") ;
+        }
+        if (GB_jit_cache_max_size > 0)
+        { 
+            // mark the kernel as recently used, for GxB_JIT_CACHE_MAX_SIZE
+            GB_file_touch (GB_jit_temp) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // get the GB_jit_kernel function pointer
+    //--------------------------------------------------------------------------
+
+    (*dl_function) = GB_file_dlsym (dl_handle, "GB_jit_kernel") ;
+    if ((*dl_function) == NULL)
+    {
+        // JIT error: dlsym unable to find GB_jit_kernel: punt to generic
+        GBURBLE ("(jit: load error; JIT loading disabled) ") ;
+        GB_file_dlclose (dl_handle) ; dl_handle = NULL ;
+        // disable the JIT to avoid repeated loading errors
+        GB_jit_control = GxB_JIT_RUN ;
+        // remove the compiled library
+        remove (GB_jit_temp) ;
+        return (GrB_NO_VALUE) ;     // FIXME: use another error code?
+    }
+
+    // insert the new kernel into the hash table
+    if (!GB_jitifyer_insert (hash, encoding, suffix, dl_handle, (*dl_function),
+        -1))
+    {
+        // The kernel cannot be added to the hash table now, either because
+        // the table is out of memory, or its retired tables are still in use.
+        // The kernel is fine, so keep it in the cache and the JIT enabled, and
+        // punt to generic for this call only.
+        GBURBLE ("(jit: not cached) ") ;
+        GB_file_dlclose (dl_handle) ; dl_handle = NULL ;
+        (*dl_function) = NULL ;
+        return (GrB_NO_VALUE) ;
+    }
+
+    // record the time taken to compile and/or load the kernel
+    void *ignore ;
+    GB_jit_entry *table ;
+    GB_jit_entry *e = GB_jitifyer_find (hash, encoding, suffix, &ignore,
+        &table) ;
+    if (e != NULL)
+    { 
+        e->load_time = GB_omp_get_wtime ( ) - t_load ;
+    }
+
+    // record the kernel in the manifest, if requested
+    if (kcode < GB_JIT_CUDA_KERNEL)
+    { 
+        GB_jitifyer_record (kernel_name, hash) ;
+    }
+
+    // enforce the limits on the # of loaded kernels and the size of the cache
+    GB_jitifyer_evict ( ) ;
+    if (compiled)
+    { 
+        GB_jitifyer_cache_trim ( ) ;
+    }
+
+    return (GrB_SUCCESS) ;
+    #else
+    (*dl_function) = NULL ;
+    return (GrB_INVALID_VALUE) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_evictable: true if a kernel may be evicted from the hash table
+//------------------------------------------------------------------------------
+
+// PreJIT kernels and kernels in a bundle have no dl_handle of their own, and
+// the functions of user-defined operators are kept in the operators
+// themselves, so these kernels are never evicted.  CUDA kernels are not
+// evicted either.
+
+static inline bool GB_jitifyer_evictable (GB_jit_entry *e)
+{ 
+    GB_jit_kcode kcode = e->encoding.kcode ;
+    return (e->hash != 0 && e->dl_handle != NULL &&
+        kcode < GB_JIT_CUDA_KERNEL &&
+        kcode != GB_JIT_KERNEL_USEROP && kcode != GB_JIT_KERNEL_USERTYPE) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_find:  find a jit entry in the hash table
+//------------------------------------------------------------------------------
+
+// Returns the entry in the hash table, or NULL if not found.  This may be
+// done outside the critical section (see GB_jitifyer_lookup).
+
+static GB_jit_entry *GB_jitifyer_find
+(
+    // input:
+    uint64_t hash,          // hash = GB_jitifyer_hash_encoding (encoding) ;
+    GB_jit_encoding *encoding,
+    const char *suffix,
+    // output
+    void **dl_function,     // kernel function of the entry
+    GB_jit_entry **table_handle     // hash table containing the entry
+)
+{
+
+    (*dl_function) = NULL ;
+
+    // get the hash table; this may be done outside the critical section, so
+    // the bits must be read before the table itself.  GB_jitifyer_insert
+    // publishes a table before its bits, and a table is never smaller than any
+    // table before it, so the bits are never too large for the table.
+    uint64_t table_bits ;
+    GB_ATOMIC_READ
+    table_bits = GB_jit_table_bits ;
+    GB_jit_entry *table ;
+    GB_ATOMIC_READ
+    table = GB_jit_table ;
+    (*table_handle) = table ;
+
+    if (table == NULL || table_bits == 0)
+    { 
+        // no table yet, or its bits are not yet published, so the entry isn't
+        // present
+        return (NULL) ;
+    }
+
+    uint32_t suffix_len = encoding->suffix_len ;
+    bool builtin = (bool) (suffix_len == 0) ;
+
+    // look up the entry in the hash table
+    for (uint64_t k = hash ; ; k++)
+    {
+        k = k & table_bits ;
+        GB_jit_entry *e = &(table [k]) ;
+        void *e_function ;
+        GB_ATOMIC_READ
+        e_function = e->dl_function ;
+        uint64_t e_hash ;
+        GB_ATOMIC_READ
+        e_hash = e->hash ;      // zero if the kernel has been evicted
+        if (e_function == NULL)
+        { 
+            // found an empty entry, so the entry is not in the table
+            return (NULL) ;
+        }
+        else if (e_hash == hash &&
+            e->encoding.code == encoding->code &&
+            e->encoding.kcode == encoding->kcode &&
+            e->encoding.dim == encoding->dim &&
+            e->encoding.suffix_len == suffix_len &&
+            (builtin || (memcmp (e->suffix, suffix, suffix_len) == 0)))
+        { 
+            // found the right entry
+            (*dl_function) = e_function ;
+            return (e) ;
+        }
+        // otherwise, keep looking
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_lookup:  find a jit entry in the hash table
+//------------------------------------------------------------------------------
+
+void *GB_jitifyer_lookup    // return dl_function pointer, or NULL if not found
+(
+    // input:
+    uint64_t hash,          // hash = GB_jitifyer_hash_encoding (encoding) ;
+    GB_jit_encoding *encoding,
+    const char *suffix,
+    // output
+    int64_t *k1,            // location of unchecked kernel in PreJIT table
+    int64_t *kk             // location of hash entry in hash table
+)
+{
+
+    (*k1) = -1 ;
+    void *dl_function ;
+    GB_jit_entry *table ;
+    GB_jit_entry *e = GB_jitifyer_find (hash, encoding, suffix, &dl_function,
+        &table) ;
+    if (e == NULL)
+    { 
+        // the entry is not in the table
+        return (NULL) ;
+    }
+
+    // record the use of the kernel, for GxB_JIT_MAX_LOADED
+    int64_t max_loaded ;
+    GB_ATOMIC_READ
+    max_loaded = GB_jit_max_loaded ;
+    if (max_loaded > 0)
+    { 
+        int64_t t ;
+        GB_ATOMIC_CAPTURE_INC64 (t, GB_jit_clock) ;
+        GB_ATOMIC_WRITE
+        e->last_used = t ;
+    }
+
+    // found the right entry: return the corresponding dl_function
+    int64_t my_k1 ;
+    GB_ATOMIC_READ
+    my_k1 = e->prejit_index ;   // >= 0: unchecked JIT kernel
+    (*k1) = my_k1 ;
+    (*kk) = e - table ;
+    return (dl_function) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_insert:  insert a jit entry in the hash table
+//------------------------------------------------------------------------------
+
+bool GB_jitifyer_insert         // return true if successful, false if failure
+(
+    // input:
+    uint64_t hash,              // hash for the problem
+    GB_jit_encoding *encoding,  // primary encoding
+    const char *suffix,         // suffix for user-defined types/operators
+    void *dl_handle,            // library handle from GB_file_dlopen;
+                                // NULL for PreJIT
+    void *dl_function,          // function handle from GB_file_dlsym
+    int32_t prejit_index        // index into PreJIT table; =>0 if unchecked.
+)
+{
+
+    size_t siz = 0 ;
+    ASSERT_TABLE_OK ;
+
+    //--------------------------------------------------------------------------
+    // ensure the hash table is large enough
+    //--------------------------------------------------------------------------
+
+    if (GB_jit_table == NULL)
+    { 
+
+        //----------------------------------------------------------------------
+        // allocate the initial hash table
+        //----------------------------------------------------------------------
+
+        // the new table is no smaller than a table that GB_jitifyer_find
+        // may still be reading
+        int64_t new_size = GB_IMAX (GB_JITIFIER_INITIAL_SIZE,
+            GB_jit_table_size_retired) ;
+        siz = new_size * sizeof (struct GB_jit_entry_struct) ;
+        GB_jit_entry *new_table ;
+        GB_MALLOC_PERSISTENT (new_table, siz) ;
+        if (new_table == NULL)
+        {
+            // JIT error: out of memory
+            return (false) ;
+        }
+        memset (new_table, 0, siz) ;
+
+        // publish the new table, and then its bits
+        GB_ATOMIC_WRITE
+        GB_jit_table = new_table ;
+        GB_jit_table_size = new_size ;
+        GB_ATOMIC_WRITE
+        GB_jit_table_bits = new_size - 1 ; 
+        GB_jit_table_allocated = siz ;
+
+    }
+    else if (4 * GB_jit_table_populated >= GB_jit_table_size)
+    {
+
+        //----------------------------------------------------------------------
+        // expand the existing hash table by a factor of 4 and rehash
+        //----------------------------------------------------------------------
+
+        ASSERT_TABLE_OK ;
+        if (GB_jit_nretired == GB_JIT_RETIRED_MAX)
+        { 
+            // free any retired tables no longer in use
+            GB_jitifyer_reclaim (false) ;
+        }
+        if (GB_jit_nretired == GB_JIT_RETIRED_MAX)
+        { 
+            // the old table cannot be retired yet, so it cannot be rebuilt
+            return (false) ;
+        }
+        // count the entries, excluding evicted kernels
+        int64_t nlive = 0 ;
+        for (uint64_t k = 0 ; k < GB_jit_table_size ; k++)
+        {
+            GB_jit_entry *e = &(GB_jit_table [k]) ;
+            if (e->dl_function != NULL && e->hash != 0)
+            { 
+                nlive++ ;
+            }
+        }
+        // create a new table that is four times the size, or the same size if
+        // the table is mostly full of evicted kernels
+        int64_t new_size = 4 * GB_jit_table_size ;
+        if (8 * nlive < GB_jit_table_size)
+        { 
+            new_size = GB_jit_table_size ;
+        }
+        int64_t new_bits = new_size - 1 ;
+        siz = new_size * sizeof (struct GB_jit_entry_struct) ;
+        GB_jit_entry *new_table ;
+        GB_MALLOC_PERSISTENT (new_table, siz) ;
+        if (new_table == NULL)
+        {
+            // JIT error: out of memory; leave the existing table as-is
+            return (false) ;
+        }
+
+        // rehash into the new table
+        memset (new_table, 0, siz) ;
+        for (uint64_t k = 0 ; k < GB_jit_table_size ; k++)
+        {
+            if (GB_jit_table [k].dl_function != NULL &&
+                GB_jit_table [k].hash != 0)
+            { 
+                // rehash the entry to the larger hash table
+                uint64_t hash = GB_jit_table [k].hash ;
+                for (uint64_t knew = hash ; ; knew++)
+                {
+                    knew = knew & new_bits ;
+                    GB_jit_entry *e = &(new_table [knew]) ;
+                    if (e->dl_function == NULL)
+                    { 
+                        // found an empty slot in the new table
+                        new_table [knew] = GB_jit_table [k] ;
+                        break ;
+                    }
+                }
+            }
+        }
+
+        // retire the old table, since GB_jitifyer_lookup may be reading it
+        GB_jit_retired [GB_jit_nretired] = GB_jit_table ;
+        GB_jit_retired_allocated [GB_jit_nretired] = GB_jit_table_allocated ;
+        GB_jit_nretired++ ;
+        GB_ATOMIC_WRITE
+        GB_jit_reclaim_pending = true ;
+
+        // publish the new table, and then its bits
+        GB_ATOMIC_WRITE
+        GB_jit_table = new_table ;
+        GB_jit_table_size = new_size ;
+        GB_ATOMIC_WRITE
+        GB_jit_table_bits = new_bits ;
+        GB_jit_table_allocated = siz ;
+        GB_jit_table_populated = nlive ;
+        ASSERT_TABLE_OK ;
+        GB_jitifyer_reclaim (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // insert the jit entry in the hash table
+    //--------------------------------------------------------------------------
+
+    uint64_t suffix_len = (uint64_t) (encoding->suffix_len) ;
+    bool builtin = (bool) (suffix_len == 0) ;
+    ASSERT_TABLE_OK ;
+
+    for (uint64_t k = hash ; ; k++)
+    {
+        k = k & GB_jit_table_bits ;
+        GB_jit_entry *e = &(GB_jit_table [k]) ;
+        if (e->dl_function == NULL)
+        { 
+            // found an empty slot
+            e->suffix = NULL ;
+            if (!builtin)
+            { 
+                // allocate the suffix if the kernel is not builtin
+                GB_MALLOC_PERSISTENT (e->suffix, suffix_len+2) ;
+                if (e->suffix == NULL)
+                {
+                    // JIT error: out of memory
+                    return (false) ;
+                }
+                strncpy (e->suffix, suffix, suffix_len+1) ;
+            }
+            e->hash = hash ;
+            memcpy (&(e->encoding), encoding, sizeof (GB_jit_encoding)) ;
+            e->dl_handle = dl_handle ;              // NULL for PreJIT
+            e->prejit_index = prejit_index ;        // -1 for JIT kernels
+            e->ncalls = 0 ;
+            e->run_time = 0 ;
+            e->load_time = 0 ;
+            int64_t t ;
+            GB_ATOMIC_CAPTURE_INC64 (t, GB_jit_clock) ;
+            e->last_used = t ;
+            GB_jit_table_populated++ ;
+            if (GB_jitifyer_evictable (e))
+            { 
+                GB_jit_nloaded++ ;
+            }
+            // the entry is visible to GB_jitifyer_lookup once dl_function
+            // is set, so it must be set last
+            GB_ATOMIC_WRITE
+            e->dl_function = dl_function ;
+            ASSERT_TABLE_OK ;
+            return (true) ;
+        }
+        // otherwise, keep looking
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_entry_free: free a single JIT hash table entry
+//------------------------------------------------------------------------------
+
+void GB_jitifyer_entry_free (GB_jit_entry *e)
+{
+    if (e->hash == 0)
+    { 
+        // an evicted kernel; its suffix and dl_handle are in GB_jit_evicted
+        GB_ATOMIC_WRITE
+        e->dl_function = NULL ;
+        GB_jit_table_populated-- ;
+        return ;
+    }
+    if (GB_jitifyer_evictable (e))
+    { 
+        GB_jit_nloaded-- ;
+    }
+    GB_ATOMIC_WRITE
+    e->dl_function = NULL ;
+    GB_jit_table_populated-- ;
+    GB_FREE_PERSISTENT (e->suffix) ;
+    // unload the dl library
+    if (e->dl_handle != NULL)
+    { 
+        GB_file_dlclose (e->dl_handle) ; e->dl_handle = NULL ;
+    }
+    ASSERT_TABLE_OK ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_table_free:  free the hash and clear all loaded kernels
+//------------------------------------------------------------------------------
+
+// Clears all runtime JIT kernels from the hash table.  PreJIT kernels and JIT
+// kernels containing user-defined operators are not freed if freall is true
+// (only done by GrB_finalize), but they are flagged as unchecked.  This allows
+// the application to call GxB_set to set the JIT control to OFF then ON again,
+// to indicate that a user-defined type or operator has been changed, and that
+// all JIT kernels must cleared and all PreJIT kernels checked again before
+// using them.
+
+// If freeall is false (the JIT control is set to GxB_JIT_OFF), other user
+// threads may still be running JIT kernels or searching the hash table, so
+// nothing is unloaded or freed here.  Each JIT kernel is evicted instead, the
+// same as GB_jitifyer_evict, and the table is retired if no kernels remain in
+// it.  They are freed by GB_jitifyer_reclaim, once no user thread can still be
+// using them.  If freeall is true, no other user thread may be using
+// GraphBLAS, and everything is freed.
+
+// After calling this function, the JIT is still enabled.  GB_jitifyer_insert
+// will reallocate the table if it is NULL.
+
+void GB_jitifyer_table_free (bool freeall)
+{ 
+
+    //--------------------------------------------------------------------------
+    // free or evict the kernels
+    //--------------------------------------------------------------------------
+
+    if (GB_jit_table != NULL)
+    {
+        for (uint64_t k = 0 ; k < GB_jit_table_size ; k++)
+        {
+            GB_jit_entry *e = &(GB_jit_table [k]) ;
+            if (e->dl_function == NULL)
+            { 
+                // empty entry
+                continue ;
+            }
+            else if (e->hash == 0)
+            { 
+                // an evicted kernel; its dl_handle and suffix are already in
+                // GB_jit_evicted
+                if (freeall)
+                { 
+                    GB_jitifyer_entry_free (e) ;
+                }
+                continue ;
+            }
+            if (e->dl_handle == NULL)
+            { 
+                // flag the PreJIT kernel as unchecked
+                GB_ATOMIC_WRITE
+                e->prejit_index = GB_UNFLIP (e->prejit_index) ;
+            }
+            if (freeall)
+            { 
+                // free the entry
+                GB_jitifyer_entry_free (e) ;
+            }
+            else if (e->dl_handle != NULL &&
+                e->encoding.kcode != GB_JIT_KERNEL_USEROP)
+            {
+                // evict the kernel, since another user thread may be using it
+                if (!GB_jitifyer_evict_entry (e))
+                { 
+                    // out of memory: remove the kernel from the table but
+                    // leave it loaded, since it may still be in use
+                    if (GB_jitifyer_evictable (e))
+                    { 
+                        GB_jit_nloaded-- ;
+                    }
+                    GB_ATOMIC_WRITE
+                    e->hash = 0 ;
+                    e->dl_handle = NULL ;
+                }
+            }
+        }
+    }
+
+    // forget any kernels still being compiled in the background; their
+    // lib*.so files are loaded normally if they are needed again
+    GB_jitifyer_pending_free ( ) ;
+
+    //--------------------------------------------------------------------------
+    // free or retire the table
+    //--------------------------------------------------------------------------
+
+    if (freeall)
+    { 
+        // unload all evicted kernels and free all retired tables
+        GB_jitifyer_reclaim (true) ;
+        ASSERT (GB_jit_table_populated == 0) ;
+        GB_ATOMIC_WRITE
+        GB_jit_table_bits = 0 ;
+        GB_jit_table_size = 0 ;
+        GB_jit_table_size_retired = 0 ;
+        GB_FREE_STUFF (GB_jit_table) ;
+        return ;
+    }
+
+    if (GB_jit_table != NULL)
+    {
+        // count the entries that remain, excluding evicted kernels
+        int64_t nlive = 0 ;
+        for (uint64_t k = 0 ; k < GB_jit_table_size ; k++)
+        {
+            GB_jit_entry *e = &(GB_jit_table [k]) ;
+            if (e->dl_function != NULL && e->hash != 0)
+            { 
+                nlive++ ;
+            }
+        }
+        if (nlive == 0 && GB_jit_nretired < GB_JIT_RETIRED_MAX)
+        { 
+            // retire the empty table, since GB_jitifyer_lookup may be reading
+            // it; publish the NULL table, and then its bits
+            GB_jit_retired [GB_jit_nretired] = GB_jit_table ;
+            GB_jit_retired_allocated [GB_jit_nretired] =
+                GB_jit_table_allocated ;
+            GB_jit_nretired++ ;
+            GB_ATOMIC_WRITE
+            GB_jit_reclaim_pending = true ;
+            GB_jit_table_size_retired = GB_IMAX (GB_jit_table_size_retired,
+                GB_jit_table_size) ;
+            GB_ATOMIC_WRITE
+            GB_jit_table = NULL ;
+            GB_jit_table_size = 0 ;
+            GB_ATOMIC_WRITE
+            GB_jit_table_bits = 0 ;
+            GB_jit_table_allocated = 0 ;
+            GB_jit_table_populated = 0 ;
+        }
+        // otherwise, the evicted kernels are dropped from the table when it
+        // is next rebuilt by GB_jitifyer_insert
+    }
+
+    // unload the evicted kernels and free the retired tables once no user
+    // thread can still be using them
+    GB_jitifyer_reclaim (false) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_max_loaded: get the max # of JIT kernels loaded
+//------------------------------------------------------------------------------
+
+int64_t GB_jitifyer_get_max_loaded (void)
+{ 
+    int64_t max_loaded ;
+    GB_ATOMIC_READ
+    max_loaded = GB_jit_max_loaded ;
+    return (max_loaded) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_max_loaded: set the max # of JIT kernels loaded
+//------------------------------------------------------------------------------
+
+// If more kernels are already loaded, the least recently used ones are
+// evicted at once.  Zero (or a negative value) means no limit.
+
+void GB_jitifyer_set_max_loaded (int64_t max_loaded)
+{ 
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        GB_ATOMIC_WRITE
+        GB_jit_max_loaded = GB_IMAX (max_loaded, 0) ;
+        GB_jitifyer_evict ( ) ;
+        GB_jitifyer_reclaim (false) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_cache_max_size: get the max size of the JIT cache
+//------------------------------------------------------------------------------
+
+int64_t GB_jitifyer_get_cache_max_size (void)
+{ 
+    int64_t max_size ;
+    #pragma omp critical (GB_jitifyer_worker)
+    { 
+        max_size = GB_jit_cache_max_size ;
+    }
+    return (max_size) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_cache_max_size: set the max size of the JIT cache, in bytes
+//------------------------------------------------------------------------------
+
+// If the cache is already larger than this, it is trimmed at once.  Zero (or
+// a negative value) means no limit.
+
+void GB_jitifyer_set_cache_max_size (int64_t max_size)
+{ 
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        GB_jit_cache_max_size = GB_IMAX (max_size, 0) ;
+        GB_jitifyer_cache_trim ( ) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_specialize_dim: get the largest dimension fixed in a kernel
+//------------------------------------------------------------------------------
+
+int32_t GB_jitifyer_get_specialize_dim (void)
+{ 
+    int32_t dim ;
+    GB_ATOMIC_READ
+    dim = GB_jit_specialize_dim ;
+    return (dim) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_specialize_dim: set the largest dimension fixed in a kernel
+//------------------------------------------------------------------------------
+
+// Kernels already loaded are not affected, since the fixed dimension is part
+// of the encoding of each kernel.  Zero (or a negative value) disables the
+// specialization, and the dimension is limited to GB_JIT_SPECIALIZE_DIM_MAX.
+
+void GB_jitifyer_set_specialize_dim (int32_t dim)
+{ 
+    dim = GB_IMAX (dim, 0) ;
+    dim = GB_IMIN (dim, GB_JIT_SPECIALIZE_DIM_MAX) ;
+    GB_ATOMIC_WRITE
+    GB_jit_specialize_dim = dim ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_acquire: a JIT kernel is about to be used
+//------------------------------------------------------------------------------
+
+// GB_jitifyer_load calls this function before it searches the hash table.
+// The user thread is counted as a user of the current epoch (see
+// GB_jitifyer_reclaim), and the epoch is recorded for GB_jitifyer_release.
+
+static inline void GB_jitifyer_acquire (void)
+{
+    #ifdef GB_JIT_NO_EPOCHS
+    int64_t slot = 0 ;
+    #else
+    int64_t epoch ;
+    GB_ATOMIC_READ
+    epoch = GB_jit_epoch ;
+    int64_t slot = epoch & 1 ;
+    GB_jit_slots = (GB_jit_slots << 1) | ((uint64_t) slot) ;
+    #endif
+    GB_ATOMIC_UPDATE
+    GB_jit_nusers [slot]++ ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_release: a JIT kernel is no longer in use
+//------------------------------------------------------------------------------
+
+// GB_jitifyer_load marks each kernel it returns as in use, and GB_JIT_CALL
+// calls this function once the kernel has returned.  When the last user of an
+// epoch is done, any evicted kernels and retired hash tables that it might
+// have seen are freed.  This is done without the critical section unless
+// there is work to do.
+
+void GB_jitifyer_release (void)
+{
+    #ifdef GB_JIT_NO_EPOCHS
+    int64_t slot = 0 ;
+    #else
+    int64_t slot = GB_jit_slots & 1 ;
+    GB_jit_slots = GB_jit_slots >> 1 ;
+    #endif
+    GB_ATOMIC_UPDATE
+    GB_jit_nusers [slot]-- ;
+    int64_t nusers ;
+    GB_ATOMIC_READ
+    nusers = GB_jit_nusers [slot] ;
+    bool reclaim_pending ;
+    GB_ATOMIC_READ
+    reclaim_pending = GB_jit_reclaim_pending ;
+    if (nusers == 0 && reclaim_pending)
+    { 
+        #pragma omp critical (GB_jitifyer_worker)
+        { 
+            GB_jitifyer_reclaim (false) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_reclaim: unload evicted kernels and free retired hash tables
+//------------------------------------------------------------------------------
+
+// Must be called inside the GB_jitifyer_worker critical section.  Evicted
+// kernels and retired tables may still be in use by other user threads (see
+// GB_jitifyer_lookup), so they are freed only when no user thread can still
+// reach them, or if force is true (only done by GrB_finalize).
+
+// Each use of a kernel is counted in GB_jit_nusers for the epoch in which it
+// started.  Kernels evicted and tables retired in the current epoch E can be
+// reached by users of epoch E or earlier, but not by users of later epochs,
+// which only see the hash table as it is after they were removed.  Once all
+// users of epoch E-1 are done, the kernels evicted and tables retired before
+// epoch E are freed, and the epoch advances to E+1.  The users of epoch E+1
+// are counted in the same slot as the users of E-1, which is now zero.  New
+// users always join the current epoch, so the users of the prior epoch drain
+// even if kernels are in use at all times.  A user that reads the epoch just
+// before it advances is counted in a later epoch than the one it started in,
+// which is safe since it searches the hash table only after it is counted.
+
+static void GB_jitifyer_reclaim (bool force)
+{
+
+    if (force)
+    { 
+        // free everything, regardless of the users of any epoch
+        GB_jit_nevicted_old = GB_jit_nevicted ;
+        GB_jit_nretired_old = GB_jit_nretired ;
+    }
+
+    for (int pass = 0 ; pass < 2 ; pass++)
+    {
+
+        //----------------------------------------------------------------------
+        // check if the prior epoch still has users
+        //----------------------------------------------------------------------
+
+        if (!force)
+        {
+            #ifdef GB_JIT_NO_EPOCHS
+            int64_t prior = 0 ;
+            #else
+            int64_t prior = (GB_jit_epoch + 1) & 1 ;
+            #endif
+            int64_t nusers ;
+            GB_ATOMIC_READ
+            nusers = GB_jit_nusers [prior] ;
+            if (nusers > 0)
+            { 
+                // try again when they are done
+                break ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // free the kernels evicted and tables retired before the current epoch
+        //----------------------------------------------------------------------
+
+        for (int64_t k = 0 ; k < GB_jit_nevicted_old ; k++)
+        {
+            GB_jit_entry *e = &(GB_jit_evicted [k]) ;
+            GB_FREE_PERSISTENT (e->suffix) ;
+            if (e->dl_handle != NULL)
+            { 
+                GB_file_dlclose (e->dl_handle) ; e->dl_handle = NULL ;
+            }
+        }
+        int64_t nnew = GB_jit_nevicted - GB_jit_nevicted_old ;
+        if (nnew > 0 && GB_jit_nevicted_old > 0)
+        { 
+            memmove (GB_jit_evicted, GB_jit_evicted + GB_jit_nevicted_old,
+                nnew * sizeof (struct GB_jit_entry_struct)) ;
+        }
+        GB_jit_nevicted = nnew ;
+
+        int tnew = GB_jit_nretired - GB_jit_nretired_old ;
+        for (int t = 0 ; t < GB_jit_nretired ; t++)
+        {
+            if (t < GB_jit_nretired_old)
+            { 
+                GB_FREE_PERSISTENT (GB_jit_retired [t]) ;
+            }
+            if (t < tnew)
+            { 
+                GB_jit_retired [t] = GB_jit_retired [t + GB_jit_nretired_old] ;
+                GB_jit_retired_allocated [t] =
+                    GB_jit_retired_allocated [t + GB_jit_nretired_old] ;
+            }
+            else
+            { 
+                GB_jit_retired [t] = NULL ;
+                GB_jit_retired_allocated [t] = 0 ;
+            }
+        }
+        GB_jit_nretired = tnew ;
+
+        //----------------------------------------------------------------------
+        // advance to the next epoch, if anything is left to free
+        //----------------------------------------------------------------------
+
+        // Whatever is left was removed in the current epoch, and can be freed
+        // once the users of the current epoch are done.
+        GB_jit_nevicted_old = GB_jit_nevicted ;
+        GB_jit_nretired_old = GB_jit_nretired ;
+        if (GB_jit_nevicted == 0 && GB_jit_nretired == 0)
+        { 
+            break ;
+        }
+        #ifndef GB_JIT_NO_EPOCHS
+        GB_ATOMIC_WRITE
+        GB_jit_epoch++ ;
+        #endif
+    }
+
+    GB_ATOMIC_WRITE
+    GB_jit_reclaim_pending = (GB_jit_nevicted > 0 || GB_jit_nretired > 0) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_evict_entry: remove a kernel from the hash table
+//------------------------------------------------------------------------------
+
+// Must be called inside the GB_jitifyer_worker critical section.  The entry
+// is left in the hash table with a hash of zero, so that it is no longer found
+// by GB_jitifyer_find but the search of other entries still passes through
+// it.  Its dl_handle and suffix are moved to GB_jit_evicted, since another
+// user thread may still be using the kernel; they are freed later by
+// GB_jitifyer_reclaim.  Returns false if out of memory, in which case the
+// entry is not modified.
+
+static bool GB_jitifyer_evict_entry (GB_jit_entry *e)
+{
+
+    //--------------------------------------------------------------------------
+    // ensure the GB_jit_evicted list is large enough
+    //--------------------------------------------------------------------------
+
+    if (GB_jit_nevicted == GB_jit_evicted_size)
+    {
+        int64_t new_size = GB_IMAX (16, 2 * GB_jit_evicted_size) ;
+        size_t siz = new_size * sizeof (struct GB_jit_entry_struct) ;
+        GB_jit_entry *new_evicted ;
+        GB_MALLOC_PERSISTENT (new_evicted, siz) ;
+        if (new_evicted == NULL)
+        { 
+            // out of memory
+            return (false) ;
+        }
+        if (GB_jit_nevicted > 0)
+        { 
+            memcpy (new_evicted, GB_jit_evicted,
+                GB_jit_nevicted * sizeof (struct GB_jit_entry_struct)) ;
+        }
+        GB_FREE_STUFF (GB_jit_evicted) ;
+        GB_jit_evicted = new_evicted ;
+        GB_jit_evicted_size = new_size ;
+        GB_jit_evicted_allocated = siz ;
+    }
+
+    //--------------------------------------------------------------------------
+    // evict the kernel
+    //--------------------------------------------------------------------------
+
+    if (GB_jitifyer_evictable (e))
+    { 
+        GB_jit_nloaded-- ;
+    }
+    GB_jit_evicted [GB_jit_nevicted++] = (*e) ;
+    GB_ATOMIC_WRITE
+    e->hash = 0 ;
+    e->dl_handle = NULL ;
+    GB_ATOMIC_WRITE
+    GB_jit_reclaim_pending = true ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_evict: evict the least recently used kernels
+//------------------------------------------------------------------------------
+
+// Must be called inside the GB_jitifyer_worker critical section.  While more
+// than GB_jit_max_loaded kernels are loaded, the kernel with the oldest
+// last_used time is removed from the hash table with GB_jitifyer_evict_entry.
+// The kernel remains in the cache, so it can be loaded again if needed.
+
+static void GB_jitifyer_evict (void)
+{
+
+    if (GB_jit_max_loaded <= 0)
+    { 
+        // no limit on the # of kernels loaded
+        return ;
+    }
+
+    while (GB_jit_nloaded > GB_jit_max_loaded)
+    {
+
+        //----------------------------------------------------------------------
+        // find the least recently used kernel
+        //----------------------------------------------------------------------
+
+        GB_jit_entry *victim = NULL ;
+        int64_t oldest = INT64_MAX ;
+        for (int64_t k = 0 ; k < GB_jit_table_size ; k++)
+        {
+            GB_jit_entry *e = &(GB_jit_table [k]) ;
+            if (e->dl_function == NULL || !GB_jitifyer_evictable (e))
+            { 
+                continue ;
+            }
+            int64_t t ;
+            GB_ATOMIC_READ
+            t = e->last_used ;
+            if (t < oldest)
+            { 
+                oldest = t ;
+                victim = e ;
+            }
+        }
+        if (victim == NULL)
+        { 
+            // no kernel can be evicted
+            break ;
+        }
+
+        //----------------------------------------------------------------------
+        // evict the kernel
+        //----------------------------------------------------------------------
+
+        if (!GB_jitifyer_evict_entry (victim))
+        { 
+            // out of memory; leave the kernels loaded
+            break ;
+        }
+        GBURBLE ("(jit: evict) ") ;
+    }
+
+    // unload the evicted kernels, or start a new epoch so that they can be
+    // unloaded once the kernels now in use are done
+    GB_jitifyer_reclaim (false) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_cache_trim: keep the JIT cache within its size limit
+//------------------------------------------------------------------------------
+
+// Must be called inside the GB_jitifyer_worker critical section.  The size of
+// the cache is the total size of each compiled kernel (its lib*.so file) and
+// the files for it in the c folder (its source, and any object files).  If
+// the size exceeds GB_jit_cache_max_size, the kernels that were least
+// recently compiled or loaded are deleted, using the modification time of
+// their lib*.so files, which GB_jitifyer_load_worker updates each time it
+// loads a kernel from the cache.  Kernels currently loaded by this process
+// are kept.  Other files in the cache (the GraphBLAS source, the bundle of
+// kernels, and lock files) are not counted.
+
+typedef struct
+{
+    int64_t size ;              // total size of the kernel's files
+    int64_t mtime ;             // last modification time of its lib*.so
+    uint32_t bucket ;           // the kernel's bucket in the cache
+    char name [GB_KLEN] ;       // the kernel's name
+}
+GB_jit_cache_file ;
+
+static int GB_jitifyer_cache_compare (const void *p1, const void *p2)
+{ 
+    const GB_jit_cache_file *a = (const GB_jit_cache_file *) p1 ;
+    const GB_jit_cache_file *b = (const GB_jit_cache_file *) p2 ;
+    if (a->mtime != b->mtime) return ((a->mtime < b->mtime) ? -1 : 1) ;
+    return (strcmp (a->name, b->name)) ;
+}
+
+// GB_jitifyer_cache_files: return the total size of the files for a kernel,
+// and the modification time of its lib*.so file (-1 if it does not exist).
+// The files are removed if remove_them is true.
+
+static int64_t GB_jitifyer_cache_files
+(
+    uint32_t bucket,
+    const char *kernel_name,
+    bool remove_them,
+    int64_t *mtime
+)
+{
+    int64_t total = 0, size, t ;
+    (*mtime) = -1 ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%02x/%s%s%s",
+        GB_jit_cache_path, bucket, GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX) ;
+    if (!GB_file_stat (GB_jit_temp, &size, mtime))
+    { 
+        // the kernel has not been compiled, or is being compiled
+        (*mtime) = -1 ;
+        return (0) ;
+    }
+    total += size ;
+    if (remove_them) remove (GB_jit_temp) ;
+    const char *suffixes [4] =
+        { ".c", ".cu", GB_OBJ_SUFFIX, "_bundle" GB_OBJ_SUFFIX } ;
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s%s",
+            GB_jit_cache_path, bucket, kernel_name, suffixes [k]) ;
+        if (GB_file_stat (GB_jit_temp, &size, &t))
+        { 
+            total += size ;
+            if (remove_them) remove (GB_jit_temp) ;
+        }
+    }
+    return (total) ;
+}
+
+// GB_jitifyer_cache_in_use: true if a kernel is loaded in the hash table
+
+static bool GB_jitifyer_cache_in_use (uint32_t bucket, const char *kernel_name)
+{
+    for (int64_t k = 0 ; k < GB_jit_table_size ; k++)
+    {
+        GB_jit_entry *e = &(GB_jit_table [k]) ;
+        if (e->dl_function == NULL || e->hash == 0 ||
+            (e->hash & 0xFF) != bucket)
+        { 
+            continue ;
+        }
+        int scode_digits ;
+        const char *kname = GB_jitifyer_kname (e->encoding.kcode,
+            &scode_digits) ;
+        char name [GB_KLEN] ;
+        GB_macrofy_name (name, "GB_jit", kname, e->encoding.dim,
+            scode_digits, e->encoding.code, e->suffix) ;
+        if (strcmp (name, kernel_name) == 0)
+        { 
+            return (true) ;
+        }
+    }
+    return (false) ;
+}
+
+static void GB_jitifyer_cache_trim (void)
+{
+
+    #ifndef NJIT
+    if (GB_jit_cache_max_size <= 0 || GB_jit_cache_path == NULL ||
+        GB_jit_cache_path [0] == '\0')
+    { 
+        // no limit on the size of the cache, or no cache
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find all compiled kernels in the cache, and their sizes
+    //--------------------------------------------------------------------------
+
+    GB_jit_cache_file *Files = NULL ;
+    int64_t nfiles = 0, nmax = 0, total = 0 ;
+    for (uint32_t bucket = 0 ; bucket <= 0xFF ; bucket++)
+    {
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x",
+            GB_jit_cache_path, bucket) ;
+        void *dir = GB_file_opendir (GB_jit_temp) ;
+        const char *file ;
+        while ((file = GB_file_readdir (dir)) != NULL)
+        {
+            // find the next kernel source file, GB_jit__*.c or *.cu
+            size_t len = strlen (file) ;
+            size_t ext = (len >= 3 && strcmp (file + len - 3, ".cu") == 0) ?
+                3 : 2 ;
+            if (len < 10 || len >= GB_KLEN || strncmp (file, "GB_jit__", 8) != 0
+                || (ext == 2 && strcmp (file + len - 2, ".c") != 0))
+            { 
+                continue ;
+            }
+            // make sure space is available for it
+            if (nfiles == nmax)
+            {
+                int64_t newmax = GB_IMAX (2 * nmax, 256) ;
+                size_t siz = newmax * sizeof (GB_jit_cache_file) ;
+                GB_jit_cache_file *NewFiles = NULL ;
+                GB_MALLOC_PERSISTENT (NewFiles, siz) ;
+                if (NewFiles == NULL)
+                { 
+                    // out of memory; do not trim the cache
+                    GB_file_closedir (dir) ;
+                    GB_FREE_PERSISTENT (Files) ;
+                    return ;
+                }
+                if (nfiles > 0)
+                { 
+                    memcpy (NewFiles, Files,
+                        nfiles * sizeof (GB_jit_cache_file)) ;
+                }
+                GB_FREE_PERSISTENT (Files) ;
+                Files = NewFiles ;
+                nmax = newmax ;
+            }
+            // get the kernel name (the filename without the .c or .cu)
+            GB_jit_cache_file *f = &(Files [nfiles]) ;
+            memcpy (f->name, file, len - ext) ;
+            f->name [len - ext] = '\0' ;
+            f->bucket = bucket ;
+            // include the kernel only if its lib*.so file exists
+            f->size = GB_jitifyer_cache_files (bucket, f->name, false,
+                &(f->mtime)) ;
+            if (f->mtime >= 0)
+            { 
+                total += f->size ;
+                nfiles++ ;
+            }
+        }
+        GB_file_closedir (dir) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // delete the least recently used kernels until the cache is small enough
+    //--------------------------------------------------------------------------
+
+    if (total > GB_jit_cache_max_size)
+    {
+        GBURBLE ("(jit: trim cache) ") ;
+        qsort (Files, nfiles, sizeof (GB_jit_cache_file),
+            GB_jitifyer_cache_compare) ;
+        for (int64_t k = 0 ; k < nfiles && total > GB_jit_cache_max_size ; k++)
+        {
+            GB_jit_cache_file *f = &(Files [k]) ;
+            if (GB_jitifyer_cache_in_use (f->bucket, f->name))
+            { 
+                // keep the kernels loaded by this process
+                continue ;
+            }
+            int64_t mtime ;
+            GB_jitifyer_cache_files (f->bucket, f->name, true, &mtime) ;
+            total -= f->size ;
+        }
+    }
+
+    GB_FREE_PERSISTENT (Files) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_command: run a command in a child process
+//------------------------------------------------------------------------------
+
+// No error condition or status is returned.
+
+// If burble is on, stdout is left alone, so the stdout of the command is sent
+// to the stdout of the parent process.  If burble is off, stdout is sent to
+// /dev/null (nul on Windows).  If there is no error log file, stderr is not
+// redirected; otherwise, it is redirected to that file.  The redirects are
+// handled by modifying the command string in the caller, so they do not have
+// to be handled here.
+
+// NOTE: this call to system(...) *cannot* be sanitized; CodeQL flags calls to
+// GB_jitifyer_command as security issues, but this is intentional.  The JIT
+// allows the end user to create arbitrary user-defined types and operators,
+// which GraphBLAS then injects into C source code of a JIT kernel created at
+// run time.  The end user can also specify an arbitrary compiler to compile
+// JIT kernels.  This code injection is intentional, and required for the JIT.
+// If a security-hardened GraphBLAS library is required, then GraphBLAS must be
+// compiled with -DNJIT to disable the JIT entirely.  User-defined JIT kernels
+// will not be created at run time, and thus user-defined types and operators
+// will be slow, however.  This option does not disable any PreJIT kernels, so
+// if fast user-defined kernels are required, they can be used with the PreJIT
+// mechanism; see the GraphBLAS User Guide for details.
+
+static void GB_jitifyer_command (char *command)
+{ 
+    #ifndef NJIT
+    int result = system (command) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_cmake_compile: compile a kernel with cmake
+//------------------------------------------------------------------------------
+
+// This method does not return any error/success code.  If the compilation
+// fails for any reason, the subsequent load of the compiled kernel will fail.
+
+// This method works on most platforms (not yet on MINGW, so it is not used
+// there).  For Windows using MSVC, this method is always used.
+
+// FUTURE: get this method to work in MINGW.
+
+#define GB_BLD_DIR "%s/tmp/%016" PRIx64
+
+void GB_jitifyer_cmake_compile (char *kernel_name, uint64_t hash)
+{ 
+#ifndef NJIT
+
+    uint32_t bucket = hash & 0xFF ;
+    GBURBLE ("(jit: %s)\n", "cmake") ;
+    char *burble_stdout = GB_Global_burble_get ( ) ? "" : GB_DEV_NULL ;
+    bool have_log = (GB_STRLEN (GB_jit_error_log) > 0) ;
+    char *err_redirect = have_log ?  " 2>> " : " 2>&1 " ;
+    char *log_quote = have_log ? "\"" : "" ;
+
+#if defined (__MINGW32__)
+#define GB_SH_C "sh -c "
+#else
+#define GB_SH_C
+#endif
+
+    // remove any prior build folder for this kernel, and all its contents
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+        GB_SH_C "cmake -E remove_directory \"" GB_BLD_DIR "\" %s %s %s%s%s",
+        GB_jit_cache_path, hash,     // build path
+        burble_stdout, err_redirect,
+        log_quote, GB_jit_error_log, log_quote) ;
+    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+
+    // create the build folder for this kernel
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, GB_BLD_DIR,
+        GB_jit_cache_path, hash) ;
+    if (!GB_file_mkdir (GB_jit_temp)) return ;
+
+    // create the CMakeLists.txt file in the build folder for this kernel
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, GB_BLD_DIR "/CMakeLists.txt",
+        GB_jit_cache_path, hash) ;
+    FILE *fp = fopen (GB_jit_temp, "w") ;
+    if (fp == NULL) return ;
+    fprintf (fp,
+        "cmake_minimum_required ( VERSION 3.13 )\n" // end user needs cmake 3.13
+        "project ( GBjit LANGUAGES C )\n"
+        "include_directories ( \"%s/src\" \"%s/src/template\""
+        " \"%s/src/include\" %s)\n"
+        "add_compile_definitions ( GB_JIT_RUNTIME )\n",
+        GB_jit_cache_path,          // include: cache/src
+        GB_jit_cache_path,          // include: cache/src/template
+        GB_jit_cache_path,          // include: cache/src/include
+        ((strlen (GB_OMP_INC_DIRS) == 0) ? " " : " \"" GB_OMP_INC_DIRS "\" ")) ;
+    // print the C flags, followed by the C flags of the types, operators, and
+    // semiring of the kernel, but escape any double quote characters
+    fprintf (fp, "set ( CMAKE_C_FLAGS \"") ;
+    for (char *p = GB_jit_C_flags ; *p != '\0' ; p++)
+    {
+        if (*p == '"') fprintf (fp, "\\") ;
+        fprintf (fp, "%c", *p) ;
+    }
+    if (GB_STRLEN (GB_jit_kernel_C_flags) > 0)
+    {
+        fprintf (fp, " ") ;
+        for (char *p = GB_jit_kernel_C_flags ; *p != '\0' ; p++)
+        {
+            if (*p == '"') fprintf (fp, "\\") ;
+            fprintf (fp, "%c", *p) ;
+        }
+    }
+    fprintf (fp, "\" )\n") ;
+    fprintf (fp,
+        "add_library ( %s SHARED \"%s/c/%02x/%s.c\" )\n",
+        kernel_name,                // target name for add_library command
+        GB_jit_cache_path, bucket, kernel_name) ; // source file for add_library
+    if (GB_STRLEN (GB_jit_C_cmake_libs) > 0)
+    {
+        fprintf (fp,
+            "target_link_libraries ( %s PUBLIC %s )\n",
+            kernel_name,                // target name of the library
+            GB_jit_C_cmake_libs) ;      // libraries to link against
+    }
+    if (GB_STRLEN (GB_jit_kernel_C_objects) > 0)
+    {
+        // link the object files of the operators of the kernel, with each
+        // file in double quotes instead of single quotes
+        fprintf (fp, "target_link_libraries ( %s PRIVATE ", kernel_name) ;
+        for (char *p = GB_jit_kernel_C_objects ; *p != '\0' ; p++)
+        {
+            fprintf (fp, "%c", (*p == '\'') ? '"' : *p) ;
+        }
+        fprintf (fp, " )\n") ;
+    }
+
+    fprintf (fp, 
+        "set_target_properties ( %s PROPERTIES\n"
+        "    C_STANDARD 11 C_STANDARD_REQUIRED ON )\n"
+        "install ( TARGETS %s\n"
+        "    LIBRARY DESTINATION \"%s/lib/%02x\"\n"
+        "    ARCHIVE DESTINATION \"%s/lib/%02x\"\n"
+        "    RUNTIME DESTINATION \"%s/lib/%02x\" )\n",
+        kernel_name,
+        kernel_name,
+        GB_jit_cache_path, bucket,
+        GB_jit_cache_path, bucket,
+        GB_jit_cache_path, bucket) ;
+    fclose (fp) ;
+
+    // generate the build system for this kernel
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+        GB_SH_C "cmake -S \"" GB_BLD_DIR "\" -B \"" GB_BLD_DIR "\""
+        " -DCMAKE_C_COMPILER=\"%s\" %s %s %s%s%s",
+        GB_jit_cache_path, hash,     // -S source path
+        GB_jit_cache_path, hash,     // -B build path
+        GB_jit_C_compiler,                  // C compiler to use
+        burble_stdout, err_redirect, log_quote, GB_jit_error_log, log_quote) ;
+    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+
+    // compile the library for this kernel
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+        GB_SH_C "cmake --build \"" GB_BLD_DIR
+        "\" --config Release %s %s %s%s%s",
+        // can add "--verbose" here too
+        GB_jit_cache_path, hash,     // build path
+        burble_stdout, err_redirect, log_quote, GB_jit_error_log, log_quote) ;
+    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+
+    // install the library
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+        GB_SH_C "cmake --install \"" GB_BLD_DIR "\" %s %s %s%s%s",
+        GB_jit_cache_path, hash,     // build path
+        burble_stdout, err_redirect, log_quote, GB_jit_error_log, log_quote) ;
+    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+
+    // remove the build folder and all its contents
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+        GB_SH_C "cmake -E remove_directory \"" GB_BLD_DIR "\" %s %s %s%s%s",
+        GB_jit_cache_path, hash,     // build path
+        burble_stdout, err_redirect, log_quote, GB_jit_error_log, log_quote) ;
+    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+
+#endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_nvcc_compile: compile a CUDA kernel with nvcc
+//------------------------------------------------------------------------------
+
+// Compiles a CUDA JIT kernel in a *.cu file, containing host code that
+// launches one or more device kernels.
+
+// The input file has the form:
+//
+//      %s/c/%02x/%s or [cache_path]/c/[bucket]/[kernel_name].cu
+//
+// and the libary file is linked as
+//
+//      %s/lib/%02x/lib%s.so or [cache_path]/lib/[bucket]/lib[kernel_name].so
+//
+// All other temporary files (including *.o object files) are removed.
+
+void GB_jitifyer_nvcc_compile (char *kernel_name, uint32_t bucket)
+{
+
+#if defined ( GRAPHBLAS_HAS_CUDA ) && !defined ( NJIT )
+
+    char *burble_stdout = GB_Global_burble_get ( ) ? "" : GB_DEV_NULL ;
+    bool have_log = (GB_STRLEN (GB_jit_error_log) > 0) ;
+    char *err_redirect = have_log ?  " 2>> " : " 2>&1 " ;
+    char *log_quote = have_log ? "'" : "" ;
+
+    GBURBLE ("(jit compiling cuda with nvcc: %s/c/%02x/%s.cu) ",
+        GB_jit_cache_path, bucket, kernel_name) ;
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+
+    // compile:
+    "sh -c \""                          // execute with POSIX shell
+    // FIXME: use GB_CUDA_COMPILER here:
+    "nvcc "                             // compiler command
+    "-forward-unknown-to-host-compiler "
+    "-DGB_JIT_RUNTIME=1  "              // nvcc flags
+    // FIXME: add GB_CUDA_INC here:
+    "-I/usr/local/cuda/include -std=c++17 " 
+    // FIXME: use GB_CUDA_ARCHITECTURES here:
+    " -arch=sm_60 "
+    " -fPIC " 
+    // FIXME: add GB_CUDA_FLAGS here:
+    " -O3 "   // HACK FIXME (for CUDA)
+    "-I'%s/src' "                       // include source directory
+    "-I'%s/src/template' "
+    "-I'%s/src/include' "
+    "-o '%s/c/%02x/%s%s' "              // *.o output file
+    "-c '%s/c/%02x/%s.cu' "             // *.cu input file
+    "%s "                               // burble stdout
+    "%s %s%s%s ; "                      // error log file
+
+    // link:
+    "nvcc "                             // compiler
+    "-DGB_JIT_RUNTIME=1  "              // nvcc flags
+    "-I/usr/local/cuda/include -std=c++17 -arch=sm_60 "
+    " -shared "
+    "-o '%s/lib/%02x/%s%s%s' "          // lib*.so output file
+    "'%s/c/%02x/%s%s' "                 // *.o input file
+    " -cudart shared "
+//  "%s "                               // libraries to link with (any?)
+    "%s "                               // burble stdout
+    "%s %s%s%s\"",                      // error log file
+
+    // compile:
+    GB_jit_cache_path,                  // include cache/src
+    GB_jit_cache_path,                  // include cache/src/template
+    GB_jit_cache_path,                  // include cache/src/include
+    GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX,  // *.o output file
+    GB_jit_cache_path, bucket, kernel_name,                 // *.cu input file
+    burble_stdout,                      // burble stdout
+    err_redirect, log_quote, GB_jit_error_log, log_quote,   // error log file
+
+    // link:
+    GB_jit_cache_path, bucket,  
+    GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX,              // lib*.so file
+    GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX,  // *.o input file
+//  GB_jit_C_libraries                  // libraries to link with
+    burble_stdout,                      // burble stdout
+    err_redirect, log_quote, GB_jit_error_log, log_quote) ; // error log file
+
+    // compile the library and return result
+    GBURBLE ("\n(jit: %s) ", GB_jit_temp) ;
+    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+
+    // remove the *.o file
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s%s",
+        GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX) ;
+    remove (GB_jit_temp) ;
+
+#endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_direct_compile: compile a kernel with just the compiler
+//------------------------------------------------------------------------------
+
+// This method does not return any error/success code.  If the compilation
+// fails for any reason, the subsequent load of the compiled kernel will fail.
+
+// This method does not work on Windows with MSVC.  It works for Linux, Mac,
+// or Windows with MINGW (for which it is currently the only option).
+
+// FUTURE: get this method to work in MSVC, since it's much faster than using
+// cmake on Windows.
+
+// If background is true, the command is run in a background process and this
+// method returns immediately.  The *.o file and the library are written to
+// temporary files unique to the background process, and the library is
+// renamed to lib*.so only if the compile and link succeed, so that the
+// lib*.so file never appears in a partially written state, even if another
+// process compiles the same kernel at the same time.  If the compile or link
+// fails, its exit status is written to the *.status file, so that
+// GB_jitifyer_load2_worker can detect the failure.
+
+// GB_jitifyer_direct_compile_command constructs the command in GB_jit_temp,
+// which GB_jitifyer_direct_compile then runs.  GB_jitifyer_warmup_worker
+// concatenates several background commands and runs them all at once.
+
+static void GB_jitifyer_direct_compile_command
+(
+    char *kernel_name,
+    uint32_t bucket,
+    bool background         // if true, compile in a background process
+)
+{ 
+
+#ifndef NJIT
+
+    char *burble_stdout = GB_Global_burble_get ( ) ? "" : GB_DEV_NULL ;
+    bool have_log = (GB_STRLEN (GB_jit_error_log) > 0) ;
+    char *err_redirect = have_log ?  " 2>> " : " 2>&1 " ;
+    char *log_quote = have_log ? "'" : "" ;
+    // the temporary *.o and library files are unique to the process that
+    // runs the command
+    char *lib_temp = background ? ".$$" : "" ;
+    // C flags of the types, operators, and semiring of the kernel
+    char *kernel_C_flags = (GB_jit_kernel_C_flags == NULL) ? "" :
+        GB_jit_kernel_C_flags ;
+    // object files of the operators of the kernel
+    char *kernel_C_objects = (GB_jit_kernel_C_objects == NULL) ? "" :
+        GB_jit_kernel_C_objects ;
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+
+    // compile:
+    "sh -c \""                          // execute with POSIX shell
+    "%s "                               // compiler command
+    "-DGB_JIT_RUNTIME=1 %s %s "         // C flags and kernel C flags
+    "-I'%s/src' "                       // include source directory
+    "-I'%s/src/template' "
+    "-I'%s/src/include' "
+    "%s "                               // openmp include directories
+    "-o '%s/c/%02x/%s%s%s' "            // *.o output file
+    "-c '%s/c/%02x/%s.c' "              // *.c input file
+    "%s "                               // burble stdout
+    "%s %s%s%s ; "                      // error log file
+
+    // link:
+    "%s "                               // C compiler
+    "%s %s "                            // C flags and kernel C flags
+    "%s "                               // C link flags
+    "-o '%s/lib/%02x/%s%s%s%s' "        // lib*.so output file
+    "'%s/c/%02x/%s%s%s' "               // *.o input file
+    "%s "                               // object files of the operators
+    "%s "                               // libraries to link with
+    "%s "                               // burble stdout
+    "%s %s%s%s",                        // error log file
+
+    // compile:
+    GB_jit_C_compiler,                  // C compiler
+    GB_jit_C_flags,                     // C flags
+    kernel_C_flags,                     // kernel C flags
+    GB_jit_cache_path,                  // include cache/src
+    GB_jit_cache_path,                  // include cache/src/template
+    GB_jit_cache_path,                  // include cache/src/include
+    GB_OMP_INC,                         // openmp include
+    GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX, lib_temp, // *.o
+    GB_jit_cache_path, bucket, kernel_name,                 // *.c input file
+    burble_stdout,                      // burble stdout
+    err_redirect, log_quote, GB_jit_error_log, log_quote,   // error log file
+
+    // link:
+    GB_jit_C_compiler,                  // C compiler
+    GB_jit_C_flags,                     // C flags
+    kernel_C_flags,                     // kernel C flags
+    GB_jit_C_link_flags,                // C link flags
+    GB_jit_cache_path, bucket,  
+    GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX, lib_temp,    // lib*.so file
+    GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX, lib_temp, // *.o
+    kernel_C_objects,                   // object files of the operators
+    GB_jit_C_libraries,                 // libraries to link with
+    burble_stdout,                      // burble stdout
+    err_redirect, log_quote, GB_jit_error_log, log_quote) ; // error log file
+
+    size_t len = strlen (GB_jit_temp) ;
+    if (background)
+    { 
+        // rename the library if the link succeeds or save the exit status if
+        // it fails, remove the temporary files, and run the entire command in
+        // the background.  The $? is escaped so that it is the exit status
+        // seen by the inner shell.
+        snprintf (GB_jit_temp + len, GB_jit_temp_allocated - len,
+            " && mv -f '%s/lib/%02x/%s%s%s%s' '%s/lib/%02x/%s%s%s' "
+            "|| echo \\$? > '%s/c/%02x/%s.status' ; "
+            "rm -f '%s/lib/%02x/%s%s%s%s' '%s/c/%02x/%s%s%s'\" &",
+            GB_jit_cache_path, bucket,
+            GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX, lib_temp,
+            GB_jit_cache_path, bucket,
+            GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX,
+            GB_jit_cache_path, bucket, kernel_name,
+            GB_jit_cache_path, bucket,
+            GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX, lib_temp,
+            GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX, lib_temp) ;
+    }
+    else
+    { 
+        snprintf (GB_jit_temp + len, GB_jit_temp_allocated - len, "\"") ;
+    }
+
+#endif
+}
+
+void GB_jitifyer_direct_compile
+(
+    char *kernel_name,
+    uint32_t bucket,
+    bool background         // if true, compile in a background process
+)
+{ 
+
+#ifndef NJIT
+
+    // construct the command in GB_jit_temp
+    GB_jitifyer_direct_compile_command (kernel_name, bucket, background) ;
+
+    // compile the library and return result
+    GBURBLE ("(jit: %s) ", GB_jit_temp) ;
+    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+
+    if (!background)
+    { 
+        // remove the *.o file
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s%s",
+            GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX) ;
+        remove (GB_jit_temp) ;
+    }
+
+#endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_libtcc_compile: compile a kernel in this process with libtcc
+//------------------------------------------------------------------------------
+
+// If GraphBLAS is compiled with libtcc (GRAPHBLAS_USE_LIBTCC in CMakeLists.txt),
+// CPU kernels can be compiled inside the user process, with no compiler, shell,
+// or cmake started by system( ).  The kernel source is the same as for the
+// direct compile, and the lib*.so file is written to the same place in the
+// cache, so it is loaded (now, and by later processes) just like a kernel
+// compiled by the C compiler.
+
+// tcc compiles much faster than gcc or clang, but optimizes much less, and it
+// ignores the OpenMP pragmas, so each kernel it compiles uses a single thread.
+// The C flags (GxB_JIT_C_COMPILER_FLAGS) are meant for the C compiler and are
+// not used here, but the C flags of the types and operators of the kernel are
+// given to tcc.
+
+// tcc has no complex type, so GraphBLAS.h defines GxB_FC32_t and GxB_FC64_t
+// as structs when compiled by tcc (see __TINYC__ in GraphBLAS.h).  Kernels
+// that do complex arithmetic cannot be compiled by tcc, so they fail here.
+
+// Returns true if the lib*.so file was created, or false if the compilation
+// fails for any reason, in which case the caller compiles the kernel with the
+// C compiler or cmake instead.  Compiler errors are written to the error log
+// if there is one, or to the burble otherwise.
+
+#if defined ( GRAPHBLAS_HAS_LIBTCC ) && !defined ( NJIT )
+static void GB_jitifyer_libtcc_error (void *opaque, const char *msg)
+{ 
+    FILE *fp = NULL ;
+    if (GB_STRLEN (GB_jit_error_log) > 0)
+    { 
+        fp = fopen (GB_jit_error_log, "a") ;
+    }
+    if (fp != NULL)
+    { 
+        fprintf (fp, "%s\n", msg) ;
+        fclose (fp) ;
+    }
+    else
+    { 
+        GBURBLE ("\n(jit: %s)\n", msg) ;
+    }
+}
+#endif
+
+bool GB_jitifyer_libtcc_compile (char *kernel_name, uint32_t bucket)
+{
+
+#if defined ( GRAPHBLAS_HAS_LIBTCC ) && !defined ( NJIT )
+
+    GBURBLE ("(jit compiling with libtcc: %s/c/%02x/%s.c) ",
+        GB_jit_cache_path, bucket, kernel_name) ;
+
+    TCCState *tcc = tcc_new ( ) ;
+    if (tcc == NULL)
+    { 
+        // out of memory
+        return (false) ;
+    }
+    tcc_set_error_func (tcc, NULL, GB_jitifyer_libtcc_error) ;
+
+    // C flags of the types, operators, and semiring of the kernel
+    if (GB_STRLEN (GB_jit_kernel_C_flags) > 0)
+    { 
+        tcc_set_options (tcc, GB_jit_kernel_C_flags) ;
+    }
+    tcc_set_output_type (tcc, TCC_OUTPUT_DLL) ;
+    tcc_define_symbol (tcc, "GB_JIT_RUNTIME", "1") ;
+
+    // include the source directories
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/src",
+        GB_jit_cache_path) ;
+    tcc_add_include_path (tcc, GB_jit_temp) ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/src/template",
+        GB_jit_cache_path) ;
+    tcc_add_include_path (tcc, GB_jit_temp) ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/src/include",
+        GB_jit_cache_path) ;
+    tcc_add_include_path (tcc, GB_jit_temp) ;
+
+    // compile the *.c file
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.c",
+        GB_jit_cache_path, bucket, kernel_name) ;
+    bool ok = (tcc_add_file (tcc, GB_jit_temp) == 0) ;
+    #if !defined ( _WIN32 ) && !defined ( __APPLE__ )
+    ok = ok && (tcc_add_library (tcc, "m") == 0) ;
+    #endif
+
+    // link the lib*.so file
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%02x/%s%s%s",
+        GB_jit_cache_path, bucket, GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX) ;
+    ok = ok && (tcc_output_file (tcc, GB_jit_temp) == 0) ;
+    tcc_delete (tcc) ;
+    if (!ok)
+    { 
+        // remove any partially written library
+        GBURBLE ("(jit: libtcc failed) ") ;
+        remove (GB_jit_temp) ;
+    }
+    return (ok) ;
+
+#else
+    return (false) ;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_warmup: compile the kernels listed in a manifest
+//------------------------------------------------------------------------------
+
+// The manifest is written by a prior run with GxB_JIT_MANIFEST set; see
+// GB_jitifyer_record.  Each kernel in the manifest whose lib*.so file is not
+// already in the cache is compiled, from the source held in the manifest (or
+// from the source already in the cache, if the manifest holds none).  With the
+// direct compile, up to ncompilers kernels are compiled at the same time, each
+// in its own background process, and each batch of compiles is finished
+// before the next one starts.  With cmake or libtcc, the kernels are compiled
+// one at a time.
+
+// The kernels are not loaded into the hash table here.  Each is loaded from
+// its lib*.so file when it is first used, with no compilation required.
+
+GrB_Info GB_jitifyer_warmup (const char *manifest, int ncompilers)
+{ 
+
+    //--------------------------------------------------------------------------
+    // compile the kernels in a critical section
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        info = GB_jitifyer_warmup_worker (manifest, ncompilers) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_run_batch: compile a batch of kernels in parallel
+//------------------------------------------------------------------------------
+
+static void GB_jitifyer_run_batch
+(
+    char *batch,                // background compile commands for each kernel
+    size_t batch_allocated,
+    int *nbatch                 // # of kernels in the batch
+)
+{
+    if ((*nbatch) == 0) return ;
+    GBURBLE ("(jit: compiling %d kernels in parallel) ", *nbatch) ;
+    size_t len = strlen (batch) ;
+    snprintf (batch + len, batch_allocated - len, "wait") ;
+    GB_jitifyer_command (batch) ; // OK: see security comment above
+    batch [0] = '\0' ;
+    (*nbatch) = 0 ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_run_warmup_batch: compile a batch of kernels, then unlock them
+//------------------------------------------------------------------------------
+
+// Each kernel in a batch of GB_jitifyer_warmup_worker is locked until its
+// compilation has finished.
+
+static void GB_jitifyer_run_warmup_batch
+(
+    char *batch,                // background compile commands for each kernel
+    size_t batch_allocated,
+    int *nbatch,                // # of kernels in the batch
+    FILE **Lock_fp,             // lock file pointer of each kernel
+    int *Lock_fd                // lock file descriptor of each kernel
+)
+{
+    int n = (*nbatch) ;
+    GB_jitifyer_run_batch (batch, batch_allocated, nbatch) ;
+    for (int k = 0 ; k < n ; k++)
+    { 
+        GB_file_unlock_and_close (&(Lock_fp [k]), &(Lock_fd [k])) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_warmup_worker: compile the kernels in a manifest
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jitifyer_warmup_worker (const char *manifest, int ncompilers)
+{
+
+    #ifndef NJIT
+
+    //--------------------------------------------------------------------------
+    // quick return if the JIT is not permitted to compile new kernels
+    //--------------------------------------------------------------------------
+
+    if (GB_jit_control < GxB_JIT_ON)
+    { 
+        GBURBLE ("(jit warmup: compilation disabled) ") ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // open the manifest and allocate workspace
+    //--------------------------------------------------------------------------
+
+    FILE *fm = fopen (manifest, "r") ;
+    if (fm == NULL)
+    { 
+        // unable to open the manifest
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    ncompilers = GB_IMAX (ncompilers, 1) ;
+    char *batch = NULL ;
+    char *batch_names = NULL ;
+    FILE **Lock_fp = NULL ;
+    int *Lock_fd = NULL ;
+    size_t batch_allocated = ncompilers * (GB_jit_temp_allocated + 1) + 8 ;
+    GB_MALLOC_PERSISTENT (batch, batch_allocated) ;
+    GB_MALLOC_PERSISTENT (batch_names, ncompilers * GB_KLEN) ;
+    GB_MALLOC_PERSISTENT (Lock_fp, ncompilers * sizeof (FILE *)) ;
+    GB_MALLOC_PERSISTENT (Lock_fd, ncompilers * sizeof (int)) ;
+    if (batch == NULL || batch_names == NULL || Lock_fp == NULL ||
+        Lock_fd == NULL)
+    { 
+        // out of memory
+        fclose (fm) ;
+        GB_FREE_PERSISTENT (batch) ;
+        GB_FREE_PERSISTENT (batch_names) ;
+        GB_FREE_PERSISTENT (Lock_fp) ;
+        GB_FREE_PERSISTENT (Lock_fd) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    batch [0] = '\0' ;
+
+    //--------------------------------------------------------------------------
+    // compile each kernel in the manifest that is not in the cache
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GrB_SUCCESS ;
+    int nbatch = 0 ;
+    int64_t ncompiled = 0, ncached = 0 ;
+    char line [GB_KLEN + 64] ;
+    char kernel_name [GB_KLEN + 64] ;
+
+    while (fgets (line, GB_KLEN + 64, fm) != NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // parse the header of the next kernel
+        //----------------------------------------------------------------------
+
+        uint64_t hash = 0 ;
+        int64_t nbytes = -1 ;
+        bool ok = (sscanf (line, "GB_jit_manifest %" SCNx64 " %s %" SCNd64,
+            &hash, kernel_name, &nbytes) == 3) && (nbytes >= 0)
+            && (strlen (kernel_name) < GB_KLEN)
+            && (strncmp (kernel_name, "GB_jit__", 8) == 0) ;
+        for (char *p = kernel_name ; ok && (*p) != '\0' ; p++)
+        { 
+            // the kernel name appears in the compile command, so only
+            // letters, digits, and underscores are permitted
+            char c = (*p) ;
+            ok = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                 (c >= '0' && c <= '9') || (c == '_') ;
+        }
+        if (!ok)
+        { 
+            // the manifest is invalid
+            info = GrB_INVALID_VALUE ;
+            break ;
+        }
+        uint32_t bucket = hash & 0xFF ;
+
+        //----------------------------------------------------------------------
+        // skip the kernel if it is already compiled, or in the current batch
+        //----------------------------------------------------------------------
+
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%02x/%s%s%s",
+            GB_jit_cache_path, bucket, GB_LIB_PREFIX, kernel_name,
+            GB_LIB_SUFFIX) ;
+        bool skip = GB_file_exists (GB_jit_temp) ;
+        for (int k = 0 ; !skip && k < nbatch ; k++)
+        { 
+            skip = (strcmp (batch_names + k * GB_KLEN, kernel_name) == 0) ;
+        }
+
+        //----------------------------------------------------------------------
+        // lock the kernel, as done by GB_jitifyer_load2_worker
+        //----------------------------------------------------------------------
+
+        // The lock is held until the kernel has been compiled, so that
+        // another process does not compile it at the same time, or read its
+        // source while it is being written.
+
+        FILE *fp_klock = NULL ;
+        int fd_klock = -1 ;
+        bool locked = false ;
+        if (!skip)
+        { 
+            snprintf (GB_jit_temp, GB_jit_temp_allocated,
+                "%s/lock/%02x/%016" PRIx64 "_lock", GB_jit_cache_path, bucket,
+                hash) ;
+            locked = GB_file_open_and_lock (GB_jit_temp, &fp_klock,
+                &fd_klock) ;
+            if (!locked)
+            { 
+                GBURBLE ("(jit warmup: unable to lock %s) ", kernel_name) ;
+            }
+            else
+            { 
+                // another process may have compiled the kernel by now
+                snprintf (GB_jit_temp, GB_jit_temp_allocated,
+                    "%s/lib/%02x/%s%s%s", GB_jit_cache_path, bucket,
+                    GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX) ;
+                skip = GB_file_exists (GB_jit_temp) ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // write the kernel source to the cache
+        //----------------------------------------------------------------------
+
+        // The source is written to a temporary file and then renamed, as done
+        // by GB_jitifyer_load2_worker.
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.c.tmp",
+            GB_jit_cache_path, bucket, kernel_name) ;
+        FILE *fp = (skip || !locked || nbytes == 0) ? NULL :
+            fopen (GB_jit_temp, "w") ;
+        int64_t nread = GB_jitifyer_copy (fp, fm, nbytes) ;
+        if (fp != NULL) fclose (fp) ;
+        size_t len = strlen (GB_jit_temp) + 1 ;
+        char *source = GB_jit_temp + len ;
+        snprintf (source, GB_jit_temp_allocated - len, "%s/c/%02x/%s.c",
+            GB_jit_cache_path, bucket, kernel_name) ;
+        if (nread < nbytes)
+        { 
+            // the manifest is truncated
+            if (fp != NULL) remove (GB_jit_temp) ;
+            GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
+            info = GrB_INVALID_VALUE ;
+            break ;
+        }
+        if (fp != NULL && rename (GB_jit_temp, source) != 0)
+        { 
+            // rename fails on Windows if the file already exists
+            remove (source) ;
+            rename (GB_jit_temp, source) ;
+        }
+        if (skip)
+        { 
+            GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
+            ncached++ ;
+            continue ;
+        }
+        if (!locked || !GB_file_exists (source))
+        { 
+            // the kernel cannot be locked, or it has no source, so it cannot
+            // be compiled
+            GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // get the C flags of the kernel, and the object files linked into it
+        //----------------------------------------------------------------------
+
+        info = GB_jitifyer_kernel_C_flags_read (kernel_name, bucket) ;
+        if (info == GrB_INVALID_VALUE)
+        { 
+            // the C flags or object files in the source are invalid; skip the
+            // kernel
+            GBURBLE ("(jit warmup: %s has invalid C flags or object files) ",
+                kernel_name) ;
+            GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
+            info = GrB_SUCCESS ;
+            continue ;
+        }
+        else if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
+            break ;
+        }
+        if (batch_allocated < ncompilers * (GB_jit_temp_allocated + 1) + 8)
+        {
+            // GB_jit_temp has grown, so the batch must grow as well
+            GB_jitifyer_run_warmup_batch (batch, batch_allocated, &nbatch,
+                Lock_fp, Lock_fd) ;
+            GB_FREE_PERSISTENT (batch) ;
+            batch_allocated = ncompilers * (GB_jit_temp_allocated + 1) + 8 ;
+            GB_MALLOC_PERSISTENT (batch, batch_allocated) ;
+            if (batch == NULL)
+            { 
+                // out of memory
+                GB_jitifyer_kernel_C_flags_clear ( ) ;
+                GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
+                info = GrB_OUT_OF_MEMORY ;
+                break ;
+            }
+            batch [0] = '\0' ;
+        }
+
+        //----------------------------------------------------------------------
+        // compile the kernel
+        //----------------------------------------------------------------------
+
+        ncompiled++ ;
+        if (GB_jit_use_libtcc && GB_STRLEN (GB_jit_kernel_C_objects) == 0
+            && GB_jitifyer_libtcc_compile (kernel_name, bucket))
+        { 
+            // the kernel has been compiled with libtcc, one at a time; tcc
+            // cannot link the object files of operators
+        }
+        else if (GB_jit_use_cmake)
+        { 
+            // use cmake to compile the kernel, one at a time
+            GB_jitifyer_cmake_compile (kernel_name, hash) ;
+        }
+        else
+        { 
+            // add the kernel to the current batch, which keeps it locked
+            GB_jitifyer_direct_compile_command (kernel_name, bucket, true) ;
+            size_t len = strlen (batch) ;
+            snprintf (batch + len, batch_allocated - len, "%s ", GB_jit_temp) ;
+            strcpy (batch_names + nbatch * GB_KLEN, kernel_name) ;
+            Lock_fp [nbatch] = fp_klock ; fp_klock = NULL ;
+            Lock_fd [nbatch] = fd_klock ; fd_klock = -1 ;
+            nbatch++ ;
+            if (nbatch == ncompilers)
+            { 
+                GB_jitifyer_run_warmup_batch (batch, batch_allocated, &nbatch,
+                    Lock_fp, Lock_fd) ;
+            }
+        }
+        GB_jitifyer_kernel_C_flags_clear ( ) ;
+        GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
     }
-}
 
-//------------------------------------------------------------------------------
-// GB_jitifyer_entry_free: free a single JIT hash table entry
-//------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------
+    // compile the last batch, and free workspace
+    //--------------------------------------------------------------------------
 
-void GB_jitifyer_entry_free (GB_jit_entry *e)
-{
-    e->dl_function = NULL ;
-    GB_jit_table_populated-- ;
-    GB_FREE_PERSISTENT (e->suffix) ;
-    // unload the dl library
-    if (e->dl_handle != NULL)
+    if (batch != NULL)
     { 
-        GB_file_dlclose (e->dl_handle) ; e->dl_handle = NULL ;
+        GB_jitifyer_run_warmup_batch (batch, batch_allocated, &nbatch,
+            Lock_fp, Lock_fd) ;
     }
-    ASSERT_TABLE_OK ;
+    GBURBLE ("(jit warmup: %" PRId64 " compiled, %" PRId64 " cached) ",
+        ncompiled, ncached) ;
+    fclose (fm) ;
+    GB_FREE_PERSISTENT (batch) ;
+    GB_FREE_PERSISTENT (batch_names) ;
+    GB_FREE_PERSISTENT (Lock_fp) ;
+    GB_FREE_PERSISTENT (Lock_fd) ;
+    return (info) ;
+
+    #else
+    return (GrB_SUCCESS) ;
+    #endif
 }
 
 //------------------------------------------------------------------------------
-// GB_jitifyer_table_free:  free the hash and clear all loaded kernels
+// GB_jitifyer_bundle_register: register all kernels in a bundle of JIT kernels
 //------------------------------------------------------------------------------
 
-// Clears all runtime JIT kernels from the hash table.  PreJIT kernels and JIT
-// kernels containing user-defined operators are not freed if freall is true
-// (only done by GrB_finalize), but they are flagged as unchecked.  This allows
-// the application to call GxB_set to set the JIT control to OFF then ON again,
-// to indicate that a user-defined type or operator has been changed, and that
-// all JIT kernels must cleared and all PreJIT kernels checked again before
-// using them.
+// A bundle of JIT kernels is a single library created by GB_jitifyer_pack,
+// either in the JIT cache of this application or in the cache of another.
+// The library holds the renamed GB_jit_kernel and GB_jit_query functions of
+// each kernel, and a NULL-terminated list of their names, GB_jit_bundle_names.
+// The bundle is opened with a single dlopen, and each of its kernels is added
+// to the hash table as an unchecked kernel, just like the PreJIT kernels.  The
+// kernels are checked when first used, with GB_jitifyer_query.  The bundle
+// remains open until GrB_finalize.
 
-// After calling this function, the JIT is still enabled.  GB_jitifyer_insert
-// will reallocate the table if it is NULL.
+// Returns GrB_SUCCESS, GrB_OUT_OF_MEMORY, or GrB_INVALID_VALUE if the library
+// cannot be opened or is not a bundle of JIT kernels.
 
-void GB_jitifyer_table_free (bool freeall)
-{ 
-    if (GB_jit_table != NULL)
+static GrB_Info GB_jitifyer_bundle_register (const char *library)
+{
+
+    #ifndef NJIT
+
+    //--------------------------------------------------------------------------
+    // open the library and find its list of kernels
+    //--------------------------------------------------------------------------
+
+    void *dl_handle = GB_file_dlopen ((char *) library) ;
+    if (dl_handle == NULL)
+    { 
+        // unable to open the library
+        return (GrB_INVALID_VALUE) ;
+    }
+    const char **Names = (const char **) GB_file_dlsym (dl_handle,
+        "GB_jit_bundle_names") ;
+    int64_t nbundle = 0 ;
+    if (Names != NULL)
     {
-        for (uint64_t k = 0 ; k < GB_jit_table_size ; k++)
-        {
-            GB_jit_entry *e = &(GB_jit_table [k]) ;
-            if (e->dl_function != NULL)
-            {
-                // found an entry
-                if (e->dl_handle == NULL)
-                { 
-                    // flag the PreJIT kernel as unchecked
-                    e->prejit_index = GB_UNFLIP (e->prejit_index) ;
-                }
-                // free it if permitted
-                if (freeall || (e->dl_handle != NULL &&
-                      e->encoding.kcode != GB_JIT_KERNEL_USEROP))
-                { 
-                    // free the entry
-                    GB_jitifyer_entry_free (e) ;
-                }
-            }
-        }
+        while (Names [nbundle] != NULL) nbundle++ ;
     }
-
-    ASSERT (GB_IMPLIES (freeall, GB_jit_table_populated == 0)) ;
-    if (GB_jit_table_populated == 0)
+    if (Names == NULL ||
+        nbundle > INT32_MAX - GB_jit_bundle_offset - GB_jit_bundle_nqueries)
     { 
-        // the JIT table is now empty, so free it
-        GB_FREE_STUFF (GB_jit_table) ;
-        GB_jit_table_size = 0 ;
-        GB_jit_table_bits = 0 ;
+        // not a bundle of JIT kernels
+        GB_file_dlclose (dl_handle) ;
+        return (GrB_INVALID_VALUE) ;
     }
-}
 
-//------------------------------------------------------------------------------
-// GB_jitifyer_command: run a command in a child process
-//------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------
+    // make space for the library handle and its query functions
+    //--------------------------------------------------------------------------
 
-// No error condition or status is returned.
+    void **Handles = NULL, **Queries = NULL ;
+    size_t handles_size = (GB_jit_nbundles + 1) * sizeof (void *) ;
+    size_t queries_size = (GB_jit_bundle_nqueries + nbundle + 1) *
+        sizeof (void *) ;
+    GB_MALLOC_PERSISTENT (Handles, handles_size) ;
+    GB_MALLOC_PERSISTENT (Queries, queries_size) ;
+    if (Handles == NULL || Queries == NULL)
+    { 
+        // out of memory
+        GB_FREE_PERSISTENT (Handles) ;
+        GB_FREE_PERSISTENT (Queries) ;
+        GB_file_dlclose (dl_handle) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    if (GB_jit_nbundles > 0)
+    { 
+        memcpy (Handles, GB_jit_bundle_handles,
+            GB_jit_nbundles * sizeof (void *)) ;
+    }
+    if (GB_jit_bundle_nqueries > 0)
+    { 
+        memcpy (Queries, GB_jit_bundle_queries,
+            GB_jit_bundle_nqueries * sizeof (void *)) ;
+    }
+    GB_FREE_STUFF (GB_jit_bundle_handles) ;
+    GB_FREE_STUFF (GB_jit_bundle_queries) ;
+    GB_jit_bundle_handles = Handles ;
+    GB_jit_bundle_handles_allocated = handles_size ;
+    GB_jit_bundle_queries = Queries ;
+    GB_jit_bundle_queries_allocated = queries_size ;
+    GB_jit_bundle_handles [GB_jit_nbundles++] = dl_handle ;
 
-// If burble is on, stdout is left alone, so the stdout of the command is sent
-// to the stdout of the parent process.  If burble is off, stdout is sent to
-// /dev/null (nul on Windows).  If there is no error log file, stderr is not
-// redirected; otherwise, it is redirected to that file.  The redirects are
-// handled by modifying the command string in the caller, so they do not have
-// to be handled here.
+    //--------------------------------------------------------------------------
+    // add each kernel in the bundle to the hash table
+    //--------------------------------------------------------------------------
 
-// NOTE: this call to system(...) *cannot* be sanitized; CodeQL flags calls to
-// GB_jitifyer_command as security issues, but this is intentional.  The JIT
-// allows the end user to create arbitrary user-defined types and operators,
-// which GraphBLAS then injects into C source code of a JIT kernel created at
-// run time.  The end user can also specify an arbitrary compiler to compile
-// JIT kernels.  This code injection is intentional, and required for the JIT.
-// If a security-hardened GraphBLAS library is required, then GraphBLAS must be
-// compiled with -DNJIT to disable the JIT entirely.  User-defined JIT kernels
-// will not be created at run time, and thus user-defined types and operators
-// will be slow, however.  This option does not disable any PreJIT kernels, so
-// if fast user-defined kernels are required, they can be used with the PreJIT
-// mechanism; see the GraphBLAS User Guide for details.
+    for (int64_t k = 0 ; k < nbundle ; k++)
+    {
+        const char *name = Names [k] ;
+        int32_t kq = GB_jit_bundle_nqueries++ ;
+        GB_jit_bundle_queries [kq] = NULL ;
+        if (GB_STRLEN (name) >= GB_KLEN) continue ;
+        void *dl_function = GB_file_dlsym (dl_handle, (char *) name) ;
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s_query", name) ;
+        void *dl_query = GB_file_dlsym (dl_handle, GB_jit_temp) ;
+        if (dl_function == NULL || dl_query == NULL)
+        { 
+            // the kernel is not in the bundle; ignore it
+            continue ;
+        }
+        GB_jit_bundle_queries [kq] = dl_query ;
+        if (!GB_jitifyer_register_kernel (name, dl_function,
+            (GB_jit_query_func) dl_query, GB_jit_bundle_offset + kq))
+        { 
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
 
-static void GB_jitifyer_command (char *command)
-{ 
-    #ifndef NJIT
-    int result = system (command) ;
+    GBURBLE ("(jit: bundle of %" PRId64 " kernels loaded) ", nbundle) ;
+    return (GrB_SUCCESS) ;
+
+    #else
+    return (GrB_NOT_IMPLEMENTED) ;
     #endif
 }
 
 //------------------------------------------------------------------------------
-// GB_jitifyer_cmake_compile: compile a kernel with cmake
+// GB_jitifyer_bundle_load: load the bundle of JIT kernels from the cache
 //------------------------------------------------------------------------------
 
-// This method does not return any error/success code.  If the compilation
-// fails for any reason, the subsequent load of the compiled kernel will fail.
+// If the cache holds a bundle of JIT kernels (created by GB_jitifyer_pack),
+// it is registered by GB_jitifyer_bundle_register.  Only the bundle in the
+// first cache path used is loaded.
 
-// This method works on most platforms (not yet on MINGW, so it is not used
-// there).  For Windows using MSVC, this method is always used.
+// Returns GrB_SUCCESS or GrB_OUT_OF_MEMORY.  If the bundle cannot be loaded
+// for any other reason, it is ignored.
 
-// FUTURE: get this method to work in MINGW.
+GrB_Info GB_jitifyer_bundle_load (void)
+{
 
-#define GB_BLD_DIR "%s/tmp/%016" PRIx64
+    #ifndef NJIT
 
-void GB_jitifyer_cmake_compile (char *kernel_name, uint64_t hash)
-{ 
-#ifndef NJIT
+    if (GB_jit_cache_bundle_loaded || GB_jit_control < GxB_JIT_LOAD)
+    { 
+        // the cache bundle is already loaded, or no kernels may be loaded
+        return (GrB_SUCCESS) ;
+    }
 
-    uint32_t bucket = hash & 0xFF ;
-    GBURBLE ("(jit: %s)\n", "cmake") ;
-    char *burble_stdout = GB_Global_burble_get ( ) ? "" : GB_DEV_NULL ;
-    bool have_log = (GB_STRLEN (GB_jit_error_log) > 0) ;
-    char *err_redirect = have_log ?  " 2>> " : " 2>&1 " ;
-    char *log_quote = have_log ? "\"" : "" ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%sGB_jit_bundle%s",
+        GB_jit_cache_path, GB_LIB_PREFIX, GB_LIB_SUFFIX) ;
+    if (!GB_file_exists (GB_jit_temp))
+    { 
+        // no bundle in the cache
+        return (GrB_SUCCESS) ;
+    }
 
-#if defined (__MINGW32__)
-#define GB_SH_C "sh -c "
-#else
-#define GB_SH_C
-#endif
+    GrB_Info info = GB_jitifyer_bundle_register (GB_jit_temp) ;
+    if (info == GrB_OUT_OF_MEMORY)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    else if (info != GrB_SUCCESS)
+    { 
+        // unable to load the bundle; ignore it
+        GBURBLE ("(jit: unable to load bundle) ") ;
+    }
+    GB_jit_cache_bundle_loaded = true ;
+    return (GrB_SUCCESS) ;
 
-    // remove any prior build folder for this kernel, and all its contents
-    snprintf (GB_jit_temp, GB_jit_temp_allocated,
-        GB_SH_C "cmake -E remove_directory \"" GB_BLD_DIR "\" %s %s %s%s%s",
-        GB_jit_cache_path, hash,     // build path
-        burble_stdout, err_redirect,
-        log_quote, GB_jit_error_log, log_quote) ;
-    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+    #else
+    return (GrB_SUCCESS) ;
+    #endif
+}
 
-    // create the build folder for this kernel
-    snprintf (GB_jit_temp, GB_jit_temp_allocated, GB_BLD_DIR,
-        GB_jit_cache_path, hash) ;
-    if (!GB_file_mkdir (GB_jit_temp)) return ;
+//------------------------------------------------------------------------------
+// GB_jitifyer_bundle_free: unload all bundles of JIT kernels
+//------------------------------------------------------------------------------
 
-    // create the CMakeLists.txt file in the build folder for this kernel
-    snprintf (GB_jit_temp, GB_jit_temp_allocated, GB_BLD_DIR "/CMakeLists.txt",
-        GB_jit_cache_path, hash) ;
-    FILE *fp = fopen (GB_jit_temp, "w") ;
-    if (fp == NULL) return ;
-    fprintf (fp,
-        "cmake_minimum_required ( VERSION 3.13 )\n" // end user needs cmake 3.13
-        "project ( GBjit LANGUAGES C )\n"
-        "include_directories ( \"%s/src\" \"%s/src/template\""
-        " \"%s/src/include\" %s)\n"
-        "add_compile_definitions ( GB_JIT_RUNTIME )\n",
-        GB_jit_cache_path,          // include: cache/src
-        GB_jit_cache_path,          // include: cache/src/template
-        GB_jit_cache_path,          // include: cache/src/include
-        ((strlen (GB_OMP_INC_DIRS) == 0) ? " " : " \"" GB_OMP_INC_DIRS "\" ")) ;
-    // print the C flags, but escape any double quote characters
-    fprintf (fp, "set ( CMAKE_C_FLAGS \"") ;
-    for (char *p = GB_jit_C_flags ; *p != '\0' ; p++)
-    {
-        if (*p == '"') fprintf (fp, "\\") ;
-        fprintf (fp, "%c", *p) ;
-    }
-    fprintf (fp, "\" )\n") ;
-    fprintf (fp,
-        "add_library ( %s SHARED \"%s/c/%02x/%s.c\" )\n",
-        kernel_name,                // target name for add_library command
-        GB_jit_cache_path, bucket, kernel_name) ; // source file for add_library
-    if (GB_STRLEN (GB_jit_C_cmake_libs) > 0)
-    {
-        fprintf (fp,
-            "target_link_libraries ( %s PUBLIC %s )\n",
-            kernel_name,                // target name of the library
-            GB_jit_C_cmake_libs) ;      // libraries to link against
+// All kernels from the bundles must already have been removed from the hash
+// table; this is only done by GrB_finalize.
+
+void GB_jitifyer_bundle_free (void)
+{ 
+    for (int32_t b = 0 ; b < GB_jit_nbundles ; b++)
+    { 
+        GB_file_dlclose (GB_jit_bundle_handles [b]) ;
     }
+    GB_FREE_STUFF (GB_jit_bundle_handles) ;
+    GB_FREE_STUFF (GB_jit_bundle_queries) ;
+    GB_jit_nbundles = 0 ;
+    GB_jit_bundle_nqueries = 0 ;
+    GB_jit_cache_bundle_loaded = false ;
+}
 
-    fprintf (fp, 
-        "set_target_properties ( %s PROPERTIES\n"
-        "    C_STANDARD 11 C_STANDARD_REQUIRED ON )\n"
-        "install ( TARGETS %s\n"
-        "    LIBRARY DESTINATION \"%s/lib/%02x\"\n"
-        "    ARCHIVE DESTINATION \"%s/lib/%02x\"\n"
-        "    RUNTIME DESTINATION \"%s/lib/%02x\" )\n",
-        kernel_name,
-        kernel_name,
-        GB_jit_cache_path, bucket,
-        GB_jit_cache_path, bucket,
-        GB_jit_cache_path, bucket) ;
-    fclose (fp) ;
+//------------------------------------------------------------------------------
+// GB_jitifyer_load_bundle: register a bundle of JIT kernels from a library
+//------------------------------------------------------------------------------
 
-    // generate the build system for this kernel
-    snprintf (GB_jit_temp, GB_jit_temp_allocated,
-        GB_SH_C "cmake -S \"" GB_BLD_DIR "\" -B \"" GB_BLD_DIR "\""
-        " -DCMAKE_C_COMPILER=\"%s\" %s %s %s%s%s",
-        GB_jit_cache_path, hash,     // -S source path
-        GB_jit_cache_path, hash,     // -B build path
-        GB_jit_C_compiler,                  // C compiler to use
-        burble_stdout, err_redirect, log_quote, GB_jit_error_log, log_quote) ;
-    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+// The library must have been created by GB_jitifyer_pack, in any JIT cache,
+// by the same version of GraphBLAS; kernels from any other version are
+// ignored when first used.  The kernels can be used even if the JIT control
+// is GxB_JIT_LOAD, so an application can ship its own pack of kernels and
+// never compile any kernels at run time.
 
-    // compile the library for this kernel
-    snprintf (GB_jit_temp, GB_jit_temp_allocated,
-        GB_SH_C "cmake --build \"" GB_BLD_DIR
-        "\" --config Release %s %s %s%s%s",
-        // can add "--verbose" here too
-        GB_jit_cache_path, hash,     // build path
-        burble_stdout, err_redirect, log_quote, GB_jit_error_log, log_quote) ;
-    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+GrB_Info GB_jitifyer_load_bundle (const char *library)
+{ 
 
-    // install the library
-    snprintf (GB_jit_temp, GB_jit_temp_allocated,
-        GB_SH_C "cmake --install \"" GB_BLD_DIR "\" %s %s %s%s%s",
-        GB_jit_cache_path, hash,     // build path
-        burble_stdout, err_redirect, log_quote, GB_jit_error_log, log_quote) ;
-    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+    //--------------------------------------------------------------------------
+    // register the bundle in a critical section
+    //--------------------------------------------------------------------------
 
-    // remove the build folder and all its contents
-    snprintf (GB_jit_temp, GB_jit_temp_allocated,
-        GB_SH_C "cmake -E remove_directory \"" GB_BLD_DIR "\" %s %s %s%s%s",
-        GB_jit_cache_path, hash,     // build path
-        burble_stdout, err_redirect, log_quote, GB_jit_error_log, log_quote) ;
-    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        info = GB_jitifyer_load_bundle_worker (library) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_load_bundle_worker: register a bundle in a critical section
+//------------------------------------------------------------------------------
 
-#endif
+GrB_Info GB_jitifyer_load_bundle_worker (const char *library)
+{ 
+    if (GB_jit_temp == NULL)
+    { 
+        // the JIT workspace has not been allocated
+        return (GrB_INVALID_VALUE) ;
+    }
+    return (GB_jitifyer_bundle_register (library)) ;
 }
 
 //------------------------------------------------------------------------------
-// GB_jitifyer_nvcc_compile: compile a CUDA kernel with nvcc
+// GB_jitifyer_pack: pack all compiled kernels in the cache into a bundle
 //------------------------------------------------------------------------------
 
-// Compiles a CUDA JIT kernel in a *.cu file, containing host code that
-// launches one or more device kernels.
-
-// The input file has the form:
-//
-//      %s/c/%02x/%s or [cache_path]/c/[bucket]/[kernel_name].cu
-//
-// and the libary file is linked as
-//
-//      %s/lib/%02x/lib%s.so or [cache_path]/lib/[bucket]/lib[kernel_name].so
-//
-// All other temporary files (including *.o object files) are removed.
+// Each kernel in the cache that has been compiled into its own lib*.so file
+// is compiled again from its source, with its GB_jit_kernel and GB_jit_query
+// functions renamed (as is done for PreJIT kernels) so that they are unique.
+// Up to ncompilers kernels are compiled at the same time.  The resulting
+// objects are linked into a single library, lib/libGB_jit_bundle.so, along
+// with the list of their names.  The bundle is loaded by
+// GB_jitifyer_bundle_load when GraphBLAS starts, or it can be copied elsewhere
+// and loaded by GB_jitifyer_load_bundle (GxB_JIT_register).
+// The individual lib*.so files are left in the cache, so kernels that are not
+// in the bundle (or whose user-defined types or operators have changed) are
+// loaded or compiled as usual.
+
+// The bundle can only be created with a direct compile; GrB_NOT_IMPLEMENTED
+// is returned if the JIT is using cmake.
+
+GrB_Info GB_jitifyer_pack (int ncompilers)
+{ 
 
-void GB_jitifyer_nvcc_compile (char *kernel_name, uint32_t bucket)
-{
+    //--------------------------------------------------------------------------
+    // pack the kernels in a critical section
+    //--------------------------------------------------------------------------
 
-#if defined ( GRAPHBLAS_HAS_CUDA ) && !defined ( NJIT )
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        info = GB_jitifyer_pack_worker (ncompilers) ;
+    }
+    return (info) ;
+}
 
-    char *burble_stdout = GB_Global_burble_get ( ) ? "" : GB_DEV_NULL ;
-    bool have_log = (GB_STRLEN (GB_jit_error_log) > 0) ;
-    char *err_redirect = have_log ?  " 2>> " : " 2>&1 " ;
-    char *log_quote = have_log ? "'" : "" ;
+//------------------------------------------------------------------------------
+// GB_jitifyer_pack_worker: pack the kernels in a critical section
+//------------------------------------------------------------------------------
 
-    GBURBLE ("(jit compiling cuda with nvcc: %s/c/%02x/%s.cu) ",
-        GB_jit_cache_path, bucket, kernel_name) ;
+#define GB_FREE_PACK_WORKSPACE                  \
+{                                               \
+    GB_FREE_PERSISTENT (Names) ;                \
+    GB_FREE_PERSISTENT (Buckets) ;              \
+    GB_FREE_PERSISTENT (batch) ;                \
+    GB_file_unlock_and_close (&fp_lock, &fd_lock) ; \
+}
 
-    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+GrB_Info GB_jitifyer_pack_worker (int ncompilers)
+{
 
-    // compile:
-    "sh -c \""                          // execute with POSIX shell
-    // FIXME: use GB_CUDA_COMPILER here:
-    "nvcc "                             // compiler command
-    "-forward-unknown-to-host-compiler "
-    "-DGB_JIT_RUNTIME=1  "              // nvcc flags
-    // FIXME: add GB_CUDA_INC here:
-    "-I/usr/local/cuda/include -std=c++17 " 
-    // FIXME: use GB_CUDA_ARCHITECTURES here:
-    " -arch=sm_60 "
-    " -fPIC " 
-    // FIXME: add GB_CUDA_FLAGS here:
-    " -O3 "   // HACK FIXME (for CUDA)
-    "-I'%s/src' "                       // include source directory
-    "-I'%s/src/template' "
-    "-I'%s/src/include' "
-    "-o '%s/c/%02x/%s%s' "              // *.o output file
-    "-c '%s/c/%02x/%s.cu' "             // *.cu input file
-    "%s "                               // burble stdout
-    "%s %s%s%s ; "                      // error log file
+    #ifndef NJIT
 
-    // link:
-    "nvcc "                             // compiler
-    "-DGB_JIT_RUNTIME=1  "              // nvcc flags
-    "-I/usr/local/cuda/include -std=c++17 -arch=sm_60 "
-    " -shared "
-    "-o '%s/lib/%02x/%s%s%s' "          // lib*.so output file
-    "'%s/c/%02x/%s%s' "                 // *.o input file
-    " -cudart shared "
-//  "%s "                               // libraries to link with (any?)
-    "%s "                               // burble stdout
-    "%s %s%s%s\"",                      // error log file
+    //--------------------------------------------------------------------------
+    // check if the JIT can pack the cache
+    //--------------------------------------------------------------------------
 
-    // compile:
-    GB_jit_cache_path,                  // include cache/src
-    GB_jit_cache_path,                  // include cache/src/template
-    GB_jit_cache_path,                  // include cache/src/include
-    GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX,  // *.o output file
-    GB_jit_cache_path, bucket, kernel_name,                 // *.cu input file
-    burble_stdout,                      // burble stdout
-    err_redirect, log_quote, GB_jit_error_log, log_quote,   // error log file
+    if (GB_jit_control < GxB_JIT_ON)
+    { 
+        GBURBLE ("(jit pack: compilation disabled) ") ;
+        return (GrB_SUCCESS) ;
+    }
 
-    // link:
-    GB_jit_cache_path, bucket,  
-    GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX,              // lib*.so file
-    GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX,  // *.o input file
-//  GB_jit_C_libraries                  // libraries to link with
-    burble_stdout,                      // burble stdout
-    err_redirect, log_quote, GB_jit_error_log, log_quote) ; // error log file
+    if (GB_jit_use_cmake)
+    { 
+        // the bundle cannot be created with cmake
+        return (GrB_NOT_IMPLEMENTED) ;
+    }
 
-    // compile the library and return result
-    GBURBLE ("\n(jit: %s) ", GB_jit_temp) ;
-    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+    //--------------------------------------------------------------------------
+    // lock the bundle, so that only one process can create it at a time
+    //--------------------------------------------------------------------------
 
-    // remove the *.o file
-    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s%s",
-        GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX) ;
-    remove (GB_jit_temp) ;
+    char *Names = NULL ;
+    uint32_t *Buckets = NULL ;
+    char *batch = NULL ;
+    FILE *fp_lock = NULL ;
+    int fd_lock = -1 ;
 
-#endif
-}
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lock/GB_jit_bundle_lock",
+        GB_jit_cache_path) ;
+    if (!GB_file_open_and_lock (GB_jit_temp, &fp_lock, &fd_lock))
+    { 
+        // unable to lock the bundle
+        return (GrB_INVALID_VALUE) ;
+    }
 
-//------------------------------------------------------------------------------
-// GB_jitifyer_direct_compile: compile a kernel with just the compiler
-//------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------
+    // find all kernels in the cache with a compiled lib*.so file
+    //--------------------------------------------------------------------------
 
-// This method does not return any error/success code.  If the compilation
-// fails for any reason, the subsequent load of the compiled kernel will fail.
+    int64_t nkernels = 0, nmax = 0 ;
+    for (uint32_t bucket = 0 ; bucket <= 0xFF ; bucket++)
+    {
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x",
+            GB_jit_cache_path, bucket) ;
+        void *dir = GB_file_opendir (GB_jit_temp) ;
+        const char *file ;
+        while ((file = GB_file_readdir (dir)) != NULL)
+        {
+            // find the next kernel source file, GB_jit__*.c
+            size_t len = strlen (file) ;
+            if (len < 10 || len >= GB_KLEN || strncmp (file, "GB_jit__", 8) != 0
+                || strcmp (file + len - 2, ".c") != 0)
+            { 
+                continue ;
+            }
+            // make sure space is available for it
+            if (nkernels == nmax)
+            {
+                int64_t newmax = GB_IMAX (2 * nmax, 256) ;
+                char *NewNames = NULL ;
+                uint32_t *NewBuckets = NULL ;
+                GB_MALLOC_PERSISTENT (NewNames, newmax * GB_KLEN) ;
+                GB_MALLOC_PERSISTENT (NewBuckets, newmax * sizeof (uint32_t)) ;
+                if (NewNames == NULL || NewBuckets == NULL)
+                { 
+                    // out of memory
+                    GB_FREE_PERSISTENT (NewNames) ;
+                    GB_FREE_PERSISTENT (NewBuckets) ;
+                    GB_file_closedir (dir) ;
+                    GB_FREE_PACK_WORKSPACE ;
+                    return (GrB_OUT_OF_MEMORY) ;
+                }
+                if (nkernels > 0)
+                { 
+                    memcpy (NewNames, Names, nkernels * GB_KLEN) ;
+                    memcpy (NewBuckets, Buckets, nkernels * sizeof (uint32_t)) ;
+                }
+                GB_FREE_PERSISTENT (Names) ;
+                GB_FREE_PERSISTENT (Buckets) ;
+                Names = NewNames ;
+                Buckets = NewBuckets ;
+                nmax = newmax ;
+            }
+            // get the kernel name (the filename without the .c)
+            char *kernel_name = Names + nkernels * GB_KLEN ;
+            memcpy (kernel_name, file, len - 2) ;
+            kernel_name [len - 2] = '\0' ;
+            // include the kernel only if its lib*.so file exists
+            snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%02x/%s%s%s",
+                GB_jit_cache_path, bucket, GB_LIB_PREFIX, kernel_name,
+                GB_LIB_SUFFIX) ;
+            if (!GB_file_exists (GB_jit_temp))
+            { 
+                continue ;
+            }
+            // exclude the kernel if it links the object file of an operator,
+            // since its symbols are hidden within the lib*.so of the kernel,
+            // and the object file may be shared with other kernels.  The
+            // kernel is loaded from its own lib*.so file instead.
+            GrB_Info info = GB_jitifyer_kernel_C_flags_read (kernel_name,
+                bucket) ;
+            bool has_objects = (GB_STRLEN (GB_jit_kernel_C_objects) > 0) ;
+            GB_jitifyer_kernel_C_flags_clear ( ) ;
+            if (info == GrB_OUT_OF_MEMORY)
+            { 
+                // out of memory
+                GB_file_closedir (dir) ;
+                GB_FREE_PACK_WORKSPACE ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            if (info != GrB_SUCCESS)
+            { 
+                GBURBLE ("(jit pack: %s not packed; it has invalid C flags "
+                    "or object files) ", kernel_name) ;
+                continue ;
+            }
+            if (has_objects)
+            { 
+                GBURBLE ("(jit pack: %s not packed; it links an object "
+                    "file) ", kernel_name) ;
+                continue ;
+            }
+            Buckets [nkernels++] = bucket ;
+        }
+        GB_file_closedir (dir) ;
+    }
 
-// This method does not work on Windows with MSVC.  It works for Linux, Mac,
-// or Windows with MINGW (for which it is currently the only option).
+    GBURBLE ("(jit pack: %" PRId64 " kernels) ", nkernels) ;
+    if (nkernels == 0)
+    { 
+        // nothing to pack
+        GB_FREE_PACK_WORKSPACE ;
+        return (GrB_SUCCESS) ;
+    }
 
-// FUTURE: get this method to work in MSVC, since it's much faster than using
-// cmake on Windows.
+    //--------------------------------------------------------------------------
+    // allocate space for the commands
+    //--------------------------------------------------------------------------
 
-void GB_jitifyer_direct_compile (char *kernel_name, uint32_t bucket)
-{ 
+    // The batch holds the compile commands for up to ncompilers kernels, and
+    // then the link command for all of them.
+    ncompilers = GB_IMAX (ncompilers, 1) ;
+    size_t batch_allocated = GB_IMAX (
+        ncompilers * (GB_jit_temp_allocated + 1),
+        GB_jit_temp_allocated + 2 * GB_jit_cache_path_allocated +
+        nkernels * (GB_jit_cache_path_allocated + GB_KLEN + 32)) + 64 ;
+    GB_MALLOC_PERSISTENT (batch, batch_allocated) ;
+    if (batch == NULL)
+    { 
+        // out of memory
+        GB_FREE_PACK_WORKSPACE ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    batch [0] = '\0' ;
 
-#ifndef NJIT
+    //--------------------------------------------------------------------------
+    // compile each kernel, with its functions renamed
+    //--------------------------------------------------------------------------
 
     char *burble_stdout = GB_Global_burble_get ( ) ? "" : GB_DEV_NULL ;
     bool have_log = (GB_STRLEN (GB_jit_error_log) > 0) ;
     char *err_redirect = have_log ?  " 2>> " : " 2>&1 " ;
     char *log_quote = have_log ? "'" : "" ;
 
-    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+    // Each kernel is compiled with its own C flags, which were checked when
+    // the kernels were found above.  GB_jit_temp was then made large enough
+    // for all of them, so it is not reallocated here.
+    int nbatch = 0 ;
+    for (int64_t k = 0 ; k < nkernels ; k++)
+    {
+        char *kernel_name = Names + k * GB_KLEN ;
+        uint32_t bucket = Buckets [k] ;
+        if (GB_jitifyer_kernel_C_flags_read (kernel_name, bucket)
+            != GrB_SUCCESS)
+        { 
+            // the kernel source has changed; it is not packed
+            snprintf (GB_jit_temp, GB_jit_temp_allocated,
+                "%s/c/%02x/%s_bundle%s", GB_jit_cache_path, bucket,
+                kernel_name, GB_OBJ_SUFFIX) ;
+            remove (GB_jit_temp) ;
+            continue ;
+        }
+        char *kernel_C_flags = (GB_jit_kernel_C_flags == NULL) ? "" :
+            GB_jit_kernel_C_flags ;
+        snprintf (GB_jit_temp, GB_jit_temp_allocated,
+            "sh -c \""                          // execute with POSIX shell
+            "%s "                               // compiler command
+            "-DGB_JIT_RUNTIME=1 %s %s "         // C flags
+            "-DGB_jit_kernel=%s "               // rename the kernel
+            "-DGB_jit_query=%s_query "          // rename the query function
+            "-I'%s/src' "                       // include source directory
+            "-I'%s/src/template' "
+            "-I'%s/src/include' "
+            "%s "                               // openmp include directories
+            "-o '%s/c/%02x/%s_bundle%s' "       // *.o output file
+            "-c '%s/c/%02x/%s.c' "              // *.c input file
+            "%s "                               // burble stdout
+            "%s %s%s%s\" & ",                   // error log file
+            GB_jit_C_compiler, GB_jit_C_flags, kernel_C_flags,
+            kernel_name, kernel_name,
+            GB_jit_cache_path, GB_jit_cache_path, GB_jit_cache_path,
+            GB_OMP_INC,
+            GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX,
+            GB_jit_cache_path, bucket, kernel_name,
+            burble_stdout,
+            err_redirect, log_quote, GB_jit_error_log, log_quote) ;
+        GB_jitifyer_kernel_C_flags_clear ( ) ;
+        size_t len = strlen (batch) ;
+        snprintf (batch + len, batch_allocated - len, "%s", GB_jit_temp) ;
+        nbatch++ ;
+        if (nbatch == ncompilers)
+        { 
+            GB_jitifyer_run_batch (batch, batch_allocated, &nbatch) ;
+        }
+    }
+    GB_jitifyer_run_batch (batch, batch_allocated, &nbatch) ;
 
-    // compile:
-    "sh -c \""                          // execute with POSIX shell
-    "%s "                               // compiler command
-    "-DGB_JIT_RUNTIME=1 %s "            // C flags
-    "-I'%s/src' "                       // include source directory
-    "-I'%s/src/template' "
-    "-I'%s/src/include' "
-    "%s "                               // openmp include directories
-    "-o '%s/c/%02x/%s%s' "              // *.o output file
-    "-c '%s/c/%02x/%s.c' "              // *.c input file
-    "%s "                               // burble stdout
-    "%s %s%s%s ; "                      // error log file
+    //--------------------------------------------------------------------------
+    // find the kernels that compiled
+    //--------------------------------------------------------------------------
 
-    // link:
-    "%s "                               // C compiler
-    "%s "                               // C flags
-    "%s "                               // C link flags
-    "-o '%s/lib/%02x/%s%s%s' "          // lib*.so output file
-    "'%s/c/%02x/%s%s' "                 // *.o input file
-    "%s "                               // libraries to link with
-    "%s "                               // burble stdout
-    "%s %s%s%s\"",                      // error log file
+    int64_t nbundle = 0 ;
+    for (int64_t k = 0 ; k < nkernels ; k++)
+    {
+        char *kernel_name = Names + k * GB_KLEN ;
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s_bundle%s",
+            GB_jit_cache_path, Buckets [k], kernel_name, GB_OBJ_SUFFIX) ;
+        if (GB_file_exists (GB_jit_temp))
+        {
+            // keep this kernel in the list of kernels in the bundle
+            if (nbundle < k)
+            { 
+                memcpy (Names + nbundle * GB_KLEN, kernel_name, GB_KLEN) ;
+                Buckets [nbundle] = Buckets [k] ;
+            }
+            nbundle++ ;
+        }
+    }
 
-    // compile:
-    GB_jit_C_compiler,                  // C compiler
-    GB_jit_C_flags,                     // C flags
-    GB_jit_cache_path,                  // include cache/src
-    GB_jit_cache_path,                  // include cache/src/template
-    GB_jit_cache_path,                  // include cache/src/include
-    GB_OMP_INC,                         // openmp include
-    GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX,  // *.o output file
-    GB_jit_cache_path, bucket, kernel_name,                 // *.c input file
-    burble_stdout,                      // burble stdout
-    err_redirect, log_quote, GB_jit_error_log, log_quote,   // error log file
+    //--------------------------------------------------------------------------
+    // write the list of kernel names, and the index
+    //--------------------------------------------------------------------------
 
-    // link:
-    GB_jit_C_compiler,                  // C compiler
-    GB_jit_C_flags,                     // C flags
-    GB_jit_C_link_flags,                // C link flags
-    GB_jit_cache_path, bucket,  
-    GB_LIB_PREFIX, kernel_name, GB_LIB_SUFFIX,              // lib*.so file
-    GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX,  // *.o input file
-    GB_jit_C_libraries,                 // libraries to link with
-    burble_stdout,                      // burble stdout
-    err_redirect, log_quote, GB_jit_error_log, log_quote) ; // error log file
+    // The list of kernel names, GB_jit_bundle_names, is linked into the
+    // bundle, so that the bundle can be registered from any location by
+    // GB_jitifyer_bundle_register.  The index, lib/GB_jit_bundle.txt, lists
+    // the same kernels, one per line, but it is not needed to load the bundle.
 
-    // compile the library and return result
-    GBURBLE ("(jit: %s) ", GB_jit_temp) ;
-    GB_jitifyer_command (GB_jit_temp) ; // OK: see security comment above
+    GrB_Info info = GrB_INVALID_VALUE ;
+    FILE *fp = NULL, *fp_index = NULL ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+        "%s/c/GB_jit_bundle_names.c", GB_jit_cache_path) ;
+    fp = fopen (GB_jit_temp, "w") ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/GB_jit_bundle.txt",
+        GB_jit_cache_path) ;
+    fp_index = fopen (GB_jit_temp, "w") ;
+    if (fp != NULL)
+    {
+        fprintf (fp, "// list of kernels in this bundle (GxB_JIT_pack)\n"
+            "const char *GB_jit_bundle_names [%" PRId64 "] =\n{\n",
+            nbundle + 1) ;
+        for (int64_t k = 0 ; k < nbundle ; k++)
+        { 
+            fprintf (fp, "    \"%s\",\n", Names + k * GB_KLEN) ;
+        }
+        fprintf (fp, "    0\n} ;\n") ;
+        fclose (fp) ;
+    }
+    if (fp_index != NULL)
+    {
+        for (int64_t k = 0 ; k < nbundle ; k++)
+        { 
+            fprintf (fp_index, "%s\n", Names + k * GB_KLEN) ;
+        }
+        fclose (fp_index) ;
+    }
 
-    // remove the *.o file
-    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s%s",
-        GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX) ;
+    //--------------------------------------------------------------------------
+    // link all the kernels that compiled into the bundle
+    //--------------------------------------------------------------------------
+
+    snprintf (batch, batch_allocated,
+        "sh -c \"%s %s %s -o '%s/lib/%sGB_jit_bundle%s.tmp' "
+        "'%s/c/GB_jit_bundle_names.c' ",
+        GB_jit_C_compiler, GB_jit_C_flags, GB_jit_C_link_flags,
+        GB_jit_cache_path, GB_LIB_PREFIX, GB_LIB_SUFFIX, GB_jit_cache_path) ;
+    for (int64_t k = 0 ; k < nbundle ; k++)
+    { 
+        size_t len = strlen (batch) ;
+        snprintf (batch + len, batch_allocated - len,
+            "'%s/c/%02x/%s_bundle%s' ", GB_jit_cache_path, Buckets [k],
+            Names + k * GB_KLEN, GB_OBJ_SUFFIX) ;
+    }
+    size_t len = strlen (batch) ;
+    snprintf (batch + len, batch_allocated - len, "%s %s %s%s%s\"",
+        GB_jit_C_libraries, burble_stdout,
+        err_redirect, log_quote, GB_jit_error_log, log_quote) ;
+    GBURBLE ("(jit pack: linking %" PRId64 " kernels) ", nbundle) ;
+    if (fp != NULL && nbundle > 0)
+    { 
+        GB_jitifyer_command (batch) ; // OK: see security comment above
+    }
+
+    // remove the objects
+    for (int64_t k = 0 ; k < nbundle ; k++)
+    { 
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s_bundle%s",
+            GB_jit_cache_path, Buckets [k], Names + k * GB_KLEN,
+            GB_OBJ_SUFFIX) ;
+        remove (GB_jit_temp) ;
+    }
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+        "%s/c/GB_jit_bundle_names.c", GB_jit_cache_path) ;
     remove (GB_jit_temp) ;
 
-#endif
+    //--------------------------------------------------------------------------
+    // move the bundle into place
+    //--------------------------------------------------------------------------
+
+    snprintf (batch, batch_allocated, "%s/lib/%sGB_jit_bundle%s.tmp",
+        GB_jit_cache_path, GB_LIB_PREFIX, GB_LIB_SUFFIX) ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%sGB_jit_bundle%s",
+        GB_jit_cache_path, GB_LIB_PREFIX, GB_LIB_SUFFIX) ;
+    if (GB_file_exists (batch) && rename (batch, GB_jit_temp) == 0)
+    { 
+        info = GrB_SUCCESS ;
+    }
+    else
+    { 
+        // unable to create the bundle
+        GBURBLE ("(jit pack: failed) ") ;
+        remove (batch) ;
+    }
+
+    GB_FREE_PACK_WORKSPACE ;
+    return (info) ;
+
+    #else
+    return (GrB_SUCCESS) ;
+    #endif
 }
 
 //------------------------------------------------------------------------------
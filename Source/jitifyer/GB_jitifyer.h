@@ -31,7 +31,7 @@ void GB_prejit
 typedef enum
 {
     GB_jit_reduce_family    = 1,    // kcode 1
-    GB_jit_mxm_family       = 2,    // kcodes 2 to 9
+    GB_jit_mxm_family       = 2,    // kcodes 2 to 9, and 88 to 90
     GB_jit_ewise_family     = 3,    // kcodes 10 to 24
     GB_jit_apply_family     = 4,    // kcodes 25 to 33
     GB_jit_build_family     = 5,    // kcode 34
@@ -111,6 +111,13 @@ typedef enum
     GB_JIT_KERNEL_SUBASSIGN_23  = 43, // GB_subassign_23
     GB_JIT_KERNEL_SUBASSIGN_25  = 44, // GB_subassign_25
 
+    // fused mxm and reduce methods (in the mxm family):
+    GB_JIT_KERNEL_AXB_DOT3_REDUCE = 88, // GB_AxB_dot3_reduce
+    GB_JIT_KERNEL_AXB_DOT3_ROWREDUCE = 89, // GB_AxB_dot3_rowreduce
+
+    // fine-grain dot products for tiny C=A'*B (in the mxm family):
+    GB_JIT_KERNEL_AXB_DOT2_FINE = 90, // GB_AxB_dot2_fine
+
     //--------------------------------------------------------------------------
     // future:: the following kernels have not been implemented yet
     //--------------------------------------------------------------------------
@@ -208,17 +215,26 @@ GB_jit_kcode ;
 // To save space, prejit_index could then be reduced to uint32_t and saved
 // in the encoding struct.
 
+// dim is a matrix dimension that is fixed when the kernel is compiled, so
+// that its loops can be unrolled (see GxB_JIT_SPECIALIZE_DIM).  It is zero
+// for a kernel that works for any dimension.
+
 struct GB_jit_encoding_struct
 {
     uint64_t code ;         // from GB_enumify_*
-    uint32_t kcode ;        // which kernel (a GB_jit_kcode)
+    uint16_t kcode ;        // which kernel (a GB_jit_kcode)
+    uint16_t dim ;          // fixed dimension of the kernel (0 if none)
     uint32_t suffix_len ;   // length of the suffix (0 for builtin)
 } ;
 
 typedef struct GB_jit_encoding_struct GB_jit_encoding ;
 
 // prejit_index could be int32_t, but making it int64_t rounds up the size of
-// the GB_jit_entry_struct to a multiple of 8 (56 bytes):
+// the GB_jit_entry_struct to a multiple of 8 (88 bytes).  The ncalls and
+// run_time are only updated if the JIT profile is enabled (GxB_JIT_PROFILE).
+// last_used is the LRU clock when the kernel was last looked up, for
+// GxB_JIT_MAX_LOADED.  An entry with a hash of zero is a kernel that has been
+// evicted from the table; its slot is not reused until the table is rebuilt.
 
 struct GB_jit_entry_struct
 {
@@ -230,6 +246,10 @@ struct GB_jit_entry_struct
     void *dl_function ;         // address of kernel function
     int64_t prejit_index ;      // -1: JIT kernel or checked PreJIT kernel
                                 // >= 0: index of unchecked PreJIT kernel.
+    int64_t ncalls ;            // # of times the kernel has been called
+    double run_time ;           // total time spent in the kernel (seconds)
+    double load_time ;          // time to compile and/or load the kernel
+    int64_t last_used ;         // LRU clock when the kernel was last used
 } ;
 
 typedef struct GB_jit_entry_struct GB_jit_entry ;
@@ -354,8 +374,10 @@ bool GB_jitifyer_query
 ) ;
 
 void GB_jitifyer_cmake_compile (char *kernel_name, uint64_t hash) ;
-void GB_jitifyer_direct_compile (char *kernel_name, uint32_t bucket) ;
+void GB_jitifyer_direct_compile (char *kernel_name, uint32_t bucket,
+    bool background) ;
 void GB_jitifyer_nvcc_compile (char *kernel_name, uint32_t bucket) ;
+bool GB_jitifyer_libtcc_compile (char *kernel_name, uint32_t bucket) ;
 
 GrB_Info GB_jitifyer_init (void) ;  // initialize the JIT
 
@@ -410,8 +432,92 @@ const char *GB_jitifyer_get_error_log (void) ;
 GrB_Info GB_jitifyer_set_error_log (const char *new_error_log) ;
 GrB_Info GB_jitifyer_set_error_log_worker (const char *new_error_log) ;
 
+const char *GB_jitifyer_get_manifest (void) ;
+GrB_Info GB_jitifyer_set_manifest (const char *new_manifest) ;
+GrB_Info GB_jitifyer_set_manifest_worker (const char *new_manifest) ;
+
+GrB_Info GB_jitifyer_warmup (const char *manifest, int ncompilers) ;
+GrB_Info GB_jitifyer_warmup_worker (const char *manifest, int ncompilers) ;
+
+GrB_Info GB_jitifyer_bundle_load (void) ;
+void GB_jitifyer_bundle_free (void) ;
+GrB_Info GB_jitifyer_pack (int ncompilers) ;
+GrB_Info GB_jitifyer_pack_worker (int ncompilers) ;
+GrB_Info GB_jitifyer_load_bundle (const char *library) ;
+GrB_Info GB_jitifyer_load_bundle_worker (const char *library) ;
+
 bool GB_jitifyer_get_use_cmake (void) ;
 void GB_jitifyer_set_use_cmake (bool use_cmake) ;
+bool GB_jitifyer_get_use_libtcc (void) ;
+GrB_Info GB_jitifyer_set_use_libtcc (bool use_libtcc) ;
+
+//------------------------------------------------------------------------------
+// JIT kernel profile
+//------------------------------------------------------------------------------
+
+bool GB_jitifyer_get_profile (void) ;
+void GB_jitifyer_set_profile (bool profile) ;
+const char *GB_jitifyer_get_profile_report (bool refresh) ;
+void GB_jitifyer_profile_report_worker (void) ;
+
+void GB_jitifyer_profile        // record the run time of a JIT kernel
+(
+    uint64_t hash,              // hash code for the kernel
+    GB_jit_encoding *encoding,  // encoding of the problem
+    const char *suffix,         // suffix for the kernel_name (NULL if none)
+    double t                    // time taken by one call to the kernel
+) ;
+
+void GB_jitifyer_generic        // count a generic kernel of a JIT family
+(
+    GB_jit_family family
+) ;
+
+// GB_JIT_CALL: call a JIT kernel and return its result in info.  If the JIT
+// profile is enabled, the call and its run time are recorded in the kernel's
+// entry in the hash table.  The kernel was marked as in use by
+// GB_jitifyer_load, so it cannot be unloaded by GxB_JIT_MAX_LOADED while it
+// runs; GB_jitifyer_release marks it as no longer in use.
+
+#define GB_JIT_CALL(info,hash,encoding,suffix,kernel_call)      \
+{                                                               \
+    if (GB_jitifyer_get_profile ( ))                            \
+    {                                                           \
+        double t_start = GB_omp_get_wtime ( ) ;                 \
+        info = kernel_call ;                                    \
+        GB_jitifyer_profile (hash, encoding, suffix,            \
+            GB_omp_get_wtime ( ) - t_start) ;                   \
+    }                                                           \
+    else                                                        \
+    {                                                           \
+        info = kernel_call ;                                    \
+    }                                                           \
+    GB_jitifyer_release ( ) ;                                   \
+}
+
+// GB_JIT_GENERIC: count a generic kernel, if the JIT profile is enabled
+#define GB_JIT_GENERIC(family)                                  \
+{                                                               \
+    if (GB_jitifyer_get_profile ( )) GB_jitifyer_generic (family) ; \
+}
+
+//------------------------------------------------------------------------------
+// limits on the # of loaded kernels and the size of the JIT cache
+//------------------------------------------------------------------------------
+
+int64_t GB_jitifyer_get_max_loaded (void) ;
+void GB_jitifyer_set_max_loaded (int64_t max_loaded) ;
+int64_t GB_jitifyer_get_cache_max_size (void) ;
+void GB_jitifyer_set_cache_max_size (int64_t max_size) ;
+void GB_jitifyer_release (void) ;       // a JIT kernel is no longer in use
+
+//------------------------------------------------------------------------------
+// JIT kernels specialized for small matrix dimensions
+//------------------------------------------------------------------------------
+
+#define GB_JIT_SPECIALIZE_DIM_MAX 256
+int32_t GB_jitifyer_get_specialize_dim (void) ;
+void GB_jitifyer_set_specialize_dim (int32_t dim) ;
 
 void GB_jitifyer_sanitize (char *string, size_t len) ;
 
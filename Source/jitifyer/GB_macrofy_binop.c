@@ -64,7 +64,24 @@ void GB_macrofy_binop
         //----------------------------------------------------------------------
 
         ASSERT (op != NULL) ;
-        GB_macrofy_defn (fp, 3, op->name, op->defn) ;
+        if (op->defn != NULL)
+        { 
+            GB_macrofy_defn (fp, 3, op->name, op->defn) ;
+        }
+        else
+        { 
+            // the function is compiled in op->jit_C_object, which is linked
+            // into the kernel (see GxB_JIT_C_OBJECT).  It is hidden in the
+            // kernel, so that it can be inlined with link-time optimization.
+            fprintf (fp,
+                "#ifndef GB_GUARD_%s_DEFINED\n"
+                "#define GB_GUARD_%s_DEFINED\n"
+                "#if defined ( __GNUC__ ) && !defined ( _WIN32 )\n"
+                "__attribute__ ((visibility (\"hidden\")))\n"
+                "#endif\n"
+                "void %s (void *z, const void *x, const void *y) ;\n"
+                "#endif\n", op->name, op->name, op->name) ;
+        }
 
         if (is_monoid_or_build)
         { 
@@ -301,6 +301,24 @@ void GB_macrofy_mxm         // construct all macros for GrB_mxm
         fprintf (fp, "#define GB_SEMIRING_HAS_AVX_IMPLEMENTATION 1\n") ;
     }
 
+    if ((addop->opcode == GB_PLUS_binop_code &&
+          mult->opcode == GB_TIMES_binop_code) ||
+        (addop->opcode == GB_MIN_binop_code &&
+          mult->opcode == GB_PLUS_binop_code))
+    {
+        if (zcode == GB_FP32_code || zcode == GB_FP64_code ||
+            zcode == GB_INT64_code)
+        {
+
+            //------------------------------------------------------------------
+            // PLUS_TIMES and MIN_PLUS semirings for FP32, FP64, and INT64
+            //------------------------------------------------------------------
+
+            // saxpy4 and dot4 are compiled for AVX512F and AVX2
+            fprintf (fp, "#define GB_SEMIRING_HAS_AVX_SAXPY4_DOT4 1\n") ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // special case multiply ops
     //--------------------------------------------------------------------------
@@ -20,6 +20,9 @@
 // parsing the kernel_name of a PreJIT kernel.
 //
 // The suffix is used only for user-defined types and operators.
+//
+// If the kernel is compiled for a fixed dimension (dim > 0), the dimension is
+// appended to the kname, as in namespace__kname_d16__012345 for dim = 16.
 
 #include "GB.h"
 #include "jitifyer/GB_stringify.h"
@@ -31,11 +34,20 @@ void GB_macrofy_name
     // input
     const char *name_space, // namespace for the kernel_name
     const char *kname,      // kname for the kernel_name
+    uint32_t dim,           // fixed dimension of the kernel (0 if none)
     int scode_digits,       // # of hexadecimal digits printed
     uint64_t scode,         // enumify'd code of the kernel
     const char *suffix      // suffix for the kernel_name (NULL if none)
 )
 {
+    char kname_dim [GB_KLEN] ;
+    if (dim > 0)
+    { 
+        // kernel is specialized for a fixed dimension
+        snprintf (kname_dim, GB_KLEN-1, "%s_d%u", kname, dim) ;
+        kname = kname_dim ;
+    }
+
     if (suffix == NULL)
     { 
         // kernel uses only built-in types and operators
@@ -47,6 +47,7 @@ void GB_macrofy_name
     // input
     const char *name_space, // namespace for the kernel_name
     const char *kname,      // kname for the kernel_name
+    uint32_t dim,           // fixed dimension of the kernel (0 if none)
     int scode_digits,       // # of hexadecimal digits printed
     uint64_t scode,         // enumify'd code of the kernel
     const char *suffix      // suffix for the kernel_name (NULL if none)
@@ -564,6 +565,21 @@ GrB_Info GB_AxB_dot2n_jit        // C<M>=A*B, dot2n method, via the JIT
     const int nbslice
 ) ;
 
+GrB_Info GB_AxB_dot2_fine_jit   // C=A'*B, dot2 fine tasks, via the JIT
+(
+    // output:
+    GB_void *restrict W,        // partial results, of size ntasks
+    int8_t *restrict Wb,        // Wb [tid] true if W [tid] exists
+    // input:
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    const int nfine,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_AxB_dot3_jit        // C<M>=A'B, dot3, via the JIT
 (
     // input/output:
@@ -579,6 +595,39 @@ GrB_Info GB_AxB_dot3_jit        // C<M>=A'B, dot3, via the JIT
     const int nthreads
 ) ;
 
+GrB_Info GB_AxB_dot3_reduce_jit // s = reduce (C<M>=A'B), via the JIT
+(
+    // output:
+    GB_void *restrict W,        // partial results, of size ntasks
+    int64_t *restrict Wcount,   // # of entries summed in each task
+    // input:
+    const GrB_Matrix M, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AxB_dot3_rowreduce_jit  // T = rowreduce (C<M>=A'B), via the JIT
+(
+    // output:
+    GrB_Matrix T,               // bitmap vector, T(j) = reduce (C(:,j))
+    GB_void *restrict W,        // partial results of fine tasks
+    int64_t *restrict Wcount,   // # of entries computed by each task
+    // input:
+    const GrB_Matrix M, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_AxB_dot4_jit            // C+=A'*B, dot4 method, via the JIT
 (
     // input/output:
@@ -0,0 +1,34 @@
+//------------------------------------------------------------------------------
+// GxB_JIT_pack: link all compiled kernels in the JIT cache into one library
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Each CPU kernel that has been compiled in the JIT cache is compiled again
+// and linked into a single bundle, with up to GxB_NTHREADS compiler processes
+// running at the same time (as determined by the Context of the calling
+// thread).  The bundle is loaded with a single dlopen the next time GraphBLAS
+// starts, or when the cache path is set.
+
+#include "GB.h"
+#include "jitifyer/GB_jitifyer.h"
+
+GrB_Info GxB_JIT_pack (void)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_JIT_pack ( )") ;
+
+    //--------------------------------------------------------------------------
+    // pack the kernels
+    //--------------------------------------------------------------------------
+
+    int ncompilers = GB_Context_nthreads_max ( ) ;
+    return (GB_jitifyer_pack (ncompilers)) ;
+}
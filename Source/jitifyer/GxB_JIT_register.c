@@ -0,0 +1,39 @@
+//------------------------------------------------------------------------------
+// GxB_JIT_register: register a bundle of JIT kernels from a library
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The library is a bundle of JIT kernels created by GxB_JIT_pack (the file
+// lib/libGB_jit_bundle.so in the JIT cache), which may have been copied to
+// any location, such as next to the application that uses it.  Its kernels
+// are registered in the same way as the PreJIT kernels, without rebuilding
+// GraphBLAS.  Each kernel is checked when first used; kernels from another
+// version of GraphBLAS, or whose user-defined types or operators differ from
+// those of the application, are ignored.
+
+#include "GB.h"
+#include "jitifyer/GB_jitifyer.h"
+
+GrB_Info GxB_JIT_register       // register a bundle of JIT kernels
+(
+    const char *library         // library created by GxB_JIT_pack
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_JIT_register (library)") ;
+    GB_RETURN_IF_NULL (library) ;
+
+    //--------------------------------------------------------------------------
+    // register the kernels in the library
+    //--------------------------------------------------------------------------
+
+    return (GB_jitifyer_load_bundle (library)) ;
+}
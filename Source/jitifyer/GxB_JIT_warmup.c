@@ -0,0 +1,39 @@
+//------------------------------------------------------------------------------
+// GxB_JIT_warmup: compile the kernels listed in a JIT manifest
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The manifest is written by a prior run of GraphBLAS, with GxB_JIT_MANIFEST
+// set to the name of the manifest file.  Each kernel in the manifest that is
+// not already compiled in the JIT cache is compiled, with up to GxB_NTHREADS
+// compiler processes running at the same time (as determined by the Context
+// of the calling thread).  The kernels are loaded later, when first used.
+
+#include "GB.h"
+#include "jitifyer/GB_jitifyer.h"
+
+GrB_Info GxB_JIT_warmup         // compile the kernels in a JIT manifest
+(
+    const char *manifest        // manifest file
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_JIT_warmup (manifest)") ;
+    GB_RETURN_IF_NULL (manifest) ;
+
+    //--------------------------------------------------------------------------
+    // compile the kernels
+    //--------------------------------------------------------------------------
+
+    int ncompilers = GB_Context_nthreads_max ( ) ;
+    return (GB_jitifyer_warmup (manifest, ncompilers)) ;
+}
+
@@ -28,6 +28,15 @@ void GB_bix_free                // free A->b, A->i, and A->x of a matrix
         return ;
     }
 
+    //--------------------------------------------------------------------------
+    // discard any background wait, since it reads the content of A
+    //--------------------------------------------------------------------------
+
+    if (A->Background != NULL)
+    { 
+        GB_wait_background_cancel (A) ;
+    }
+
     //--------------------------------------------------------------------------
     // free all but A->p and A->h
     //--------------------------------------------------------------------------
@@ -73,7 +82,8 @@ void GB_bix_free                // free A->b, A->i, and A->x of a matrix
     // an empty matrix is not jumbled
     A->jumbled = false ;
 
-    // free the list of pending tuples
+    // free the list of pending tuples, and those in any shards
     GB_Pending_free (&(A->Pending)) ;
+    GB_Pending_shards_free (A) ;
 }
 
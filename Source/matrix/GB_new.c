@@ -169,6 +169,15 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->Pending = NULL ;
     A->iso = false ;            // OK: if iso, burble in the caller
 
+    // concurrent setElement is disabled
+    A->nshards = 0 ;
+    A->shards_anchored = 0 ;
+    A->Shards = NULL ;
+    A->Shards_size = 0 ;
+
+    // no background wait is in progress
+    A->Background = NULL ;
+
     //--------------------------------------------------------------------------
     // Allocate A->p and A->h if requested
     //--------------------------------------------------------------------------
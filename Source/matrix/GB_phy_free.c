@@ -28,6 +28,15 @@ void GB_phy_free                // free A->p, A->h, and A->Y of a matrix
         return ;
     }
 
+    //--------------------------------------------------------------------------
+    // discard any background wait, since it reads the content of A
+    //--------------------------------------------------------------------------
+
+    if (A->Background != NULL)
+    { 
+        GB_wait_background_cancel (A) ;
+    }
+
     //--------------------------------------------------------------------------
     // free A->p, A->h, and A->Y
     //--------------------------------------------------------------------------
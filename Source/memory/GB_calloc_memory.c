@@ -27,14 +27,30 @@ static inline void *GB_calloc_helper
     // make sure the block is at least 8 bytes in size
     (*size) = GB_IMAX (*size, 8) ;
 
-    p = GB_Global_malloc_function (*size) ;
+    // get a block from the memory pool, or allocate a new one
+    p = GB_memory_pool_get (size) ;
+    if (p == NULL)
+    { 
+        p = GB_Global_malloc_function (*size) ;
+    }
 
     #ifdef GB_MEMDUMP
     printf ("hard calloc %p %ld\n", p, *size) ; // MEMDUMP
     GB_Global_memtable_dump ( ) ;
     #endif
 
-    if (p != NULL)
+    int64_t huge_pages = GB_Global_huge_pages_get ( ) ;
+    if (p == NULL)
+    { 
+        // out of memory
+    }
+    else if (huge_pages > 0 && (*size) >= (size_t) huge_pages)
+    { 
+        // use huge pages, and clear the block in parallel, with each thread
+        // clearing one contiguous part of it
+        GB_memory_place (p, NULL, *size, true) ;
+    }
+    else
     { 
         // clear the block of memory with a parallel memset
         int nthreads_max = GB_Context_nthreads_max ( ) ;
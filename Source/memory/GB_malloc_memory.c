@@ -27,7 +27,18 @@ static inline void *GB_malloc_helper
     // make sure the block is at least 8 bytes in size
     (*size) = GB_IMAX (*size, 8) ;
 
-    p = GB_Global_malloc_function (*size) ;
+    // get a block from the memory pool, or allocate a new one
+    p = GB_memory_pool_get (size) ;
+    if (p == NULL)
+    { 
+        p = GB_Global_malloc_function (*size) ;
+        int64_t huge_pages = GB_Global_huge_pages_get ( ) ;
+        if (huge_pages > 0 && (*size) >= (size_t) huge_pages)
+        { 
+            // use huge pages, and touch the new block in parallel
+            GB_memory_place (p, NULL, *size, false) ;
+        }
+    }
 
     #ifdef GB_MEMDUMP
     printf ("hard malloc %p %ld\n", p, *size) ; // MEMDUMP
@@ -59,6 +59,45 @@ void *GB_xalloc_memory      // return the newly-allocated space
     size_t *size            // resulting size
 ) ;
 
+//------------------------------------------------------------------------------
+// memory pool
+//------------------------------------------------------------------------------
+
+void *GB_memory_pool_get    // get a block from the pool, or NULL if none
+(
+    // input/output:
+    size_t *size            // on input: # of bytes requested (at least 8)
+                            // on output: # of bytes to allocate
+) ;
+
+bool GB_memory_pool_put     // put a block in the pool; false if not placed
+(
+    void *p,                // block to place in the pool
+    size_t size             // size of the block, in bytes
+) ;
+
+void GB_memory_pool_flush (void) ;      // free all blocks in the pool
+int64_t GB_memory_pool_get_max_size (void) ;
+void GB_memory_pool_set_max_size (int64_t max_size) ;
+int64_t GB_memory_pool_size (void) ;    // # of bytes held in the pool
+
+//------------------------------------------------------------------------------
+// huge pages and parallel first-touch for large blocks
+//------------------------------------------------------------------------------
+
+void GB_memory_place
+(
+    void *p,                // block to place
+    const void *src,        // if not NULL, copy src into p
+    size_t size,            // size of the block, in bytes
+    bool clear              // if true (and src is NULL), clear the block
+) ;
+
+GrB_Info GB_memory_place_matrix     // place the large arrays of a matrix
+(
+    GrB_Matrix A
+) ;
+
 //------------------------------------------------------------------------------
 // parallel memcpy and memset
 //------------------------------------------------------------------------------
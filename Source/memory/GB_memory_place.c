@@ -0,0 +1,183 @@
+//------------------------------------------------------------------------------
+// GB_memory_place: huge pages and parallel first-touch for large blocks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// On a NUMA system, each page of a new block of memory is placed on the NUMA
+// node of the thread that first touches it.  If a large A->i or A->x array is
+// initialized by a single thread, all of it lands on one node, and the
+// threads on all other nodes must access it remotely.  The kernels that
+// later use the array partition its entries evenly across their threads (via
+// GB_p_slice and GB_ek_slice), so the array is placed the same way here:
+// each thread first-touches an equal contiguous part of the block.  Large
+// blocks also ask the operating system for transparent huge pages, to
+// reduce TLB misses.
+
+// This is done for all blocks of at least GxB_HUGE_PAGES bytes allocated by
+// GB_malloc_memory and GB_calloc_memory (0 by default, which disables it),
+// and for the existing arrays of a matrix when GxB_HUGE_PAGES is set for that
+// matrix with GrB_set.
+
+#include "GB.h"
+#define GB_FREE_ALL ;
+#if defined ( __linux__ )
+#include <sys/mman.h>
+#endif
+
+#define GB_PAGE_SIZE 4096
+#define GB_HUGE_PAGE_SIZE (2*1024*1024)
+#define GB_MEM_CHUNK (1024*1024)
+
+//------------------------------------------------------------------------------
+// GB_memory_place: place a block of memory
+//------------------------------------------------------------------------------
+
+void GB_memory_place
+(
+    void *p,                // block to place
+    const void *src,        // if not NULL, copy src into p
+    size_t size,            // size of the block, in bytes
+    bool clear              // if true (and src is NULL), clear the block
+)
+{
+
+    if (p == NULL || size == 0)
+    {
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // ask for transparent huge pages
+    //--------------------------------------------------------------------------
+
+    #if defined ( __linux__ ) && defined ( MADV_HUGEPAGE )
+    if (size >= GB_HUGE_PAGE_SIZE)
+    {
+        // madvise requires a page-aligned start; the partial pages at either
+        // end of the block are left as-is
+        uintptr_t pstart = ((uintptr_t) p + GB_PAGE_SIZE - 1) &
+            ~((uintptr_t) GB_PAGE_SIZE - 1) ;
+        uintptr_t pend = ((uintptr_t) p + size) &
+            ~((uintptr_t) GB_PAGE_SIZE - 1) ;
+        if (pend > pstart)
+        {
+            // this is only a hint, so any error is ignored
+            (void) madvise ((void *) pstart, pend - pstart, MADV_HUGEPAGE) ;
+        }
+    }
+    #endif
+
+    //--------------------------------------------------------------------------
+    // first-touch the block in parallel, with one contiguous part per thread
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    size_t nchunks = 1 + (size / GB_MEM_CHUNK) ;
+    int nthreads = (int) GB_IMIN ((size_t) nthreads_max, nchunks) ;
+    nthreads = GB_IMAX (nthreads, 1) ;
+    int64_t npages = 1 + (size - 1) / GB_PAGE_SIZE ;
+    GB_void *pdest = (GB_void *) p ;
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        // this thread owns pages kfirst to klast-1 of the block
+        int64_t kfirst, klast ;
+        GB_PARTITION (kfirst, klast, npages, tid, nthreads) ;
+        size_t pfirst = kfirst * GB_PAGE_SIZE ;
+        size_t plast = GB_IMIN (klast * GB_PAGE_SIZE, size) ;
+        if (pfirst >= plast)
+        {
+            // nothing to do
+        }
+        else if (src != NULL)
+        {
+            // copy this part of the block
+            memcpy (pdest + pfirst, ((const GB_void *) src) + pfirst,
+                plast - pfirst) ;
+        }
+        else if (clear)
+        {
+            // clear this part of the block
+            memset (pdest + pfirst, 0, plast - pfirst) ;
+        }
+        else
+        {
+            // touch each page of this part of the block
+            for (size_t k = pfirst ; k < plast ; k += GB_PAGE_SIZE)
+            {
+                ((volatile GB_void *) pdest) [k] = 0 ;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_place_array: move a large array of a matrix to a placed block
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_memory_place_array
+(
+    void **p_handle,        // array to move
+    size_t *p_size_handle,  // size of the array
+    bool shallow            // true if the array is shallow
+)
+{
+
+    void *p = (*p_handle) ;
+    size_t size = (*p_size_handle) ;
+    if (p == NULL || shallow || size < GB_HUGE_PAGE_SIZE)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    size_t newsize = 0 ;
+    void *pnew = GB_malloc_memory (size, sizeof (GB_void), &newsize) ;
+    if (pnew == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    // place the new block as a copy of the old one.  If GB_malloc_memory has
+    // already placed it, the same threads touch the same pages again.
+    GB_memory_place (pnew, p, size, false) ;
+    GB_free_memory (p_handle, size) ;
+    (*p_handle) = pnew ;
+    (*p_size_handle) = newsize ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_place_matrix: place the large arrays of a matrix
+//------------------------------------------------------------------------------
+
+// Each non-shallow array of A of size 2MB or more is copied into a new block
+// that is placed by GB_memory_place, and the old array is freed.  This can be
+// used for a large matrix that was built or imported by a single thread.
+
+GrB_Info GB_memory_place_matrix
+(
+    GrB_Matrix A
+)
+{
+
+    GrB_Info info ;
+    ASSERT (A != NULL) ;
+    GB_OK (GB_memory_place_array ((void **) &(A->p), &(A->p_size),
+        A->p_shallow)) ;
+    GB_OK (GB_memory_place_array ((void **) &(A->h), &(A->h_size),
+        A->h_shallow)) ;
+    GB_OK (GB_memory_place_array ((void **) &(A->b), &(A->b_size),
+        A->b_shallow)) ;
+    GB_OK (GB_memory_place_array ((void **) &(A->i), &(A->i_size),
+        A->i_shallow)) ;
+    GB_OK (GB_memory_place_array ((void **) &(A->x), &(A->x_size),
+        A->x_shallow)) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,216 @@
+//------------------------------------------------------------------------------
+// GB_memory_pool: a pool of free memory blocks, by size class
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Iterative algorithms call GrB_mxm, GrB_eWiseAdd, GrB_wait, and so on, many
+// times with problems of about the same size, and each call allocates and
+// frees the same kinds of blocks (Cp, Ci, Cx, hash tables, task lists, and
+// other workspace).  If the pool is enabled (GxB_MEMORY_POOL_MAX_SIZE > 0),
+// GB_free_memory places each block of size 2^k into the pool instead of
+// freeing it, and GB_malloc_memory and GB_calloc_memory take a block from the
+// pool if one of the right size exists.  To allow this, all blocks no larger
+// than the pool size are allocated with a size rounded up to a power of 2.
+// This costs no extra memory for the pages of large blocks that are never
+// touched, and recycled blocks avoid the page faults of freshly allocated
+// memory.
+
+// The pool holds at most GB_pool_max_size bytes.  A block that would not fit
+// is freed as usual.  All blocks in the pool are freed by GrB_finalize, or by
+// setting GxB_MEMORY_POOL_MAX_SIZE to zero.
+
+// Each free block holds the pointer to the next block in its size class, in
+// its first 8 bytes.  The pool is shared by all user threads, and protected
+// by a critical section.  GraphBLAS allocates and frees its blocks outside of
+// its parallel regions, so the critical section is held only briefly, once per
+// block, by each user thread calling GraphBLAS.
+
+// Blocks in the pool are still allocated, as far as the malloc_function and
+// the memory usage tracking (GB_Global_memtable_*) are concerned.
+
+#include "GB.h"
+
+// size classes 2^3 (8 bytes, the smallest block) to 2^62
+#define GB_POOL_KMIN 3
+#define GB_POOL_KMAX 62
+
+static void   *GB_pool [GB_POOL_KMAX+1] ;   // list of free blocks of size 2^k
+static int64_t GB_pool_size = 0 ;           // total # of bytes in the pool
+static int64_t GB_pool_max_size = 0 ;       // max # of bytes; 0 if disabled
+
+#define GB_POOL_NEXT(p) (*((void **) (p)))
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_trim: free blocks until the pool fits in max_size
+//------------------------------------------------------------------------------
+
+// The largest blocks are freed first.  Must be called in the critical section.
+
+static void GB_memory_pool_trim (int64_t max_size)
+{
+    for (int k = GB_POOL_KMAX ; k >= GB_POOL_KMIN ; k--)
+    {
+        while (GB_pool_size > max_size && GB_pool [k] != NULL)
+        {
+            void *p = GB_pool [k] ;
+            GB_pool [k] = GB_POOL_NEXT (p) ;
+            GB_pool_size -= ((int64_t) 1) << k ;
+            #ifdef GB_MEMDUMP
+            printf ("pool flush %p %ld\n", p, ((int64_t) 1) << k) ; // MEMDUMP
+            #endif
+            GB_Global_free_function (p) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_get: get a block from the pool
+//------------------------------------------------------------------------------
+
+// If the pool is enabled and the block fits in the pool, (*size) is rounded up
+// to a power of 2, and a block of that size is returned if the pool has one.
+// Otherwise, NULL is returned and the caller must allocate a new block of the
+// (possibly rounded) size.
+
+void *GB_memory_pool_get
+(
+    // input/output:
+    size_t *size            // on input: # of bytes requested (at least 8)
+                            // on output: # of bytes to allocate
+)
+{
+
+    int64_t max_size ;
+    GB_ATOMIC_READ
+    max_size = GB_pool_max_size ;
+    if ((*size) > (size_t) max_size)
+    {
+        // the pool is disabled, or the block is too large for the pool
+        return (NULL) ;
+    }
+
+    int k = (int) GB_CEIL_LOG2 (*size) ;
+    k = GB_IMAX (k, GB_POOL_KMIN) ;
+    (*size) = ((size_t) 1) << k ;
+
+    void *p = NULL ;
+    #pragma omp critical (GB_memory_pool)
+    {
+        p = GB_pool [k] ;
+        if (p != NULL)
+        {
+            GB_pool [k] = GB_POOL_NEXT (p) ;
+            GB_pool_size -= (*size) ;
+        }
+    }
+
+    #ifdef GB_MEMDUMP
+    if (p != NULL) printf ("pool get %p %ld\n", p, *size) ; // MEMDUMP
+    #endif
+    return (p) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_put: put a block in the pool
+//------------------------------------------------------------------------------
+
+// Returns true if the block was placed in the pool, or false if the pool is
+// disabled, the size is not a power of 2, or the pool is full.  In that case,
+// the caller must free the block.
+
+bool GB_memory_pool_put
+(
+    void *p,                // block to place in the pool
+    size_t size             // size of the block, in bytes
+)
+{
+
+    int64_t max_size ;
+    GB_ATOMIC_READ
+    max_size = GB_pool_max_size ;
+    if (p == NULL || size < (((size_t) 1) << GB_POOL_KMIN) ||
+        size > (size_t) max_size || !GB_IS_POWER_OF_TWO (size))
+    {
+        return (false) ;
+    }
+
+    int k = (int) GB_FLOOR_LOG2 (size) ;
+    bool ok = false ;
+    #pragma omp critical (GB_memory_pool)
+    {
+        if (GB_pool_size + (int64_t) size <= GB_pool_max_size)
+        {
+            GB_POOL_NEXT (p) = GB_pool [k] ;
+            GB_pool [k] = p ;
+            GB_pool_size += size ;
+            ok = true ;
+        }
+    }
+
+    #ifdef GB_MEMDUMP
+    if (ok) printf ("pool put %p %ld\n", p, size) ; // MEMDUMP
+    #endif
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_flush: free all blocks in the pool
+//------------------------------------------------------------------------------
+
+void GB_memory_pool_flush (void)
+{
+    #pragma omp critical (GB_memory_pool)
+    {
+        GB_memory_pool_trim (0) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_get_max_size: get the max # of bytes in the pool
+//------------------------------------------------------------------------------
+
+int64_t GB_memory_pool_get_max_size (void)
+{
+    int64_t max_size ;
+    GB_ATOMIC_READ
+    max_size = GB_pool_max_size ;
+    return (max_size) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_set_max_size: set the max # of bytes in the pool
+//------------------------------------------------------------------------------
+
+// If the pool holds more than the new max_size, blocks are freed until it
+// fits.  Zero (or a negative value) disables the pool and frees all its
+// blocks.
+
+void GB_memory_pool_set_max_size (int64_t max_size)
+{
+    max_size = GB_IMAX (max_size, 0) ;
+    #pragma omp critical (GB_memory_pool)
+    {
+        GB_ATOMIC_WRITE
+        GB_pool_max_size = max_size ;
+        GB_memory_pool_trim (max_size) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_size: get the # of bytes held in the pool
+//------------------------------------------------------------------------------
+
+int64_t GB_memory_pool_size (void)
+{
+    int64_t size ;
+    #pragma omp critical (GB_memory_pool)
+    {
+        size = GB_pool_size ;
+    }
+    return (size) ;
+}
+
@@ -0,0 +1,453 @@
+//------------------------------------------------------------------------------
+// GB_AxB_autotune: select the C=A*B method from measured run times
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// By default, GB_AxB_meta selects the saxpy or dot product method, and
+// GB_AxB_saxpy3 selects the Hash or Gustavson method for each task, with
+// heuristics based on the sparsity and flop counts of the problem.  If
+// autotuning is enabled (with GrB_set (GrB_GLOBAL, true, GxB_AUTOTUNE)), the
+// run time of each method is recorded in a table, for each kind of problem.
+// Problems of the same kind have the same semiring, the same sparsity formats
+// of M, A, and B, and about the same dimensions and number of entries (to
+// within a factor of 4).  Each method that can be used for a kind of problem
+// is tried a few times, starting with the method selected by the heuristics.
+// After that, the method with the smallest mean run time is used.
+
+// The first trial of each method is not timed, since it may include the time
+// to compile and load a JIT kernel.  The table is loaded from the JIT cache
+// folder when first needed, and saved there when autotuning is disabled or
+// when GrB_finalize is called, so it persists across runs of the application.
+// The table is merged with the file when it is saved, so that several
+// applications can share it.
+
+// Autotuning is not done if the method is selected by the descriptor, if C
+// can be computed in-place, if a GxB_MxmPlan is used, or if the semiring has
+// user-defined operators or types that cannot be JIT'd.  It is also not done
+// if OpenMP is not available, since the run times cannot be measured.
+
+#include "mxm/GB_mxm.h"
+#include "mxm/GB_AxB_autotune.h"
+#include "jitifyer/GB_jitifyer.h"
+#include "jitifyer/GB_file.h"
+
+// # of trials of each method, including the first trial, which is not timed
+#define GB_AUTOTUNE_TRIALS 3
+
+// size of the table (a power of 2)
+#define GB_AUTOTUNE_SIZE 1024
+
+// files holding the table and its lock, in the JIT cache folder
+#define GB_AUTOTUNE_FILE "GB_autotune.txt"
+#define GB_AUTOTUNE_LOCK "lock/00/autotune_lock"
+
+typedef struct
+{
+    uint64_t key ;                          // key of the problem, 0 if empty
+    int64_t count [GB_AUTOTUNE_NARMS] ;     // # of trials of each arm
+    double time [GB_AUTOTUNE_NARMS] ;       // total time of timed trials
+}
+GB_autotune_entry ;
+
+static GB_autotune_entry GB_autotune_table [GB_AUTOTUNE_SIZE] ;
+static bool GB_autotune = false ;
+static bool GB_autotune_loaded = false ;
+
+//------------------------------------------------------------------------------
+// GB_autotune_lookup: find or insert an entry in the table
+//------------------------------------------------------------------------------
+
+// Returns NULL if the key is not in the table and the table is full.  The
+// caller must be in the GB_autotune critical section.
+
+static GB_autotune_entry *GB_autotune_lookup (uint64_t key)
+{
+    for (int k = 0 ; k < GB_AUTOTUNE_SIZE ; k++)
+    {
+        GB_autotune_entry *e =
+            &(GB_autotune_table [(key + k) & (GB_AUTOTUNE_SIZE-1)]) ;
+        if (e->key == key)
+        {
+            // found the entry
+            return (e) ;
+        }
+        if (e->key == 0)
+        {
+            // insert a new entry
+            memset (e, 0, sizeof (GB_autotune_entry)) ;
+            e->key = key ;
+            return (e) ;
+        }
+    }
+    // the table is full
+    return (NULL) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_autotune_filename: allocate the name of a file in the JIT cache folder
+//------------------------------------------------------------------------------
+
+static char *GB_autotune_filename (const char *name, size_t *name_size)
+{
+    const char *cache_path = GB_jitifyer_get_cache_path ( ) ;
+    if (cache_path == NULL || cache_path [0] == '\0') return (NULL) ;
+    size_t len = strlen (cache_path) + strlen (name) + 2 ;
+    char *filename = GB_MALLOC (len, char, name_size) ;
+    if (filename != NULL)
+    {
+        snprintf (filename, len, "%s/%s", cache_path, name) ;
+    }
+    return (filename) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_autotune_merge: merge the table in the file into the table in memory
+//------------------------------------------------------------------------------
+
+// Each line of the file holds the key of a problem, an arm, the # of trials,
+// and the total time of the timed trials.  If an arm of a problem appears
+// in both tables, the one with the most trials is kept.  The caller must hold
+// the lock on the table file.
+
+static void GB_autotune_merge (const char *filename)
+{
+    FILE *fp = fopen (filename, "r") ;
+    if (fp == NULL) return ;
+    uint64_t key ;
+    int arm ;
+    int64_t count ;
+    double t ;
+    while (fscanf (fp, "%" SCNx64 " %d %" SCNd64 " %lg",
+        &key, &arm, &count, &t) == 4)
+    {
+        if (key == 0 || arm < 0 || arm >= GB_AUTOTUNE_NARMS) continue ;
+        GB_autotune_entry *e = GB_autotune_lookup (key) ;
+        if (e != NULL && count > e->count [arm])
+        {
+            e->count [arm] = count ;
+            e->time [arm] = t ;
+        }
+    }
+    fclose (fp) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_autotune_load_or_save: load or save the table in the JIT cache folder
+//------------------------------------------------------------------------------
+
+// The table file is locked via lock/00/autotune_lock, in the same way that
+// the JIT locks its kernels.  When the table is saved, it is first merged with
+// the table in the file, so that several applications can share it.
+
+static void GB_autotune_load_or_save (bool save)
+{
+    size_t name_size = 0, lock_size = 0 ;
+    char *filename = GB_autotune_filename (GB_AUTOTUNE_FILE, &name_size) ;
+    char *lockname = GB_autotune_filename (GB_AUTOTUNE_LOCK, &lock_size) ;
+    FILE *fp_lock = NULL ;
+    int fd_lock = -1 ;
+    if (filename != NULL && lockname != NULL &&
+        GB_file_open_and_lock (lockname, &fp_lock, &fd_lock))
+    {
+        GB_autotune_merge (filename) ;
+        if (save)
+        {
+            FILE *fp = fopen (filename, "w") ;
+            if (fp != NULL)
+            {
+                for (int k = 0 ; k < GB_AUTOTUNE_SIZE ; k++)
+                {
+                    GB_autotune_entry *e = &(GB_autotune_table [k]) ;
+                    if (e->key == 0) continue ;
+                    for (int arm = 0 ; arm < GB_AUTOTUNE_NARMS ; arm++)
+                    {
+                        if (e->count [arm] == 0) continue ;
+                        fprintf (fp, "%016" PRIx64 " %d %" PRId64 " %.6e\n",
+                            e->key, arm, e->count [arm], e->time [arm]) ;
+                    }
+                }
+                fclose (fp) ;
+            }
+        }
+        GB_file_unlock_and_close (&fp_lock, &fd_lock) ;
+    }
+    GB_FREE (&filename, name_size) ;
+    GB_FREE (&lockname, lock_size) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_autotune_set: enable or disable autotuning
+//------------------------------------------------------------------------------
+
+void GB_AxB_autotune_set (bool autotune)
+{
+    #pragma omp critical (GB_autotune)
+    {
+        if (GB_autotune && !autotune && GB_autotune_loaded)
+        {
+            // autotuning is being disabled: save what has been learned
+            GB_autotune_load_or_save (true) ;
+        }
+        GB_autotune = autotune ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_autotune_get: return true if autotuning is enabled
+//------------------------------------------------------------------------------
+
+bool GB_AxB_autotune_get (void)
+{
+    bool autotune ;
+    #pragma omp critical (GB_autotune)
+    {
+        autotune = GB_autotune ;
+    }
+    return (autotune) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_autotune_finalize: save the table when GraphBLAS is finalized
+//------------------------------------------------------------------------------
+
+void GB_AxB_autotune_finalize (void)
+{
+    #pragma omp critical (GB_autotune)
+    {
+        if (GB_autotune && GB_autotune_loaded)
+        {
+            GB_autotune_load_or_save (true) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_autotune_bucket: log4 of an integer, to bucket the size of a problem
+//------------------------------------------------------------------------------
+
+static inline int GB_autotune_bucket (uint64_t x)
+{
+    int b = 0 ;
+    while (x > 0)
+    {
+        x >>= 2 ;
+        b++ ;
+    }
+    return (b) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_autotune_select: select the method for C=A*B or C=A'*B
+//------------------------------------------------------------------------------
+
+int GB_AxB_autotune_select  // return the arm to use, or -1 if not autotuned
+(
+    // input/output:
+    int *axb_method,                // GB_USE_DOT or GB_USE_SAXPY
+    GrB_Desc_Value *AxB_method,     // GxB_DEFAULT, Hash, or Gustavson
+    // output:
+    uint64_t *key,                  // key of the problem, for _record
+    // input:
+    const GrB_Matrix M,
+    const bool Mask_comp,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const bool atrans,              // if true, C=A'*B is computed
+    const GrB_Matrix B,
+    const bool btrans,              // if true, C=A*B' is computed
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    const bool can_do_in_place,
+    const GxB_MxmPlan plan
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check if this problem can be autotuned
+    //--------------------------------------------------------------------------
+
+    #ifndef _OPENMP
+    {
+        // the run time cannot be measured
+        return (-1) ;
+    }
+    #endif
+
+    if (!GB_AxB_autotune_get ( )
+        || (*AxB_method) != GxB_DEFAULT
+        || !((*axb_method) == GB_USE_DOT || (*axb_method) == GB_USE_SAXPY)
+        || can_do_in_place || plan != NULL
+        || semiring->hash == UINT64_MAX)
+    {
+        return (-1) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine which arms can be used
+    //--------------------------------------------------------------------------
+
+    // The dot product can be very slow if C=A'*B has no mask, since all of
+    // C is computed, so it is only tried if the heuristics selected it or if
+    // the mask is present and not complemented (for dot3).
+    bool dot_ok = ((*axb_method) == GB_USE_DOT) || (M != NULL && !Mask_comp) ;
+
+    // Hash and Gustavson only differ if saxpy would use GB_AxB_saxpy3.  If
+    // C=A'*B or C=A*B', the sparsity of A' or B' is taken as the sparsity of
+    // A or B.
+    int C_sparsity, saxpy_method ;
+    GB_AxB_saxpy_sparsity (&C_sparsity, &saxpy_method, M, Mask_comp, A, B) ;
+    bool saxpy3_ok = (saxpy_method == GB_SAXPY_METHOD_3) ;
+
+    bool ok [GB_AUTOTUNE_NARMS] ;
+    ok [GB_AUTOTUNE_DOT      ] = dot_ok ;
+    ok [GB_AUTOTUNE_SAXPY    ] = true ;
+    ok [GB_AUTOTUNE_HASH     ] = saxpy3_ok ;
+    ok [GB_AUTOTUNE_GUSTAVSON] = saxpy3_ok ;
+    int heuristic = ((*axb_method) == GB_USE_DOT) ?
+        GB_AUTOTUNE_DOT : GB_AUTOTUNE_SAXPY ;
+
+    //--------------------------------------------------------------------------
+    // construct the key of the problem
+    //--------------------------------------------------------------------------
+
+    struct
+    {
+        uint64_t semiring_hash ;
+        int32_t add_opcode, mult_opcode, xcode, ycode, zcode ;
+        int32_t M_sparsity, A_sparsity, B_sparsity ;
+        int32_t cvlen_bucket, cvdim_bucket, anz_bucket, bnz_bucket ;
+        int32_t nthreads_max ;
+        bool flipxy, atrans, btrans, Mask_comp, Mask_struct ;
+    }
+    problem ;
+    memset (&problem, 0, sizeof (problem)) ;
+    GrB_BinaryOp mult = semiring->multiply ;
+    problem.semiring_hash = semiring->hash ;
+    problem.add_opcode  = semiring->add->op->opcode ;
+    problem.mult_opcode = mult->opcode ;
+    problem.xcode = mult->xtype->code ;
+    problem.ycode = mult->ytype->code ;
+    problem.zcode = mult->ztype->code ;
+    problem.M_sparsity = (M == NULL) ? 0 : GB_sparsity (M) ;
+    problem.A_sparsity = GB_sparsity (A) ;
+    problem.B_sparsity = GB_sparsity (B) ;
+    problem.cvlen_bucket = GB_autotune_bucket (atrans ? A->vdim : A->vlen) ;
+    problem.cvdim_bucket = GB_autotune_bucket (btrans ? B->vlen : B->vdim) ;
+    problem.anz_bucket = GB_autotune_bucket (GB_nnz (A)) ;
+    problem.bnz_bucket = GB_autotune_bucket (GB_nnz (B)) ;
+    problem.nthreads_max = GB_Context_nthreads_max ( ) ;
+    problem.flipxy = flipxy ;
+    problem.atrans = atrans ;
+    problem.btrans = btrans ;
+    problem.Mask_comp = (M != NULL) && Mask_comp ;
+    problem.Mask_struct = (M != NULL) && Mask_struct ;
+    (*key) = GB_jitifyer_hash (&problem, sizeof (problem), true) ;
+    if ((*key) == 0) (*key) = 1 ;   // 0 denotes an empty entry in the table
+
+    //--------------------------------------------------------------------------
+    // select the arm
+    //--------------------------------------------------------------------------
+
+    int arm = heuristic ;
+    #pragma omp critical (GB_autotune)
+    {
+        if (!GB_autotune_loaded)
+        {
+            GB_autotune_load_or_save (false) ;
+            GB_autotune_loaded = true ;
+        }
+        GB_autotune_entry *e = GB_autotune_lookup (*key) ;
+        if (e == NULL)
+        {
+            // the table is full; use the heuristics
+            arm = -1 ;
+        }
+        else if (e->count [heuristic] < GB_AUTOTUNE_TRIALS)
+        {
+            // try the method selected by the heuristics first
+            arm = heuristic ;
+        }
+        else
+        {
+            // try any other method not yet tried enough; if all have been
+            // tried, use the method with the smallest mean run time
+            double tbest = INFINITY ;
+            for (int k = 0 ; k < GB_AUTOTUNE_NARMS ; k++)
+            {
+                if (!ok [k]) continue ;
+                if (e->count [k] < GB_AUTOTUNE_TRIALS)
+                {
+                    arm = k ;
+                    break ;
+                }
+                double tmean = e->time [k] / (double) (e->count [k] - 1) ;
+                if (tmean < tbest)
+                {
+                    tbest = tmean ;
+                    arm = k ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return the method to use
+    //--------------------------------------------------------------------------
+
+    switch (arm)
+    {
+        case GB_AUTOTUNE_DOT :
+            (*axb_method) = GB_USE_DOT ;
+            GBURBLE ("(autotune: dot) ") ;
+            break ;
+        case GB_AUTOTUNE_SAXPY :
+            (*axb_method) = GB_USE_SAXPY ;
+            GBURBLE ("(autotune: saxpy) ") ;
+            break ;
+        case GB_AUTOTUNE_HASH :
+            (*axb_method) = GB_USE_SAXPY ;
+            (*AxB_method) = GxB_AxB_HASH ;
+            GBURBLE ("(autotune: hash) ") ;
+            break ;
+        case GB_AUTOTUNE_GUSTAVSON :
+            (*axb_method) = GB_USE_SAXPY ;
+            (*AxB_method) = GxB_AxB_GUSTAVSON ;
+            GBURBLE ("(autotune: gustavson) ") ;
+            break ;
+        default :
+            break ;
+    }
+    return (arm) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_autotune_record: record the run time of an arm
+//------------------------------------------------------------------------------
+
+void GB_AxB_autotune_record
+(
+    const uint64_t key,
+    const int arm,
+    const double t
+)
+{
+    if (arm < 0 || arm >= GB_AUTOTUNE_NARMS) return ;
+    #pragma omp critical (GB_autotune)
+    {
+        GB_autotune_entry *e = GB_autotune_lookup (key) ;
+        if (e != NULL)
+        {
+            if (e->count [arm] > 0)
+            {
+                // the first trial is not timed
+                e->time [arm] += t ;
+            }
+            e->count [arm]++ ;
+        }
+    }
+}
+
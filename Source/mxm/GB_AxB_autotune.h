@@ -0,0 +1,54 @@
+//------------------------------------------------------------------------------
+// GB_AxB_autotune.h: definitions for autotuning the selection of C=A*B methods
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_AXB_AUTOTUNE_H
+#define GB_AXB_AUTOTUNE_H
+
+// methods ("arms") that the autotuner selects between
+#define GB_AUTOTUNE_DOT         0   // dot product: dot2, dot3, or dot4
+#define GB_AUTOTUNE_SAXPY       1   // saxpy, Hash or Gustavson for each task
+#define GB_AUTOTUNE_HASH        2   // saxpy, Hash method for all tasks
+#define GB_AUTOTUNE_GUSTAVSON   3   // saxpy, Gustavson method for all tasks
+#define GB_AUTOTUNE_NARMS       4
+
+void GB_AxB_autotune_set (bool autotune) ;
+bool GB_AxB_autotune_get (void) ;
+
+int GB_AxB_autotune_select  // return the arm to use, or -1 if not autotuned
+(
+    // input/output:
+    int *axb_method,                // GB_USE_DOT or GB_USE_SAXPY
+    GrB_Desc_Value *AxB_method,     // GxB_DEFAULT, Hash, or Gustavson
+    // output:
+    uint64_t *key,                  // key of the problem, for _record
+    // input:
+    const GrB_Matrix M,
+    const bool Mask_comp,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const bool atrans,              // if true, C=A'*B is computed
+    const GrB_Matrix B,
+    const bool btrans,              // if true, C=A*B' is computed
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    const bool can_do_in_place,
+    const GxB_MxmPlan plan
+) ;
+
+void GB_AxB_autotune_record // record the run time of an arm
+(
+    const uint64_t key,
+    const int arm,
+    const double t
+) ;
+
+void GB_AxB_autotune_finalize (void) ;   // save the table in the JIT cache
+
+#endif
+
@@ -0,0 +1,426 @@
+//------------------------------------------------------------------------------
+// GB_AxB_bitpack: boolean C=A*B or C=A'*B with bit-packed workspace
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_AxB_bitpack computes C=A*B (for GB_AxB_saxpy) or C=A'*B (for
+// GB_AxB_dot) where C is bitmap, A is sparse or hypersparse, B is bitmap or
+// full, and no mask is present.  The monoid must be ANY_BOOL or LOR_BOOL,
+// and the multiply operator must be PAIR (with any types for A and B) or
+// LAND_BOOL (with A and B both boolean).  This is the typical multi-source
+// BFS, where each of the B->vdim columns of B is the frontier of one source.
+
+// Each row B(k,:) is packed into nwords = ceil (B->vdim/64) words, one bit
+// per entry, and each row C(i,:) is computed in a packed workspace the same
+// way, using word-wide OR operations.  For C=A*B, with A held by column:
+
+//      for each entry A(i,k):  Cpack (i,:) |= Bpack (k,:)
+
+// For C=A'*B, each row C(i,:) is computed by a single task:
+
+//      Cpack (i,:) = OR of Bpack (k,:) for all entries A(k,i)
+
+// The work is nnz(A)*nwords for either method, instead of one operation for
+// each pair of entries A(i,k) and B(k,j) as done by GB_AxB_saxbit and
+// GB_AxB_dot2.  The packed result is then unpacked into the int8_t bitmap of
+// C, and C->nvals is found with a popcount of each word.  For the LAND
+// multiplier, a second bit-packed array holds the values of B and C.
+
+// The method is not used (and GrB_NO_VALUE is returned) if the above
+// conditions do not hold, or if B has fewer than GB_BITPACK_MIN_NCOLS columns,
+// or if B has fewer than one entry per word of Bpack (in which case the bitmap
+// saxpy and dot2 methods do less work).  It is also not used for C=A'*B if A
+// is hypersparse, since C would then have A->vdim rows, most of them empty.
+// GB_AxB_dot2 handles that case by computing just the A->nvec rows of C for
+// the vectors present in A, and then expanding C to hypersparse.
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_FREE_WORK (&Bpack, Bpack_size) ;     \
+    GB_FREE_WORK (&Bvals, Bvals_size) ;     \
+    GB_FREE_WORK (&Cpack, Cpack_size) ;     \
+    GB_FREE_WORK (&Cvals, Cvals_size) ;     \
+    GB_WERK_POP (A_slice, int64_t) ;        \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_phybix_free (C) ;                    \
+}
+
+#include "mxm/GB_mxm.h"
+#include "binaryop/GB_binop.h"
+
+// B must have at least this many columns to use the bit-packed method
+#define GB_BITPACK_MIN_NCOLS 64
+
+// # of bits set in a 64-bit word
+#if GB_COMPILER_MSC
+static inline int64_t GB_popcount64 (uint64_t x)
+{
+    x = x - ((x >> 1) & 0x5555555555555555ULL) ;
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL) ;
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL ;
+    return ((int64_t) ((x * 0x0101010101010101ULL) >> 56)) ;
+}
+#else
+#define GB_popcount64(x) ((int64_t) __builtin_popcountll (x))
+#endif
+
+GrB_Info GB_AxB_bitpack             // C=A*B or C=A'*B, bit-packed boolean
+(
+    GrB_Matrix C,                   // output matrix, static header
+    const bool C_iso,               // true if C is iso
+    const GB_void *cscalar,         // iso value of C
+    const GrB_Matrix M,             // mask matrix; method not used if present
+    const bool A_transposed,        // if true, C=A'*B, else C=A*B
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL && (C->static_header || GBNSTATIC)) ;
+    ASSERT_MATRIX_OK (A, "A for bitpack A*B", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for bitpack A*B", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for bitpack A*B", GB0) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (GB_JUMBLED_OK (A)) ;
+    ASSERT (!GB_PENDING (B)) ;
+    ASSERT (!GB_ZOMBIES (B)) ;
+    ASSERT (GB_JUMBLED_OK (B)) ;
+    ASSERT (A_transposed ? (A->vlen == B->vlen) : (A->vdim == B->vlen)) ;
+
+    //--------------------------------------------------------------------------
+    // determine if the bit-packed method can be used
+    //--------------------------------------------------------------------------
+
+    if (M != NULL
+        || !(GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A))
+        || (A_transposed && GB_IS_HYPERSPARSE (A))
+        || !(GB_IS_BITMAP (B) || GB_IS_FULL (B))
+        || B->vdim < GB_BITPACK_MIN_NCOLS
+        || semiring->add->op->ztype != GrB_BOOL)
+    {
+        return (GrB_NO_VALUE) ;
+    }
+
+    GB_Opcode add_opcode  = GB_boolean_rename (semiring->add->op->opcode) ;
+    GB_Opcode mult_opcode = GB_boolean_rename (semiring->multiply->opcode) ;
+    bool mult_is_land = false ;
+    if (mult_opcode == GB_LAND_binop_code
+        && semiring->multiply->xtype == GrB_BOOL
+        && A->type == GrB_BOOL && B->type == GrB_BOOL)
+    {
+        // z = x && y where x, y, and z are all boolean
+        mult_is_land = true ;
+    }
+    else if (mult_opcode != GB_PAIR_binop_code)
+    {
+        return (GrB_NO_VALUE) ;
+    }
+    if (!(add_opcode == GB_ANY_binop_code || add_opcode == GB_LOR_binop_code))
+    {
+        return (GrB_NO_VALUE) ;
+    }
+
+    int64_t cvlen = A_transposed ? A->vdim : A->vlen ;
+    int64_t cvdim = B->vdim ;
+    int64_t bvlen = B->vlen ;
+    int64_t nwords = GB_ICEIL (cvdim, 64) ;
+    int64_t bnz = GB_nnz_held (B) ;
+    if (GB_IS_BITMAP (B))
+    {
+        bnz = B->nvals ;
+    }
+    if (((double) bnz) < ((double) bvlen) * ((double) nwords))
+    {
+        // B has too few entries; the bitmap saxpy or dot2 method does less
+        // work than the bit-packed method
+        return (GrB_NO_VALUE) ;
+    }
+
+    int64_t cnz ;
+    if (!GB_int64_multiply ((GrB_Index *) (&cnz), cvlen, cvdim))
+    {
+        // C is too large; let the caller handle it
+        return (GrB_NO_VALUE) ;
+    }
+
+    GBURBLE ("(bitpack %s) ", A_transposed ? "dot" : "saxpy") ;
+
+    // the LAND multiplier needs the values of B and C, unless C is iso
+    bool need_values = mult_is_land && !C_iso ;
+
+    //--------------------------------------------------------------------------
+    // get A and B
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const bool    *restrict Ax = (bool *) A->x ;
+    const bool A_iso = A->iso ;
+    const int64_t anvec = A->nvec ;
+    const int64_t anz = GB_nnz (A) ;
+
+    const int8_t  *restrict Bb = B->b ;
+    const bool    *restrict Bx = (bool *) B->x ;
+    const bool B_iso = B->iso ;
+
+    //--------------------------------------------------------------------------
+    // declare workspace and determine the # of threads to use
+    //--------------------------------------------------------------------------
+
+    uint64_t *restrict Bpack = NULL ; size_t Bpack_size = 0 ;
+    uint64_t *restrict Bvals = NULL ; size_t Bvals_size = 0 ;
+    uint64_t *restrict Cpack = NULL ; size_t Cpack_size = 0 ;
+    uint64_t *restrict Cvals = NULL ; size_t Cvals_size = 0 ;
+    GB_WERK_DECLARE (A_slice, int64_t) ;
+
+    double work = ((double) anz) * ((double) nwords) + ((double) bvlen) *
+        ((double) cvdim) + ((double) cnz) ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (work, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+    int bntasks = (int) GB_IMIN (ntasks, bvlen) ;
+    int cntasks = (int) GB_IMIN (ntasks, cvlen) ;
+    int antasks = (int) GB_IMIN (ntasks, anvec) ;
+    bntasks = GB_IMAX (bntasks, 1) ;
+    cntasks = GB_IMAX (cntasks, 1) ;
+    antasks = GB_IMAX (antasks, 1) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace and slice A
+    //--------------------------------------------------------------------------
+
+    Bpack = GB_CALLOC_WORK (bvlen * nwords, uint64_t, &Bpack_size) ;
+    Cpack = GB_CALLOC_WORK (cvlen * nwords, uint64_t, &Cpack_size) ;
+    if (need_values)
+    {
+        Bvals = GB_CALLOC_WORK (bvlen * nwords, uint64_t, &Bvals_size) ;
+        Cvals = GB_CALLOC_WORK (cvlen * nwords, uint64_t, &Cvals_size) ;
+    }
+    GB_WERK_PUSH (A_slice, antasks + 1, int64_t) ;
+    if (Bpack == NULL || Cpack == NULL || A_slice == NULL
+        || (need_values && (Bvals == NULL || Cvals == NULL)))
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    GB_p_slice (A_slice, Ap, anvec, antasks, true) ;
+
+    //--------------------------------------------------------------------------
+    // pack B by rows: Bpack (k,:) holds the pattern of B(k,:)
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid < bntasks ; tid++)
+    {
+        int64_t kfirst, klast ;
+        GB_PARTITION (kfirst, klast, bvlen, tid, bntasks) ;
+        for (int64_t j = 0 ; j < cvdim ; j++)
+        {
+            const int64_t w = j / 64 ;
+            const int s = (int) (j % 64) ;
+            const int64_t pB_start = j * bvlen ;
+            for (int64_t k = kfirst ; k < klast ; k++)
+            {
+                const int64_t pB = pB_start + k ;
+                const uint64_t bkj = (Bb == NULL) ? 1 : (uint64_t) Bb [pB] ;
+                Bpack [k * nwords + w] |= (bkj << s) ;
+                if (need_values)
+                {
+                    const uint64_t x = (uint64_t) Bx [B_iso ? 0 : pB] ;
+                    Bvals [k * nwords + w] |= ((bkj & x) << s) ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // compute Cpack
+    //--------------------------------------------------------------------------
+
+    if (A_transposed)
+    {
+
+        //----------------------------------------------------------------------
+        // C=A'*B: Cpack (i,:) = OR (Bpack (A(:,i),:)), no atomics needed
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (tid = 0 ; tid < antasks ; tid++)
+        {
+            for (int64_t kA = A_slice [tid] ; kA < A_slice [tid+1] ; kA++)
+            {
+                const int64_t i = GBH (Ah, kA) ;
+                uint64_t *restrict Ci = Cpack + i * nwords ;
+                for (int64_t pA = Ap [kA] ; pA < Ap [kA+1] ; pA++)
+                {
+                    const int64_t k = Ai [pA] ;
+                    const uint64_t *restrict Bk = Bpack + k * nwords ;
+                    for (int64_t w = 0 ; w < nwords ; w++)
+                    {
+                        Ci [w] |= Bk [w] ;
+                    }
+                    if (need_values && Ax [A_iso ? 0 : pA])
+                    {
+                        uint64_t *restrict Cv = Cvals + i * nwords ;
+                        const uint64_t *restrict Bv = Bvals + k * nwords ;
+                        for (int64_t w = 0 ; w < nwords ; w++)
+                        {
+                            Cv [w] |= Bv [w] ;
+                        }
+                    }
+                }
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // C=A*B: Cpack (A(:,k),:) |= Bpack (k,:)
+        //----------------------------------------------------------------------
+
+        // Each task operates on a slice of the columns of A, and the tasks
+        // can modify the same row of Cpack, so atomics are used if the
+        // computation is done in parallel.
+
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (tid = 0 ; tid < antasks ; tid++)
+        {
+            for (int64_t kA = A_slice [tid] ; kA < A_slice [tid+1] ; kA++)
+            {
+                const int64_t k = GBH (Ah, kA) ;
+                const uint64_t *restrict Bk = Bpack + k * nwords ;
+                for (int64_t pA = Ap [kA] ; pA < Ap [kA+1] ; pA++)
+                {
+                    const int64_t i = Ai [pA] ;
+                    uint64_t *restrict Ci = Cpack + i * nwords ;
+                    const bool aik = need_values && Ax [A_iso ? 0 : pA] ;
+                    uint64_t *restrict Cv = aik ? (Cvals + i * nwords) : NULL ;
+                    const uint64_t *restrict Bv = aik ? (Bvals + k * nwords)
+                        : NULL ;
+                    if (nthreads == 1)
+                    {
+                        for (int64_t w = 0 ; w < nwords ; w++)
+                        {
+                            Ci [w] |= Bk [w] ;
+                        }
+                        if (aik)
+                        {
+                            for (int64_t w = 0 ; w < nwords ; w++)
+                            {
+                                Cv [w] |= Bv [w] ;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for (int64_t w = 0 ; w < nwords ; w++)
+                        {
+                            GB_ATOMIC_UPDATE
+                            Ci [w] |= Bk [w] ;
+                        }
+                        if (aik)
+                        {
+                            for (int64_t w = 0 ; w < nwords ; w++)
+                            {
+                                GB_ATOMIC_UPDATE
+                                Cv [w] |= Bv [w] ;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate C as bitmap
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK (&Bpack, Bpack_size) ;
+    GB_FREE_WORK (&Bvals, Bvals_size) ;
+
+    // set C->iso = C_iso   OK
+    GB_OK (GB_new_bix (&C, // existing header
+        GrB_BOOL, cvlen, cvdim, GB_Ap_null, true, GxB_BITMAP, false,
+        GB_HYPER_SWITCH_DEFAULT, -1, GB_IMAX (cnz, 1), true, C_iso)) ;
+    C->magic = GB_MAGIC ;
+    if (C_iso)
+    {
+        memcpy (C->x, cscalar, sizeof (bool)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // unpack Cpack into the bitmap of C, and count the entries in C
+    //--------------------------------------------------------------------------
+
+    // If the values of C were not computed separately, the value of each
+    // entry in C is true (with the PAIR multiplier, or if C is iso).
+
+    int8_t *restrict Cb = C->b ;
+    bool   *restrict Cx = (bool *) C->x ;
+    const uint64_t *restrict Cval_pack = (need_values) ? Cvals : Cpack ;
+    int64_t cnvals = 0 ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:cnvals)
+    for (tid = 0 ; tid < cntasks ; tid++)
+    {
+        int64_t ifirst, ilast ;
+        GB_PARTITION (ifirst, ilast, cvlen, tid, cntasks) ;
+        for (int64_t j = 0 ; j < cvdim ; j++)
+        {
+            const int64_t w = j / 64 ;
+            const int s = (int) (j % 64) ;
+            const int64_t pC_start = j * cvlen ;
+            for (int64_t i = ifirst ; i < ilast ; i++)
+            {
+                const int64_t pC = pC_start + i ;
+                Cb [pC] = (int8_t) ((Cpack [i * nwords + w] >> s) & 1) ;
+                if (!C_iso)
+                {
+                    Cx [pC] = (bool) ((Cval_pack [i * nwords + w] >> s) & 1) ;
+                }
+            }
+        }
+        int64_t task_cnvals = 0 ;
+        for (int64_t p = ifirst * nwords ; p < ilast * nwords ; p++)
+        {
+            task_cnvals += GB_popcount64 (Cpack [p]) ;
+        }
+        cnvals += task_cnvals ;
+    }
+
+    C->nvals = cnvals ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (C, "C bitpack output", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -207,9 +207,18 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
     // general case: C<M>=A'*B, C<!M>=A'*B, or C=A'*B, not in-place
     //--------------------------------------------------------------------------
 
-    GBURBLE ("(%sdot2) ", iso_kind) ;
     (*mask_applied) = (M != NULL) ; // mask applied if present
     (*done_in_place) = false ;      // TODO: allow dot2 to work in-place
+
+    if (M == NULL)
+    { 
+        // C=A'*B for boolean semirings via bit-packed rows of B and C
+        info = GB_AxB_bitpack (C, C_iso, cscalar, NULL, true, A, B,
+            semiring, flipxy, Werk) ;
+        if (info != GrB_NO_VALUE) return (info) ;
+    }
+
+    GBURBLE ("(%sdot2) ", iso_kind) ;
     return (GB_AxB_dot2 (C, C_iso, cscalar, M, Mask_comp, Mask_struct,
         false, A, B, semiring, flipxy, Werk)) ;
 }
@@ -16,6 +16,10 @@
 // is bitmap or full, and the dot product method accesses A with a different
 // stride than when computing C<#M>=A'*B.
 
+// If C=A'*B has too few entries to keep all threads busy, and no mask is
+// present, each dot product is split across several tasks by
+// GB_AxB_dot2_fine.
+
 // TODO:  this is slower than it could be if A and B are both bitmap/full, when
 // A->vlen is large.  This is because the inner loop is a simple full/bitmap
 // dot product, across the entire input vectors.  No tiling is used, so cache
@@ -282,6 +286,28 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
     bool A_is_pattern, B_is_pattern ;
     GB_binop_pattern (&A_is_pattern, &B_is_pattern, flipxy, mult->opcode) ;
 
+    //--------------------------------------------------------------------------
+    // determine if the dot products should be split across fine tasks
+    //--------------------------------------------------------------------------
+
+    // If C has fewer than GB_DOT2_FINE_ENTRIES_PER_THREAD*nthreads entries,
+    // the tasks above cannot keep all the threads busy, so each dot product
+    // is split into nfine tasks instead, by GB_AxB_dot2_fine.  This is not
+    // done if the mask is present, for C=A*B, or for positional operators.
+
+    #define GB_DOT2_FINE_ENTRIES_PER_THREAD 4
+    int nfine = 0 ;
+    if (nthreads > 1 && M == NULL && !A_not_transposed && cnz > 0
+        && cnz < GB_DOT2_FINE_ENTRIES_PER_THREAD * nthreads
+        && !GB_OPCODE_IS_POSITIONAL (mult->opcode))
+    { 
+        // about GB_DOT2_FINE_ENTRIES_PER_THREAD*nthreads tasks in total
+        nfine = (int) GB_ICEIL (GB_DOT2_FINE_ENTRIES_PER_THREAD * nthreads,
+            cnz) ;
+        nfine = (int) GB_IMIN (nfine, A->vlen) ;
+        if (nfine <= 1) nfine = 0 ;
+    }
+
     //--------------------------------------------------------------------------
     // allocate workspace and slice A and B
     //--------------------------------------------------------------------------
@@ -420,12 +446,24 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
     else
     {
 
+        info = GrB_NO_VALUE ;
+
+        //----------------------------------------------------------------------
+        // via the JIT or PreJIT kernel, with fine-grain tasks
+        //----------------------------------------------------------------------
+
+        if (nfine > 0)
+        { 
+            info = GB_AxB_dot2_fine (C, A, B, semiring, flipxy, nfine,
+                nthreads, false) ;
+        }
+
         //----------------------------------------------------------------------
         // via the factory kernel
         //----------------------------------------------------------------------
 
-        info = GrB_NO_VALUE ;
         #ifndef GBCOMPACT
+        if (info == GrB_NO_VALUE)
         GB_IF_FACTORY_KERNELS_ENABLED
         { 
 
@@ -487,9 +525,17 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
         // via the generic kernel
         //----------------------------------------------------------------------
 
+        if (info == GrB_NO_VALUE && nfine > 0)
+        { 
+            // with fine-grain tasks
+            info = GB_AxB_dot2_fine (C, A, B, semiring, flipxy, nfine,
+                nthreads, true) ;
+        }
+
         if (info == GrB_NO_VALUE)
         { 
             #define GB_DOT2_GENERIC
+            GB_JIT_GENERIC (GB_jit_mxm_family) ;
             GB_BURBLE_MATRIX (C, "(generic C%s=A%s*B, C %s) ",
                 (M == NULL) ? "" : (Mask_comp ? "<!M>" : "<M>"),
                 A_not_transposed ? "" : "'",
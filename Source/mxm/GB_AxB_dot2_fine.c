@@ -0,0 +1,182 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot2_fine: C=A'*B via dot products split across fine tasks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_AxB_dot2 computes each entry C(i,j) = A(:,i)'*B(:,j) with a single task,
+// so if C has fewer entries than there are threads (as in C=A'*B where C is
+// a scalar, or w=A*u where A is held by row and has just a few rows), most
+// threads are idle.  This method splits each dot product into nfine tasks,
+// each of which computes a partial result for a slice of the index range
+// 0:vlen-1.  The partial results of each entry C(i,j) are then summed with
+// the monoid of the semiring.
+
+// C has already been allocated by GB_AxB_dot2, as bitmap or full, and is not
+// iso.  No mask is present, A and B are not hypersparse, and the multiply
+// operator is not positional.  C is computed in place, and C->nvals is set.
+
+// If use_generic is false, only the JIT kernel is tried, and GrB_NO_VALUE is
+// returned if the JIT is disabled.  The factory kernels of dot2 (which do not
+// split the dot products) can then be used instead.  If use_generic is true,
+// the generic kernel is used.
+
+// JIT: done.  There are no factory kernels for this method.
+
+#include "mxm/GB_mxm.h"
+#include "jitifyer/GB_stringify.h"
+#include "include/GB_unused.h"
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORK (&W, W_size) ;                 \
+    GB_FREE_WORK (&Wb, Wb_size) ;               \
+}
+
+GrB_Info GB_AxB_dot2_fine           // C=A'*B via fine-grain dot products
+(
+    GrB_Matrix C,                   // output matrix, bitmap or full
+    const GrB_Matrix A,             // input matrix, not hypersparse
+    const GrB_Matrix B,             // input matrix, not hypersparse
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    const int nfine,                // # of tasks for each dot product
+    const int nthreads,             // # of threads to use
+    const bool use_generic          // if true, use the generic kernel
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (GB_IS_BITMAP (C) || GB_IS_FULL (C)) ;
+    ASSERT (!C->iso) ;
+    ASSERT (!GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (!GB_IS_HYPERSPARSE (B)) ;
+    ASSERT (A->vlen == B->vlen) ;
+    ASSERT (A->vlen > 0) ;
+    ASSERT (C->vlen == A->vdim && C->vdim == B->vdim) ;
+    ASSERT (nfine > 1) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for dot2_fine A'*B", GB0) ;
+
+    GB_void *restrict W = NULL ; size_t W_size = 0 ;
+    int8_t  *restrict Wb = NULL ; size_t Wb_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // get the semiring operators
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp mult = semiring->multiply ;
+    GrB_Monoid add = semiring->add ;
+    ASSERT (mult->ztype == add->op->ztype) ;
+    ASSERT (C->type == add->op->ztype) ;
+    ASSERT (!GB_OPCODE_IS_POSITIONAL (mult->opcode)) ;
+    size_t zsize = add->op->ztype->size ;
+    bool A_is_pattern, B_is_pattern ;
+    GB_binop_pattern (&A_is_pattern, &B_is_pattern, flipxy, mult->opcode) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace for the result of each task
+    //--------------------------------------------------------------------------
+
+    const int64_t cnz = C->vlen * C->vdim ;
+    const int ntasks = (int) (cnz * nfine) ;
+
+    W = GB_MALLOC_WORK (ntasks * zsize, GB_void, &W_size) ;
+    Wb = GB_MALLOC_WORK (ntasks, int8_t, &Wb_size) ;
+    if (W == NULL || Wb == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // W [tid] = A(k0:k1-1,i)'*B(k0:k1-1,j) for each fine task
+    //--------------------------------------------------------------------------
+
+    if (use_generic)
+    {
+        // via the generic kernel
+        #define GB_DOT2_FINE_GENERIC
+        GB_JIT_GENERIC (GB_jit_mxm_family) ;
+        GB_BURBLE_MATRIX (C, "(generic fine C=A'*B) ") ;
+        #include "mxm/factory/GB_AxB_dot_generic.c"
+        info = GrB_SUCCESS ;
+    }
+    else
+    {
+        // via the JIT or PreJIT kernel
+        info = GB_AxB_dot2_fine_jit (W, Wb, A, B, semiring, flipxy,
+            nfine, ntasks, nthreads) ;
+    }
+
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory, JIT not available, or other error
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    GBURBLE ("(dot2 fine: nfine %d ntasks %d) ", nfine, ntasks) ;
+
+    //--------------------------------------------------------------------------
+    // C(i,j) = sum of W [tid] for the nfine tasks of each entry C(i,j)
+    //--------------------------------------------------------------------------
+
+    // C has fewer entries than the # of threads, so this is done by a single
+    // thread.
+
+    GxB_binary_function freduce = add->op->binop_function ;
+    GB_void *restrict Cx = (GB_void *) C->x ;
+    int8_t  *restrict Cb = C->b ;
+    int64_t cnvals = 0 ;
+
+    for (int64_t pC = 0 ; pC < cnz ; pC++)
+    {
+        GB_void *cij = Cx + pC * zsize ;
+        bool cij_exists = false ;
+        for (int64_t tid = pC * nfine ; tid < (pC+1) * nfine ; tid++)
+        {
+            if (!Wb [tid]) continue ;
+            if (cij_exists)
+            {
+                // C(i,j) += W [tid]
+                freduce (cij, cij, W + tid * zsize) ;
+            }
+            else
+            {
+                // C(i,j) = W [tid]
+                memcpy (cij, W + tid * zsize, zsize) ;
+                cij_exists = true ;
+            }
+        }
+        if (Cb != NULL)
+        {
+            // C is bitmap
+            Cb [pC] = cij_exists ;
+            cnvals += cij_exists ;
+        }
+        else if (!cij_exists)
+        {
+            // C is full, so C(i,j) is known to exist, but its partial results
+            // can all be zero when the PLUS_PAIR semiring ignores overflow
+            memcpy (cij, add->identity, zsize) ;
+        }
+    }
+
+    C->nvals = cnvals ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
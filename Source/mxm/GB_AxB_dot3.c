@@ -330,6 +330,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
         if (info == GrB_NO_VALUE)
         { 
             #define GB_DOT3_GENERIC
+            GB_JIT_GENERIC (GB_jit_mxm_family) ;
             GB_BURBLE_MATRIX (C, "(generic C<M>=A'*B) ") ;
             #include "mxm/factory/GB_AxB_dot_generic.c"
             info = GrB_SUCCESS ;
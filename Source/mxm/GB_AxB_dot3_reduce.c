@@ -0,0 +1,197 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot3_reduce: compute s = reduce (C<M>=A'*B) without forming C
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This function computes the same entries C(i,j) as GB_AxB_dot3, but each one
+// is summed into a scalar owned by the task that computes it, with the monoid
+// of the semiring, instead of being written into C.  The tasks are then
+// summed into the scalar s.  C, its Ci and Cx arrays, and its zombies are
+// never allocated, and the phase1 work estimate of dot3 (which requires the
+// Cwork array of size nnz(M)) is skipped.  The mask M must be present, not
+// complemented, and sparse or hypersparse.  It can be structural or valued.
+
+// s has the type of the monoid, semiring->add->op->ztype.  If C<M>=A'*B has
+// no entries, s_exists is returned as false and s is not modified.
+
+// JIT: done.  There are no factory kernels for this method.
+
+#include "mxm/GB_mxm.h"
+#include "jitifyer/GB_stringify.h"
+#include "include/GB_unused.h"
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORK (&TaskList, TaskList_size) ;   \
+    GB_FREE_WORK (&W, W_size) ;                 \
+    GB_FREE_WORK (&Wcount, Wcount_size) ;       \
+}
+
+GrB_Info GB_AxB_dot3_reduce         // s = reduce (C<M>=A'*B)
+(
+    GB_void *s,                     // output scalar, of type add->op->ztype
+    bool *s_exists,                 // true if C<M>=A'*B has any entries
+    const GrB_Matrix M,             // mask matrix
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B and s
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (s != NULL && s_exists != NULL) ;
+
+    ASSERT_MATRIX_OK (M, "M for dot3_reduce A'*B", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for dot3_reduce A'*B", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for dot3_reduce A'*B", GB0) ;
+
+    ASSERT (!GB_ZOMBIES (M)) ;
+    ASSERT (GB_JUMBLED_OK (M)) ;
+    ASSERT (!GB_PENDING (M)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_ZOMBIES (B)) ;
+    ASSERT (!GB_JUMBLED (B)) ;
+    ASSERT (!GB_PENDING (B)) ;
+
+    ASSERT (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) ;
+    ASSERT (A->vlen == B->vlen) ;
+    ASSERT (A->vlen > 0) ;
+
+    ASSERT_SEMIRING_OK (semiring, "semiring for dot3_reduce A'*B", GB0) ;
+
+    (*s_exists) = false ;
+
+    int ntasks, nthreads ;
+    GB_task_struct *TaskList = NULL ; size_t TaskList_size = 0 ;
+    GB_void *restrict W = NULL ; size_t W_size = 0 ;
+    int64_t *restrict Wcount = NULL ; size_t Wcount_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // get the semiring operators
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp mult = semiring->multiply ;
+    GrB_Monoid add = semiring->add ;
+    ASSERT (mult->ztype == add->op->ztype) ;
+    GrB_Type ztype = add->op->ztype ;
+    size_t zsize = ztype->size ;
+
+    bool op_is_first  = mult->opcode == GB_FIRST_binop_code ;
+    bool op_is_second = mult->opcode == GB_SECOND_binop_code ;
+    bool op_is_pair   = mult->opcode == GB_PAIR_binop_code ;
+    bool A_is_pattern = false ;
+    bool B_is_pattern = false ;
+
+    if (flipxy)
+    {
+        // z = fmult (b,a) will be computed
+        A_is_pattern = op_is_first  || op_is_pair ;
+        B_is_pattern = op_is_second || op_is_pair ;
+    }
+    else
+    {
+        // z = fmult (a,b) will be computed
+        A_is_pattern = op_is_second || op_is_pair ;
+        B_is_pattern = op_is_first  || op_is_pair ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the tasks and the hyper hashes of A and B
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_hyper_hash_build (A, Werk)) ;
+    GB_OK (GB_hyper_hash_build (B, Werk)) ;
+
+    GB_OK (GB_AxB_dot3_one_slice (&TaskList, &TaskList_size, &ntasks, &nthreads,
+        M, Werk)) ;
+
+    GBURBLE ("(%s%s%s%s = %s'*%s, reduce) nthreads %d ntasks %d ",
+        GB_sparsity_char_matrix (M),
+        Mask_struct ? "{" : "<",
+        GB_sparsity_char_matrix (M),
+        Mask_struct ? "}" : ">",
+        GB_sparsity_char_matrix (A),
+        GB_sparsity_char_matrix (B), nthreads, ntasks) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace for the result of each task
+    //--------------------------------------------------------------------------
+
+    W = GB_MALLOC_WORK (ntasks * zsize, GB_void, &W_size) ;
+    Wcount = GB_MALLOC_WORK (ntasks, int64_t, &Wcount_size) ;
+    if (W == NULL || Wcount == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // W [tid] = reduce (C<M>=A'*B) for each task, via the JIT kernel
+    //--------------------------------------------------------------------------
+
+    info = GB_AxB_dot3_reduce_jit (W, Wcount, M, Mask_struct, A, B,
+        semiring, flipxy, TaskList, ntasks, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // via the generic kernel
+    //--------------------------------------------------------------------------
+
+    if (info == GrB_NO_VALUE)
+    {
+        #define GB_DOT3_REDUCE_GENERIC
+        GB_JIT_GENERIC (GB_jit_mxm_family) ;
+        GB_BURBLE_MATRIX (M, "(generic s=reduce(C<M>=A'*B)) ") ;
+        #include "mxm/factory/GB_AxB_dot_generic.c"
+        info = GrB_SUCCESS ;
+    }
+
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory, or other error
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // s = sum of W [tid] for all tasks that found any entries
+    //--------------------------------------------------------------------------
+
+    GxB_binary_function freduce = add->op->binop_function ;
+    for (int tid = 0 ; tid < ntasks ; tid++)
+    {
+        if (Wcount [tid] == 0) continue ;
+        if (*s_exists)
+        {
+            // s += W [tid]
+            freduce (s, s, W + tid * zsize) ;
+        }
+        else
+        {
+            // s = W [tid]
+            memcpy (s, W + tid * zsize, zsize) ;
+            (*s_exists) = true ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,227 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot3_rowreduce: compute T = rowreduce (C<M>=A'*B) without forming C
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This function computes the same entries C(i,j) as GB_AxB_dot3, but each
+// vector C(:,j) is reduced to a single entry T(j) with the monoid of the
+// semiring, instead of being written into C.  C, its Ci and Cx arrays, and
+// its zombies are never allocated.  The mask M must be present, not
+// complemented, and sparse or hypersparse.  It can be structural or valued.
+
+// T is returned as a bitmap vector of length M->vdim, with the type of the
+// monoid.  T(j) is not present if C(:,j) has no entries.  If M is held by row,
+// the vectors of M are the rows of C, and T is the row reduction of C.
+
+// JIT: done.  There are no factory kernels for this method.
+
+#include "mxm/GB_mxm.h"
+#include "jitifyer/GB_stringify.h"
+#include "include/GB_unused.h"
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_FREE_WORK (&TaskList, TaskList_size) ;   \
+    GB_FREE_WORK (&W, W_size) ;                 \
+    GB_FREE_WORK (&Wcount, Wcount_size) ;       \
+}
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORKSPACE ;                         \
+    GB_phybix_free (T) ;                        \
+}
+
+GrB_Info GB_AxB_dot3_rowreduce      // T = rowreduce (C<M>=A'*B)
+(
+    GrB_Matrix T,                   // output vector, static header
+    const GrB_Matrix M,             // mask matrix
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B and T
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (T != NULL && (T->static_header || GBNSTATIC)) ;
+
+    ASSERT_MATRIX_OK (M, "M for dot3_rowreduce A'*B", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for dot3_rowreduce A'*B", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for dot3_rowreduce A'*B", GB0) ;
+
+    ASSERT (!GB_ZOMBIES (M)) ;
+    ASSERT (GB_JUMBLED_OK (M)) ;
+    ASSERT (!GB_PENDING (M)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_ZOMBIES (B)) ;
+    ASSERT (!GB_JUMBLED (B)) ;
+    ASSERT (!GB_PENDING (B)) ;
+
+    ASSERT (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) ;
+    ASSERT (A->vlen == B->vlen) ;
+    ASSERT (A->vlen > 0) ;
+
+    ASSERT_SEMIRING_OK (semiring, "semiring for dot3_rowreduce A'*B", GB0) ;
+
+    int ntasks, nthreads ;
+    GB_task_struct *TaskList = NULL ; size_t TaskList_size = 0 ;
+    GB_void *restrict W = NULL ; size_t W_size = 0 ;
+    int64_t *restrict Wcount = NULL ; size_t Wcount_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // get the semiring operators
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp mult = semiring->multiply ;
+    GrB_Monoid add = semiring->add ;
+    ASSERT (mult->ztype == add->op->ztype) ;
+    GrB_Type ztype = add->op->ztype ;
+    size_t zsize = ztype->size ;
+
+    bool op_is_first  = mult->opcode == GB_FIRST_binop_code ;
+    bool op_is_second = mult->opcode == GB_SECOND_binop_code ;
+    bool op_is_pair   = mult->opcode == GB_PAIR_binop_code ;
+    bool A_is_pattern = false ;
+    bool B_is_pattern = false ;
+
+    if (flipxy)
+    { 
+        // z = fmult (b,a) will be computed
+        A_is_pattern = op_is_first  || op_is_pair ;
+        B_is_pattern = op_is_second || op_is_pair ;
+    }
+    else
+    { 
+        // z = fmult (a,b) will be computed
+        A_is_pattern = op_is_second || op_is_pair ;
+        B_is_pattern = op_is_first  || op_is_pair ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the bitmap vector T, with all entries not present
+    //--------------------------------------------------------------------------
+
+    int64_t tlen = M->vdim ;
+    GB_OK (GB_new_bix (&T, // bitmap, existing header
+        ztype, tlen, 1, GB_Ap_null, true, GxB_BITMAP, true,
+        GB_HYPER_SWITCH_DEFAULT, -1, GB_IMAX (tlen, 1), true, false)) ;
+    T->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // construct the tasks and the hyper hashes of A and B
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_hyper_hash_build (A, Werk)) ;
+    GB_OK (GB_hyper_hash_build (B, Werk)) ;
+
+    GB_OK (GB_AxB_dot3_one_slice (&TaskList, &TaskList_size, &ntasks, &nthreads,
+        M, Werk)) ;
+
+    GBURBLE ("(T = rowreduce (%s%s%s%s = %s'*%s)) nthreads %d ntasks %d ",
+        GB_sparsity_char_matrix (M),
+        Mask_struct ? "{" : "<",
+        GB_sparsity_char_matrix (M),
+        Mask_struct ? "}" : ">",
+        GB_sparsity_char_matrix (A),
+        GB_sparsity_char_matrix (B), nthreads, ntasks) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace for the fine tasks
+    //--------------------------------------------------------------------------
+
+    W = GB_MALLOC_WORK (GB_IMAX (ntasks, 1) * zsize, GB_void, &W_size) ;
+    Wcount = GB_MALLOC_WORK (GB_IMAX (ntasks, 1), int64_t, &Wcount_size) ;
+    if (W == NULL || Wcount == NULL)
+    { 
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // T(j) = reduce (C(:,j)) for each vector of C<M>=A'*B, via the JIT kernel
+    //--------------------------------------------------------------------------
+
+    info = GB_AxB_dot3_rowreduce_jit (T, W, Wcount, M, Mask_struct, A, B,
+        semiring, flipxy, TaskList, ntasks, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // via the generic kernel
+    //--------------------------------------------------------------------------
+
+    if (info == GrB_NO_VALUE)
+    { 
+        #define GB_DOT3_ROWREDUCE
+        #define GB_DOT3_REDUCE_GENERIC
+        GB_JIT_GENERIC (GB_jit_mxm_family) ;
+        GB_BURBLE_MATRIX (M, "(generic T=rowreduce(C<M>=A'*B)) ") ;
+        #include "mxm/factory/GB_AxB_dot_generic.c"
+        info = GrB_SUCCESS ;
+    }
+
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory, or other error
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sum the results of the fine tasks into T, and count the entries of T
+    //--------------------------------------------------------------------------
+
+    GxB_binary_function freduce = add->op->binop_function ;
+    GB_void *restrict Tx = (GB_void *) T->x ;
+    int8_t  *restrict Tb = T->b ;
+    const int64_t *restrict Mh = M->h ;
+    int64_t tnvals = 0 ;
+
+    for (int tid = 0 ; tid < ntasks ; tid++)
+    {
+        if (TaskList [tid].klast != -1)
+        { 
+            // coarse task: Wcount [tid] entries of T were computed
+            tnvals += Wcount [tid] ;
+        }
+        else if (Wcount [tid] > 0)
+        {
+            // fine task: T(j) += W [tid]
+            int64_t j = GBH (Mh, TaskList [tid].kfirst) ;
+            GB_void *tj = Tx + j * zsize ;
+            if (Tb [j])
+            { 
+                freduce (tj, tj, W + tid * zsize) ;
+            }
+            else
+            { 
+                memcpy (tj, W + tid * zsize, zsize) ;
+                Tb [j] = 1 ;
+                tnvals++ ;
+            }
+        }
+    }
+
+    T->nvals = tnvals ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (T, "T output for dot3_rowreduce A'*B", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -18,7 +18,9 @@
 // matrix C passed in from the user (C_in).
 
 // The method is chosen automatically:  a gather/scatter saxpy method
-// (Gustavson), or a dot product method.
+// (Gustavson), or a dot product method.  If autotuning is enabled, the choice
+// is revised from the run times measured for similar problems (see
+// GB_AxB_autotune).
 
 // FUTURE:: an outer-product method for C=A*B'
 
@@ -37,6 +39,7 @@
 
 #include "mxm/GB_mxm.h"
 #include "transpose/GB_transpose.h"
+#include "mxm/GB_AxB_autotune.h"
 
 GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
 (
@@ -60,6 +63,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     bool *done_in_place,            // if true, C was computed in-place
     GrB_Desc_Value AxB_method,      // for auto vs user selection of methods
     const int do_sort,              // if nonzero, try to return C unjumbled
+    GxB_MxmPlan plan,               // optional plan for T=A*B, or NULL
     GB_Werk Werk
 )
 {
@@ -562,6 +566,11 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     // use GB_AxB_saxpy3 by default
     int axb_method = GB_USE_SAXPY ;
 
+    // for autotuning the selection of the method
+    int tune_arm = -1 ;
+    uint64_t tune_key = 0 ;
+    double tune_time = 0 ;
+
     if (atrans)
     {
 
@@ -595,6 +604,12 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             Mask_comp, A, B, accum, semiring, flipxy, can_do_in_place,
             allow_scale, B_is_diagonal, AxB_method) ;
 
+        // revise the selection from measured run times, if autotuning
+        tune_arm = GB_AxB_autotune_select (&axb_method, &AxB_method,
+            &tune_key, M, Mask_comp, Mask_struct, A, true, B, false, semiring,
+            flipxy, can_do_in_place, plan) ;
+        if (tune_arm >= 0) tune_time = GB_OPENMP_GET_WTIME ;
+
         //----------------------------------------------------------------------
         // AT = A'
         //----------------------------------------------------------------------
@@ -644,10 +659,17 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GBURBLE ("C%s=A'*B, saxpy (transposed %s) ", M_str, A_str) ;
                 GB_OK (GB_AxB_saxpy (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, AT, B, semiring, flipxy,
-                    mask_applied, done_in_place, AxB_method, do_sort, Werk)) ;
+                    mask_applied, done_in_place, AxB_method, do_sort, plan,
+                    Werk)) ;
                 break ;
         }
 
+        if (tune_arm >= 0)
+        { 
+            GB_AxB_autotune_record (tune_key, tune_arm,
+                GB_OPENMP_GET_WTIME - tune_time) ;
+        }
+
     }
     else if (btrans)
     {
@@ -676,6 +698,12 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             axb_method = GB_USE_DOT ;
         }
 
+        // revise the selection from measured run times, if autotuning
+        tune_arm = GB_AxB_autotune_select (&axb_method, &AxB_method,
+            &tune_key, M, Mask_comp, Mask_struct, A, false, B, true, semiring,
+            flipxy, can_do_in_place, plan) ;
+        if (tune_arm >= 0) tune_time = GB_OPENMP_GET_WTIME ;
+
         //----------------------------------------------------------------------
         // BT = B'
         //----------------------------------------------------------------------
@@ -728,10 +756,17 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GBURBLE ("C%s=A*B', saxpy (transposed %s) ", M_str, B_str) ;
                 GB_OK (GB_AxB_saxpy (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, A, BT, semiring, flipxy,
-                    mask_applied, done_in_place, AxB_method, do_sort, Werk)) ;
+                    mask_applied, done_in_place, AxB_method, do_sort, plan,
+                    Werk)) ;
                 break ;
         }
 
+        if (tune_arm >= 0)
+        { 
+            GB_AxB_autotune_record (tune_key, tune_arm,
+                GB_OPENMP_GET_WTIME - tune_time) ;
+        }
+
     }
     else
     {
@@ -797,6 +832,12 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             }
         }
 
+        // revise the selection from measured run times, if autotuning
+        tune_arm = GB_AxB_autotune_select (&axb_method, &AxB_method,
+            &tune_key, M, Mask_comp, Mask_struct, A, false, B, false, semiring,
+            flipxy, can_do_in_place, plan) ;
+        if (tune_arm >= 0) tune_time = GB_OPENMP_GET_WTIME ;
+
         //----------------------------------------------------------------------
         // C<M> = A*B
         //----------------------------------------------------------------------
@@ -832,9 +873,16 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GBURBLE ("C%s=A*B, saxpy ", M_str) ;
                 GB_OK (GB_AxB_saxpy (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, A, B, semiring, flipxy,
-                    mask_applied, done_in_place, AxB_method, do_sort, Werk)) ;
+                    mask_applied, done_in_place, AxB_method, do_sort, plan,
+                    Werk)) ;
                 break ;
         }
+
+        if (tune_arm >= 0)
+        { 
+            GB_AxB_autotune_record (tune_key, tune_arm,
+                GB_OPENMP_GET_WTIME - tune_time) ;
+        }
     }
 
     if (*M_transposed) { GBURBLE ("(M transposed) ") ; }
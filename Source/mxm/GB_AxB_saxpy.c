@@ -29,6 +29,7 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
     bool *done_in_place,            // if true, C was computed in-place 
     const GrB_Desc_Value AxB_method,
     const int do_sort,              // if nonzero, try to sort in saxpy3
+    GxB_MxmPlan plan,               // optional plan for C=A*B, or NULL
     GB_Werk Werk
 )
 {
@@ -207,7 +208,7 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
         ASSERT (C_sparsity == GxB_HYPERSPARSE || C_sparsity == GxB_SPARSE) ;
         info = GB_AxB_saxpy3 (C, C_iso, cscalar, C_sparsity, M, Mask_comp,
             Mask_struct, A, B, semiring, flipxy, mask_applied, AxB_method,
-            do_sort, Werk) ;
+            do_sort, plan, Werk) ;
 
         if (info == GrB_NO_VALUE)
         { 
@@ -221,7 +222,7 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
             ASSERT (M != NULL) ;
             info = GB_AxB_saxpy (C, NULL, NULL, false, false, NULL, A, B,
                 semiring, flipxy, mask_applied, done_in_place, AxB_method,
-                do_sort, Werk) ;
+                do_sort, plan, Werk) ;
         }
 
     }
@@ -246,9 +247,16 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
         else
         { 
 
-            // C<#M> = A*B via bitmap saxpy method
-            info = GB_AxB_saxbit (C, C_iso, cscalar, M,
-                Mask_comp, Mask_struct, A, B, semiring, flipxy, Werk) ;
+            // C = A*B for boolean semirings via bit-packed rows of B and C
+            info = GB_AxB_bitpack (C, C_iso, cscalar, M, false, A, B,
+                semiring, flipxy, Werk) ;
+
+            if (info == GrB_NO_VALUE)
+            { 
+                // C<#M> = A*B via bitmap saxpy method
+                info = GB_AxB_saxbit (C, C_iso, cscalar, M,
+                    Mask_comp, Mask_struct, A, B, semiring, flipxy, Werk) ;
+            }
         }
 
         // the mask is always applied if present
@@ -33,6 +33,7 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
     bool *done_in_place,            // if true, C was computed in-place 
     const GrB_Desc_Value AxB_method,
     const int do_sort,              // if nonzero, try to sort in saxpy3
+    GxB_MxmPlan plan,               // optional plan for C=A*B, or NULL
     GB_Werk Werk
 ) ;
 
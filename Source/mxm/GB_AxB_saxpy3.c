@@ -21,6 +21,12 @@
 // For simplicity, this discussion and all comments in this code assume that
 // all matrices are in CSC format, but the algorithm is CSR/CSC agnostic.
 
+// If a GxB_MxmPlan is provided and no mask is present, the tasks and the
+// counts of entries in each vector of C (for coarse tasks) are saved in the
+// plan, after the symbolic phase.  The next call with the same plan and with
+// A and B having the same patterns skips phase0 and phase1, and does just the
+// numeric phases.
+
 // The matrix B is split into two kinds of tasks: coarse and fine.  A coarse
 // task computes C(:,j1:j2) = A*B(:,j1:j2), for a unique set of vectors j1:j2.
 // Those vectors are not shared with any other tasks.  A fine task works with a
@@ -93,6 +99,7 @@
 #include "jitifyer/GB_stringify.h"
 #include "mxm/GB_AxB_saxpy_generic.h"
 #include "mxm/GB_AxB__include1.h"
+#include "mxm/GB_MxmPlan.h"
 #ifndef GBCOMPACT
 #include "FactoryKernels/GB_AxB__include2.h"
 #endif
@@ -132,6 +139,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     bool *mask_applied,             // if true, then mask was applied
     GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
     const int do_sort,              // if nonzero, try to sort in saxpy3
+    GxB_MxmPlan plan,               // optional plan for C=A*B, or NULL
     GB_Werk Werk
 )
 {
@@ -274,7 +282,31 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     int nthreads, ntasks, nfine ;
     bool M_in_place = false ;
 
-    if (nthreads_max == 1 && M == NULL && (AxB_method != GxB_AxB_HASH) &&
+    // The analysis held in the plan is used only for C=A*B with no mask, and
+    // only if the patterns of A and B have not changed since it was saved.
+    bool use_plan = (M == NULL) && GB_MxmPlan_match (plan, A, B, AxB_method) ;
+
+    if (use_plan)
+    { 
+        // Skip the flopcount analysis and reuse the tasks saved in the plan.
+        GBURBLE ("(reuse plan) ") ;
+        ntasks = plan->ntasks ;
+        nfine = plan->nfine ;
+        nthreads = plan->nthreads ;
+        SaxpyTasks = GB_MALLOC_WORK (ntasks, GB_saxpy3task_struct,
+            &SaxpyTasks_size) ;
+        info = GrB_SUCCESS ;
+        if (SaxpyTasks == NULL)
+        { 
+            info = GrB_OUT_OF_MEMORY ;
+        }
+        else
+        { 
+            memcpy (SaxpyTasks, plan->SaxpyTasks,
+                ntasks * sizeof (GB_saxpy3task_struct)) ;
+        }
+    }
+    else if (nthreads_max == 1 && M == NULL && (AxB_method != GxB_AxB_HASH) &&
         GB_IMIN (GB_nnz (A), GB_nnz (B)) > cvlen/16)
     { 
         // Skip the flopcount analysis if only a single thread is being used,
@@ -588,8 +620,25 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     // a total of 5.9 second for phase 7 (the numerical work below).
     // Figure out a faster method.
 
-    GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
-        A, B, SaxpyTasks, ntasks, nfine, nthreads) ;
+    if (use_plan)
+    { 
+        // Cp [kk] = nnz (C (:,j)) for each vector of a coarse task, as found
+        // by the symbolic analysis when the plan was saved.
+        GB_memcpy (Cp, plan->Cp, (cnvec+1) * sizeof (int64_t), nthreads_max) ;
+    }
+    else
+    {
+        GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
+            A, B, SaxpyTasks, ntasks, nfine, nthreads) ;
+        if (plan != NULL && M == NULL)
+        { 
+            // Save the analysis in the plan, for the next C=A*B.  The plan is
+            // only an optimization, so if this runs out of memory, the plan
+            // is left empty and the error is ignored.
+            GB_MxmPlan_save (plan, A, B, AxB_method, SaxpyTasks, ntasks, nfine,
+                nthreads, Cp, cnvec) ;
+        }
+    }
 
     //==========================================================================
     // C = A*B, via saxpy3 method, phases 2 to 5
@@ -32,6 +32,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     bool *mask_applied,             // if true, then mask was applied
     GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
     const int do_sort,              // if nonzero, try to sort in saxpy3
+    GxB_MxmPlan plan,               // optional plan for C=A*B, or NULL
     GB_Werk Werk
 ) ;
 
@@ -34,6 +34,7 @@
 #include "mxm/GB_mxm.h"
 #include "binaryop/GB_binop.h"
 #include "mxm/GB_AxB_saxpy_generic.h"
+#include "jitifyer/GB_jitifyer.h"
 
 GrB_Info GB_AxB_saxpy_generic
 (
@@ -89,6 +90,7 @@ GrB_Info GB_AxB_saxpy_generic
         // generic semirings with positional mulitiply operators
         //----------------------------------------------------------------------
 
+        GB_JIT_GENERIC (GB_jit_mxm_family) ;
         GB_BURBLE_MATRIX (C, "(generic positional C=A*B) ") ;
 
         ASSERT (!flipxy) ;
@@ -279,6 +281,7 @@ GrB_Info GB_AxB_saxpy_generic
         // generic semirings with standard multiply operators
         //----------------------------------------------------------------------
 
+        GB_JIT_GENERIC (GB_jit_mxm_family) ;
         GB_BURBLE_MATRIX (C, "(generic C=A*B) ") ;
 
         if (opcode == GB_FIRST_binop_code)
@@ -0,0 +1,221 @@
+//------------------------------------------------------------------------------
+// GB_MxmPlan: save, check, and clear the saxpy3 analysis held in a plan
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The analysis is saved only when A and B are both sparse or hypersparse, and
+// when C=A*B is computed by GB_AxB_saxpy3 with no mask.  It is reused only if
+// A and B have the same dimensions, sparsity, and patterns as when the
+// analysis was done, and if the max # of threads has not changed.  The values
+// of A and B may differ.
+
+#include "GB.h"
+#include "mxm/GB_MxmPlan.h"
+
+//------------------------------------------------------------------------------
+// GB_MxmPlan_clear: free the analysis held in a plan
+//------------------------------------------------------------------------------
+
+void GB_MxmPlan_clear       // free the analysis held in a plan
+(
+    GxB_MxmPlan plan
+)
+{
+    plan->analyzed = false ;
+    GB_FREE (&(plan->SaxpyTasks), plan->SaxpyTasks_size) ;
+    GB_FREE (&(plan->Cp), plan->Cp_size) ;
+    GB_FREE (&(plan->Ap), plan->Ap_size) ;
+    GB_FREE (&(plan->Ah), plan->Ah_size) ;
+    GB_FREE (&(plan->Ai), plan->Ai_size) ;
+    GB_FREE (&(plan->Bp), plan->Bp_size) ;
+    GB_FREE (&(plan->Bh), plan->Bh_size) ;
+    GB_FREE (&(plan->Bi), plan->Bi_size) ;
+    plan->ntasks = 0 ;
+    plan->nfine = 0 ;
+    plan->nthreads = 0 ;
+}
+
+//------------------------------------------------------------------------------
+// GB_MxmPlan_match: true if the plan can be used for C=A*B
+//------------------------------------------------------------------------------
+
+// If the pattern of A or B differs from the pattern saved in the plan, the
+// saved analysis is stale and is not used.  This check takes O(nnz(A)+nnz(B))
+// time, which is far less than the symbolic analysis it replaces.
+
+static inline bool GB_same
+(
+    const int64_t *X,
+    const int64_t *Y,
+    const int64_t n
+)
+{
+    if (n == 0) return (true) ;
+    if (X == NULL || Y == NULL) return (X == Y) ;
+    return (memcmp (X, Y, n * sizeof (int64_t)) == 0) ;
+}
+
+bool GB_MxmPlan_match       // true if the plan can be used for C=A*B
+(
+    const GxB_MxmPlan plan,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Desc_Value AxB_method
+)
+{
+
+    if (plan == NULL || !plan->analyzed) return (false) ;
+
+    //--------------------------------------------------------------------------
+    // check the dimensions, sparsity, and # of entries
+    //--------------------------------------------------------------------------
+
+    if (plan->AxB_method != AxB_method
+        || plan->nthreads_max != GB_Context_nthreads_max ( )
+        || plan->avlen != A->vlen || plan->avdim != A->vdim
+        || plan->anvec != A->nvec || plan->anz != GB_nnz (A)
+        || plan->A_is_hyper != GB_IS_HYPERSPARSE (A)
+        || plan->bvlen != B->vlen || plan->bvdim != B->vdim
+        || plan->bnvec != B->nvec || plan->bnz != GB_nnz (B)
+        || plan->B_is_hyper != GB_IS_HYPERSPARSE (B)
+        || !(GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A))
+        || !(GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)))
+    {
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the patterns of A and B
+    //--------------------------------------------------------------------------
+
+    return (GB_same (plan->Ap, A->p, plan->anvec + 1)
+        &&  GB_same (plan->Ah, A->h, plan->A_is_hyper ? plan->anvec : 0)
+        &&  GB_same (plan->Ai, A->i, plan->anz)
+        &&  GB_same (plan->Bp, B->p, plan->bnvec + 1)
+        &&  GB_same (plan->Bh, B->h, plan->B_is_hyper ? plan->bnvec : 0)
+        &&  GB_same (plan->Bi, B->i, plan->bnz)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_MxmPlan_save: save the saxpy3 analysis of C=A*B in a plan
+//------------------------------------------------------------------------------
+
+// If out of memory, the plan is left empty and GrB_OUT_OF_MEMORY is returned.
+// The caller can ignore this error, since the plan is only an optimization.
+
+// Cp [kk] is nnz (C (:,j)) for each vector computed by a coarse task.  The
+// counts for vectors computed by fine tasks are found in the numeric phase
+// (in GB_AxB_saxpy3_cumsum), so they are set to zero here.
+
+#define GB_SAVE(X,X_size,Y,n)                                               \
+{                                                                           \
+    if ((Y) != NULL && (n) > 0)                                             \
+    {                                                                       \
+        X = GB_MALLOC (n, int64_t, &(X_size)) ;                             \
+        if (X == NULL)                                                      \
+        {                                                                   \
+            GB_MxmPlan_clear (plan) ;                                       \
+            return (GrB_OUT_OF_MEMORY) ;                                    \
+        }                                                                   \
+        GB_memcpy (X, Y, (n) * sizeof (int64_t), nthreads_max) ;            \
+    }                                                                       \
+}
+
+GrB_Info GB_MxmPlan_save    // save the saxpy3 analysis of C=A*B in a plan
+(
+    GxB_MxmPlan plan,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Desc_Value AxB_method,
+    const GB_saxpy3task_struct *SaxpyTasks,
+    const int ntasks,
+    const int nfine,
+    const int nthreads,
+    const int64_t *Cp,
+    const int64_t cnvec
+)
+{
+
+    //--------------------------------------------------------------------------
+    // clear any prior analysis
+    //--------------------------------------------------------------------------
+
+    GB_MxmPlan_clear (plan) ;
+    if (!(GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ||
+        !(GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)))
+    {
+        // the plan is only used if A and B are sparse or hypersparse
+        return (GrB_SUCCESS) ;
+    }
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    //--------------------------------------------------------------------------
+    // save the task list, with no workspace
+    //--------------------------------------------------------------------------
+
+    plan->SaxpyTasks = GB_MALLOC (ntasks, GB_saxpy3task_struct,
+        &(plan->SaxpyTasks_size)) ;
+    if (plan->SaxpyTasks == NULL)
+    {
+        // out of memory
+        GB_MxmPlan_clear (plan) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    memcpy (plan->SaxpyTasks, SaxpyTasks,
+        ntasks * sizeof (GB_saxpy3task_struct)) ;
+    for (int taskid = 0 ; taskid < ntasks ; taskid++)
+    {
+        plan->SaxpyTasks [taskid].Hi = NULL ;
+        plan->SaxpyTasks [taskid].Hf = NULL ;
+        plan->SaxpyTasks [taskid].Hx = NULL ;
+        plan->SaxpyTasks [taskid].my_cjnz = 0 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // save the counts of entries in C(:,j) for the coarse tasks
+    //--------------------------------------------------------------------------
+
+    GB_SAVE (plan->Cp, plan->Cp_size, Cp, cnvec+1) ;
+    for (int taskid = 0 ; taskid < nfine ; taskid++)
+    {
+        plan->Cp [SaxpyTasks [taskid].vector] = 0 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // save the patterns of A and B
+    //--------------------------------------------------------------------------
+
+    int64_t anz = GB_nnz (A) ;
+    int64_t bnz = GB_nnz (B) ;
+    GB_SAVE (plan->Ap, plan->Ap_size, A->p, A->nvec+1) ;
+    GB_SAVE (plan->Ah, plan->Ah_size, A->h, A->nvec) ;
+    GB_SAVE (plan->Ai, plan->Ai_size, A->i, anz) ;
+    GB_SAVE (plan->Bp, plan->Bp_size, B->p, B->nvec+1) ;
+    GB_SAVE (plan->Bh, plan->Bh_size, B->h, B->nvec) ;
+    GB_SAVE (plan->Bi, plan->Bi_size, B->i, bnz) ;
+
+    plan->avlen = A->vlen ;
+    plan->avdim = A->vdim ;
+    plan->anvec = A->nvec ;
+    plan->anz   = anz ;
+    plan->A_is_hyper = GB_IS_HYPERSPARSE (A) ;
+    plan->bvlen = B->vlen ;
+    plan->bvdim = B->vdim ;
+    plan->bnvec = B->nvec ;
+    plan->bnz   = bnz ;
+    plan->B_is_hyper = GB_IS_HYPERSPARSE (B) ;
+
+    plan->ntasks = ntasks ;
+    plan->nfine = nfine ;
+    plan->nthreads = nthreads ;
+    plan->nthreads_max = nthreads_max ;
+    plan->AxB_method = AxB_method ;
+    plan->analyzed = true ;
+    return (GrB_SUCCESS) ;
+}
+
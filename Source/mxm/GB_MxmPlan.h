@@ -0,0 +1,79 @@
+//------------------------------------------------------------------------------
+// GB_MxmPlan.h: definitions for the GxB_MxmPlan object
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A GxB_MxmPlan holds the symbolic analysis of C=A*B computed by the saxpy3
+// method: the task list constructed by GB_AxB_saxpy3_slice_balanced (or
+// GB_AxB_saxpy3_slice_quick), and the count of entries in each vector of C
+// for the coarse tasks, computed by GB_AxB_saxpy3_symbolic.  Together, these
+// define the pattern of C, and the analysis depends only on the patterns of
+// A and B.  A copy of the patterns of A and B is kept in the plan, so that
+// any change to their patterns is detected before the plan is reused.
+
+#ifndef GB_MXMPLAN_H
+#define GB_MXMPLAN_H
+
+#include "mxm/include/GB_saxpy3task_struct.h"
+
+struct GB_MxmPlan_opaque    // content of GxB_MxmPlan
+{
+    int64_t magic ;         // for detecting uninitialized objects
+    size_t header_size ;    // size of the malloc'd block for this struct, or 0
+    // ---------------------//
+    // saxpy3 analysis:
+    bool analyzed ;         // true if the analysis below is valid
+    GB_saxpy3task_struct *SaxpyTasks ; size_t SaxpyTasks_size ;
+    int ntasks ;            // # of tasks in SaxpyTasks
+    int nfine ;             // # of fine tasks, SaxpyTasks [0:nfine-1]
+    int nthreads ;          // # of threads to use
+    int nthreads_max ;      // max # of threads when the analysis was done
+    GrB_Desc_Value AxB_method ; // saxpy3 method: Default, Gustavson, or Hash
+    int64_t *Cp ; size_t Cp_size ;  // Cp [kk] = nnz (C (:,j)), coarse tasks
+    // ---------------------//
+    // patterns of A and B when the analysis was done:
+    int64_t avlen, avdim, anvec, anz ;
+    bool A_is_hyper ;
+    int64_t *Ap ; size_t Ap_size ;
+    int64_t *Ah ; size_t Ah_size ;
+    int64_t *Ai ; size_t Ai_size ;
+    int64_t bvlen, bvdim, bnvec, bnz ;
+    bool B_is_hyper ;
+    int64_t *Bp ; size_t Bp_size ;
+    int64_t *Bh ; size_t Bh_size ;
+    int64_t *Bi ; size_t Bi_size ;
+} ;
+
+void GB_MxmPlan_clear       // free the analysis held in a plan
+(
+    GxB_MxmPlan plan
+) ;
+
+bool GB_MxmPlan_match       // true if the plan can be used for C=A*B
+(
+    const GxB_MxmPlan plan,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Desc_Value AxB_method
+) ;
+
+GrB_Info GB_MxmPlan_save    // save the saxpy3 analysis of C=A*B in a plan
+(
+    GxB_MxmPlan plan,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Desc_Value AxB_method,
+    const GB_saxpy3task_struct *SaxpyTasks,
+    const int ntasks,
+    const int nfine,
+    const int nthreads,
+    const int64_t *Cp,
+    const int64_t cnvec
+) ;
+
+#endif
+
@@ -289,6 +289,7 @@ GrB_Info GB_colscale                // C = A*D, column scale with diagonal D
             //------------------------------------------------------------------
 
             #include "generic/GB_generic.h"
+            GB_JIT_GENERIC (GB_jit_ewise_family) ;
             GB_BURBLE_MATRIX (C, "(generic C=A*D colscale) ") ;
 
             GxB_binary_function fmult = mult->binop_function ;
@@ -0,0 +1,442 @@
+//------------------------------------------------------------------------------
+// GB_fusedmm: blocked SDDMM followed by SpMM
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Z = accum (Z, (C<S>=X*Y')*W), where C<S>=X*Y' is computed with the sddmm
+// semiring, and C*W with the spmm semiring.  This function is not
+// user-callable.  It does the work for GxB_fusedmm.
+
+// A typical use is a graph attention layer, where S is the adjacency matrix
+// of the graph, X and Y hold the features of each node (one row per node),
+// and W holds the messages to be aggregated.  C has the same pattern as S and
+// is as large as S; the two-step GrB_mxm computation must construct it in
+// full before computing C*W.
+
+// If S is present, not complemented, and sparse or hypersparse, and W is
+// full (or as-if-full), the rows of S are split into blocks of about
+// GB_FUSEDMM_BLOCK entries.  Each block of C<S>=X*Y' is computed by dot3, and
+// then T += C*W is computed in-place into the full matrix T, via saxpy4 or
+// saxpy5.  Only one block of C exists at any one time.  T is initialized to
+// the identity value of the spmm monoid, and rows of T for which C(i,:) is
+// empty are then removed from T, so that the result is identical to the
+// two-step computation.  Otherwise, C<S>=X*Y' is computed in its entirety,
+// followed by Z = accum (Z, C*W).
+
+// This is not a fused kernel: each block is still computed by two separate
+// passes, an SDDMM (dot3) and then an SpMM (saxpy4 or saxpy5), and the block
+// of C is written to memory between them.  Blocking only bounds the size of
+// C; it does not avoid the round trip through memory.
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_Matrix_free (&S_blk) ;                   \
+    GB_Matrix_free (&C) ;                       \
+    GB_Matrix_free (&ST) ;                      \
+    GB_Matrix_free (&XT) ;                      \
+    GB_Matrix_free (&YT) ;                      \
+    GB_Matrix_free (&WT) ;                      \
+    GB_FREE_WORK (&Sp_blk, Sp_blk_size) ;       \
+    GB_FREE_WORK (&Sh_blk, Sh_blk_size) ;       \
+    GB_FREE_WORK (&Rmark, Rmark_size) ;         \
+}
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_FREE_WORKSPACE ;             \
+    GB_Matrix_free (&T) ;           \
+}
+
+#include "mxm/GB_mxm.h"
+#include "transpose/GB_transpose.h"
+#include "mask/GB_accum_mask.h"
+
+// target # of entries in each block of S
+#define GB_FUSEDMM_BLOCK (256 * 1024)
+
+//------------------------------------------------------------------------------
+// GB_fusedmm_by_row: return A held by row, transposing it if needed
+//------------------------------------------------------------------------------
+
+// If A is held by column, AT is constructed with the same content as A but
+// held by row, and AT is returned.  Otherwise A itself is returned.
+
+static GrB_Info GB_fusedmm_by_row
+(
+    GrB_Matrix *A_by_row,           // A, or AT if A is held by column
+    GrB_Matrix AT,                  // static header for AT
+    const GrB_Matrix A,             // input matrix
+    const GrB_Type ctype,           // type of AT
+    const bool iso_one,             // if true, AT is the iso pattern of A
+    GB_Werk Werk
+)
+{
+    if (!A->is_csc)
+    {
+        (*A_by_row) = A ;
+        return (GrB_SUCCESS) ;
+    }
+    // AT = A' held by column is the same as A held by row
+    GrB_Info info = GB_transpose_cast (AT, ctype, true, A, iso_one, Werk) ;
+    if (info != GrB_SUCCESS)
+    {
+        return (info) ;
+    }
+    AT->is_csc = false ;
+    (*A_by_row) = AT ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_fusedmm
+//------------------------------------------------------------------------------
+
+GrB_Info GB_fusedmm                 // Z = accum (Z, (C<S>=X*Y')*W)
+(
+    GrB_Matrix Z,                   // input/output matrix for results
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(Z,T)
+    const GrB_Matrix S_input,       // optional mask for C, unused if NULL
+    const bool Mask_comp,           // if true, use !S
+    const bool Mask_struct,         // if true, use the only structure of S
+    const GrB_Semiring sddmm,       // defines '+' and '*' for C=X*Y'
+    const GrB_Matrix X,             // input matrix
+    const GrB_Matrix Y,             // input matrix
+    const GrB_Semiring spmm,        // defines '+' and '*' for T=C*W
+    const GrB_Matrix W,             // input matrix
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+
+    struct GB_Matrix_opaque S_blk_header, C_header, T_header, ST_header,
+        XT_header, YT_header, WT_header ;
+    GrB_Matrix S_blk = NULL, C = NULL, T = NULL, ST = NULL, XT = NULL,
+        YT = NULL, WT = NULL ;
+    int64_t *restrict Sp_blk = NULL ; size_t Sp_blk_size = 0 ;
+    int64_t *restrict Sh_blk = NULL ; size_t Sh_blk_size = 0 ;
+    int8_t  *restrict Rmark  = NULL ; size_t Rmark_size  = 0 ;
+
+    GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (sddmm) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (spmm) ;
+
+    ASSERT_MATRIX_OK (Z, "Z input for GB_fusedmm", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (S_input, "S for GB_fusedmm", GB0) ;
+    ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_fusedmm", GB0) ;
+    ASSERT_SEMIRING_OK (sddmm, "sddmm for GB_fusedmm", GB0) ;
+    ASSERT_SEMIRING_OK (spmm, "spmm for GB_fusedmm", GB0) ;
+    ASSERT_MATRIX_OK (X, "X for GB_fusedmm", GB0) ;
+    ASSERT_MATRIX_OK (Y, "Y for GB_fusedmm", GB0) ;
+    ASSERT_MATRIX_OK (W, "W for GB_fusedmm", GB0) ;
+
+    // check domains for Z = accum (Z,T)
+    GrB_Monoid add = spmm->add ;
+    GrB_Type ztype = add->op->ztype ;
+    GrB_Type ctype = sddmm->add->op->ztype ;
+    GB_OK (GB_compatible (Z->type, Z, NULL, false, accum, ztype, Werk)) ;
+
+    // check domains of the mask
+    if (S_input != NULL && !Mask_struct &&
+        !GB_Type_compatible (S_input->type, GrB_BOOL))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH, "Mask of type [%s] cannot be typecast "
+            "to boolean", S_input->type->name) ;
+    }
+
+    // C=X*Y' and T=C*W: the inputs must be compatible with each semiring
+    GB_OK (GB_BinaryOp_compatible (sddmm->multiply,
+        NULL, X->type, Y->type, GB_ignore_code, Werk)) ;
+    GB_OK (GB_BinaryOp_compatible (spmm->multiply,
+        NULL, ctype, W->type, GB_ignore_code, Werk)) ;
+
+    // check the dimensions
+    int64_t m = GB_NROWS (X) ;
+    int64_t k = GB_NCOLS (X) ;
+    int64_t n = GB_NROWS (Y) ;
+    int64_t d = GB_NCOLS (W) ;
+    if (GB_NCOLS (Y) != k || GB_NROWS (W) != n ||
+        GB_NROWS (Z) != m || GB_NCOLS (Z) != d || (S_input != NULL &&
+        (GB_NROWS (S_input) != m || GB_NCOLS (S_input) != n)))
+    {
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "Dimensions not compatible:\n"
+            "output is " GBd "-by-" GBd "\n"
+            "mask is " GBd "-by-" GBd "\n"
+            "X is " GBd "-by-" GBd "\n"
+            "Y is " GBd "-by-" GBd "\n"
+            "W is " GBd "-by-" GBd,
+            GB_NROWS (Z), GB_NCOLS (Z),
+            (S_input == NULL) ? m : GB_NROWS (S_input),
+            (S_input == NULL) ? n : GB_NCOLS (S_input),
+            m, k, n, GB_NCOLS (Y), GB_NROWS (W), d) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finish any pending work
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix S = S_input ;
+    GB_MATRIX_WAIT (S) ;
+    GB_MATRIX_WAIT (X) ;
+    GB_MATRIX_WAIT (Y) ;
+    GB_MATRIX_WAIT (W) ;
+
+    //--------------------------------------------------------------------------
+    // Z = accum (Z, (C<S>=X*Y')*W) via two calls to GB_mxm
+    //--------------------------------------------------------------------------
+
+    if (!GB_AxB_dot3_control (S, Mask_comp) || !GB_as_if_full (W) ||
+        m == 0 || n == 0 || d == 0 || add->op->opcode == GB_ANY_binop_code)
+    {
+
+        // The mask is not present, or complemented, or bitmap/full, or W is
+        // not full.  The rows of C cannot be computed in independent blocks
+        // in these cases.  The ANY monoid has no identity value with which
+        // to initialize T.
+        GBURBLE ("(fusedmm: C=X*Y' then Z=C*W) ") ;
+        GB_CLEAR_STATIC_HEADER (C, &C_header) ;
+        GB_OK (GB_new (&C, // auto sparsity, existing header
+            ctype, m, n, GB_Ap_calloc, true, GxB_AUTO_SPARSITY,
+            GB_Global_hyper_switch_get ( ), 1)) ;
+        GB_OK (GB_mxm (C, false, S, Mask_comp, Mask_struct, NULL, sddmm,
+            X, false, Y, true, false, AxB_method, 0, NULL, Werk)) ;
+        GB_OK (GB_mxm (Z, false, NULL, false, false, accum, spmm,
+            C, false, W, false, false, AxB_method, 0, NULL, Werk)) ;
+        GB_FREE_WORKSPACE ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // hold S, X, Y, and W by row
+    //--------------------------------------------------------------------------
+
+    // Each block of C<S>=X*Y' is a set of rows of C, computed by dot3 with no
+    // explicit transpose of X and Y if all three matrices are held by row.
+    // T += C*W is then computed in-place with no transpose if T and W are
+    // also held by row.  Any matrix held by column is transposed once here,
+    // rather than once for each block.
+
+    GB_CLEAR_STATIC_HEADER (ST, &ST_header) ;
+    GB_CLEAR_STATIC_HEADER (XT, &XT_header) ;
+    GB_CLEAR_STATIC_HEADER (YT, &YT_header) ;
+    GB_CLEAR_STATIC_HEADER (WT, &WT_header) ;
+    GB_OK (GB_fusedmm_by_row (&S, ST, S, Mask_struct ? GrB_BOOL : S->type,
+        Mask_struct, Werk)) ;
+    if (S == ST)
+    { 
+        GB_ENSURE_SPARSE (ST) ;
+    }
+    GrB_Matrix X_by_row, Y_by_row, W_by_row ;
+    GB_OK (GB_fusedmm_by_row (&X_by_row, XT, X, X->type, false, Werk)) ;
+    GB_OK (GB_fusedmm_by_row (&Y_by_row, YT, Y, Y->type, false, Werk)) ;
+    GB_OK (GB_fusedmm_by_row (&W_by_row, WT, W, W->type, false, Werk)) ;
+    ASSERT (!S->is_csc && (GB_IS_SPARSE (S) || GB_IS_HYPERSPARSE (S))) ;
+
+    //--------------------------------------------------------------------------
+    // allocate T and workspace
+    //--------------------------------------------------------------------------
+
+    // T is m-by-d, full, held by row, with all entries equal to the identity
+    // value of the spmm monoid
+    size_t zsize = ztype->size ;
+    GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+    GB_OK (GB_new_bix (&T, // full, existing header
+        ztype, d, m, GB_Ap_null, false, GxB_FULL, false,
+        GB_HYPER_SWITCH_DEFAULT, -1, 1, true, true)) ;
+    memcpy (T->x, add->identity, zsize) ;
+    T->magic = GB_MAGIC ;
+    GB_OK (GB_convert_any_to_non_iso (T, true)) ;
+
+    const int64_t *restrict Sp = S->p ;
+    const int64_t *restrict Sh = S->h ;
+    const int64_t snvec = S->nvec ;
+    size_t ssize = S->type->size ;
+
+    Sp_blk = GB_MALLOC_WORK (snvec + 1, int64_t, &Sp_blk_size) ;
+    Sh_blk = GB_MALLOC_WORK (snvec, int64_t, &Sh_blk_size) ;
+    Rmark  = GB_CALLOC_WORK (m, int8_t, &Rmark_size) ;
+    if (Sp_blk == NULL || Sh_blk == NULL || Rmark == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    GB_CLEAR_STATIC_HEADER (S_blk, &S_blk_header) ;
+    GB_CLEAR_STATIC_HEADER (C, &C_header) ;
+
+    //--------------------------------------------------------------------------
+    // T += (C<S>=X*Y')*W, one block of rows at a time
+    //--------------------------------------------------------------------------
+
+    int64_t nblocks = 0 ;
+    int64_t kfirst = 0 ;
+    while (kfirst < snvec)
+    {
+
+        //----------------------------------------------------------------------
+        // find the rows S(kfirst:klast-1,:) of the next block
+        //----------------------------------------------------------------------
+
+        int64_t pstart = Sp [kfirst] ;
+        int64_t klast = kfirst + 1 ;
+        while (klast < snvec && Sp [klast+1] - pstart <= GB_FUSEDMM_BLOCK)
+        {
+            klast++ ;
+        }
+        int64_t nblk = klast - kfirst ;
+        int64_t snz = Sp [klast] - pstart ;
+        if (snz == 0)
+        {
+            // no work to do for this block
+            kfirst = klast ;
+            continue ;
+        }
+        nblocks++ ;
+
+        //----------------------------------------------------------------------
+        // construct S_blk, a hypersparse shallow view of the block
+        //----------------------------------------------------------------------
+
+        for (int64_t kk = 0 ; kk < nblk ; kk++)
+        {
+            Sp_blk [kk] = Sp [kfirst + kk] - pstart ;
+            Sh_blk [kk] = GBH (Sh, kfirst + kk) ;
+        }
+        Sp_blk [nblk] = snz ;
+
+        // copy the header of S, but not its static_header status
+        bool S_blk_static_header = S_blk->static_header ;
+        size_t S_blk_header_size = S_blk->header_size ;
+        memcpy (S_blk, S, sizeof (struct GB_Matrix_opaque)) ;
+        S_blk->static_header = S_blk_static_header ;
+        S_blk->header_size = S_blk_header_size ;
+        S_blk->user_name = NULL ;
+        S_blk->user_name_size = 0 ;
+        S_blk->Y = NULL ;
+        S_blk->Y_shallow = false ;
+
+        // S_blk->p and S_blk->h are workspace owned by this method; S_blk->i
+        // and S_blk->x are slices of S->i and S->x
+        S_blk->p = Sp_blk ; S_blk->p_size = (nblk + 1) * sizeof (int64_t) ;
+        S_blk->h = Sh_blk ; S_blk->h_size = nblk * sizeof (int64_t) ;
+        S_blk->i = S->i + pstart ; S_blk->i_size = snz * sizeof (int64_t) ;
+        S_blk->x = S->iso ? S->x : ((GB_void *) S->x) + pstart * ssize ;
+        S_blk->x_size = S->iso ? ssize : (snz * ssize) ;
+        S_blk->p_shallow = true ;
+        S_blk->h_shallow = true ;
+        S_blk->i_shallow = true ;
+        S_blk->x_shallow = true ;
+        S_blk->nvec = nblk ;
+        S_blk->plen = nblk ;
+        S_blk->nvec_nonempty = -1 ;
+        S_blk->nvals = snz ;
+        ASSERT_MATRIX_OK (S_blk, "S_blk for GB_fusedmm", GB0) ;
+        ASSERT (GB_IS_HYPERSPARSE (S_blk)) ;
+
+        //----------------------------------------------------------------------
+        // C<S_blk> = X*Y', via dot3
+        //----------------------------------------------------------------------
+
+        GB_OK (GB_new (&C, // sparse or hyper, existing header
+            ctype, n, m, GB_Ap_calloc, false, GxB_HYPERSPARSE,
+            GB_Global_hyper_switch_get ( ), 1)) ;
+        C->sparsity_control = GxB_SPARSE + GxB_HYPERSPARSE ;
+        GB_OK (GB_mxm (C, false, S_blk, false, Mask_struct, NULL, sddmm,
+            X_by_row, false, Y_by_row, true, false, AxB_method, 0, NULL,
+            Werk)) ;
+        GB_MATRIX_WAIT (C) ;
+        ASSERT (!C->is_csc && (GB_IS_SPARSE (C) || GB_IS_HYPERSPARSE (C))) ;
+
+        //----------------------------------------------------------------------
+        // mark the rows of T that appear in the result
+        //----------------------------------------------------------------------
+
+        const int64_t *restrict Cp = C->p ;
+        const int64_t *restrict Ch = C->h ;
+        const int64_t cnvec = C->nvec ;
+        int nthreads = GB_nthreads (cnvec, chunk, nthreads_max) ;
+        int64_t kC ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (kC = 0 ; kC < cnvec ; kC++)
+        {
+            if (Cp [kC+1] > Cp [kC])
+            {
+                Rmark [GBH (Ch, kC)] = 1 ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // T += C*W, in-place
+        //----------------------------------------------------------------------
+
+        GB_OK (GB_mxm (T, false, NULL, false, false, add->op, spmm,
+            C, false, W_by_row, false, false, AxB_method, 0, NULL, Werk)) ;
+        ASSERT (GB_IS_FULL (T)) ;
+
+        //----------------------------------------------------------------------
+        // free the block
+        //----------------------------------------------------------------------
+
+        GB_Matrix_free (&C) ;
+        GB_CLEAR_STATIC_HEADER (C, &C_header) ;
+        // S_blk is all shallow; this frees only S_blk->Y, if constructed
+        GB_phybix_free (S_blk) ;
+        kfirst = klast ;
+    }
+
+    GBURBLE ("(fusedmm: " GBd " blocks) ", nblocks) ;
+
+    //--------------------------------------------------------------------------
+    // remove the rows of T that do not appear in the result
+    //--------------------------------------------------------------------------
+
+    int64_t nrows_present = 0 ;
+    int nthreads = GB_nthreads (m, chunk, nthreads_max) ;
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nrows_present)
+    for (i = 0 ; i < m ; i++)
+    {
+        nrows_present += Rmark [i] ;
+    }
+
+    if (nrows_present < m)
+    {
+        // T(i,:) is empty if C(i,:) is empty, since W is full
+        GB_OK (GB_convert_any_to_bitmap (T, Werk)) ;
+        int8_t *restrict Tb = T->b ;
+        nthreads = GB_nthreads (m * d, chunk, nthreads_max) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (i = 0 ; i < m ; i++)
+        {
+            if (!Rmark [i])
+            {
+                memset (Tb + i * d, 0, d) ;
+            }
+        }
+        T->nvals = nrows_present * d ;
+    }
+
+    ASSERT_MATRIX_OK (T, "T for GB_fusedmm", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // Z = accum (Z,T), which frees T
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    return (GB_accum_mask (Z, NULL, NULL, accum, &T, false, false, false,
+        Werk)) ;
+}
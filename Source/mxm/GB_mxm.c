@@ -10,7 +10,7 @@
 // C<M> = accum (C,A*B) and variations.
 
 // This function is not user-callable.  It does the work for user-callable
-// functions GrB_mxm, GrB_mxv, and GrB_vxm.
+// functions GrB_mxm, GrB_mxv, GrB_vxm, and GxB_MxmPlan_execute.
 
 #define GB_FREE_ALL         \
 {                           \
@@ -37,6 +37,7 @@ GrB_Info GB_mxm                     // C<M> = A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
     const int do_sort,              // if nonzero, try to return C unjumbled
+    GxB_MxmPlan plan,               // optional plan for T=A*B, or NULL
     GB_Werk Werk
 )
 {
@@ -138,13 +139,24 @@ GrB_Info GB_mxm                     // C<M> = A*B
     GB_CLEAR_STATIC_HEADER (MT, &MT_header) ;
     GB_CLEAR_STATIC_HEADER (T, &T_header) ;
 
+    // If a plan is used, T=A*B is computed without the mask, so that the
+    // pattern of T does not depend on M, and C is not computed in-place.  The
+    // mask is then applied by GB_accum_mask, below.
+    GrB_Matrix C_AxB = C ;
+    GrB_Matrix M_AxB = M ;
+    if (plan != NULL && M != NULL)
+    { 
+        C_AxB = NULL ;
+        M_AxB = NULL ;
+    }
+
     bool mask_applied = false ;
     bool done_in_place = false ;
     bool M_transposed = false ;
-    GB_OK (GB_AxB_meta (T, C, C_replace, C->is_csc, MT, &M_transposed, M,
-        Mask_comp, Mask_struct, accum, A, B, semiring, A_transpose,
-        B_transpose, flipxy, &mask_applied, &done_in_place, AxB_method,
-        do_sort, Werk)) ;
+    GB_OK (GB_AxB_meta (T, C_AxB, C_replace, C->is_csc, MT, &M_transposed,
+        M_AxB, Mask_comp && (M_AxB != NULL), Mask_struct, accum, A, B,
+        semiring, A_transpose, B_transpose, flipxy, &mask_applied,
+        &done_in_place, AxB_method, do_sort, plan, Werk)) ;
 
     if (done_in_place)
     { 
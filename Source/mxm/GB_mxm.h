@@ -30,6 +30,40 @@ GrB_Info GB_mxm                     // C<M> = A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
     const int do_sort,              // if nonzero, try to return C unjumbled
+    GxB_MxmPlan plan,               // optional plan for T=A*B, or NULL
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_mxm_reduce              // s or w = accum (s or w, reduce (A*B))
+(
+    GrB_Scalar s,                   // input/output scalar for the result
+    GrB_Vector w,                   // input/output vector for the result
+    const GrB_Matrix M_input,       // optional mask for C, unused if NULL
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_fusedmm                 // Z = accum (Z, (C<S>=X*Y')*W)
+(
+    GrB_Matrix Z,                   // input/output matrix for results
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(Z,T)
+    const GrB_Matrix S_input,       // optional mask for C, unused if NULL
+    const bool Mask_comp,           // if true, use !S
+    const bool Mask_struct,         // if true, use the only structure of S
+    const GrB_Semiring sddmm,       // defines '+' and '*' for C=X*Y'
+    const GrB_Matrix X,             // input matrix
+    const GrB_Matrix Y,             // input matrix
+    const GrB_Semiring spmm,        // defines '+' and '*' for T=C*W
+    const GrB_Matrix W,             // input matrix
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
     GB_Werk Werk
 ) ;
 
@@ -72,6 +106,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     bool *done_in_place,            // if true, C was computed in-place
     GrB_Desc_Value AxB_method,      // for auto vs user selection of methods
     const int do_sort,              // if nonzero, try to return C unjumbled
+    GxB_MxmPlan plan,               // optional plan for T=A*B, or NULL
     GB_Werk Werk
 ) ;
 
@@ -130,6 +165,32 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_AxB_bitpack             // C=A*B or C=A'*B, bit-packed boolean
+(
+    GrB_Matrix C,                   // output matrix, static header
+    const bool C_iso,               // true if C is iso
+    const GB_void *cscalar,         // iso value of C
+    const GrB_Matrix M,             // mask matrix; method not used if present
+    const bool A_transposed,        // if true, C=A'*B, else C=A*B
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_AxB_dot2_fine           // C=A'*B via fine-grain dot products
+(
+    GrB_Matrix C,                   // output matrix, bitmap or full
+    const GrB_Matrix A,             // input matrix, not hypersparse
+    const GrB_Matrix B,             // input matrix, not hypersparse
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    const int nfine,                // # of tasks for each dot product
+    const int nthreads,             // # of threads to use
+    const bool use_generic          // if true, use the generic kernel
+) ;
+
 bool GB_is_diagonal             // true if A is diagonal
 (
     const GrB_Matrix A          // input matrix to examine
@@ -149,6 +210,31 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_AxB_dot3_reduce         // s = reduce (C<M>=A'*B)
+(
+    GB_void *s,                     // output scalar, of type add->op->ztype
+    bool *s_exists,                 // true if C<M>=A'*B has any entries
+    const GrB_Matrix M,             // mask matrix
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B and s
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_AxB_dot3_rowreduce      // T = rowreduce (C<M>=A'*B)
+(
+    GrB_Matrix T,                   // output vector, static header
+    const GrB_Matrix M,             // mask matrix
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B and T
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_AxB_dot3_slice
 (
     // output:
@@ -0,0 +1,311 @@
+//------------------------------------------------------------------------------
+// GB_mxm_reduce: reduce a masked matrix-matrix product to a scalar or vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// s = accum (s, reduce (C<M>=A*B)), or w = accum (w, rowreduce (C<M>=A*B)),
+// where the reduction uses the monoid of the semiring, and where w(i) is the
+// reduction of C(i,:).  Exactly one of s or w is non-NULL.  This function is
+// not user-callable.  It does the work for GxB_mxm_reduce and
+// GxB_mxm_reduce_Vector.
+
+// If M is present, not complemented, and sparse or hypersparse, the result is
+// computed by GB_AxB_dot3_reduce or GB_AxB_dot3_rowreduce, which do not
+// construct C.  Otherwise, the matrix T<M>=A*B is computed by GB_mxm, and
+// then reduced to the scalar or vector.
+
+// A typical use is triangle counting, with s = sum (L.*(L*L')) computed as
+// GxB_mxm_reduce (s, NULL, L, GxB_PLUS_PAIR_INT64, L, L, GrB_DESC_ST1).  The
+// local clustering coefficient needs the # of triangles incident on each
+// node, w = sum (A.*(A*A'), 2), computed with GxB_mxm_reduce_Vector.
+
+#define GB_FREE_WORKSPACE       \
+{                               \
+    GB_Matrix_free (&AT) ;      \
+    GB_Matrix_free (&BT) ;      \
+    GB_Matrix_free (&MT) ;      \
+    GB_Matrix_free (&T) ;       \
+}
+
+#define GB_FREE_ALL GB_FREE_WORKSPACE
+
+#include "mxm/GB_mxm.h"
+#include "binaryop/GB_binop.h"
+#include "transpose/GB_transpose.h"
+#include "reduce/GB_reduce.h"
+#include "mask/GB_accum_mask.h"
+
+GrB_Info GB_mxm_reduce              // s or w = accum (s or w, reduce (A*B))
+(
+    GrB_Scalar s,                   // input/output scalar for the result
+    GrB_Vector w,                   // input/output vector for the result
+    const GrB_Matrix M_input,       // optional mask for C, unused if NULL
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+
+    struct GB_Matrix_opaque AT_header, BT_header, MT_header, T_header ;
+    GrB_Matrix AT = NULL, BT = NULL, MT = NULL, T = NULL ;
+
+    GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+
+    ASSERT ((s == NULL) != (w == NULL)) ;
+    ASSERT_SCALAR_OK_OR_NULL (s, "s input for GB_mxm_reduce", GB0) ;
+    ASSERT_VECTOR_OK_OR_NULL (w, "w input for GB_mxm_reduce", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (M_input, "M for GB_mxm_reduce", GB0) ;
+    ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_mxm_reduce", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for GB_mxm_reduce", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for GB_mxm_reduce", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for GB_mxm_reduce", GB0) ;
+
+    // check domains for s = accum (s,t) or w = accum (w,t)
+    GrB_Monoid add = semiring->add ;
+    GrB_Type ztype = add->op->ztype ;
+    size_t zsize = ztype->size ;
+    GrB_Type outtype = (s != NULL) ? s->type : w->type ;
+    GB_OK (GB_compatible (outtype, NULL, NULL, false, accum, ztype, Werk)) ;
+
+    // check domains of the mask
+    if (M_input != NULL && !Mask_struct &&
+        !GB_Type_compatible (M_input->type, GrB_BOOL))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH, "Mask of type [%s] cannot be typecast "
+            "to boolean", M_input->type->name) ;
+    }
+
+    // C=A*B via semiring: A and B must be compatible with semiring->multiply
+    GB_OK (GB_BinaryOp_compatible (semiring->multiply,
+        NULL, A->type, B->type, GB_ignore_code, Werk)) ;
+
+    // check the dimensions
+    int64_t anrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    int64_t ancols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    int64_t bnrows = (B_transpose) ? GB_NCOLS (B) : GB_NROWS (B) ;
+    int64_t bncols = (B_transpose) ? GB_NROWS (B) : GB_NCOLS (B) ;
+    if (ancols != bnrows || (M_input != NULL &&
+        (GB_NROWS (M_input) != anrows || GB_NCOLS (M_input) != bncols)))
+    {
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "Dimensions not compatible:\n"
+            "mask is " GBd "-by-" GBd "\n"
+            "first input is " GBd "-by-" GBd "%s\n"
+            "second input is " GBd "-by-" GBd "%s",
+            (M_input == NULL) ? anrows : GB_NROWS (M_input),
+            (M_input == NULL) ? bncols : GB_NCOLS (M_input),
+            anrows, ancols, A_transpose ? " (transposed)" : "",
+            bnrows, bncols, B_transpose ? " (transposed)" : "") ;
+    }
+    if (w != NULL && GB_NROWS (w) != anrows)
+    {
+        GB_ERROR (GrB_DIMENSION_MISMATCH, "Dimensions not compatible:\n"
+            "output is " GBd "-by-1\n"
+            "first input is " GBd "-by-" GBd "%s",
+            GB_NROWS (w), anrows, ancols, A_transpose ? " (transposed)" : "") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finish any pending work
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix M = M_input ;
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (M) ;
+    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT (B) ;
+
+    //--------------------------------------------------------------------------
+    // s or w = accum (s or w, reduce (C<M>=A*B)) via GB_mxm and GB_*reduce*
+    //--------------------------------------------------------------------------
+
+    if (!GB_AxB_dot3_control (M, Mask_comp) || ancols == 0)
+    {
+
+        // The mask is not present, or complemented, or bitmap/full.  The
+        // fused method cannot exploit the mask in these cases, so construct
+        // T<M>=A*B and reduce it to the scalar or vector.
+        GBURBLE ("(mxm_reduce: T=A*B then reduce) ") ;
+        GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+        GB_OK (GB_new (&T, // auto sparsity, existing header
+            ztype, anrows, bncols, GB_Ap_calloc, true, GxB_AUTO_SPARSITY,
+            GB_Global_hyper_switch_get ( ), 1)) ;
+        GB_OK (GB_mxm (T, false, M, Mask_comp, Mask_struct, NULL, semiring,
+            A, A_transpose, B, B_transpose, false, AxB_method, 0, NULL, Werk)) ;
+        if (s != NULL)
+        { 
+            GB_OK (GB_Scalar_reduce (s, accum, add, T, Werk)) ;
+        }
+        else
+        { 
+            GB_OK (GB_reduce_to_vector ((GrB_Matrix) w, NULL, accum, add, T,
+                NULL, Werk)) ;
+        }
+        GB_FREE_WORKSPACE ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // handle the CSR/CSC formats of M, A, and B
+    //--------------------------------------------------------------------------
+
+    // The scalar s does not depend on the format of C, so C is computed in the
+    // same format as M, and M is never transposed.  If M is held by row, then
+    // C' is computed instead, with C'<M'> = B'*A' and the multiplicative
+    // operator flipped.  In either case, dot3 computes C<M>=X'*Y, and X and Y
+    // are transposed explicitly only if they are not already in that form.
+
+    // The vector w = rowreduce (C) reduces each row of C, so M must be held by
+    // row, with each row of C computed by a single vector of C'<M'> = B'*A'.
+    // If M is held by column, it is transposed first.
+
+    // A is used as A' if A_transpose is true, or if A is held by row (but not
+    // both); likewise for B.
+    bool A_is_transposed = (A->is_csc) ? A_transpose : !A_transpose ;
+    bool B_is_transposed = (B->is_csc) ? B_transpose : !B_transpose ;
+    bool flipxy ;
+    bool X_transpose, Y_transpose ;
+    GrB_Matrix X, Y ;
+    bool M_is_csc = M->is_csc ;
+
+    if (w != NULL && M_is_csc)
+    { 
+        // MT = M', so that the vectors of MT are the rows of C.  If the mask
+        // is structural, only the pattern of M is needed.
+        GBURBLE ("(M transpose) ") ;
+        GB_CLEAR_STATIC_HEADER (MT, &MT_header) ;
+        GB_OK (GB_transpose_cast (MT, Mask_struct ? GrB_BOOL : M->type, true,
+            M, Mask_struct, Werk)) ;
+        M = MT ;
+        M_is_csc = false ;
+    }
+
+    if (M_is_csc)
+    {
+        // C<M> = A*B = X'*Y with X = A' and Y = B
+        X = A ; X_transpose = !A_is_transposed ;
+        Y = B ; Y_transpose = B_is_transposed ;
+        flipxy = false ;
+    }
+    else
+    {
+        // C'<M'> = B'*A' = X'*Y with X = B and Y = A'
+        X = B ; X_transpose = B_is_transposed ;
+        Y = A ; Y_transpose = !A_is_transposed ;
+        flipxy = true ;
+    }
+
+    // finalize the semiring after flipping the binary multiplicative operator
+    struct GB_Semiring_opaque semiring_struct ;
+    GrB_Semiring S = &semiring_struct ;
+    memcpy (S, semiring, sizeof (struct GB_Semiring_opaque)) ;
+    S->header_size = 0 ;
+    S->multiply = GB_flip_binop (semiring->multiply, &flipxy) ;
+
+    GB_Opcode opcode = S->multiply->opcode ;
+    bool op_is_positional = GB_OPCODE_IS_POSITIONAL (opcode) ;
+    bool op_is_first  = (opcode == GB_FIRST_binop_code) ;
+    bool op_is_second = (opcode == GB_SECOND_binop_code) ;
+    bool op_is_pair   = (opcode == GB_PAIR_binop_code) ;
+    bool X_is_pattern = !flipxy && (op_is_second || op_is_pair ||
+        op_is_positional) ;
+    bool Y_is_pattern = !flipxy && (op_is_first  || op_is_pair ||
+        op_is_positional) ;
+    GrB_Type xtype_cast = flipxy ? S->multiply->ytype : S->multiply->xtype ;
+    GrB_Type ytype_cast = flipxy ? S->multiply->xtype : S->multiply->ytype ;
+
+    if (X_transpose)
+    {
+        // X = X', or X = one (X') if only the pattern of X is needed
+        GBURBLE ("(A transpose) ") ;
+        GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
+        GB_OK (GB_transpose_cast (AT, xtype_cast, true, X, X_is_pattern,
+            Werk)) ;
+        X = AT ;
+    }
+
+    if (Y_transpose)
+    {
+        // Y = Y', or Y = one (Y') if only the pattern of Y is needed
+        GBURBLE ("(B transpose) ") ;
+        GB_CLEAR_STATIC_HEADER (BT, &BT_header) ;
+        GB_OK (GB_transpose_cast (BT, ytype_cast, true, Y, Y_is_pattern,
+            Werk)) ;
+        Y = BT ;
+    }
+
+    //--------------------------------------------------------------------------
+    // w = accum (w, rowreduce (C<M>=X'*Y)), without forming C
+    //--------------------------------------------------------------------------
+
+    if (w != NULL)
+    { 
+        // T(i) = reduce (C(i,:)), as a bitmap vector
+        GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+        GB_OK (GB_AxB_dot3_rowreduce (T, M, Mask_struct, X, Y, S, flipxy,
+            Werk)) ;
+        GB_Matrix_free (&AT) ;
+        GB_Matrix_free (&BT) ;
+        GB_Matrix_free (&MT) ;
+        // w = accum (w,T), which frees T
+        return (GB_accum_mask ((GrB_Matrix) w, NULL, NULL, accum, &T, false,
+            false, false, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // t = reduce (C<M>=X'*Y), without forming C
+    //--------------------------------------------------------------------------
+
+    GB_void t [GB_VLA(zsize)] ;
+    bool t_exists = false ;
+    GB_OK (GB_AxB_dot3_reduce (t, &t_exists, M, Mask_struct, X, Y, S, flipxy,
+        Werk)) ;
+    GB_FREE_WORKSPACE ;
+
+    //--------------------------------------------------------------------------
+    // s = accum (s,t)
+    //--------------------------------------------------------------------------
+
+    if (!t_exists)
+    {
+        // no work to do, except to clear s if there is no accum operator
+        if (accum == NULL)
+        {
+            GB_OK (GB_clear ((GrB_Matrix) s, Werk)) ;
+        }
+        return (GrB_SUCCESS) ;
+    }
+
+    // T is a 1-by-1 iso full matrix with a static header that holds t.  It
+    // contains no dynamically-allocated content and does not need to be freed.
+    GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+    info = GB_new (&T, // full, existing header
+        ztype, 1, 1, GB_Ap_null, true, GxB_FULL, GB_NEVER_HYPER, 1) ;
+    ASSERT (info == GrB_SUCCESS) ;
+    T->magic = GB_MAGIC ;
+    T->iso = true ;             // OK: T is a temporary matrix; no burble
+    T->x = t ;
+    T->x_shallow = true ;
+    T->x_size = zsize ;
+    ASSERT_MATRIX_OK (T, "T for GB_mxm_reduce", GB0) ;
+    info = GB_Scalar_reduce (s, accum, add, T, Werk) ;
+    return (info) ;
+}
+
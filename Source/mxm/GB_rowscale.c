@@ -273,6 +273,7 @@ GrB_Info GB_rowscale                // C = D*B, row scale with diagonal D
             //------------------------------------------------------------------
 
             #include "generic/GB_generic.h"
+            GB_JIT_GENERIC (GB_jit_ewise_family) ;
             GB_BURBLE_MATRIX (C, "(generic C=D*B rowscale) ") ;
 
             GxB_binary_function fmult = mult->binop_function ;
@@ -60,6 +60,7 @@ GrB_Info GrB_mxm                    // C<M> = accum (C, A*B)
         B,          B_transpose,    // B matrix and its descriptor
         false,                      // use fmult(x,y), flipxy = false
         AxB_method, do_sort,        // algorithm selector
+        NULL,                       // no plan
         Werk) ;
 
     GB_BURBLE_END ;
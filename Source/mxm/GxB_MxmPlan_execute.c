@@ -0,0 +1,77 @@
+//------------------------------------------------------------------------------
+// GxB_MxmPlan_execute: matrix-matrix multiply, reusing a symbolic analysis
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M> = accum (C,A*B) and variations, identical to GrB_mxm, except that the
+// symbolic analysis of T=A*B done by the saxpy3 method is kept in the plan.
+// The next call with the same plan reuses the analysis, if the patterns of A
+// and B have not changed, and skips the flop count, task construction, and
+// symbolic phases of saxpy3.  Only the numeric phase is done.  If the patterns
+// have changed, the analysis is redone and saved in the plan.
+
+// The mask M is not used to compute T=A*B when a plan is used, since the
+// pattern of T would then depend on M.  Instead, the mask is applied when T
+// is accumulated into C.
+
+#include "mxm/GB_mxm.h"
+#include "mask/GB_get_mask.h"
+#include "mxm/GB_MxmPlan.h"
+
+GrB_Info GxB_MxmPlan_execute        // C<M> = accum (C, A*B), using a plan
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix M_in,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for T=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc,      // descriptor for C, M, A, and B
+    GxB_MxmPlan plan                // analysis of T=A*B, updated on output
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_MxmPlan_execute (C, M, accum, semiring, A, B, desc, "
+        "plan)") ;
+    GB_BURBLE_START ("GxB_MxmPlan_execute") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (plan) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, B_transpose, AxB_method, do_sort) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C,A*B) and variations, using the mxm kernel and the plan
+    //--------------------------------------------------------------------------
+
+    info = GB_mxm (
+        C,          C_replace,      // C matrix and its descriptor
+        M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
+        accum,                      // for accum (C,T)
+        semiring,                   // semiring that defines T=A*B
+        A,          A_transpose,    // A matrix and its descriptor
+        B,          B_transpose,    // B matrix and its descriptor
+        false,                      // use fmult(x,y), flipxy = false
+        AxB_method, do_sort,        // algorithm selector
+        plan,                       // analysis of T=A*B
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,38 @@
+//------------------------------------------------------------------------------
+// GxB_MxmPlan_free: free a plan
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+#include "mxm/GB_MxmPlan.h"
+
+GrB_Info GxB_MxmPlan_free           // free a plan
+(
+    GxB_MxmPlan *plan_handle        // handle of plan to free
+)
+{
+
+    if (plan_handle != NULL)
+    {
+        GxB_MxmPlan plan = *plan_handle ;
+        if (plan != NULL)
+        {
+            size_t header_size = plan->header_size ;
+            if (header_size > 0)
+            { 
+                // free the analysis and the plan itself
+                GB_MxmPlan_clear (plan) ;
+                plan->magic = GB_FREED ;  // to help detect dangling pointers
+                plan->header_size = 0 ;
+                GB_FREE (plan_handle, header_size) ;
+            }
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
+
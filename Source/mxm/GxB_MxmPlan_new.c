@@ -0,0 +1,52 @@
+//------------------------------------------------------------------------------
+// GxB_MxmPlan_new: create a new plan for repeated matrix multiplies
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The plan is created empty.  The analysis is done by the first call to
+// GxB_MxmPlan_execute that uses it.
+
+#include "GB.h"
+#include "mxm/GB_MxmPlan.h"
+
+GrB_Info GxB_MxmPlan_new            // create a new plan
+(
+    GxB_MxmPlan *plan_handle        // handle of plan to create
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_MxmPlan_new (&plan)") ;
+    GB_RETURN_IF_NULL (plan_handle) ;
+    (*plan_handle) = NULL ;
+    GxB_MxmPlan plan = NULL ;
+
+    //--------------------------------------------------------------------------
+    // create the plan
+    //--------------------------------------------------------------------------
+
+    // allocate the plan, with all of its contents zero and NULL
+    size_t header_size ;
+    plan = GB_CALLOC (1, struct GB_MxmPlan_opaque, &header_size) ;
+    if (plan == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    plan->magic = GB_MAGIC ;
+    plan->header_size = header_size ;
+    plan->analyzed = false ;
+
+    // return the result
+    (*plan_handle) = plan ;
+    return (GrB_SUCCESS) ;
+}
+
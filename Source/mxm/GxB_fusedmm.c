@@ -0,0 +1,73 @@
+//------------------------------------------------------------------------------
+// GxB_fusedmm: blocked SDDMM followed by SpMM
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Z = accum (Z, (C<S>=X*Y')*W), where C<S>=X*Y' uses the sddmm semiring and
+// C*W uses the spmm semiring.  The result is identical to two calls to
+// GrB_mxm, but C is computed and consumed one block of rows at a time if S
+// is present, not complemented, and sparse or hypersparse, and W is full.
+// If S is NULL, C=X*Y' is computed without a mask.
+
+// The descriptor controls the mask S (GrB_COMP and GrB_STRUCTURE) and the
+// algorithm used (GxB_AxB_METHOD).  GrB_REPLACE, GrB_INP0, and GrB_INP1 are
+// ignored.
+
+#include "mxm/GB_mxm.h"
+#include "mask/GB_get_mask.h"
+
+GrB_Info GxB_fusedmm                // Z = accum (Z, (C<S>=X*Y')*W)
+(
+    GrB_Matrix Z,                   // input/output matrix for results
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(Z,T)
+    const GrB_Matrix S_in,          // optional mask for C=X*Y'
+    const GrB_Semiring sddmm,       // defines '+' and '*' for C=X*Y'
+    const GrB_Matrix X,             // first input:  matrix X
+    const GrB_Matrix Y,             // second input: matrix Y
+    const GrB_Semiring spmm,        // defines '+' and '*' for T=C*W
+    const GrB_Matrix W,             // third input:  matrix W
+    const GrB_Descriptor desc       // descriptor for S
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (Z, "GxB_fusedmm (Z, accum, S, sddmm, X, Y, spmm, W, desc)") ;
+    GB_BURBLE_START ("GxB_fusedmm") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (Z) ;
+    GB_RETURN_IF_FAULTY (S_in) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (X) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (Y) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (W) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx, Mask_comp, Mask_struct,
+        xx1, xx2, AxB_method, xx3) ;
+
+    // get the mask
+    GrB_Matrix S = GB_get_mask (S_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // Z = accum (Z, (C<S>=X*Y')*W)
+    //--------------------------------------------------------------------------
+
+    info = GB_fusedmm (
+        Z,                          // output matrix
+        accum,                      // for accum (Z,T)
+        S, Mask_comp, Mask_struct,  // mask matrix and its descriptor
+        sddmm,                      // semiring that defines C=X*Y'
+        X, Y,                       // inputs for C=X*Y'
+        spmm,                       // semiring that defines T=C*W
+        W,                          // input for T=C*W
+        AxB_method,                 // algorithm selector
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// GxB_innerProduct: inner product of two vectors
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// s = accum (s, u'*v), where u and v are vectors of the same length.  The
+// result is identical to GrB_vxm or GrB_mxv with a 1-by-1 output, but it is
+// always computed with a dot product.  The single dot product u'*v is split
+// across all the threads, with each task computing a slice of u'*v, and the
+// results are then summed with the monoid of the semiring.  If u'*v has no
+// entries, s is not modified (or cleared, if accum is NULL).
+
+// The descriptor is checked but its settings are not used: GrB_INP0,
+// GrB_INP1, GrB_MASK, GrB_OUTP, and GxB_AXB_METHOD are ignored.
+
+#include "mxm/GB_mxm.h"
+
+GrB_Info GxB_innerProduct           // s = accum (s, u'*v)
+(
+    GrB_Scalar s,                   // input/output scalar for the result
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for u'*v
+    const GrB_Vector u,             // first input:  vector u
+    const GrB_Vector v,             // second input: vector v
+    const GrB_Descriptor desc       // descriptor (unused)
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (s, "GxB_innerProduct (s, accum, semiring, u, v, desc)") ;
+    GB_BURBLE_START ("GxB_innerProduct") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (s) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (u) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (v) ;
+    ASSERT (GB_VECTOR_OK (u)) ;
+    ASSERT (GB_VECTOR_OK (v)) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // s = accum (s, u'*v), using the dot product method
+    //--------------------------------------------------------------------------
+
+    // u and v are passed as matrices to GB_mxm_reduce.  u'*v is a 1-by-1
+    // matrix, and its reduction to a scalar is its single entry, if present.
+    info = GB_mxm_reduce (
+        s, NULL,                    // output scalar
+        NULL, false, false,         // no mask
+        accum,                      // for accum (s,t)
+        semiring,                   // semiring that defines t=u'*v
+        (GrB_Matrix) u,   true,     // u is transposed
+        (GrB_Matrix) v,   false,    // v is not transposed
+        GxB_AxB_DOT,                // always use the dot product method
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+// GxB_mxm_reduce: reduce a masked matrix-matrix product to a scalar
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// s = accum (s, reduce (C<M>=A*B)) and variations, where the reduction uses
+// the monoid of the semiring.  The result is identical to GrB_mxm followed
+// by GrB_reduce to a GrB_Scalar with the same monoid, but C is not
+// constructed if the mask M is present, not complemented, and sparse or
+// hypersparse.
+
+// The input matrices A and B are optionally transposed, as determined by the
+// Descriptor desc.  GrB_REPLACE is ignored, since s is not masked.
+
+#include "mxm/GB_mxm.h"
+#include "mask/GB_get_mask.h"
+
+GrB_Info GxB_mxm_reduce             // s = accum (s, reduce (C<M>=A*B))
+(
+    GrB_Scalar s,                   // input/output scalar for the result
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Matrix M_in,          // optional mask for C, unused if NULL
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for M, A, and B
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (s, "GxB_mxm_reduce (s, accum, M, semiring, A, B, desc)") ;
+    GB_BURBLE_START ("GxB_mxm_reduce") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (s) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx, Mask_comp, Mask_struct,
+        A_transpose, B_transpose, AxB_method, xx2) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // s = accum (s, reduce (C<M>=A*B))
+    //--------------------------------------------------------------------------
+
+    info = GB_mxm_reduce (
+        s, NULL,                    // output scalar
+        M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
+        accum,                      // for accum (s,t)
+        semiring,                   // semiring that defines C=A*B and t
+        A,          A_transpose,    // A matrix and its descriptor
+        B,          B_transpose,    // B matrix and its descriptor
+        AxB_method,                 // algorithm selector
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
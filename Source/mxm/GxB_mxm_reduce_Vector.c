@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+// GxB_mxm_reduce_Vector: reduce each row of a masked matrix-matrix product
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// w = accum (w, rowreduce (C<M>=A*B)) and variations, where w(i) is the
+// reduction of C(i,:) with the monoid of the semiring.  The result is
+// identical to GrB_mxm followed by GrB_Matrix_reduce_Monoid with the same
+// monoid, but C is not constructed if the mask M is present, not
+// complemented, and sparse or hypersparse.
+
+// The input matrices A and B are optionally transposed, as determined by the
+// Descriptor desc.  GrB_REPLACE is ignored, since w is not masked.
+
+#include "mxm/GB_mxm.h"
+#include "mask/GB_get_mask.h"
+
+GrB_Info GxB_mxm_reduce_Vector      // w = accum (w, rowreduce (C<M>=A*B))
+(
+    GrB_Vector w,                   // input/output vector for the result
+    const GrB_BinaryOp accum,       // optional accum for w=accum(w,t)
+    const GrB_Matrix M_in,          // optional mask for C, unused if NULL
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for M, A, and B
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (w, "GxB_mxm_reduce_Vector (w, accum, M, semiring, A, B, desc)") ;
+    GB_BURBLE_START ("GxB_mxm_reduce_Vector") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (w) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx, Mask_comp, Mask_struct,
+        A_transpose, B_transpose, AxB_method, xx2) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // w = accum (w, rowreduce (C<M>=A*B))
+    //--------------------------------------------------------------------------
+
+    info = GB_mxm_reduce (
+        NULL, w,                    // output vector
+        M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
+        accum,                      // for accum (w,t)
+        semiring,                   // semiring that defines C=A*B and t
+        A,          A_transpose,    // A matrix and its descriptor
+        B,          B_transpose,    // B matrix and its descriptor
+        AxB_method,                 // algorithm selector
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
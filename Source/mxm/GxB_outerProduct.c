@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+// GxB_outerProduct: outer product of two vectors
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M> = accum (C, u*v'), where u has length m, v has length n, and C is
+// m-by-n.  The result is identical to GrB_mxm with u and v as m-by-1 and
+// n-by-1 matrices, with v transposed.
+
+// The input vectors u and v are never transposed, so GrB_INP0 and GrB_INP1
+// are ignored.
+
+#include "mxm/GB_mxm.h"
+#include "mask/GB_get_mask.h"
+
+GrB_Info GxB_outerProduct           // C<M> = accum (C, u*v')
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix M_in,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for u*v'
+    const GrB_Vector u,             // first input:  vector u
+    const GrB_Vector v,             // second input: vector v
+    const GrB_Descriptor desc       // descriptor for C and M
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_outerProduct (C, M, accum, semiring, u, v, desc)") ;
+    GB_BURBLE_START ("GxB_outerProduct") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (u) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (v) ;
+    ASSERT (GB_VECTOR_OK (u)) ;
+    ASSERT (GB_VECTOR_OK (v)) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        xx1, xx2, AxB_method, do_sort) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C,u*v'), using the mxm kernel
+    //--------------------------------------------------------------------------
+
+    // u and v are passed as matrices to GB_mxm.
+    info = GB_mxm (
+        C,                  C_replace,      // C and its descriptor
+        M, Mask_comp, Mask_struct,          // mask and its descriptor
+        accum,                              // for accum (C,T)
+        semiring,                           // definition of matrix multiply
+        (GrB_Matrix) u,     false,          // u is never transposed
+        (GrB_Matrix) v,     true,           // v is always transposed
+        false,                              // fmult(x,y), flipxy = false
+        AxB_method, do_sort,                // algorithm selector
+        NULL,                               // no plan
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -9,7 +9,12 @@
 
 // This template serves the dot2 and dot3 methods, but not dot4, since dot4 is
 // not implemented for generic kernels.  The #including file defines
-// GB_DOT2_GENERIC or GB_DOT3_GENERIC.
+// GB_DOT2_GENERIC, GB_DOT3_GENERIC, GB_DOT3_REDUCE_GENERIC, or
+// GB_DOT2_FINE_GENERIC.  GB_DOT3_REDUCE_GENERIC computes s = reduce
+// (C<M>=A'*B) without forming C, so C is not accessed.  If GB_DOT3_ROWREDUCE
+// is also defined, each vector of C is reduced instead.  GB_DOT2_FINE_GENERIC
+// splits each dot product C(i,j)=A(:,i)'*B(:,j) across fine tasks, and does
+// not access C either.  It is not used for positional multiply operators.
 
 // This file does not use GB_DECLARE_TERMINAL_CONST (zterminal).  Instead, it
 // defines zterminal itself.
@@ -23,14 +28,17 @@
     // get operators, functions, workspace, contents of A, B, C
     //--------------------------------------------------------------------------
 
-    ASSERT (!C->iso) ;
-
     GxB_binary_function fmult = mult->binop_function ;    // NULL if positional
     GxB_binary_function fadd  = add->op->binop_function ;
     GB_Opcode opcode = mult->opcode ;
     bool op_is_positional = GB_OPCODE_IS_POSITIONAL (opcode) ;
 
+    #if defined ( GB_DOT3_REDUCE_GENERIC ) || defined ( GB_DOT2_FINE_GENERIC )
+    size_t csize = add->op->ztype->size ;
+    #else
+    ASSERT (!C->iso) ;
     size_t csize = C->type->size ;
+    #endif
     size_t asize = A_is_pattern ? 0 : A->type->size ;
     size_t bsize = B_is_pattern ? 0 : B->type->size ;
 
@@ -98,6 +106,14 @@
         // Cx [p] = cij
         #define GB_PUTC(cij,Cx,p) Cx [p] = cij
 
+        // z = identity, z += cij, and W [tid] = z, for GB_DOT3_REDUCE_GENERIC
+        #define GB_DOT_REDUCE_DECLARE(z)                                \
+            GB_C_TYPE z ;                                               \
+            memcpy (&z, add->identity, csize)
+        #define GB_DOT_REDUCE_UPDATE(z,cij) fadd (&z, &z, &cij)
+        #define GB_DOT_REDUCE_SAVE(W,tid,z)                             \
+            memcpy ((W) + (tid)*csize, &z, csize)
+
         // break if cij reaches the terminal value.  The terminal condition
         // 'is_terminal' is checked even if the monoid is not terminal.
         #undef  GB_MONOID_IS_TERMINAL
@@ -142,6 +158,8 @@
                     #include "mxm/template/GB_AxB_dot2_meta.c"
                     #elif defined ( GB_DOT3_GENERIC )
                     #include "mxm/template/GB_AxB_dot3_meta.c"
+                    #elif defined ( GB_DOT3_REDUCE_GENERIC )
+                    #include "mxm/template/GB_AxB_dot3_reduce_meta.c"
                     #endif
                     break ;
                 case GB_FIRSTJ_binop_code   :   // first_j(A'(i,k),y) == k
@@ -154,6 +172,8 @@
                     #include "mxm/template/GB_AxB_dot2_meta.c"
                     #elif defined ( GB_DOT3_GENERIC )
                     #include "mxm/template/GB_AxB_dot3_meta.c"
+                    #elif defined ( GB_DOT3_REDUCE_GENERIC )
+                    #include "mxm/template/GB_AxB_dot3_reduce_meta.c"
                     #endif
                     break ;
                 case GB_SECONDJ_binop_code  :   // second_j(x,B(k,j)) == j
@@ -164,6 +184,8 @@
                     #include "mxm/template/GB_AxB_dot2_meta.c"
                     #elif defined ( GB_DOT3_GENERIC )
                     #include "mxm/template/GB_AxB_dot3_meta.c"
+                    #elif defined ( GB_DOT3_REDUCE_GENERIC )
+                    #include "mxm/template/GB_AxB_dot3_reduce_meta.c"
                     #endif
                     break ;
                 default: ;
@@ -191,6 +213,8 @@
                     #include "mxm/template/GB_AxB_dot2_meta.c"
                     #elif defined ( GB_DOT3_GENERIC )
                     #include "mxm/template/GB_AxB_dot3_meta.c"
+                    #elif defined ( GB_DOT3_REDUCE_GENERIC )
+                    #include "mxm/template/GB_AxB_dot3_reduce_meta.c"
                     #endif
                     break ;
                 case GB_FIRSTJ_binop_code   :   // first_j(A'(i,k),y) == k
@@ -203,6 +227,8 @@
                     #include "mxm/template/GB_AxB_dot2_meta.c"
                     #elif defined ( GB_DOT3_GENERIC )
                     #include "mxm/template/GB_AxB_dot3_meta.c"
+                    #elif defined ( GB_DOT3_REDUCE_GENERIC )
+                    #include "mxm/template/GB_AxB_dot3_reduce_meta.c"
                     #endif
                     break ;
                 case GB_SECONDJ_binop_code  :   // second_j(x,B(k,j)) == j
@@ -213,6 +239,8 @@
                     #include "mxm/template/GB_AxB_dot2_meta.c"
                     #elif defined ( GB_DOT3_GENERIC )
                     #include "mxm/template/GB_AxB_dot3_meta.c"
+                    #elif defined ( GB_DOT3_REDUCE_GENERIC )
+                    #include "mxm/template/GB_AxB_dot3_reduce_meta.c"
                     #endif
                     break ;
                 default: ;
@@ -255,6 +283,18 @@
         #undef  GB_PUTC
         #define GB_PUTC(cij,Cx,p) memcpy (Cx +((p)*csize), cij, csize)
 
+        // z = identity, z += cij, and W [tid] = z, for GB_DOT3_REDUCE_GENERIC
+        // and GB_DOT2_FINE_GENERIC
+        #undef  GB_DOT_REDUCE_DECLARE
+        #define GB_DOT_REDUCE_DECLARE(z)                                \
+            GB_void z [GB_VLA(csize)] ;                                 \
+            memcpy (z, add->identity, csize)
+        #undef  GB_DOT_REDUCE_UPDATE
+        #define GB_DOT_REDUCE_UPDATE(z,cij) fadd (z, z, cij)
+        #undef  GB_DOT_REDUCE_SAVE
+        #define GB_DOT_REDUCE_SAVE(W,tid,z)                             \
+            memcpy ((W) + (tid)*csize, z, csize)
+
         // instead of GB_DECLARE_TERMINAL_CONST (zterminal):
         GB_void *restrict zterminal = (GB_void *) add->terminal ;
 
@@ -295,6 +335,10 @@
             #include "mxm/template/GB_AxB_dot2_meta.c"
             #elif defined ( GB_DOT3_GENERIC )
             #include "mxm/template/GB_AxB_dot3_meta.c"
+            #elif defined ( GB_DOT3_REDUCE_GENERIC )
+            #include "mxm/template/GB_AxB_dot3_reduce_meta.c"
+            #elif defined ( GB_DOT2_FINE_GENERIC )
+            #include "mxm/template/GB_AxB_dot2_fine_meta.c"
             #endif
         }
         else if (opcode == GB_SECOND_binop_code)
@@ -309,6 +353,10 @@
             #include "mxm/template/GB_AxB_dot2_meta.c"
             #elif defined ( GB_DOT3_GENERIC )
             #include "mxm/template/GB_AxB_dot3_meta.c"
+            #elif defined ( GB_DOT3_REDUCE_GENERIC )
+            #include "mxm/template/GB_AxB_dot3_reduce_meta.c"
+            #elif defined ( GB_DOT2_FINE_GENERIC )
+            #include "mxm/template/GB_AxB_dot2_fine_meta.c"
             #endif
         }
         else if (flipxy)
@@ -320,6 +368,10 @@
             #include "mxm/template/GB_AxB_dot2_meta.c"
             #elif defined ( GB_DOT3_GENERIC )
             #include "mxm/template/GB_AxB_dot3_meta.c"
+            #elif defined ( GB_DOT3_REDUCE_GENERIC )
+            #include "mxm/template/GB_AxB_dot3_reduce_meta.c"
+            #elif defined ( GB_DOT2_FINE_GENERIC )
+            #include "mxm/template/GB_AxB_dot2_fine_meta.c"
             #endif
         }
         else
@@ -331,6 +383,10 @@
             #include "mxm/template/GB_AxB_dot2_meta.c"
             #elif defined ( GB_DOT3_GENERIC )
             #include "mxm/template/GB_AxB_dot3_meta.c"
+            #elif defined ( GB_DOT3_REDUCE_GENERIC )
+            #include "mxm/template/GB_AxB_dot3_reduce_meta.c"
+            #elif defined ( GB_DOT2_FINE_GENERIC )
+            #include "mxm/template/GB_AxB_dot2_fine_meta.c"
             #endif
         }
     }
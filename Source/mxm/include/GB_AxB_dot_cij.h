@@ -65,9 +65,10 @@
     // ANY monoid, including the ANY_PAIR semiring
     //--------------------------------------------------------------------------
 
-    #if defined ( GB_DOT3 )
+    #if defined ( GB_DOT3 ) || defined ( GB_DOT2_FINE )
 
-        // for the dot3 method: C is sparse or hyper
+        // for the dot3 method: C is sparse or hyper, or for the dot2 fine
+        // tasks: C is not accessed
         #define GB_DOT(k,pA,pB)                                         \
         {                                                               \
             GB_DECLAREA (aki) ;                                         \
@@ -71,6 +71,11 @@
 #define GB_SEMIRING_HAS_AVX_IMPLEMENTATION 0
 #endif
 
+// 1 if the saxpy4 and dot4 methods are compiled for AVX512F and AVX2
+#ifndef GB_SEMIRING_HAS_AVX_SAXPY4_DOT4
+#define GB_SEMIRING_HAS_AVX_SAXPY4_DOT4 0
+#endif
+
 //------------------------------------------------------------------------------
 // special multiply operators
 //------------------------------------------------------------------------------
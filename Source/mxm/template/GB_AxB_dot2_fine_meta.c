@@ -0,0 +1,133 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot2_fine_meta: C=A'*B via dot products split across fine tasks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This template is #include'd in 2 ways to construct:
+//  * a generic method: mxm/factory/GB_AxB_dot_generic.c
+//  * a JIT kernel: jit_kernels/GB_jit_kernel_AxB_dot2_fine.c
+
+// C=A'*B is computed where C has very few entries, so that the dot2 method
+// would have fewer tasks than threads.  Instead, each dot product C(i,j) =
+// A(:,i)'*B(:,j) is split into nfine tasks, each of which computes the dot
+// product for a contiguous range of the index k.  The C matrix is not
+// accessed.  On output, W [tid] holds the partial result of task tid, and
+// Wb [tid] is true if the task found any entry.  The caller sums the nfine
+// partial results of each entry of C, with the monoid.
+
+// The #include'ing file must define GB_DOT_REDUCE_SAVE(W,tid,z) for
+// W [tid] = z.  No mask is present, A and B are not hypersparse, and the
+// multiplicative operator is not positional.
+
+#define GB_DOT2_FINE
+
+#include "include/GB_unused.h"
+#include "include/GB_AxB_dot_cij.h"
+
+// GB_DOT_ALWAYS_SAVE_CIJ: W [tid] = cij
+#define GB_DOT_ALWAYS_SAVE_CIJ              \
+{                                           \
+    GB_DOT_REDUCE_SAVE (W, tid, cij) ;      \
+    Wb [tid] = 1 ;                          \
+}
+
+// GB_DOT_SAVE_CIJ: W [tid] = cij, if it exists
+#define GB_DOT_SAVE_CIJ                     \
+{                                           \
+    if (GB_CIJ_EXISTS)                      \
+    {                                       \
+        GB_DOT_ALWAYS_SAVE_CIJ ;            \
+    }                                       \
+}
+
+// p = first position in X [pstart:pend-1] with X [p] >= k, or pend if none
+#define GB_DOT2_FINE_LOWER_BOUND(p,k,X,pstart,pend)                     \
+{                                                                       \
+    int64_t pleft = pstart ;                                            \
+    int64_t pright = (pend) - 1 ;                                       \
+    GB_TRIM_BINARY_SEARCH (k, X, pleft, pright) ;                       \
+    if (pleft < (pend) && X [pleft] < k) pleft++ ;                      \
+    p = pleft ;                                                         \
+}
+
+{
+
+    //--------------------------------------------------------------------------
+    // get A and B
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Bp = B->p ;
+    const int8_t  *restrict Bb = B->b ;
+    const int64_t *restrict Bi = B->i ;
+    #ifdef GB_JIT_KERNEL
+    #define B_is_bitmap    GB_B_IS_BITMAP
+    #define B_is_sparse    GB_B_IS_SPARSE
+    #define B_is_full      GB_B_IS_FULL
+    #define B_iso          GB_B_ISO
+    #else
+    const bool B_is_bitmap = GB_IS_BITMAP (B) ;
+    const bool B_is_sparse = GB_IS_SPARSE (B) ;
+    const bool B_is_full   = GB_IS_FULL (B) ;
+    const bool B_iso       = B->iso ;
+    #endif
+    ASSERT (!GB_IS_HYPERSPARSE (B)) ;
+    #define B_is_hyper false
+
+    const int64_t *restrict Ap = A->p ;
+    const int8_t  *restrict Ab = A->b ;
+    const int64_t *restrict Ai = A->i ;
+    #ifdef GB_JIT_KERNEL
+    #define A_is_bitmap    GB_A_IS_BITMAP
+    #define A_is_sparse    GB_A_IS_SPARSE
+    #define A_is_full      GB_A_IS_FULL
+    #define A_iso          GB_A_ISO
+    #else
+    const bool A_is_bitmap = GB_IS_BITMAP (A) ;
+    const bool A_is_sparse = GB_IS_SPARSE (A) ;
+    const bool A_is_full   = GB_IS_FULL (A) ;
+    const bool A_iso       = A->iso ;
+    #endif
+    ASSERT (!GB_IS_HYPERSPARSE (A)) ;
+    #define A_is_hyper false
+
+    #if !GB_A_IS_PATTERN
+    const GB_A_TYPE *restrict Ax = (GB_A_TYPE *) A->x ;
+    #endif
+    #if !GB_B_IS_PATTERN
+    const GB_B_TYPE *restrict Bx = (GB_B_TYPE *) B->x ;
+    #endif
+
+    // the vlen of each task is shortened if A and B are both bitmap/full
+    const int64_t avlen = A->vlen ;
+    ASSERT (A->vlen == B->vlen) ;
+    const int64_t cvlen = A->vdim ;
+
+    //--------------------------------------------------------------------------
+    // W [tid] = A(k0:k1-1,i)'*B(k0:k1-1,j) for each fine task
+    //--------------------------------------------------------------------------
+
+    #ifdef GB_JIT_KERNEL
+    {
+        GB_DECLARE_TERMINAL_CONST (zterminal) ;
+        #define GB_META16
+        #include "include/GB_meta16_definitions.h"
+        #include "template/GB_AxB_dot2_fine_template.c"
+    }
+    #else
+    {
+        #include "template/GB_meta16_factory.c"
+    }
+    #endif
+}
+
+#undef A_is_hyper
+#undef B_is_hyper
+#undef GB_DOT_ALWAYS_SAVE_CIJ
+#undef GB_DOT_SAVE_CIJ
+#undef GB_DOT2_FINE_LOWER_BOUND
+#undef GB_DOT2_FINE
+
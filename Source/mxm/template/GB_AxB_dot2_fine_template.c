@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot2_fine_template: C=A'*B via dot products split across fine tasks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A and B are sparse, bitmap, or full; never hypersparse.  Task tid computes
+// a slice of the dot product C(i,j), where C(i,j) is at position pC = tid /
+// nfine in the bitmap/full matrix C, and the slice is fine_tid = tid % nfine.
+
+// If A and B are both bitmap or full, the index range 0:vlen-1 is split
+// evenly.  Otherwise, the entries of the longer sparse vector A(:,i) or
+// B(:,j) are split evenly, and the other vector, if sparse, is trimmed to the
+// same range of indices with a binary search.  In all cases, the indices k of
+// each task are disjoint, so the partial results can be summed by the monoid
+// in any order.
+
+#if ( !GB_A_IS_HYPER && !GB_B_IS_HYPER )
+{
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the task descriptor
+        //----------------------------------------------------------------------
+
+        const int64_t pC = tid / nfine ;
+        const int fine_tid = tid % nfine ;
+        const int64_t i = pC % cvlen ;
+        const int64_t j = pC / cvlen ;
+        Wb [tid] = 0 ;
+
+        //----------------------------------------------------------------------
+        // get the slices of A(:,i) and B(:,j) for this task
+        //----------------------------------------------------------------------
+
+        #if ( !GB_A_IS_SPARSE && !GB_B_IS_SPARSE )
+
+            // A and B are bitmap or full: split the range 0:avlen-1
+            const int64_t k0 = GB_PART (fine_tid,   avlen, nfine) ;
+            const int64_t k1 = GB_PART (fine_tid+1, avlen, nfine) ;
+            if (k0 >= k1) continue ;
+            // A(k0:k1-1,i) and B(k0:k1-1,j) are treated as vectors of
+            // length vlen = k1-k0, starting at pA and pB_start
+            const int64_t vlen = k1 - k0 ;
+            const int64_t pA = i * avlen + k0 ;
+            const int64_t pB_start = j * avlen + k0 ;
+
+        #else
+
+            const int64_t vlen = avlen ;
+
+            #if GB_A_IS_SPARSE
+            int64_t pA = Ap [i] ;
+            int64_t pA_end = Ap [i+1] ;
+            #else
+            const int64_t pA = i * vlen ;
+            #endif
+
+            #if GB_B_IS_SPARSE
+            int64_t pB_start = Bp [j] ;
+            int64_t pB_end = Bp [j+1] ;
+            #else
+            const int64_t pB_start = j * vlen ;
+            #endif
+
+            #if ( GB_A_IS_SPARSE && GB_B_IS_SPARSE )
+            const bool split_A = (pA_end - pA >= pB_end - pB_start) ;
+            #else
+            const bool split_A = GB_A_IS_SPARSE ;
+            #endif
+
+            if (split_A)
+            {
+                #if GB_A_IS_SPARSE
+                // split the entries of A(:,i)
+                const int64_t aknz = pA_end - pA ;
+                pA_end = pA + GB_PART (fine_tid+1, aknz, nfine) ;
+                pA     = pA + GB_PART (fine_tid,   aknz, nfine) ;
+                if (pA >= pA_end) continue ;
+                #if GB_B_IS_SPARSE
+                // trim B(:,j) to the indices k0:k1-1 of this slice of A(:,i)
+                const int64_t k0 = Ai [pA] ;
+                const int64_t k1 = Ai [pA_end-1] + 1 ;
+                int64_t pB_first = pB_start ;
+                GB_DOT2_FINE_LOWER_BOUND (pB_start, k0, Bi, pB_first, pB_end) ;
+                GB_DOT2_FINE_LOWER_BOUND (pB_end,   k1, Bi, pB_start, pB_end) ;
+                #endif
+                #endif
+            }
+            else
+            {
+                #if GB_B_IS_SPARSE
+                // split the entries of B(:,j)
+                const int64_t bknz = pB_end - pB_start ;
+                pB_end   = pB_start + GB_PART (fine_tid+1, bknz, nfine) ;
+                pB_start = pB_start + GB_PART (fine_tid,   bknz, nfine) ;
+                if (pB_start >= pB_end) continue ;
+                #if GB_A_IS_SPARSE
+                // trim A(:,i) to the indices k0:k1-1 of this slice of B(:,j)
+                const int64_t k0 = Bi [pB_start] ;
+                const int64_t k1 = Bi [pB_end-1] + 1 ;
+                int64_t pA_first = pA ;
+                GB_DOT2_FINE_LOWER_BOUND (pA,     k0, Ai, pA_first, pA_end) ;
+                GB_DOT2_FINE_LOWER_BOUND (pA_end, k1, Ai, pA,       pA_end) ;
+                #endif
+                #endif
+            }
+
+            #if GB_A_IS_SPARSE
+            const int64_t ainz = pA_end - pA ;
+            if (ainz == 0) continue ;
+            #endif
+
+            #if GB_B_IS_SPARSE
+            const int64_t bjnz = pB_end - pB_start ;
+            if (bjnz == 0) continue ;
+            #if GB_A_IS_SPARSE
+            // Both A and B are sparse; get first and last in B(:,j)
+            const int64_t ib_first = Bi [pB_start] ;
+            const int64_t ib_last  = Bi [pB_end-1] ;
+            #endif
+            #endif
+
+        #endif
+
+        //----------------------------------------------------------------------
+        // W [tid] = A(k0:k1-1,i)'*B(k0:k1-1,j)
+        //----------------------------------------------------------------------
+
+        bool cij_exists = false ;
+        GB_CIJ_DECLARE (cij) ;
+        #if GB_IS_PLUS_PAIR_REAL_SEMIRING
+        cij = 0 ;
+        #endif
+        #include "template/GB_AxB_dot_cij.c"
+    }
+}
+#endif
+
+#undef GB_A_IS_SPARSE
+#undef GB_A_IS_HYPER
+#undef GB_A_IS_BITMAP
+#undef GB_A_IS_FULL
+#undef GB_B_IS_SPARSE
+#undef GB_B_IS_HYPER
+#undef GB_B_IS_BITMAP
+#undef GB_B_IS_FULL
+
@@ -27,7 +27,12 @@
 
     ASSERT (GB_IS_BITMAP (C) || GB_IS_FULL (C)) ;
     int8_t *restrict Cb = C->b ;
+    #ifdef GB_C_NROWS
+    // the JIT kernel is specialized for a fixed # of rows of C
+    const int64_t cvlen = GB_C_NROWS ;
+    #else
     const int64_t cvlen = C->vlen ;
+    #endif
     #ifdef GB_JIT_KERNEL
     #define C_is_full      GB_C_IS_FULL
     #else
@@ -79,7 +84,12 @@
           GB_C_TYPE *restrict Cx = (GB_C_TYPE *) C->x ;
     #endif
 
+    #if defined ( GB_C_NROWS ) && defined ( GB_A_NOT_TRANSPOSED )
+    // C=A*B: A has the same # of rows as C
+    const int64_t vlen = GB_C_NROWS ;
+    #else
     const int64_t vlen = A->vlen ;
+    #endif
 
     const int ntasks = naslice * nbslice ;
 
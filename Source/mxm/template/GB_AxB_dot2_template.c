@@ -124,6 +124,54 @@
                 const int64_t pB_start = j * vlen ;
             #endif
 
+            //------------------------------------------------------------------
+            // C(:,j) = A*B(:,j) when C has a fixed # of rows
+            //------------------------------------------------------------------
+
+            #if defined ( GB_C_NROWS ) && defined ( GB_A_NOT_TRANSPOSED ) \
+                && GB_C_IS_FULL && GB_A_IS_FULL && GB_B_IS_SPARSE \
+                && !GB_IS_ANY_MONOID && !GB_IS_PAIR_MULTIPLIER \
+                && !GB_IS_FIRSTJ_MULTIPLIER
+            if (kA_start == 0 && kA_end == GB_C_NROWS)
+            {
+                // The JIT kernel is compiled for C with GB_C_NROWS rows, and
+                // this task computes all of C(:,j).  C(:,j) is held in cx,
+                // and A(:,k)*B(k,j) is added to it for each entry B(k,j), in
+                // loops of fixed length that the compiler can unroll and
+                // vectorize.  A terminal monoid does not stop early.
+                GB_CIJ_DECLARE (cx [GB_C_NROWS]) ;
+                GB_DECLAREA (aik) ;
+                GB_DECLAREB (bkj) ;
+                // cx = A(:,k) * B(k,j) for the first entry in B(:,j)
+                int64_t k = Bi [pB_start] ;
+                int64_t pA = k * GB_C_NROWS ;       // A(:,k) starts here
+                GB_GETB (bkj, Bx, pB_start, B_iso) ;
+                for (int64_t i = 0 ; i < GB_C_NROWS ; i++)
+                { 
+                    GB_GETA (aik, Ax, pA + i, A_iso) ;
+                    GB_MULT (cx [i], aik, bkj, i, k, j) ;
+                }
+                // cx += A(:,k) * B(k,j) for all other entries in B(:,j)
+                for (int64_t pB = pB_start + 1 ; pB < pB_end ; pB++)
+                {
+                    k = Bi [pB] ;
+                    pA = k * GB_C_NROWS ;
+                    GB_GETB (bkj, Bx, pB, B_iso) ;
+                    for (int64_t i = 0 ; i < GB_C_NROWS ; i++)
+                    { 
+                        GB_GETA (aik, Ax, pA + i, A_iso) ;
+                        GB_MULTADD (cx [i], aik, bkj, i, k, j) ;
+                    }
+                }
+                // C(:,j) = cx
+                for (int64_t i = 0 ; i < GB_C_NROWS ; i++)
+                { 
+                    GB_PUTC (cx [i], Cx, pC_start + i) ;
+                }
+                continue ;
+            }
+            #endif
+
             //------------------------------------------------------------------
             // C(:,j)<#M(:,j)> = A'*B(:,j), or C(:,j) = A'*B(:,j) if no mask
             //------------------------------------------------------------------
@@ -0,0 +1,186 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot3_reduce_meta: s = reduce (C<M>=A'*B) without forming C
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This template is #include'd in 2 ways to construct:
+//  * a generic method: mxm/factory/GB_AxB_dot_generic.c
+//  * a JIT kernel: jit_kernels/GB_jit_kernel_AxB_dot3_reduce.c, or
+//      jit_kernels/GB_jit_kernel_AxB_dot3_rowreduce.c
+
+// Each entry C(i,j) of C<M>=A'*B is computed just as in the dot3 method, but
+// instead of being written to C it is summed into a scalar owned by the task,
+// using the monoid of the semiring.  C is never allocated, and no zombies are
+// created.  On output, W [tid] holds the result of task tid, and Wcount [tid]
+// holds the # of entries of C that it has summed.  If Wcount [tid] is zero,
+// W [tid] is undefined (it holds the identity value, but the ANY monoid has
+// no identity).
+
+// If GB_DOT3_ROWREDUCE is defined by the #include'ing file, each vector
+// C(:,j) is instead reduced to T(j), where T is a bitmap vector of the monoid
+// ztype, of length M->vdim.  For coarse tasks, Wcount [tid] is the # of
+// entries of T computed by the task.  Each fine task reduces its part of a
+// single vector to W [tid], and Wcount [tid] is the # of entries it summed.
+
+// The #include'ing file must define GB_DOT_REDUCE_DECLARE(z), which declares
+// z and sets it to the identity value of the monoid, GB_DOT_REDUCE_UPDATE(z,t)
+// for z += t, and GB_DOT_REDUCE_SAVE(W,tid,z) for W [tid] = z.
+
+#define GB_DOT3
+#define GB_DOT3_REDUCE
+
+#include "include/GB_unused.h"
+#include "include/GB_AxB_dot_cij.h"
+
+// GB_DOT_ALWAYS_SAVE_CIJ: z += cij
+#define GB_DOT_ALWAYS_SAVE_CIJ          \
+{                                       \
+    cij_exists = true ;                 \
+    GB_DOT_REDUCE_UPDATE (zreduce, cij) ; \
+    zcount++ ;                          \
+}
+
+// GB_DOT_SAVE_CIJ: z += cij, if it exists
+#define GB_DOT_SAVE_CIJ                 \
+{                                       \
+    if (GB_CIJ_EXISTS)                  \
+    {                                   \
+        GB_DOT_REDUCE_UPDATE (zreduce, cij) ; \
+        zcount++ ;                      \
+    }                                   \
+}
+
+{
+
+    //--------------------------------------------------------------------------
+    // get M, A, and B
+    //--------------------------------------------------------------------------
+
+    // M is sparse or hyper, and not complemented.  It defines the pattern of
+    // the matrix C that would be computed by dot3.
+
+    const int64_t *restrict Bp = B->p ;
+    const int64_t *restrict Bh = B->h ;
+    const int8_t  *restrict Bb = B->b ;
+    const int64_t *restrict Bi = B->i ;
+    const int64_t bnvec = B->nvec ;
+
+    #ifdef GB_JIT_KERNEL
+    // B matrix properties fixed in the jit kernel
+    #define B_is_hyper  GB_B_IS_HYPER
+    #define B_is_bitmap GB_B_IS_BITMAP
+    #define B_is_sparse GB_B_IS_SPARSE
+    #define B_iso GB_B_ISO
+    #else
+    const bool B_is_hyper = GB_IS_HYPERSPARSE (B) ;
+    const bool B_is_bitmap = GB_IS_BITMAP (B) ;
+    const bool B_is_sparse = GB_IS_SPARSE (B) ;
+    const bool B_iso = B->iso ;
+    #endif
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int8_t  *restrict Ab = A->b ;
+    const int64_t *restrict Ai = A->i ;
+    const int64_t anvec = A->nvec ;
+
+    #ifdef GB_JIT_KERNEL
+    // A matrix properties fixed in the jit kernel
+    #define A_is_hyper  GB_A_IS_HYPER
+    #define A_is_bitmap GB_A_IS_BITMAP
+    #define A_is_sparse GB_A_IS_SPARSE
+    #define A_iso GB_A_ISO
+    #else
+    const bool A_is_hyper = GB_IS_HYPERSPARSE (A) ;
+    const bool A_is_bitmap = GB_IS_BITMAP (A) ;
+    const bool A_is_sparse = GB_IS_SPARSE (A) ;
+    const bool A_iso = A->iso ;
+    #endif
+
+    const int64_t *restrict A_Yp = (A->Y == NULL) ? NULL : A->Y->p ;
+    const int64_t *restrict A_Yi = (A->Y == NULL) ? NULL : A->Y->i ;
+    const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
+    const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
+
+    const int64_t *restrict B_Yp = (B->Y == NULL) ? NULL : B->Y->p ;
+    const int64_t *restrict B_Yi = (B->Y == NULL) ? NULL : B->Y->i ;
+    const int64_t *restrict B_Yx = (B->Y == NULL) ? NULL : B->Y->x ;
+    const int64_t B_hash_bits = (B->Y == NULL) ? 0 : (B->Y->vdim - 1) ;
+
+    #if !GB_A_IS_PATTERN
+    const GB_A_TYPE *restrict Ax = (GB_A_TYPE *) A->x ;
+    #endif
+    #if !GB_B_IS_PATTERN
+    const GB_B_TYPE *restrict Bx = (GB_B_TYPE *) B->x ;
+    #endif
+
+    const int64_t vlen = A->vlen ;
+    ASSERT (A->vlen == B->vlen) ;
+
+    #ifdef GB_JIT_KERNEL
+    #define Mask_struct GB_MASK_STRUCT
+    #endif
+
+    const int64_t *restrict Mp = M->p ;
+    const int64_t *restrict Mh = M->h ;
+    const int64_t *restrict Mi = M->i ;
+    const size_t mvlen = M->vlen ;
+    const GB_M_TYPE *restrict Mx = (GB_M_TYPE *) (Mask_struct ? NULL : (M->x)) ;
+
+    #if defined ( GB_DOT3_ROWREDUCE )
+    GB_void *restrict Tx = (GB_void *) T->x ;
+    int8_t  *restrict Tb = T->b ;
+    ASSERT (T->vlen == M->vdim) ;
+    #endif
+
+    //--------------------------------------------------------------------------
+    // s = reduce (C<M> = A'*B) via dot products
+    //--------------------------------------------------------------------------
+
+    #ifdef GB_JIT_KERNEL
+    {
+        GB_DECLARE_TERMINAL_CONST (zterminal) ;
+        #define GB_META16
+        #include "include/GB_meta16_definitions.h"
+        #include "template/GB_AxB_dot3_reduce_template.c"
+    }
+    #else
+    {
+        const bool M_is_sparse = GB_IS_SPARSE (M) ;
+        ASSERT (M_is_sparse || GB_IS_HYPERSPARSE (M)) ;
+        if (M_is_sparse && Mask_struct && A_is_sparse && B_is_sparse)
+        {
+            // special case: M is present, sparse, structural, and not
+            // complemented, and A and B are sparse
+            #define GB_MASK_SPARSE_STRUCTURAL_AND_NOT_COMPLEMENTED
+            #define GB_A_IS_SPARSE 1
+            #define GB_A_IS_HYPER  0
+            #define GB_A_IS_BITMAP 0
+            #define GB_A_IS_FULL   0
+            #define GB_B_IS_SPARSE 1
+            #define GB_B_IS_HYPER  0
+            #define GB_B_IS_BITMAP 0
+            #define GB_B_IS_FULL   0
+            #include "template/GB_AxB_dot3_reduce_template.c"
+            #undef  GB_MASK_SPARSE_STRUCTURAL_AND_NOT_COMPLEMENTED
+        }
+        else
+        {
+            // general case
+            const size_t msize = M->type->size ;
+            #include "template/GB_meta16_factory.c"
+        }
+    }
+    #endif
+}
+
+#undef GB_DOT_ALWAYS_SAVE_CIJ
+#undef GB_DOT_SAVE_CIJ
+
+#undef GB_DOT3
+#undef GB_DOT3_REDUCE
+
@@ -0,0 +1,222 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot3_reduce_template: s = reduce (C<M>=A'*B) via dot products
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// M is sparse or hyper, present, and not complemented.  It may be valued or
+// structural.  The TaskList is constructed by GB_AxB_dot3_one_slice.
+
+// If GB_DOT3_ROWREDUCE is defined, each vector C(:,j) is reduced to the entry
+// T(j) of the bitmap vector T, instead of reducing all of C to a scalar.  A
+// vector of M that is split across fine tasks is reduced into W [tid] by
+// each of its fine tasks, and the caller sums these into T(j).
+
+{
+
+    int taskid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (taskid = 0 ; taskid < ntasks ; taskid++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the task descriptor
+        //----------------------------------------------------------------------
+
+        int64_t kfirst = TaskList [taskid].kfirst ;
+        int64_t klast  = TaskList [taskid].klast ;
+        bool fine_task = (klast == -1) ;
+        if (fine_task)
+        {
+            // a fine task operates on a slice of a single vector
+            klast = kfirst ;
+        }
+        #if defined ( GB_DOT3_ROWREDUCE )
+        int64_t task_cnvals = 0 ;       // # of entries of T computed
+        Wcount [taskid] = 0 ;
+        #else
+        int64_t zcount = 0 ;            // # of entries summed by this task
+        GB_DOT_REDUCE_DECLARE (zreduce) ;
+        #endif
+
+        //----------------------------------------------------------------------
+        // compute all vectors in this task
+        //----------------------------------------------------------------------
+
+        for (int64_t k = kfirst ; k <= klast ; k++)
+        {
+
+            //------------------------------------------------------------------
+            // get M(:,k)
+            //------------------------------------------------------------------
+
+            #if defined ( GB_MASK_SPARSE_STRUCTURAL_AND_NOT_COMPLEMENTED )
+            // M is sparse
+            const int64_t j = k ;
+            #else
+            // M is either sparse or hypersparse
+            const int64_t j = GBH_M (Mh, k) ;
+            #endif
+
+            GB_GET_VECTOR (pM_start, pM_end, pM, pM_end, Mp, k, mvlen) ;
+
+            #if defined ( GB_DOT3_ROWREDUCE )
+            int64_t zcount = 0 ;        // # of entries summed into T(j)
+            GB_DOT_REDUCE_DECLARE (zreduce) ;
+            #endif
+
+            //------------------------------------------------------------------
+            // get B(:,j)
+            //------------------------------------------------------------------
+
+            #if GB_B_IS_HYPER
+                // B is hyper: find B(:,j) using the B->Y hyper hash
+                int64_t pB_start, pB_end ;
+                GB_hyper_hash_lookup (Bh, bnvec, Bp, B_Yp, B_Yi, B_Yx,
+                    B_hash_bits, j, &pB_start, &pB_end) ;
+            #elif GB_B_IS_SPARSE
+                // B is sparse
+                const int64_t pB_start = Bp [j] ;
+                const int64_t pB_end = Bp [j+1] ;
+            #else
+                // B is bitmap or full
+                const int64_t pB_start = j * vlen ;
+            #endif
+
+            #if (GB_B_IS_SPARSE || GB_B_IS_HYPER)
+                const int64_t bjnz = pB_end - pB_start ;
+                if (bjnz == 0)
+                {
+                    // no work to do if B(:,j) is empty
+                    continue ;
+                }
+                #if (GB_A_IS_SPARSE || GB_A_IS_HYPER)
+                    // Both A and B are sparse; get first and last in B(:,j)
+                    const int64_t ib_first = Bi [pB_start] ;
+                    const int64_t ib_last  = Bi [pB_end-1] ;
+                #endif
+            #endif
+
+            //------------------------------------------------------------------
+            // z += A(:,i)'*B(:,j) for each i in M(:,j)
+            //------------------------------------------------------------------
+
+            for (int64_t pM = pM_start ; pM < pM_end ; pM++)
+            {
+
+                //--------------------------------------------------------------
+                // get M(i,j)
+                //--------------------------------------------------------------
+
+                bool cij_exists = false ;
+                GB_CIJ_DECLARE (cij) ;
+                #if GB_IS_PLUS_PAIR_REAL_SEMIRING
+                cij = 0 ;
+                #endif
+
+                // get the value of M(i,j)
+                int64_t i = Mi [pM] ;
+                #if !defined ( GB_MASK_SPARSE_STRUCTURAL_AND_NOT_COMPLEMENTED )
+                // if M is structural, no need to check its values
+                if (GB_MCAST (Mx, pM, msize))
+                #endif
+                {
+
+                    //----------------------------------------------------------
+                    // the mask allows C(i,j) to be computed
+                    //----------------------------------------------------------
+
+                    #if GB_A_IS_HYPER
+                    // A is hyper: find A(:,i) using the A->Y hyper hash
+                    int64_t pA, pA_end ;
+                    GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yp, A_Yi, A_Yx,
+                        A_hash_bits, i, &pA, &pA_end) ;
+                    const int64_t ainz = pA_end - pA ;
+                    if (ainz > 0)
+                    #elif GB_A_IS_SPARSE
+                    // A is sparse
+                    int64_t pA = Ap [i] ;
+                    const int64_t pA_end = Ap [i+1] ;
+                    const int64_t ainz = pA_end - pA ;
+                    if (ainz > 0)
+                    #else
+                    // A is bitmap or full
+                    const int64_t pA = i * vlen ;
+                    #endif
+                    {
+                        // z += A(:,i)'*B(:,j)
+                        #include "template/GB_AxB_dot_cij.c"
+                    }
+                }
+
+                #if defined ( GB_DOT3_ROWREDUCE )
+                // quick exit if T(j) has reached the terminal value
+                if (zcount > 0 && GB_TERMINAL_CONDITION (zreduce, zterminal))
+                {
+                    break ;
+                }
+                #endif
+            }
+
+            #if defined ( GB_DOT3_ROWREDUCE )
+
+                //--------------------------------------------------------------
+                // save the reduction of C(:,j)
+                //--------------------------------------------------------------
+
+                if (fine_task)
+                {
+                    // W [taskid] = z, summed into T(j) by the caller
+                    GB_DOT_REDUCE_SAVE (W, taskid, zreduce) ;
+                    Wcount [taskid] = zcount ;
+                }
+                else if (zcount > 0)
+                {
+                    // T(j) = z
+                    GB_DOT_REDUCE_SAVE (Tx, j, zreduce) ;
+                    Tb [j] = 1 ;
+                    task_cnvals++ ;
+                }
+
+            #else
+
+                //--------------------------------------------------------------
+                // quick exit if the task has reached the terminal value
+                //--------------------------------------------------------------
+
+                if (zcount > 0 && GB_TERMINAL_CONDITION (zreduce, zterminal))
+                {
+                    break ;
+                }
+
+            #endif
+        }
+
+        //----------------------------------------------------------------------
+        // save the result of this task
+        //----------------------------------------------------------------------
+
+        #if defined ( GB_DOT3_ROWREDUCE )
+        if (!fine_task)
+        {
+            Wcount [taskid] = task_cnvals ;
+        }
+        #else
+        GB_DOT_REDUCE_SAVE (W, taskid, zreduce) ;
+        Wcount [taskid] = zcount ;
+        #endif
+    }
+}
+
+#undef GB_A_IS_SPARSE
+#undef GB_A_IS_HYPER
+#undef GB_A_IS_BITMAP
+#undef GB_A_IS_FULL
+#undef GB_B_IS_SPARSE
+#undef GB_B_IS_HYPER
+#undef GB_B_IS_BITMAP
+#undef GB_B_IS_FULL
+
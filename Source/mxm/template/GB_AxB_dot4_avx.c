@@ -0,0 +1,103 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot4_avx.c: C+=A'*B dot4 method, compiled for AVX512F and AVX2
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The dot4 method is compiled two more times, with the target set to AVX512F
+// and AVX2, so that the compiler can use the wider vector registers for the
+// dot product reductions in GB_AxB_dot4_template.c.  The caller selects one
+// of these functions at run time, from the features of the CPU, or falls back
+// to GB_AxB_dot4_meta.c for any architecture.  See also
+// GB_AxB_saxpy4_avx.c.
+
+// This file is #include'd at file scope, by both Factory and JIT kernels.
+
+#if GB_SEMIRING_HAS_AVX_SAXPY4_DOT4
+
+    #undef GB_AXB_DOT4_AVX_PROTO
+
+    #ifdef GB_JIT_KERNEL
+
+        // C_in_iso is a compile-time constant, GB_C_IN_ISO
+        #define GB_AXB_DOT4_AVX_PROTO(GB_AxB_dot4_avx)                      \
+        GrB_Info GB_AxB_dot4_avx                                            \
+        (                                                                   \
+            GrB_Matrix C,                                                   \
+            const GrB_Matrix A,                                             \
+            const GrB_Matrix B,                                             \
+            const int64_t *restrict A_slice,                                \
+            const int64_t *restrict B_slice,                                \
+            const int naslice,                                              \
+            const int nbslice,                                              \
+            const int nthreads,                                             \
+            GB_Werk Werk,                                                   \
+            const GB_callback_struct *restrict my_callback                  \
+        )
+
+    #else
+
+        #define GB_AXB_DOT4_AVX_PROTO(GB_AxB_dot4_avx)                      \
+        GrB_Info GB_AxB_dot4_avx                                            \
+        (                                                                   \
+            GrB_Matrix C,                                                   \
+            const bool C_in_iso,                                            \
+            const GrB_Matrix A,                                             \
+            const GrB_Matrix B,                                             \
+            const int64_t *restrict A_slice,                                \
+            const int64_t *restrict B_slice,                                \
+            const int naslice,                                              \
+            const int nbslice,                                              \
+            const int nthreads,                                             \
+            GB_Werk Werk                                                    \
+        )
+
+    #endif
+
+    //--------------------------------------------------------------------------
+    // dot4 method for AVX512F
+    //--------------------------------------------------------------------------
+
+    #if GB_COMPILER_SUPPORTS_AVX512F
+
+        GB_TARGET_AVX512F static GB_AXB_DOT4_AVX_PROTO (GB_AxB_dot4_avx512f)
+        {
+            #ifdef GB_JIT_RUNTIME
+            // get callback functions
+            GB_free_memory_f GB_free_memory =
+                my_callback->GB_free_memory_func ;
+            GB_malloc_memory_f GB_malloc_memory =
+                my_callback->GB_malloc_memory_func ;
+            #endif
+            #include "template/GB_AxB_dot4_meta.c"
+            return (GrB_SUCCESS) ;
+        }
+
+    #endif
+
+    //--------------------------------------------------------------------------
+    // dot4 method for AVX2
+    //--------------------------------------------------------------------------
+
+    #if GB_COMPILER_SUPPORTS_AVX2
+
+        GB_TARGET_AVX2 static GB_AXB_DOT4_AVX_PROTO (GB_AxB_dot4_avx2)
+        {
+            #ifdef GB_JIT_RUNTIME
+            // get callback functions
+            GB_free_memory_f GB_free_memory =
+                my_callback->GB_free_memory_func ;
+            GB_malloc_memory_f GB_malloc_memory =
+                my_callback->GB_malloc_memory_func ;
+            #endif
+            #include "template/GB_AxB_dot4_meta.c"
+            return (GrB_SUCCESS) ;
+        }
+
+    #endif
+
+#endif
+
@@ -30,6 +30,11 @@
 #undef  GB_GET4C
 #define GB_GET4C(cij,p) cij = (C_in_iso) ? cinput : Cx [p]
 
+// # of columns of B in each wide panel
+#ifndef GB_DOT4_PANEL
+#define GB_DOT4_PANEL 16
+#endif
+
 #if ((GB_A_IS_BITMAP || GB_A_IS_FULL) && (GB_B_IS_BITMAP || GB_B_IS_FULL))
 {
 
@@ -433,11 +438,17 @@
         // C += A'*B: with workspace W for transposing B, one panel at a time
         //----------------------------------------------------------------------
 
+        // If B has many columns, A is read from memory once for each wide
+        // panel of GB_DOT4_PANEL columns of B, instead of once for every 4
+        // columns.  The remaining columns are done in panels of 4 or less.
+
+        const int64_t jwide = (bvdim / GB_DOT4_PANEL) * GB_DOT4_PANEL ;
+        const int64_t wsize = (jwide > 0) ? GB_DOT4_PANEL : wp ;
         size_t W_size = 0 ;
         GB_B2TYPE *restrict W = NULL ;
         if (bvdim > 1)
         {
-            W = GB_MALLOC_WORK (wp * vlen, GB_B2TYPE, &W_size) ;
+            W = GB_MALLOC_WORK (wsize * vlen, GB_B2TYPE, &W_size) ;
             if (W == NULL)
             { 
                 // out of memory
@@ -445,7 +456,72 @@
             }
         }
 
-        for (int64_t j1 = 0 ; j1 < bvdim ; j1 += 4)
+        for (int64_t j1 = 0 ; j1 < jwide ; j1 += GB_DOT4_PANEL)
+        {
+
+            //------------------------------------------------------------------
+            // G = B(:,j1:j1+GB_DOT4_PANEL-1) and convert to row-form
+            //------------------------------------------------------------------
+
+            GB_B2TYPE *restrict G = W ;
+            int64_t k ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (k = 0 ; k < vlen ; k++)
+            {
+                // G (k,:) = B (k,j1:j1+GB_DOT4_PANEL-1)
+                GB_B2TYPE *restrict Gk = G + k * GB_DOT4_PANEL ;
+                for (int64_t jj = 0 ; jj < GB_DOT4_PANEL ; jj++)
+                { 
+                    GB_GETB (Gk [jj], Bx, k + (j1 + jj) * vlen, false) ;
+                }
+            }
+
+            //------------------------------------------------------------------
+            // C += A'*G where G is vlen-by-GB_DOT4_PANEL in row-form
+            //------------------------------------------------------------------
+
+            int tid ;
+            #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+            for (tid = 0 ; tid < ntasks ; tid++)
+            {
+                // get the task descriptor
+                const int64_t kA_start = A_slice [tid] ;
+                const int64_t kA_end   = A_slice [tid+1] ;
+                for (int64_t i = kA_start ; i < kA_end ; i++)
+                {
+                    // get A(:,i)
+                    const int64_t pA = Ap [i] ;
+                    const int64_t pA_end = Ap [i+1] ;
+                    // cx = C(i,j1:j1+GB_DOT4_PANEL-1)
+                    GB_C_TYPE cx [GB_DOT4_PANEL] ;
+                    for (int64_t jj = 0 ; jj < GB_DOT4_PANEL ; jj++)
+                    { 
+                        GB_GET4C (cx [jj], i + (j1+jj)*cvlen) ;
+                    }
+                    // cx += A (:,i)'*G
+                    for (int64_t p = pA ; p < pA_end ; p++)
+                    {
+                        // aki = A(k,i)
+                        const int64_t k = Ai [p] ;
+                        GB_DECLAREA (aki) ;
+                        GB_GETA (aki, Ax, p, A_iso) ;
+                        const GB_B2TYPE *restrict Gk = G + k * GB_DOT4_PANEL ;
+                        // cx += A(k,i)*G(k,:)
+                        for (int64_t jj = 0 ; jj < GB_DOT4_PANEL ; jj++)
+                        { 
+                            GB_MULTADD (cx [jj], aki, Gk [jj], i, k, j1+jj) ;
+                        }
+                    }
+                    // C(i,j1:j1+GB_DOT4_PANEL-1) = cx
+                    for (int64_t jj = 0 ; jj < GB_DOT4_PANEL ; jj++)
+                    { 
+                        Cx [i + (j1+jj)*cvlen] = cx [jj] ;
+                    }
+                }
+            }
+        }
+
+        for (int64_t j1 = jwide ; j1 < bvdim ; j1 += 4)
         {
 
             //------------------------------------------------------------------
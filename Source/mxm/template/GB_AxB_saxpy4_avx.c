@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy4_avx.c: C+=A*B saxpy4 method, compiled for AVX512F and AVX2
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The saxpy4 method is compiled two more times, with the target set to
+// AVX512F and AVX2, so that the compiler can use the wider vector registers
+// for the inner loops of GB_AxB_saxpy4_template.c.  The caller selects one of
+// these functions at run time, from the features of the CPU, or falls back
+// to GB_AxB_saxpy4_meta.c for any architecture.  This is done only for the
+// semirings with GB_SEMIRING_HAS_AVX_SAXPY4_DOT4: plus_times and min_plus
+// for FP32, FP64, and INT64.
+
+// This file is #include'd at file scope, by both Factory and JIT kernels.
+
+#if GB_SEMIRING_HAS_AVX_SAXPY4_DOT4
+
+    #undef  GB_AXB_SAXPY4_AVX_PROTO
+    #define GB_AXB_SAXPY4_AVX_PROTO(GB_AxB_saxpy4_avx)                      \
+    void GB_AxB_saxpy4_avx                                                  \
+    (                                                                       \
+        GrB_Matrix C,                                                       \
+        const GrB_Matrix A,                                                 \
+        const GrB_Matrix B,                                                 \
+        const int ntasks,                                                   \
+        const int nthreads,                                                 \
+        const int nfine_tasks_per_vector,                                   \
+        const bool use_coarse_tasks,                                        \
+        const bool use_atomics,                                             \
+        const int64_t *restrict A_slice,                                    \
+        const int64_t *restrict H_slice,                                    \
+        GB_void *restrict Wcx,                                              \
+        int8_t *restrict Wf                                                 \
+    )
+
+    //--------------------------------------------------------------------------
+    // saxpy4 method for AVX512F
+    //--------------------------------------------------------------------------
+
+    #if GB_COMPILER_SUPPORTS_AVX512F
+
+        GB_TARGET_AVX512F static GB_AXB_SAXPY4_AVX_PROTO (GB_AxB_saxpy4_avx512f)
+        {
+            #include "template/GB_AxB_saxpy4_meta.c"
+        }
+
+    #endif
+
+    //--------------------------------------------------------------------------
+    // saxpy4 method for AVX2
+    //--------------------------------------------------------------------------
+
+    #if GB_COMPILER_SUPPORTS_AVX2
+
+        GB_TARGET_AVX2 static GB_AXB_SAXPY4_AVX_PROTO (GB_AxB_saxpy4_avx2)
+        {
+            #include "template/GB_AxB_saxpy4_meta.c"
+        }
+
+    #endif
+
+#endif
+
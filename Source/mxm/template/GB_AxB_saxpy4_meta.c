@@ -84,6 +84,12 @@
     // C += A*B, no mask, A sparse/hyper, B bitmap/full
     //--------------------------------------------------------------------------
 
+    #ifdef GB_JIT_KERNEL
+    { 
+        // A is sparse/hyper, B is bitmap or full (GB_B_IS_BITMAP), no mask
+        #include "template/GB_AxB_saxpy4_template.c"
+    }
+    #else
     if (B_is_bitmap)
     { 
         // A is sparse/hyper, B is bitmap, no mask
@@ -99,5 +105,6 @@
         #include "template/GB_AxB_saxpy4_template.c"
     }
     #undef GB_B_IS_BITMAP
+    #endif
 }
 
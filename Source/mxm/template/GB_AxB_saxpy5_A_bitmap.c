@@ -29,7 +29,11 @@
     // get C, A, and B
     //--------------------------------------------------------------------------
 
+    #ifdef GB_C_NROWS
+    const int64_t m = GB_C_NROWS ;  // # of rows of C and A, fixed by the JIT
+    #else
     const int64_t m = C->vlen ;     // # of rows of C and A
+    #endif
     const int8_t  *restrict Ab = A->b ;
     const int64_t *restrict Bp = B->p ;
     const int64_t *restrict Bh = B->h ;
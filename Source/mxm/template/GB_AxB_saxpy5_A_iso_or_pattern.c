@@ -28,7 +28,11 @@
     // get C, A, and B
     //--------------------------------------------------------------------------
 
+    #ifdef GB_C_NROWS
+    const int64_t m = GB_C_NROWS ;  // # of rows of C and A, fixed by the JIT
+    #else
     const int64_t m = C->vlen ;     // # of rows of C and A
+    #endif
     #if GB_A_IS_BITMAP
     const int8_t  *restrict Ab = A->b ;
     #endif
@@ -17,8 +17,12 @@
     #include "template/GB_AxB_dot4_template.c"
     #elif defined ( GB_DOT3_PHASE1 )
     #include "template/GB_AxB_dot3_phase1_template.c"
+    #elif defined ( GB_DOT3_REDUCE )
+    #include "template/GB_AxB_dot3_reduce_template.c"
     #elif defined ( GB_DOT3_PHASE2 )
     #include "template/GB_AxB_dot3_template.c"
+    #elif defined ( GB_DOT2_FINE )
+    #include "template/GB_AxB_dot2_fine_template.c"
     #elif defined ( GB_DOT2 )
     #include "template/GB_AxB_dot2_template.c"
 
@@ -22,6 +22,8 @@ GrB_Info GB_Op_free             // free a user-created op
         if (op != NULL)
         {
             GB_FREE (&(op->user_name), op->user_name_size) ;
+            GB_FREE (&(op->jit_C_flags), op->jit_C_flags_size) ;
+            GB_FREE (&(op->jit_C_object), op->jit_C_object_size) ;
             size_t defn_size = op->defn_size ;
             if (defn_size > 0)
             { 
@@ -60,10 +60,11 @@ GrB_Info GB_op_name_and_defn
     // get the operator name length (zero if no name given)
     (*op_name_len) = (int32_t) strlen (op_name) ;
 
-    // a user-defined op can only be JIT'd if it has a name and defn.
-    // a new builtin op (created by GB_reduce_to_vector) can always be JIT'd.
+    // a user-defined op can only be JIT'd if it has a name and defn (or an
+    // object file, set later by GrB_set with GxB_JIT_C_OBJECT).  A new builtin
+    // op (created by GB_reduce_to_vector) can always be JIT'd.
     (*op_hash) = GB_jitifyer_hash (op_name, (*op_name_len),
-        jitable && (!user_op || (*op_name_len) > 0)) ;
+        jitable && (!user_op || ((*op_name_len) > 0 && input_defn != NULL))) ;
 
     //--------------------------------------------------------------------------
     // get the definition of the operator, if present
@@ -41,6 +41,37 @@ void GB_Pending_free        // free a list of pending tuples
     GB_Pending *PHandle
 ) ;
 
+//------------------------------------------------------------------------------
+// shards of pending tuples, for concurrent setElement
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Pending_shards_set
+(
+    GrB_Matrix A,               // matrix to modify
+    int nshards,                // # of shards; 0 to disable
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_Pending_shards_add  // add a tuple to the shard of this thread
+(
+    GrB_Matrix A,                   // matrix to modify
+    const void *scalar,             // scalar to set
+    const GrB_Index row,            // row index
+    const GrB_Index col,            // column index
+    const GB_Type_code scalar_code  // type of the scalar
+) ;
+
+GrB_Info GB_Pending_shards_merge    // append all shards to A->Pending
+(
+    GrB_Matrix A,               // matrix with shards of pending tuples
+    GB_Werk Werk
+) ;
+
+void GB_Pending_shards_free     // free all shards of a matrix
+(
+    GrB_Matrix A
+) ;
+
 //------------------------------------------------------------------------------
 // GB_Pending_ensure: make sure the list of pending tuples is large enough
 //------------------------------------------------------------------------------
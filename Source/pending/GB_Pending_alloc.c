@@ -48,6 +48,7 @@ bool GB_Pending_alloc       // create a list of pending tuples
     Pending->n = 0 ;                    // no pending tuples yet
     Pending->nmax = nmax ;              // initial size of list
     Pending->sorted = true ;            // keep track if tuples are sorted
+    Pending->overlap = false ;          // tuples are not yet in A
     Pending->type = type ;              // type of pending tuples
     Pending->size = type->size ;        // size of pending tuple type
     Pending->op = (iso) ? NULL : op ;   // pending operator (NULL is OK)
@@ -0,0 +1,270 @@
+//------------------------------------------------------------------------------
+// GB_Pending_shards_add: add a tuple to a shard, for concurrent setElement
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_Pending_shards_add does the work for GrB_*_setElement when A->nshards >
+// 0.  It may be called by many user threads at the same time on the same
+// matrix A, as long as no other method is used on A by any thread while they
+// do so.  The tuple (i,j,x) is typecast to A->type and appended to the shard
+// of this thread, without looking up A(i,j) in A.  The next GB_wait (A)
+// appends all the shards to A->Pending and assembles them in a single call to
+// GB_builder.  If the same entry is set more than once by one thread, the last
+// value wins.  If it is set by more than one thread, one of the values is
+// kept, but which one is unspecified.
+
+// Each user thread is given a unique id the first time it calls this method,
+// and it uses the shard (id % A->nshards) of each matrix.  If A->nshards is at
+// least the number of user threads, no two threads share a shard and the
+// per-shard spin lock is never contended.  If the compiler does not support
+// thread-local storage, all threads use the shard 0 (this is still safe, but
+// the threads are serialized by the lock).
+
+// The first tuple added to A after A has been finished ensures that A->Shards
+// and A->Pending both exist (the latter with no tuples, if it did not exist
+// already), inside a critical section.  A is converted to sparse (if it is
+// bitmap or full), and to non-iso.  These changes are done while other threads
+// may be inside this method as well, but they only access A->vlen, A->vdim,
+// A->is_csc, A->type, A->nshards, A->shards_anchored, and A->Shards, which are
+// not modified by the conversions.
+
+// If the method runs out of memory, A is not cleared, since other threads may
+// still be appending tuples to it.  Errors are not logged in A, for the same
+// reason.
+
+#include "pending/GB_Pending.h"
+#define GB_FREE_ALL ;
+
+//------------------------------------------------------------------------------
+// GB_SHARD_ID: the id of this user thread, or -1 if not yet assigned
+//------------------------------------------------------------------------------
+
+#if defined ( _OPENMP )
+
+    // OpenMP threadprivate is preferred
+    int64_t GB_SHARD_ID = -1 ;
+    #pragma omp threadprivate (GB_SHARD_ID)
+
+#elif defined ( HAVE_KEYWORD__THREAD )
+
+    // gcc and many other compilers support the __thread keyword
+    __thread int64_t GB_SHARD_ID = -1 ;
+
+#elif defined ( HAVE_KEYWORD__DECLSPEC_THREAD )
+
+    // Windows: __declspec (thread)
+    __declspec ( thread ) int64_t GB_SHARD_ID = -1 ;
+
+#elif defined ( HAVE_KEYWORD__THREAD_LOCAL )
+
+    // C11 threads
+    #include <threads.h>
+    _Thread_local int64_t GB_SHARD_ID = -1 ;
+
+#else
+
+    // no thread-local storage: all threads use shard 0
+    #define NO_THREAD_LOCAL_STORAGE
+
+#endif
+
+// the next thread id to assign
+static int64_t GB_shard_next_id = 0 ;
+
+//------------------------------------------------------------------------------
+// GB_shard_id: get the id of this user thread
+//------------------------------------------------------------------------------
+
+static inline int64_t GB_shard_id (void)
+{
+    #ifdef NO_THREAD_LOCAL_STORAGE
+    return (0) ;
+    #else
+    if (GB_SHARD_ID < 0)
+    {
+        // first call by this thread: get the next unique id
+        int64_t id ;
+        GB_ATOMIC_CAPTURE_INC64 (id, GB_shard_next_id) ;
+        GB_SHARD_ID = id ;
+    }
+    return (GB_SHARD_ID) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_shards_anchor: ensure A->Shards and A->Pending exist
+//------------------------------------------------------------------------------
+
+// This is called by only one thread at a time, inside a critical section.
+
+static GrB_Info GB_shards_anchor
+(
+    GrB_Matrix A,
+    GB_Werk Werk
+)
+{
+
+    GrB_Info info ;
+    if (A->shards_anchored)
+    {
+        // another thread has already anchored the shards
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finish any background wait of A, since A is about to be modified
+    //--------------------------------------------------------------------------
+
+    GB_WAIT_BACKGROUND (A) ;
+
+    //--------------------------------------------------------------------------
+    // A must be sparse or hypersparse, and non-iso
+    //--------------------------------------------------------------------------
+
+    if (A->Pending == NULL)
+    {
+        if (GB_IS_BITMAP (A))
+        {
+            GB_OK (GB_convert_bitmap_to_sparse (A, Werk)) ;
+        }
+        else if (GB_IS_FULL (A))
+        {
+            GB_OK (GB_convert_full_to_sparse (A)) ;
+        }
+        if (A->iso)
+        {
+            GB_OK (GB_convert_any_to_non_iso (A, true)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the shards, each with no pending tuples yet
+    //--------------------------------------------------------------------------
+
+    if (A->Shards == NULL)
+    {
+        A->Shards = GB_CALLOC (A->nshards, GB_Shard, &(A->Shards_size)) ;
+        if (A->Shards == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // ensure A->Pending exists, so that GB_PENDING (A) is true
+    //--------------------------------------------------------------------------
+
+    if (A->Pending == NULL)
+    {
+        if (!GB_Pending_alloc (&(A->Pending), false, A->type, NULL,
+            A->vdim > 1, 1))
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // let all threads know that the shards are ready
+    //--------------------------------------------------------------------------
+
+    GB_ATOMIC_WRITE
+    A->shards_anchored = 1 ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Pending_shards_add
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Pending_shards_add  // add a tuple to the shard of this thread
+(
+    GrB_Matrix A,                   // matrix to modify
+    const void *scalar,             // scalar to set
+    const GrB_Index row,            // row index
+    const GrB_Index col,            // column index
+    const GB_Type_code scalar_code  // type of the scalar
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GrB_setElement (A, x, row, col) (concurrent)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL (scalar) ;
+    ASSERT (A->nshards > 0) ;
+
+    if (row >= GB_NROWS (A) || col >= GB_NCOLS (A))
+    {
+        return (GrB_INVALID_INDEX) ;
+    }
+
+    GrB_Type atype = A->type ;
+    GB_Type_code acode = atype->code ;
+    if (!GB_code_compatible (scalar_code, acode))
+    {
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // typecast the scalar to the type of A
+    //--------------------------------------------------------------------------
+
+    size_t asize = atype->size ;
+    GB_void s [GB_VLA(asize)] ;
+    GB_cast_scalar (s, acode, scalar, scalar_code, asize) ;
+
+    int64_t i = (A->is_csc) ? row : col ;
+    int64_t j = (A->is_csc) ? col : row ;
+
+    //--------------------------------------------------------------------------
+    // ensure A->Shards and A->Pending exist
+    //--------------------------------------------------------------------------
+
+    int32_t anchored ;
+    GB_ATOMIC_READ
+    anchored = A->shards_anchored ;
+
+    if (!anchored)
+    {
+        GrB_Info info ;
+        #pragma omp critical (GB_shards)
+        {
+            info = GB_shards_anchor (A, Werk) ;
+        }
+        if (info != GrB_SUCCESS)
+        {
+            return (info) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // append the tuple to the shard of this thread
+    //--------------------------------------------------------------------------
+
+    GB_Shard *shard = &(A->Shards [GB_shard_id ( ) % A->nshards]) ;
+
+    // acquire the lock of this shard
+    int32_t unlocked, locked = 1 ;
+    do
+    {
+        unlocked = 0 ;
+    }
+    while (!GB_ATOMIC_COMPARE_EXCHANGE_32 (&(shard->lock), unlocked, locked)) ;
+
+    bool ok = GB_Pending_add (&(shard->Pending), false, s, atype, NULL, i, j,
+        A->vdim > 1, Werk) ;
+
+    // release the lock
+    GB_ATOMIC_WRITE
+    shard->lock = 0 ;
+
+    return (ok ? GrB_SUCCESS : GrB_OUT_OF_MEMORY) ;
+}
@@ -0,0 +1,38 @@
+//------------------------------------------------------------------------------
+// GB_Pending_shards_free: free the shards of pending tuples of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// All pending tuples in the shards of A are discarded, and A->Shards is freed.
+// A->nshards is not modified, so concurrent setElement remains enabled.  The
+// caller is responsible for A->Pending.
+
+#include "pending/GB_Pending.h"
+
+void GB_Pending_shards_free     // free all shards of a matrix
+(
+    GrB_Matrix A
+)
+{
+
+    if (A == NULL)
+    { 
+        return ;
+    }
+
+    if (A->Shards != NULL)
+    {
+        for (int64_t k = 0 ; k < A->nshards ; k++)
+        { 
+            GB_Pending_free (&(A->Shards [k].Pending)) ;
+        }
+        GB_FREE (&(A->Shards), A->Shards_size) ;
+    }
+    A->Shards = NULL ;
+    A->Shards_size = 0 ;
+    A->shards_anchored = 0 ;
+}
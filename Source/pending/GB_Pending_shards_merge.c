@@ -0,0 +1,219 @@
+//------------------------------------------------------------------------------
+// GB_Pending_shards_merge: append all shards of pending tuples to A->Pending
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Called by GB_wait when A->shards_anchored is true.  The tuples in all the
+// shards of A, added by concurrent calls to GrB_setElement, are appended to
+// A->Pending, in parallel, and A->Shards is freed.  GB_wait then assembles
+// them all with a single call to GB_builder.  The prior tuples in A->Pending
+// come first, so that they are overwritten by the tuples from the shards.
+// Unlike the tuples added by GB_setElement, the tuples from the shards may
+// be entries already in A, so A->Pending->overlap is set true.
+
+// The tuples in the shards have the type of A and use the implicit SECOND
+// operator.  If the prior tuples in A->Pending differ (in their type, their
+// pending operator, or if they are iso), they are assembled first.
+
+#include "pending/GB_Pending.h"
+
+#define GB_FREE_ALL                                             \
+{                                                               \
+    GB_WERK_POP (Shard_start, int64_t) ;                        \
+    A->Shards = Shards ;                                        \
+    A->Shards_size = Shards_size ;                              \
+    GB_Pending_shards_free (A) ;                                \
+}
+
+GrB_Info GB_Pending_shards_merge    // append all shards to A->Pending
+(
+    GrB_Matrix A,               // matrix with shards of pending tuples
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_WERK_DECLARE (Shard_start, int64_t) ;
+    ASSERT (A != NULL) ;
+    ASSERT (A->shards_anchored) ;
+    ASSERT (A->Shards != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // detach the shards from A
+    //--------------------------------------------------------------------------
+
+    GB_Shard *Shards = A->Shards ;
+    size_t Shards_size = A->Shards_size ;
+    int64_t nshards = A->nshards ;
+    A->Shards = NULL ;
+    A->Shards_size = 0 ;
+    A->shards_anchored = 0 ;
+
+    //--------------------------------------------------------------------------
+    // count the tuples in all the shards
+    //--------------------------------------------------------------------------
+
+    int64_t nnew = 0 ;
+    for (int64_t k = 0 ; k < nshards ; k++)
+    {
+        GB_Pending P = Shards [k].Pending ;
+        if (P != NULL)
+        {
+            nnew += P->n ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // assemble any prior pending tuples that cannot be merged with the shards
+    //--------------------------------------------------------------------------
+
+    GB_Pending Pending = A->Pending ;
+    if (Pending != NULL && Pending->n == 0)
+    {
+        // A->Pending holds no tuples of its own
+        GB_Pending_free (&(A->Pending)) ;
+    }
+    else if (Pending != NULL && nnew > 0 && (Pending->type != A->type
+        || Pending->x == NULL || !GB_op_is_second (Pending->op, A->type)))
+    {
+        // A->shards_anchored is now false, so GB_wait does not recurse
+        GB_OK (GB_wait (A, "A (shards:incompatible pending tuples)", Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // ensure A is sparse or hypersparse, and non-iso
+    //--------------------------------------------------------------------------
+
+    if (nnew > 0 && A->Pending == NULL)
+    {
+        // A is only bitmap, full, or iso if it was just finished by GB_wait
+        if (GB_IS_BITMAP (A))
+        {
+            GB_OK (GB_convert_bitmap_to_sparse (A, Werk)) ;
+        }
+        else if (GB_IS_FULL (A))
+        {
+            GB_OK (GB_convert_full_to_sparse (A)) ;
+        }
+        if (A->iso)
+        {
+            GB_OK (GB_convert_any_to_non_iso (A, true)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // append the shards to A->Pending
+    //--------------------------------------------------------------------------
+
+    if (nnew > 0)
+    {
+
+        //----------------------------------------------------------------------
+        // ensure A->Pending is large enough
+        //----------------------------------------------------------------------
+
+        bool is_matrix = (A->vdim > 1) ;
+        if (!GB_Pending_ensure (&(A->Pending), false, A->type, NULL, is_matrix,
+            nnew, Werk))
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        Pending = A->Pending ;
+        ASSERT (Pending->type == A->type) ;
+        ASSERT (Pending->x != NULL) ;
+
+        //----------------------------------------------------------------------
+        // find where each shard goes
+        //----------------------------------------------------------------------
+
+        // The tuples of shard k are appended at positions Shard_start [k]
+        // to Shard_start [k+1]-1 of A->Pending.
+        GB_WERK_PUSH (Shard_start, nshards + 1, int64_t) ;
+        if (Shard_start == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        int64_t npending = Pending->n ;
+        int64_t pstart = npending ;
+        for (int64_t k = 0 ; k < nshards ; k++)
+        {
+            GB_Pending P = Shards [k].Pending ;
+            Shard_start [k] = pstart ;
+            pstart += (P == NULL) ? 0 : P->n ;
+        }
+        Shard_start [nshards] = pstart ;
+        ASSERT (pstart == npending + nnew) ;
+
+        //----------------------------------------------------------------------
+        // copy the tuples of each shard into A->Pending
+        //----------------------------------------------------------------------
+
+        int64_t *restrict Pending_i = Pending->i ;
+        int64_t *restrict Pending_j = Pending->j ;
+        GB_void *restrict Pending_x = Pending->x ;
+        size_t asize = A->type->size ;
+
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        double chunk = GB_Context_chunk ( ) ;
+        int nthreads = GB_nthreads (nnew, chunk, nthreads_max) ;
+        nthreads = GB_IMIN (nthreads, nshards) ;
+
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (k = 0 ; k < nshards ; k++)
+        {
+            GB_Pending P = Shards [k].Pending ;
+            if (P == NULL || P->n == 0) continue ;
+            int64_t p = Shard_start [k] ;
+            int64_t n = Shard_start [k+1] - p ;
+            memcpy (Pending_i + p, P->i, n * sizeof (int64_t)) ;
+            if (Pending_j != NULL)
+            {
+                memcpy (Pending_j + p, P->j, n * sizeof (int64_t)) ;
+            }
+            memcpy (Pending_x + p * asize, P->x, n * asize) ;
+        }
+
+        //----------------------------------------------------------------------
+        // the merged tuples are sorted only if they came from one sorted shard
+        //----------------------------------------------------------------------
+
+        int64_t nsorted = 0 ;
+        bool sorted = (npending == 0) ;
+        for (k = 0 ; k < nshards ; k++)
+        {
+            GB_Pending P = Shards [k].Pending ;
+            if (P == NULL || P->n == 0) continue ;
+            nsorted++ ;
+            sorted = sorted && P->sorted ;
+        }
+        Pending->sorted = sorted && (nsorted == 1) ;
+        Pending->n = npending + nnew ;
+
+        // GrB_setElement does not look up A(i,j) when it adds a tuple to a
+        // shard, so the tuples may include entries already in A
+        Pending->overlap = true ;
+        GB_WERK_POP (Shard_start, int64_t) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free the shards
+    //--------------------------------------------------------------------------
+
+    A->Shards = Shards ;
+    A->Shards_size = Shards_size ;
+    GB_Pending_shards_free (A) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,51 @@
+//------------------------------------------------------------------------------
+// GB_Pending_shards_set: enable or disable concurrent setElement on a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GrB_set (A, nshards, GxB_PENDING_SHARDS) finishes all pending work on A,
+// including any tuples held in its current shards, and then sets the # of
+// shards to use for concurrent setElement.  If nshards is zero, GrB_setElement
+// reverts to its usual method, and A may no longer be modified by more than
+// one user thread at a time.  The shards are allocated when the first tuple
+// is added to them; see GB_Pending_shards_add.
+
+#include "pending/GB_Pending.h"
+#define GB_FREE_ALL ;
+
+GrB_Info GB_Pending_shards_set
+(
+    GrB_Matrix A,               // matrix to modify
+    int nshards,                // # of shards; 0 to disable
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (A != NULL) ;
+    if (nshards < 0)
+    { 
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finish all pending work on A, and free its shards
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (A) ;
+    ASSERT (A->Shards == NULL && !A->shards_anchored) ;
+
+    //--------------------------------------------------------------------------
+    // set the # of shards
+    //--------------------------------------------------------------------------
+
+    A->nshards = nshards ;
+    return (GrB_SUCCESS) ;
+}
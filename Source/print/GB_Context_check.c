@@ -47,6 +47,13 @@ GrB_Info GB_Context_check       // check a GraphBLAS Context
     int gpu_id = GB_Context_gpu_id_get (Context) ;
     if (gpu_id >= 0) GBPR0 ("    Context.gpu_id:   %d\n", gpu_id) ;
 
+    int64_t werk_max_size = GB_Context_werk_max_size_get (Context) ;
+    if (werk_max_size > 0)
+    { 
+        GBPR0 ("    Context.werk:     " GBd " of " GBd " bytes\n",
+            GB_Context_werk_size_get (Context), werk_max_size) ;
+    }
+
     return (GrB_SUCCESS) ;
 }
 
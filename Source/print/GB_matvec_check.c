@@ -504,6 +504,24 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
             A->nzombies) ;
     }
 
+    if (A->nshards < 0 ||
+        (A->shards_anchored && (A->Shards == NULL || Pending == NULL)))
+    {
+        // shards for concurrent setElement are invalid
+        GBPR0 ("  invalid shards for concurrent setElement\n") ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    if (A->shards_anchored)
+    {
+        GBPR0 ("  pending tuples in " GBd " shards\n", (int64_t) A->nshards) ;
+    }
+
+    if (A->Background != NULL)
+    { 
+        GBPR0 ("  background wait in progress\n") ;
+    }
+
     if (is_full || is_bitmap)
     {
         if (A->nzombies != 0)
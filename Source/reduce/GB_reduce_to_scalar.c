@@ -305,6 +305,7 @@ GrB_Info GB_reduce_to_scalar    // z = reduce_to_scalar (A)
                 // generic worker: sum up the entries, no typecasting
                 //--------------------------------------------------------------
 
+                GB_JIT_GENERIC (GB_jit_reduce_family) ;
                 GB_BURBLE_MATRIX (A, "(generic reduce to scalar: %s) ",
                     monoid->op->name) ;
 
@@ -347,6 +348,7 @@ GrB_Info GB_reduce_to_scalar    // z = reduce_to_scalar (A)
                 // generic worker: sum up the entries, with typecasting
                 //--------------------------------------------------------------
 
+                GB_JIT_GENERIC (GB_jit_reduce_family) ;
                 GB_BURBLE_MATRIX (A, "(generic reduce to scalar, with typecast:"
                     " %s) ", monoid->op->name) ;
 
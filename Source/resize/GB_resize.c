@@ -40,6 +40,7 @@ GrB_Info GB_resize              // change the size of a matrix
     GrB_Info info ;
     GB_void *restrict Ax_new = NULL ; size_t Ax_new_size = 0 ;
     int8_t  *restrict Ab_new = NULL ; size_t Ab_new_size = 0 ;
+    GB_WAIT_BACKGROUND (A) ;    // A is about to be modified
     ASSERT_MATRIX_OK (A, "A to resize", GB0) ;
 
     //--------------------------------------------------------------------------
@@ -64,6 +64,12 @@ GrB_Scalar GB_Scalar_wrap   // create a new GrB_Scalar with one entry
     s->Pending = NULL ;
     s->nzombies = 0 ;
 
+    s->nshards = 0 ;
+    s->shards_anchored = 0 ;
+    s->Shards = NULL ;
+    s->Shards_size = 0 ;
+    s->Background = NULL ;
+
     s->hyper_switch  = GxB_NEVER_HYPER ;
     s->bitmap_switch = 0.5 ;
     s->sparsity_control = GxB_FULL ;
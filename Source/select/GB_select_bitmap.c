@@ -159,6 +159,7 @@ GrB_Info GB_select_bitmap
 
             if (info == GrB_NO_VALUE)
             { 
+                GB_JIT_GENERIC (GB_jit_select_family) ;
                 info = GB_select_generic_bitmap (C->b, &cnvals, A, flipij, ythunk,
                     op, nthreads) ;
             }
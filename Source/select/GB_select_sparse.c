@@ -223,6 +223,7 @@ GrB_Info GB_select_sparse
 
         if (info == GrB_NO_VALUE)
         { 
+            GB_JIT_GENERIC (GB_jit_select_family) ;
             // generic entry selector, phase1
             info = GB_select_generic_phase1 (Cp, Wfirst, Wlast,
                 A, flipij, ythunk, op, A_ek_slicing, A_ntasks, A_nthreads) ;
@@ -48,6 +48,10 @@ GrB_Info GB_Semiring_new            // create a semiring
     semiring->add = add ;
     semiring->multiply = multiply ;
     semiring->name = NULL ;
+    semiring->jit_C_flags = NULL ;          // no JIT options yet
+    semiring->jit_C_flags_size = 0 ;
+    semiring->jit_control = GxB_JIT_DEFAULT ;
+    semiring->jit_control_set = false ;
     if (add->hash == 0 && multiply->hash == 0)
     { 
         // semiring consists of builtin types and operators only;
@@ -76,8 +80,25 @@ GrB_Info GB_Semiring_new            // create a semiring
         (*p) = '\0' ;
         // construct the semiring hash from the newly created name.
         // the semiring is JIT'able only if its 2 operators are JIT'able.
+        bool jitable = (add->hash != UINT64_MAX &&
+            multiply->hash != UINT64_MAX) ;
         semiring->hash = GB_jitifyer_hash (semiring->name, semiring->name_len,
-            add->hash != UINT64_MAX && multiply->hash != UINT64_MAX) ;
+            jitable) ;
+        if (jitable && ((add->op->jit_C_object != NULL &&
+            add->op->defn == NULL) || (multiply->jit_C_object != NULL &&
+            multiply->defn == NULL)))
+        { 
+            // an operator is given as an object file (GxB_JIT_C_OBJECT), so
+            // fold the hashes of the monoid and multiply operator into the
+            // semiring hash; they include the path and modification time of
+            // the object file
+            uint64_t hashes [3] ;
+            hashes [0] = semiring->hash ;
+            hashes [1] = add->hash ;
+            hashes [2] = multiply->hash ;
+            semiring->hash = GB_jitifyer_hash (hashes, 3 * sizeof (uint64_t),
+                true) ;
+        }
     }
     ASSERT_SEMIRING_OK (semiring, "new semiring", GB0) ;
     return (GrB_SUCCESS) ;
@@ -11,6 +11,7 @@
 // No operator is applied and no typecasting is done.
 
 #include "transpose/GB_transpose.h"
+#define GB_FREE_ALL ;
 
 GrB_Info GB_transpose_in_place   // C=A', no change of type, no operators
 (
@@ -19,6 +20,8 @@ GrB_Info GB_transpose_in_place   // C=A', no change of type, no operators
     GB_Werk Werk
 )
 { 
+    GrB_Info info ;
+    GB_WAIT_BACKGROUND (C) ;    // C is about to be modified
     return (GB_transpose (C, NULL, C_is_csc, C,
         NULL, NULL, false, false,       // no operator
         Werk)) ;
@@ -134,6 +134,7 @@ GrB_Info GB_transpose_ix        // transpose the pattern and values of a matrix
 
         if (info == GrB_NO_VALUE)
         { 
+            GB_JIT_GENERIC (GB_jit_apply_family) ;
             GB_BURBLE_MATRIX (A, "(generic transpose) ") ;
             size_t csize = C->type->size ;
             GB_cast_function cast_A_to_X = GB_cast_factory (code1, code2) ;
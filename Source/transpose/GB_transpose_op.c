@@ -163,6 +163,7 @@ GrB_Info GB_transpose_op // transpose, typecast, and apply operator to a matrix
 
         if (info == GrB_NO_VALUE)
         {
+            GB_JIT_GENERIC (GB_jit_apply_family) ;
             GB_BURBLE_MATRIX (A, "(generic transpose: %s) ", op->name) ;
 
             size_t asize = Atype->size ;
@@ -358,6 +359,7 @@ GrB_Info GB_transpose_op // transpose, typecast, and apply operator to a matrix
 
         if (info == GrB_NO_VALUE)
         {
+            GB_JIT_GENERIC (GB_jit_ewise_family) ;
             GB_BURBLE_MATRIX (A, "(generic transpose: %s) ", op->name) ;
 
             if (binop_bind1st)
@@ -22,6 +22,7 @@ GrB_Info GrB_Type_free          // free a user-defined type
         if (t != NULL)
         {
             GB_FREE (&(t->user_name), t->user_name_size) ;
+            GB_FREE (&(t->jit_C_flags), t->jit_C_flags_size) ;
             size_t defn_size = t->defn_size ;
             if (defn_size > 0)
             { 
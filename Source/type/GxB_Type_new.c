@@ -83,6 +83,10 @@ GrB_Info GxB_Type_new
     memset (t->name, 0, GxB_MAX_NAME_LEN) ;   // no name yet
     t->defn = NULL ;                // no definition yet
     t->defn_size = 0 ;
+    t->jit_C_flags = NULL ;         // no JIT options yet
+    t->jit_C_flags_size = 0 ;
+    t->jit_control = GxB_JIT_DEFAULT ;
+    t->jit_control_set = false ;
 
     //--------------------------------------------------------------------------
     // get the name
@@ -53,6 +53,12 @@ GrB_Info GB_unop_new
     op->binop_function = NULL ;
 
     op->opcode = opcode ;
+    op->jit_C_flags = NULL ;
+    op->jit_C_flags_size = 0 ;
+    op->jit_control = GxB_JIT_DEFAULT ;
+    op->jit_control_set = false ;
+    op->jit_C_object = NULL ;
+    op->jit_C_object_size = 0 ;
 
     //--------------------------------------------------------------------------
     // get the unary op name and defn
@@ -77,6 +77,24 @@ GrB_Info GB_wait                // finish all pending computations
 
     ASSERT_MATRIX_OK (A, "A to wait", GB_FLIP (GB0)) ;
 
+    //--------------------------------------------------------------------------
+    // install the result of any background wait of A
+    //--------------------------------------------------------------------------
+
+    // This blocks until the background thread is done.  If it succeeded, A
+    // now has no pending work, except possibly for new shards.
+
+    GB_WAIT_BACKGROUND (A) ;
+
+    //--------------------------------------------------------------------------
+    // append the tuples from concurrent setElement to A->Pending
+    //--------------------------------------------------------------------------
+
+    if (A->shards_anchored)
+    {
+        GB_OK (GB_Pending_shards_merge (A, Werk)) ;
+    }
+
     if (GB_IS_FULL (A) || GB_IS_BITMAP (A))
     { 
         // full and bitmap matrices never have any pending work
@@ -156,6 +174,7 @@ GrB_Info GB_wait                // finish all pending computations
     int64_t asize = A->type->size ;
 
     int64_t tnz = 0 ;
+    bool A_and_T_are_disjoint = true ;
     if (npending > 0)
     {
 
@@ -172,6 +191,10 @@ GrB_Info GB_wait                // finish all pending computations
         GB_void *S_input = (A_iso) ? ((GB_void *) A->x) : NULL ;
         GrB_Type stype = (A_iso) ? A->type : A->Pending->type ;
 
+        // The pending tuples are entries not already in A, unless they came
+        // from the shards of A (see GB_Pending_shards_merge).
+        A_and_T_are_disjoint = !(A->Pending->overlap) ;
+
         GB_CLEAR_STATIC_HEADER (T, &T_header) ;
         info = GB_builder (
             T,                      // create T using a static header
@@ -367,7 +390,7 @@ GrB_Info GB_wait                // finish all pending computations
     int64_t anz1 = anz - anz0 ;
     bool ignore ;
 
-    // A + T will have anz_new entries
+    // A + T will have anz_new entries (or fewer, if A and T overlap)
     int64_t anz_new = anz + tnz ;       // must have at least this space
 
     if (2 * anz1 < anz0)
@@ -459,7 +482,7 @@ GrB_Info GB_wait                // finish all pending computations
     
             GB_CLEAR_STATIC_HEADER (S, &S_header) ;
             GB_OK (GB_add (S, A->type, A->is_csc, NULL, 0, 0, &ignore, A1, T,
-                false, NULL, NULL, op_2nd, true, Werk)) ;
+                false, NULL, NULL, op_2nd, A_and_T_are_disjoint, Werk)) ;
 
             ASSERT_MATRIX_OK (S, "S = A1+T", GB0) ;
 
@@ -517,7 +540,8 @@ GrB_Info GB_wait                // finish all pending computations
         }
 
         GB_jwrapup (A, jlast, anz) ;
-        ASSERT (anz == anz_new) ;
+        ASSERT (GB_IMPLIES (A_and_T_are_disjoint, anz == anz_new)) ;
+        ASSERT (anz <= anz_new) ;
 
         // need to recompute the # of non-empty vectors in GB_conform
         A->nvec_nonempty = -1 ;     // recomputed just below
@@ -556,7 +580,7 @@ GrB_Info GB_wait                // finish all pending computations
 
         GB_CLEAR_STATIC_HEADER (S, &S_header) ;
         GB_OK (GB_add (S, A->type, A->is_csc, NULL, 0, 0, &ignore, A, T,
-            false, NULL, NULL, op_2nd, true, Werk)) ;
+            false, NULL, NULL, op_2nd, A_and_T_are_disjoint, Werk)) ;
         GB_Matrix_free (&T) ;
         ASSERT_MATRIX_OK (S, "S after GB_wait:add", GB0) ;
 
@@ -29,6 +29,32 @@ GrB_Info GB_unjumble        // unjumble a matrix
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_wait_background_start   // start GB_wait (A) in a background thread
+(
+    GrB_Matrix A,               // matrix with pending computations
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_wait_background_finish  // finish a background wait of A
+(
+    GrB_Matrix A,               // matrix with a background wait, if any
+    GB_Werk Werk
+) ;
+
+void GB_wait_background_cancel      // discard a background wait of A
+(
+    GrB_Matrix A                // matrix whose content is about to be freed
+) ;
+
+// finish any background wait of A, before A is modified
+#define GB_WAIT_BACKGROUND(A)                                           \
+{                                                                       \
+    if ((A) != NULL && (A)->Background != NULL)                         \
+    {                                                                   \
+        GB_OK (GB_wait_background_finish ((GrB_Matrix) (A), Werk)) ;   \
+    }                                                                   \
+}
+
 // wait if condition holds
 #define GB_WAIT_IF(condition,A,name)                                    \
 {                                                                       \
@@ -0,0 +1,325 @@
+//------------------------------------------------------------------------------
+// GB_wait_background: finish the pending work of a matrix in the background
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GrB_wait (A, GxB_BACKGROUND) calls GB_wait_background_start, which starts a
+// thread that makes a private copy W of A (including its zombies and pending
+// tuples), and then finishes W with GB_wait and GB_hyper_hash_build.  The
+// user thread returns at once.  A itself is not modified by the background
+// thread, and A must not be modified by the user thread while the background
+// thread reads it.  So:
+
+// (1) methods that only read A, and do not need it finished (extractElement
+//      of a matrix with zombies but no pending tuples, GxB_print, GrB_get,
+//      ...) use A as-is, while the background thread runs.
+
+// (2) GB_wait (A), and thus any method that needs A finished, calls
+//      GB_wait_background_finish, which waits for the thread (if it is still
+//      running) and transplants W into A.  Only the remaining part of the
+//      work is waited for.
+
+// (3) methods that modify A without finishing it first (setElement,
+//      removeElement, assign, subassign, GB_conform, GB_convert_any_to_*,
+//      GB_resize, GB_transpose_in_place, GB_export, and GrB_set) also call
+//      GB_wait_background_finish, with the GB_WAIT_BACKGROUND macro.  A is
+//      sparse or hypersparse while a background wait is in progress, so
+//      methods that modify only full or bitmap matrices in-place need not.
+
+// (4) methods that free the content of A (GB_phy_free and GB_bix_free, and
+//      thus any method that overwrites A, and GrB_free) discard the result
+//      with GB_wait_background_cancel, after waiting for the thread.
+
+// A->Background is accessed only by the user thread that owns A.  A background
+// wait does not make A safe to share with other user threads (GrB_MATERIALIZE
+// is required for that).  If the thread runs out of memory, its result is
+// discarded, and the next GB_wait (A) does all of the work itself.
+
+// The background thread is a POSIX thread.  If GraphBLAS is compiled without
+// pthreads, or if the thread cannot be created, GB_wait_background_start
+// finishes A before returning, just like GrB_wait (A, GrB_MATERIALIZE).
+
+#include "pending/GB_Pending.h"
+#include "dup/GB_dup.h"
+#include "transplant/GB_transplant.h"
+#if defined ( GRAPHBLAS_HAS_PTHREADS )
+#include <pthread.h>
+#endif
+
+#define GB_FREE_ALL ;
+
+//------------------------------------------------------------------------------
+// GB_Background_struct: the state of a background wait
+//------------------------------------------------------------------------------
+
+struct GB_Background_struct
+{
+    size_t header_size ;        // size of the malloc'd block for this struct
+    #if defined ( GRAPHBLAS_HAS_PTHREADS )
+    pthread_t thread ;          // the background thread
+    #endif
+    struct GB_Matrix_opaque A_header ;  // shallow copy of A, without its
+                                // pending tuples, shards, name, and A->Y
+    GB_Pending Pending ;        // A->Pending when the thread was started
+    GrB_Matrix W ;              // A with all its work finished, or NULL
+    GrB_Info info ;             // status of the background thread
+} ;
+
+//------------------------------------------------------------------------------
+// GB_wait_background_worker: finish a copy of A in the background
+//------------------------------------------------------------------------------
+
+#if defined ( GRAPHBLAS_HAS_PTHREADS )
+
+static GrB_Info GB_wait_background_work
+(
+    GB_Background job,
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // W = A, with its zombies and jumbled vectors, but no pending tuples yet
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix A = &(job->A_header) ;
+    GB_OK (GB_dup_worker (&(job->W), A->iso, A, true, NULL)) ;
+    GrB_Matrix W = job->W ;
+    W->bitmap_switch = A->bitmap_switch ;
+    W->no_hyper_hash = A->no_hyper_hash ;
+
+    //--------------------------------------------------------------------------
+    // copy the pending tuples of A into W
+    //--------------------------------------------------------------------------
+
+    GB_Pending Pending = job->Pending ;
+    if (Pending != NULL && Pending->n > 0)
+    {
+        int64_t n = Pending->n ;
+        if (!GB_Pending_alloc (&(W->Pending), Pending->x == NULL,
+            Pending->type, Pending->op, Pending->j != NULL, n))
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        GB_Pending WPending = W->Pending ;
+        GB_memcpy (WPending->i, Pending->i, n * sizeof (int64_t),
+            nthreads_max) ;
+        if (Pending->j != NULL)
+        {
+            GB_memcpy (WPending->j, Pending->j, n * sizeof (int64_t),
+                nthreads_max) ;
+        }
+        if (Pending->x != NULL)
+        {
+            GB_memcpy (WPending->x, Pending->x, n * Pending->size,
+                nthreads_max) ;
+        }
+        WPending->n = n ;
+        WPending->sorted = Pending->sorted ;
+        WPending->overlap = Pending->overlap ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finish W
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_wait (W, "matrix (background)", Werk)) ;
+    GB_OK (GB_hyper_hash_build (W, Werk)) ;
+    return (GrB_SUCCESS) ;
+}
+
+static void *GB_wait_background_worker (void *arg)
+{
+    GB_Background job = (GB_Background) arg ;
+    GB_WERK ("GrB_wait (background)") ;
+    job->info = GB_wait_background_work (job, Werk) ;
+    if (job->info != GrB_SUCCESS)
+    {
+        // the caller will do all the work itself
+        GB_Matrix_free (&(job->W)) ;
+    }
+    return (NULL) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_wait_background_join: wait for the background thread and free its state
+//------------------------------------------------------------------------------
+
+// Returns the finished copy of A, or NULL if the background thread failed.
+
+static GrB_Matrix GB_wait_background_join
+(
+    GrB_Matrix A
+)
+{
+    GB_Background job = A->Background ;
+    A->Background = NULL ;
+    #if defined ( GRAPHBLAS_HAS_PTHREADS )
+    pthread_join (job->thread, NULL) ;
+    #endif
+    GrB_Matrix W = job->W ;
+    size_t header_size = job->header_size ;
+    GB_FREE (&job, header_size) ;
+    return (W) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_wait_background_start: start GB_wait (A) in a background thread
+//------------------------------------------------------------------------------
+
+GrB_Info GB_wait_background_start   // start GB_wait (A) in a background thread
+(
+    GrB_Matrix A,               // matrix with pending computations
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT_MATRIX_OK (A, "A to wait in the background", GB0) ;
+    if (A->Background != NULL)
+    {
+        // A background wait of A is already in progress
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // append any shards of pending tuples to A->Pending
+    //--------------------------------------------------------------------------
+
+    if (A->shards_anchored)
+    {
+        GB_OK (GB_Pending_shards_merge (A, Werk)) ;
+    }
+
+    if (!GB_ANY_PENDING_WORK (A))
+    {
+        // only the A->Y hyper_hash might be needed; construct it now
+        return (GB_hyper_hash_build (A, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // start the background thread
+    //--------------------------------------------------------------------------
+
+    #if defined ( GRAPHBLAS_HAS_PTHREADS )
+    size_t header_size ;
+    GB_Background job = GB_CALLOC (1, struct GB_Background_struct,
+        &header_size) ;
+    if (job != NULL)
+    {
+        // the thread reads a copy of the header of A, and the content of A
+        job->header_size = header_size ;
+        memcpy (&(job->A_header), A, sizeof (struct GB_Matrix_opaque)) ;
+        GrB_Matrix S = &(job->A_header) ;
+        S->user_name = NULL ;
+        S->user_name_size = 0 ;
+        S->logger = NULL ;
+        S->logger_size = 0 ;
+        S->Y = NULL ;
+        S->Y_shallow = false ;
+        S->Pending = NULL ;
+        S->nshards = 0 ;
+        S->shards_anchored = 0 ;
+        S->Shards = NULL ;
+        S->Shards_size = 0 ;
+        S->Background = NULL ;
+        S->p_shallow = true ;
+        S->h_shallow = true ;
+        S->b_shallow = true ;
+        S->i_shallow = true ;
+        S->x_shallow = true ;
+        job->Pending = A->Pending ;
+        job->W = NULL ;
+        job->info = GrB_SUCCESS ;
+        if (pthread_create (&(job->thread), NULL, GB_wait_background_worker,
+            job) == 0)
+        {
+            GBURBLE ("(wait: background) ") ;
+            A->Background = job ;
+            return (GrB_SUCCESS) ;
+        }
+        // the thread could not be created
+        GB_FREE (&job, header_size) ;
+    }
+    #endif
+
+    //--------------------------------------------------------------------------
+    // no background thread: finish A now
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_wait (A, "matrix", Werk)) ;
+    return (GB_hyper_hash_build (A, Werk)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_wait_background_finish: finish a background wait of A
+//------------------------------------------------------------------------------
+
+// If the background wait was successful, the finished copy of A is
+// transplanted into A, which then has no pending work.  Otherwise, A is
+// unchanged (and still has all of its pending work).
+
+GrB_Info GB_wait_background_finish  // finish a background wait of A
+(
+    GrB_Matrix A,               // matrix with a background wait, if any
+    GB_Werk Werk
+)
+{
+
+    if (A == NULL || A->Background == NULL)
+    {
+        // no background wait of A is in progress
+        return (GrB_SUCCESS) ;
+    }
+
+    // wait for the background thread, if it is still running
+    GrB_Matrix W = GB_wait_background_join (A) ;
+    if (W == NULL)
+    {
+        // the background thread failed; A is unchanged
+        return (GrB_SUCCESS) ;
+    }
+
+    // A has not been modified since the thread was started, and W is A with
+    // all of its work finished.  Transplant W into A and free W.
+    GBURBLE ("(wait: background done) ") ;
+    ASSERT_MATRIX_OK (W, "W from background wait", GB0) ;
+    return (GB_transplant_conform (A, A->type, &W, Werk)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_wait_background_cancel: discard a background wait of A
+//------------------------------------------------------------------------------
+
+// The content of A is about to be freed, so the result of the background
+// thread is no longer needed.  The thread must still be waited for, since it
+// may be reading the content of A.
+
+void GB_wait_background_cancel      // discard a background wait of A
+(
+    GrB_Matrix A                // matrix whose content is about to be freed
+)
+{
+
+    if (A == NULL || A->Background == NULL)
+    {
+        // no background wait of A is in progress
+        return ;
+    }
+
+    GrB_Matrix W = GB_wait_background_join (A) ;
+    GB_Matrix_free (&W) ;
+}
@@ -7,7 +7,9 @@
 
 //------------------------------------------------------------------------------
 
-// Finishes all work on a matrix, followed by an OpenMP flush.
+// Finishes all work on a matrix, followed by an OpenMP flush.  With the
+// GxB_BACKGROUND mode, the work is started in a background thread instead,
+// and finished by the next method that needs A (see GB_wait_background.c).
 
 #include "GB.h"
 
@@ -31,7 +33,15 @@ GrB_Info GrB_Matrix_wait    // finish all work on a matrix
     // finish all pending work on the matrix, including creating A->Y
     //--------------------------------------------------------------------------
 
-    if (waitmode != GrB_COMPLETE &&
+    if (waitmode == GxB_BACKGROUND)
+    { 
+        // start the work in a background thread, and return
+        GrB_Info info ;
+        GB_BURBLE_START ("GrB_Matrix_wait") ;
+        GB_OK (GB_wait_background_start (A, Werk)) ;
+        GB_BURBLE_END ;
+    }
+    else if (waitmode != GrB_COMPLETE &&
         (GB_ANY_PENDING_WORK (A) || GB_hyper_hash_need (A)))
     { 
         GrB_Info info ;
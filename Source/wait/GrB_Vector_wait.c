@@ -7,7 +7,8 @@
 
 //------------------------------------------------------------------------------
 
-// Finishes all work on a vector, followed by an OpenMP flush.
+// Finishes all work on a vector, followed by an OpenMP flush.  With the
+// GxB_BACKGROUND mode, the work is started in a background thread instead.
 
 #include "GB.h"
 
@@ -31,7 +32,15 @@ GrB_Info GrB_Vector_wait    // finish all work on a vector
     // finish all pending work on the vector
     //--------------------------------------------------------------------------
 
-    if (waitmode != GrB_COMPLETE && GB_ANY_PENDING_WORK (v))
+    if (waitmode == GxB_BACKGROUND)
+    { 
+        // start the work in a background thread, and return
+        GrB_Info info ;
+        GB_BURBLE_START ("GrB_Vector_wait") ;
+        GB_OK (GB_wait_background_start ((GrB_Matrix) v, Werk)) ;
+        GB_BURBLE_END ;
+    }
+    else if (waitmode != GrB_COMPLETE && GB_ANY_PENDING_WORK (v))
     { 
         GrB_Info info ;
         GB_BURBLE_START ("GrB_Vector_wait") ;
@@ -10,7 +10,9 @@
 #include "GB.h"
 
 // The werkspace is allocated from the Werk static if it small enough and space
-// is available.  Otherwise it is allocated by malloc.
+// is available.  Otherwise it is allocated from the Werk arena of the Context
+// of this user thread, if it has one and space is available there (see
+// GB_Context.c), or by malloc if all else fails.
 
 GB_CALLBACK_WERK_PUSH_PROTO (GB_werk_push)
 {
@@ -23,46 +25,59 @@ GB_CALLBACK_WERK_PUSH_PROTO (GB_werk_push)
     ASSERT (size_allocated != NULL) ;
 
     //--------------------------------------------------------------------------
-    // determine where to allocate the werkspace
+    // allocate the werkspace from the Werk stack or the Werk arena
     //--------------------------------------------------------------------------
 
-    size_t size ;
-    if (Werk == NULL || nitems > GB_WERK_SIZE || size_of_item > GB_WERK_SIZE
+    GB_void *p = NULL ;
+    size_t size = 0 ;
+    if (Werk == NULL
         #ifdef GBCOVER
         // Werk stack can be disabled for test coverage
         || (GB_Global_hack_get (1) != 0)
         #endif
     )
     { 
-        // no context, or werkspace is too large to allocate from the Werk stack
-        (*on_stack) = false ;
+        // no context; allocate the werkspace from malloc
     }
-    else
-    { 
+    else if (nitems <= GB_WERK_SIZE && size_of_item <= GB_WERK_SIZE)
+    {
         // try to allocate from the Werk stack
         size = GB_ROUND8 (nitems * size_of_item) ;
         ASSERT (size % 8 == 0) ;        // size is rounded up to a multiple of 8
         size_t freespace = GB_WERK_SIZE - Werk->pwerk ;
         ASSERT (freespace % 8 == 0) ;   // thus freespace is also multiple of 8
-        (*on_stack) = (size <= freespace) ;
+        if (size <= freespace)
+        { 
+            // allocate the werkspace from the Werk stack
+            p = Werk->Stack + Werk->pwerk ;
+            Werk->pwerk += (int) size ;
+        }
+        else
+        { 
+            // the Werk stack is full; try the Werk arena instead
+            p = GB_Context_werk_push (size) ;
+        }
+    }
+    else if (GB_size_t_multiply (&size, nitems, size_of_item) &&
+        size <= GB_NMAX)
+    { 
+        // werkspace is too large for the Werk stack; try the Werk arena
+        size = GB_ROUND8 (size) ;
+        p = GB_Context_werk_push (size) ;
     }
 
     //--------------------------------------------------------------------------
-    // allocate the werkspace
+    // return the werkspace, or allocate it from malloc
     //--------------------------------------------------------------------------
 
-    if (*on_stack)
+    (*on_stack) = (p != NULL) ;
+    if (p != NULL)
     { 
-        // allocate the werkspace from the Werk stack
-        GB_void *p = Werk->Stack + Werk->pwerk ;
-        Werk->pwerk += (int) size ;
         (*size_allocated) = size ;
         return ((void *) p) ;
     }
     else
     { 
-        // allocate the werkspace from malloc
         return (GB_malloc_memory (nitems, size_of_item, size_allocated)) ;
     }
 }
-
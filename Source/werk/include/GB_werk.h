@@ -46,7 +46,9 @@ typedef GB_Werk_struct *GB_Werk ;
 
 // Werk->Stack is a small fixed-size array that is allocated on the stack
 // of any user-callable GraphBLAS function.  It is used for small werkspace
-// allocations.
+// allocations.  Werkspace that does not fit is taken from the Werk arena of
+// the Context engaged by the user thread, if it has one (see GB_Context.c),
+// or from malloc otherwise.
 
 // GB_ROUND8(s) rounds up s to a multiple of 8
 #define GB_ROUND8(s) (((s) + 7) & (~0x7))
@@ -88,6 +88,7 @@ GrB_Info axb (GB_Werk Werk)
         &ignore2,   // done_in_place
         AxB_method,
         true,       // do the sort
+        NULL,       // no plan
         Werk) ;
 
     GrB_Monoid_free_(&add) ;
@@ -184,6 +185,7 @@ GrB_Info axb_complex (GB_Werk Werk)
         &ignore2,   // done_in_place
         AxB_method,
         true,       // do the sort
+        NULL,       // no plan
         Werk) ;
 
     GrB_Matrix_free_(&Bconj) ;
@@ -108,6 +108,7 @@ GrB_Info axb (GB_Werk Werk, bool cprint)
         &ignore2,   // done_in_place
         AxB_method,
         true,       // do the sort
+        NULL,       // no plan
         Werk) ;
 
     if (C != NULL)
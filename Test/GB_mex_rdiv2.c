@@ -132,6 +132,7 @@ GrB_Info axb (GB_Werk Werk)
         &done_in_place,
         AxB_method,
         true,       // do the sort
+        NULL,       // no plan
         Werk) ;
 
     if (info == GrB_SUCCESS)
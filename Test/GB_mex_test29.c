@@ -184,7 +184,7 @@ void mexFunction
     int32_t control ;
     OK (GrB_Global_get_INT32_ (GrB_GLOBAL, &control, (GrB_Field) GxB_JIT_C_CONTROL)) ;
     printf ("jit ctrl: %d\n", control) ;
-    for (int c = 0 ; c <= GxB_JIT_ON ; c++)
+    for (int c = 0 ; c <= GxB_JIT_ASYNC ; c++)
     {
         int32_t b ;
         OK (GrB_Global_set_INT32_ (GrB_GLOBAL, c, (GrB_Field) GxB_JIT_C_CONTROL)) ;
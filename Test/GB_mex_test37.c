@@ -0,0 +1,276 @@
+//------------------------------------------------------------------------------
+// GB_mex_test37: test GxB_mxm_reduce and GxB_mxm_reduce_Vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// s = reduce (C<M>=A*B) is computed by GxB_mxm_reduce, and w = rowreduce
+// (C<M>=A*B) by GxB_mxm_reduce_Vector.  Both are compared with GrB_mxm
+// followed by GrB_reduce.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test37"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// check_mxm_reduce: compare GxB_mxm_reduce with GrB_mxm and GrB_reduce
+//------------------------------------------------------------------------------
+
+static void check_mxm_reduce
+(
+    GrB_Matrix M,
+    GrB_BinaryOp accum,
+    GrB_Semiring semiring,
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Descriptor desc
+)
+{
+    GrB_Info info ;
+    GrB_Matrix C = NULL ;
+    GrB_Scalar s1 = NULL, s2 = NULL ;
+    GrB_Monoid monoid = NULL ;
+    GrB_Index nrows, ncols, nvals1, nvals2 ;
+    double x1 = 0, x2 = 0 ;
+
+    OK (GxB_Semiring_add (&monoid, semiring)) ;
+    OK (GrB_Matrix_nrows (&nrows, M)) ;
+    OK (GrB_Matrix_ncols (&ncols, M)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, nrows, ncols)) ;
+    OK (GrB_Scalar_new (&s1, GrB_FP64)) ;
+    OK (GrB_Scalar_new (&s2, GrB_FP64)) ;
+    if (accum != NULL)
+    {
+        OK (GrB_Scalar_setElement_FP64 (s1, 3)) ;
+        OK (GrB_Scalar_setElement_FP64 (s2, 3)) ;
+    }
+
+    // s1 = reduce (C<M>=A*B), with C constructed explicitly
+    OK (GrB_mxm (C, M, NULL, semiring, A, B, desc)) ;
+    OK (GrB_Matrix_reduce_Monoid_Scalar (s1, accum, monoid, C, NULL)) ;
+
+    // s2 = reduce (C<M>=A*B), with the fused method
+    OK (GxB_mxm_reduce (s2, accum, M, semiring, A, B, desc)) ;
+
+    OK (GrB_Scalar_nvals (&nvals1, s1)) ;
+    OK (GrB_Scalar_nvals (&nvals2, s2)) ;
+    CHECK (nvals1 == nvals2) ;
+    if (nvals1 > 0)
+    {
+        OK (GrB_Scalar_extractElement_FP64 (&x1, s1)) ;
+        OK (GrB_Scalar_extractElement_FP64 (&x2, s2)) ;
+        CHECK (fabs (x1 - x2) <= 1e-12 * (1 + fabs (x1))) ;
+    }
+
+    GrB_Matrix_free (&C) ;
+    GrB_Scalar_free (&s1) ;
+    GrB_Scalar_free (&s2) ;
+}
+
+//------------------------------------------------------------------------------
+// check_mxm_reduce_vector: compare GxB_mxm_reduce_Vector with GrB_mxm/reduce
+//------------------------------------------------------------------------------
+
+static void check_mxm_reduce_vector
+(
+    GrB_Matrix M,
+    GrB_BinaryOp accum,
+    GrB_Semiring semiring,
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Descriptor desc
+)
+{
+    GrB_Info info ;
+    GrB_Matrix C = NULL ;
+    GrB_Vector w1 = NULL, w2 = NULL ;
+    GrB_Monoid monoid = NULL ;
+    GrB_Index nrows, ncols, nvals1, nvals2 ;
+
+    OK (GxB_Semiring_add (&monoid, semiring)) ;
+    OK (GrB_Matrix_nrows (&nrows, M)) ;
+    OK (GrB_Matrix_ncols (&ncols, M)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, nrows, ncols)) ;
+    OK (GrB_Vector_new (&w1, GrB_FP64, nrows)) ;
+    OK (GrB_Vector_new (&w2, GrB_FP64, nrows)) ;
+    if (accum != NULL)
+    {
+        for (GrB_Index i = 0 ; i < nrows ; i += 3)
+        {
+            OK (GrB_Vector_setElement_FP64 (w1, (double) i, i)) ;
+            OK (GrB_Vector_setElement_FP64 (w2, (double) i, i)) ;
+        }
+    }
+
+    // w1 = rowreduce (C<M>=A*B), with C constructed explicitly
+    OK (GrB_mxm (C, M, NULL, semiring, A, B, desc)) ;
+    OK (GrB_Matrix_reduce_Monoid (w1, NULL, accum, monoid, C, NULL)) ;
+
+    // w2 = rowreduce (C<M>=A*B), with the fused method
+    OK (GxB_mxm_reduce_Vector (w2, accum, M, semiring, A, B, desc)) ;
+
+    OK (GrB_Vector_nvals (&nvals1, w1)) ;
+    OK (GrB_Vector_nvals (&nvals2, w2)) ;
+    CHECK (nvals1 == nvals2) ;
+    for (GrB_Index i = 0 ; i < nrows ; i++)
+    {
+        double x1 = 0, x2 = 0 ;
+        GrB_Info info1 = GrB_Vector_extractElement_FP64 (&x1, w1, i) ;
+        GrB_Info info2 = GrB_Vector_extractElement_FP64 (&x2, w2, i) ;
+        CHECK (info1 == info2) ;
+        CHECK (fabs (x1 - x2) <= 1e-12 * (1 + fabs (x1))) ;
+    }
+
+    GrB_Matrix_free (&C) ;
+    GrB_Vector_free (&w1) ;
+    GrB_Vector_free (&w2) ;
+}
+
+//------------------------------------------------------------------------------
+// check_both: test GxB_mxm_reduce and GxB_mxm_reduce_Vector
+//------------------------------------------------------------------------------
+
+static void check_both
+(
+    GrB_Matrix M,
+    GrB_BinaryOp accum,
+    GrB_Semiring semiring,
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Descriptor desc
+)
+{
+    check_mxm_reduce (M, accum, semiring, A, B, desc) ;
+    check_mxm_reduce_vector (M, accum, semiring, A, B, desc) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, L = NULL, E = NULL ;
+    GrB_Scalar s = NULL ;
+    GrB_Vector w = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // create a random symmetric matrix A and its lower triangular part L
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 200 ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    simple_rand_seed (1) ;
+    for (int k = 0 ; k < 2000 ; k++)
+    {
+        GrB_Index i = simple_rand ( ) % n ;
+        GrB_Index j = simple_rand ( ) % n ;
+        if (i == j) continue ;
+        double x = (double) ((int) (simple_rand ( ) % 7) - 2) ;
+        OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+        OK (GrB_Matrix_setElement_FP64 (A, x, j, i)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_new (&L, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_select_INT64 (L, NULL, NULL, GrB_TRIL, A, -1, NULL)) ;
+    OK (GrB_Matrix_new (&E, GrB_FP64, n, n)) ;
+
+    //--------------------------------------------------------------------------
+    // compare GxB_mxm_reduce with GrB_mxm and GrB_reduce
+    //--------------------------------------------------------------------------
+
+    for (int fmt = 0 ; fmt <= 1 ; fmt++)
+    {
+        OK (GxB_Matrix_Option_set (A, GxB_FORMAT,
+            fmt ? GxB_BY_COL : GxB_BY_ROW)) ;
+        OK (GxB_Matrix_Option_set (L, GxB_FORMAT,
+            fmt ? GxB_BY_ROW : GxB_BY_COL)) ;
+        for (int sparsity = 0 ; sparsity <= 2 ; sparsity++)
+        {
+            int sp = (sparsity == 0) ? GxB_SPARSE :
+                    ((sparsity == 1) ? GxB_HYPERSPARSE : GxB_BITMAP) ;
+            OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, sp)) ;
+
+            // triangle counting, and # of triangles per node
+            check_both (L, NULL, GxB_PLUS_PAIR_FP64, L, L,
+                GrB_DESC_ST1) ;
+            // valued and structural masks, transposed inputs
+            check_both (A, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, L, A,
+                NULL) ;
+            check_both (L, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, L, A,
+                GrB_DESC_ST0) ;
+            check_both (L, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+                GrB_DESC_T0T1) ;
+            check_both (L, GrB_PLUS_FP64, GxB_PLUS_FIRST_FP64, A, L,
+                GrB_DESC_S) ;
+            check_both (L, NULL, GxB_PLUS_SECOND_FP64, A, L, NULL) ;
+            // terminal and positional semirings
+            check_both (A, NULL, GrB_MIN_PLUS_SEMIRING_FP64, A, A,
+                NULL) ;
+            check_both (L, NULL, GrB_MAX_TIMES_SEMIRING_FP64, A, A,
+                GrB_DESC_S) ;
+            check_both (L, NULL, GxB_PLUS_FIRSTI_INT64, A, L,
+                GrB_DESC_S) ;
+            check_both (L, NULL, GxB_PLUS_SECONDJ_INT64, A, L, NULL) ;
+            // complemented mask, and an empty mask
+            check_both (L, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+                GrB_DESC_C) ;
+            check_both (E, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+                NULL) ;
+            check_both (E, GrB_PLUS_FP64, GrB_PLUS_TIMES_SEMIRING_FP64,
+                A, A, NULL) ;
+
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Scalar_new (&s, GrB_FP64)) ;
+    GrB_Info expected = GrB_NULL_POINTER ;
+    ERR (GxB_mxm_reduce (NULL, NULL, L, GxB_PLUS_PAIR_FP64, L, L, NULL)) ;
+    ERR (GxB_mxm_reduce (s, NULL, L, NULL, L, L, NULL)) ;
+    ERR (GxB_mxm_reduce (s, NULL, L, GxB_PLUS_PAIR_FP64, NULL, L, NULL)) ;
+    GrB_Matrix_free (&E) ;
+    OK (GrB_Matrix_new (&E, GrB_FP64, n, n+1)) ;
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR (GxB_mxm_reduce (s, NULL, L, GxB_PLUS_PAIR_FP64, L, E, NULL)) ;
+    OK (GrB_Vector_new (&w, GrB_FP64, n+1)) ;
+    ERR (GxB_mxm_reduce_Vector (w, NULL, L, GxB_PLUS_PAIR_FP64, L, L, NULL)) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_mxm_reduce_Vector (NULL, NULL, L, GxB_PLUS_PAIR_FP64, L, L,
+        NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&L) ;
+    GrB_Matrix_free (&E) ;
+    GrB_Scalar_free (&s) ;
+    GrB_Vector_free (&w) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test37: all tests passed\n\n") ;
+}
+
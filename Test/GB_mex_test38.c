@@ -0,0 +1,262 @@
+//------------------------------------------------------------------------------
+// GB_mex_test38: test GxB_fusedmm
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Z = accum (Z, (C<S>=X*Y')*W) is computed by GxB_fusedmm, and compared with
+// two calls to GrB_mxm, with and without the mask S.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test38"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random m-by-n matrix
+//------------------------------------------------------------------------------
+
+static GrB_Matrix random_matrix
+(
+    GrB_Index m,
+    GrB_Index n,
+    GrB_Index nz
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    for (GrB_Index k = 0 ; k < nz ; k++)
+    {
+        GrB_Index i = simple_rand ( ) % m ;
+        GrB_Index j = simple_rand ( ) % n ;
+        double x = (double) ((int) (simple_rand ( ) % 9) - 4) ;
+        OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    return (A) ;
+}
+
+//------------------------------------------------------------------------------
+// check_fusedmm: compare GxB_fusedmm with two calls to GrB_mxm
+//------------------------------------------------------------------------------
+
+static void check_fusedmm
+(
+    GrB_BinaryOp accum,
+    GrB_Matrix S,
+    GrB_Semiring sddmm,
+    GrB_Matrix X,
+    GrB_Matrix Y,
+    GrB_Semiring spmm,
+    GrB_Matrix W,
+    GrB_Descriptor desc
+)
+{
+    GrB_Info info ;
+    GrB_Matrix C = NULL, Z1 = NULL, Z2 = NULL ;
+    GrB_Descriptor desc1 = NULL ;
+    GrB_Index m, n, d, nvals1, nvals2 ;
+
+    OK (GrB_Matrix_nrows (&m, X)) ;
+    OK (GrB_Matrix_nrows (&n, Y)) ;
+    OK (GrB_Matrix_ncols (&d, W)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, m, n)) ;
+    OK (GrB_Matrix_new (&Z1, GrB_FP64, m, d)) ;
+    OK (GrB_Matrix_new (&Z2, GrB_FP64, m, d)) ;
+    if (accum != NULL)
+    {
+        for (GrB_Index i = 0 ; i < m ; i += 3)
+        {
+            OK (GrB_Matrix_setElement_FP64 (Z1, (double) i, i, i % d)) ;
+            OK (GrB_Matrix_setElement_FP64 (Z2, (double) i, i, i % d)) ;
+        }
+    }
+
+    // desc1: the same mask descriptor as desc, with Y transposed
+    OK (GrB_Descriptor_new (&desc1)) ;
+    if (desc != NULL)
+    {
+        int32_t mask_field ;
+        OK (GrB_Descriptor_get_INT32 (desc, &mask_field, GrB_MASK_FIELD)) ;
+        OK (GrB_Descriptor_set_INT32 (desc1, mask_field, GrB_MASK_FIELD)) ;
+    }
+    OK (GrB_Descriptor_set_INT32 (desc1, GrB_TRAN, GrB_INP1)) ;
+
+    // Z1 = accum (Z1, (C<S>=X*Y')*W), with C constructed explicitly
+    OK (GrB_mxm (C, S, NULL, sddmm, X, Y, desc1)) ;
+    OK (GrB_mxm (Z1, NULL, accum, spmm, C, W, NULL)) ;
+
+    // Z2 = accum (Z2, (C<S>=X*Y')*W), with the blocked method
+    OK (GxB_fusedmm (Z2, accum, S, sddmm, X, Y, spmm, W, desc)) ;
+
+    OK (GrB_Matrix_nvals (&nvals1, Z1)) ;
+    OK (GrB_Matrix_nvals (&nvals2, Z2)) ;
+    CHECK (nvals1 == nvals2) ;
+    for (GrB_Index i = 0 ; i < m ; i++)
+    {
+        for (GrB_Index j = 0 ; j < d ; j++)
+        {
+            double x1 = 0, x2 = 0 ;
+            GrB_Info info1 = GrB_Matrix_extractElement_FP64 (&x1, Z1, i, j) ;
+            GrB_Info info2 = GrB_Matrix_extractElement_FP64 (&x2, Z2, i, j) ;
+            CHECK (info1 == info2) ;
+            CHECK (fabs (x1 - x2) <= 1e-12 * (1 + fabs (x1))) ;
+        }
+    }
+
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&Z1) ;
+    GrB_Matrix_free (&Z2) ;
+    GrB_Descriptor_free (&desc1) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix S = NULL, X = NULL, Y = NULL, W = NULL, Ws = NULL, Z = NULL ;
+    GrB_Vector e = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    //--------------------------------------------------------------------------
+    // compare GxB_fusedmm with two calls to GrB_mxm
+    //--------------------------------------------------------------------------
+
+    // The 2nd problem has enough entries in S to be split into more than one
+    // block of rows.
+
+    for (int problem = 0 ; problem <= 1 ; problem++)
+    {
+
+        //----------------------------------------------------------------------
+        // create the problem
+        //----------------------------------------------------------------------
+
+        GrB_Index m = (problem == 0) ? 200 : 800 ;
+        GrB_Index n = (problem == 0) ? 150 : 700 ;
+        GrB_Index k = 4, d = 3 ;
+        S = random_matrix (m, n, (problem == 0) ? 2000 : 800000) ;
+        X = random_matrix (m, k, 4 * m * k) ;
+        Y = random_matrix (n, k, 4 * n * k) ;
+        W = random_matrix (n, d, n * d) ;
+        Ws = random_matrix (n, d, n) ;
+
+        // W is full
+        OK (GrB_Matrix_assign_FP64 (W, W, NULL, 1, GrB_ALL, n, GrB_ALL, d,
+            GrB_DESC_SC)) ;
+
+        // every 4th row of S is empty
+        OK (GrB_Vector_new (&e, GrB_FP64, n)) ;
+        for (GrB_Index i = 0 ; i < m ; i += 4)
+        {
+            OK (GrB_Row_assign (S, NULL, NULL, e, i, GrB_ALL, n, NULL)) ;
+        }
+        OK (GrB_Matrix_wait (S, GrB_MATERIALIZE)) ;
+        GrB_Vector_free (&e) ;
+
+        for (int fmt = 0 ; fmt <= 1 ; fmt++)
+        {
+            OK (GxB_Matrix_Option_set (S, GxB_FORMAT,
+                fmt ? GxB_BY_COL : GxB_BY_ROW)) ;
+            OK (GxB_Matrix_Option_set (W, GxB_FORMAT,
+                fmt ? GxB_BY_COL : GxB_BY_ROW)) ;
+            OK (GxB_Matrix_Option_set (X, GxB_FORMAT,
+                fmt ? GxB_BY_ROW : GxB_BY_COL)) ;
+            for (int sparsity = 0 ; sparsity <= 2 ; sparsity++)
+            {
+                int sp = (sparsity == 0) ? GxB_SPARSE :
+                        ((sparsity == 1) ? GxB_HYPERSPARSE : GxB_BITMAP) ;
+                OK (GxB_Matrix_Option_set (S, GxB_SPARSITY_CONTROL, sp)) ;
+
+                // valued and structural masks, with and without accum
+                check_fusedmm (NULL, S, GrB_PLUS_TIMES_SEMIRING_FP64, X, Y,
+                    GrB_PLUS_TIMES_SEMIRING_FP64, W, NULL) ;
+                check_fusedmm (NULL, S, GrB_PLUS_TIMES_SEMIRING_FP64, X, Y,
+                    GrB_PLUS_TIMES_SEMIRING_FP64, W, GrB_DESC_S) ;
+                check_fusedmm (GrB_MINUS_FP64, S, GxB_PLUS_PAIR_FP64, X, Y,
+                    GrB_PLUS_TIMES_SEMIRING_FP64, W, GrB_DESC_S) ;
+                // other monoids and semirings
+                check_fusedmm (NULL, S, GrB_MAX_PLUS_SEMIRING_FP64, X, Y,
+                    GrB_MIN_PLUS_SEMIRING_FP64, W, NULL) ;
+                check_fusedmm (GrB_PLUS_FP64, S, GrB_PLUS_TIMES_SEMIRING_FP64,
+                    X, Y, GxB_PLUS_SECOND_FP64, W, GrB_DESC_S) ;
+                // complemented mask, and W not full
+                check_fusedmm (NULL, S, GrB_PLUS_TIMES_SEMIRING_FP64, X, Y,
+                    GrB_PLUS_TIMES_SEMIRING_FP64, W, GrB_DESC_SC) ;
+                check_fusedmm (NULL, S, GrB_PLUS_TIMES_SEMIRING_FP64, X, Y,
+                    GrB_PLUS_TIMES_SEMIRING_FP64, Ws, NULL) ;
+            }
+
+            // no mask, with and without accum
+            check_fusedmm (NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, X, Y,
+                GrB_PLUS_TIMES_SEMIRING_FP64, W, NULL) ;
+            check_fusedmm (GrB_PLUS_FP64, NULL, GxB_PLUS_PAIR_FP64, X, Y,
+                GrB_PLUS_TIMES_SEMIRING_FP64, W, NULL) ;
+        }
+
+        GrB_Matrix_free (&S) ;
+        GrB_Matrix_free (&X) ;
+        GrB_Matrix_free (&Y) ;
+        GrB_Matrix_free (&W) ;
+        GrB_Matrix_free (&Ws) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&S, GrB_FP64, 10, 20)) ;
+    OK (GrB_Matrix_new (&X, GrB_FP64, 10, 4)) ;
+    OK (GrB_Matrix_new (&Y, GrB_FP64, 20, 4)) ;
+    OK (GrB_Matrix_new (&W, GrB_FP64, 20, 3)) ;
+    OK (GrB_Matrix_new (&Z, GrB_FP64, 10, 3)) ;
+    OK (GxB_fusedmm (Z, NULL, S, GrB_PLUS_TIMES_SEMIRING_FP64, X, Y,
+        GrB_PLUS_TIMES_SEMIRING_FP64, W, NULL)) ;
+    OK (GxB_fusedmm (Z, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, X, Y,
+        GrB_PLUS_TIMES_SEMIRING_FP64, W, NULL)) ;
+    GrB_Info expected = GrB_NULL_POINTER ;
+    ERR (GxB_fusedmm (NULL, NULL, S, GrB_PLUS_TIMES_SEMIRING_FP64, X, Y,
+        GrB_PLUS_TIMES_SEMIRING_FP64, W, NULL)) ;
+    ERR (GxB_fusedmm (Z, NULL, S, NULL, X, Y,
+        GrB_PLUS_TIMES_SEMIRING_FP64, W, NULL)) ;
+    ERR (GxB_fusedmm (Z, NULL, S, GrB_PLUS_TIMES_SEMIRING_FP64, X, Y,
+        NULL, W, NULL)) ;
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR (GxB_fusedmm (Z, NULL, S, GrB_PLUS_TIMES_SEMIRING_FP64, X, X,
+        GrB_PLUS_TIMES_SEMIRING_FP64, W, NULL)) ;
+    ERR (GxB_fusedmm (Z, NULL, S, GrB_PLUS_TIMES_SEMIRING_FP64, X, Y,
+        GrB_PLUS_TIMES_SEMIRING_FP64, Y, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix_free (&S) ;
+    GrB_Matrix_free (&X) ;
+    GrB_Matrix_free (&Y) ;
+    GrB_Matrix_free (&W) ;
+    GrB_Matrix_free (&Z) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test38: all tests passed\n\n") ;
+}
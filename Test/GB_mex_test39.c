@@ -0,0 +1,266 @@
+//------------------------------------------------------------------------------
+// GB_mex_test39: test fine-grain dot products, GxB_innerProduct, and
+// GxB_outerProduct
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// w=A*u is computed where A is held by row and has only a few rows, with one
+// thread and with 4 threads.  With 4 threads and a small chunk, each dot
+// product is split across several tasks.  The inner product u'*v is compared
+// with GrB_vxm, and the outer product u*v' is compared with GrB_mxm.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test39"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// check_vectors: check if two vectors are identical
+//------------------------------------------------------------------------------
+
+static void check_vectors
+(
+    GrB_Vector w1,
+    GrB_Vector w2
+)
+{
+    GrB_Info info ;
+    GrB_Index n, nvals1, nvals2 ;
+    OK (GrB_Vector_size (&n, w1)) ;
+    OK (GrB_Vector_nvals (&nvals1, w1)) ;
+    OK (GrB_Vector_nvals (&nvals2, w2)) ;
+    CHECK (nvals1 == nvals2) ;
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        double x1 = 0, x2 = 0 ;
+        GrB_Info info1 = GrB_Vector_extractElement_FP64 (&x1, w1, i) ;
+        GrB_Info info2 = GrB_Vector_extractElement_FP64 (&x2, w2, i) ;
+        CHECK (info1 == info2) ;
+        CHECK (x1 == x2) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, C1 = NULL, C2 = NULL, U = NULL, V = NULL ;
+    GrB_Vector u = NULL, v = NULL, w1 = NULL, w2 = NULL, a = NULL ;
+    GrB_Scalar s1 = NULL, s2 = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+    int nthreads_save ;
+    double chunk_save ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &nthreads_save)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &chunk_save)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 16)) ;
+
+    GrB_Semiring semirings [6] = { GrB_PLUS_TIMES_SEMIRING_INT64,
+        GrB_MIN_PLUS_SEMIRING_INT64, GxB_PLUS_PAIR_INT64, GxB_PLUS_PAIR_UINT8,
+        GrB_MAX_TIMES_SEMIRING_FP64, GxB_ANY_PAIR_BOOL } ;
+
+    //--------------------------------------------------------------------------
+    // w=A*u with few rows in A, and with all sparsity formats
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 20000 ;
+    for (int nrows = 1 ; nrows <= 7 ; nrows += 3)
+    {
+        for (int asparsity = 0 ; asparsity <= 2 ; asparsity++)
+        {
+            for (int usparsity = 0 ; usparsity <= 2 ; usparsity++)
+            {
+
+                //--------------------------------------------------------------
+                // create the problem
+                //--------------------------------------------------------------
+
+                OK (GrB_Matrix_new (&A, GrB_INT32, nrows, n)) ;
+                OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_ROW)) ;
+                OK (GrB_Vector_new (&u, GrB_FP64, n)) ;
+                GrB_Index anz = (asparsity == 0) ? 3000 : 40000 ;
+                for (GrB_Index k = 0 ; k < anz * nrows ; k++)
+                {
+                    int32_t x = (int32_t) (simple_rand ( ) % 3) + 1 ;
+                    GrB_Index i = simple_rand ( ) % nrows ;
+                    GrB_Index j = simple_rand ( ) % n ;
+                    OK (GrB_Matrix_setElement_INT32 (A, x, i, j)) ;
+                }
+                GrB_Index unz = (usparsity == 0) ? 2000 : 40000 ;
+                for (GrB_Index k = 0 ; k < unz ; k++)
+                {
+                    double x = (double) (simple_rand ( ) % 2) + 1 ;
+                    GrB_Index i = simple_rand ( ) % n ;
+                    OK (GrB_Vector_setElement_FP64 (u, x, i)) ;
+                }
+                if (asparsity == 2)
+                {
+                    // A is full
+                    OK (GrB_Matrix_assign_INT32 (A, A, NULL, 1, GrB_ALL,
+                        nrows, GrB_ALL, n, GrB_DESC_SC)) ;
+                }
+                if (usparsity == 2)
+                {
+                    // u is full
+                    OK (GrB_Vector_assign_FP64 (u, u, NULL, 1, GrB_ALL, n,
+                        GrB_DESC_SC)) ;
+                }
+                OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL,
+                    (asparsity == 0) ? GxB_SPARSE :
+                    ((asparsity == 1) ? GxB_BITMAP : GxB_FULL))) ;
+                OK (GxB_Vector_Option_set (u, GxB_SPARSITY_CONTROL,
+                    (usparsity == 0) ? GxB_SPARSE :
+                    ((usparsity == 1) ? GxB_BITMAP : GxB_FULL))) ;
+                OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                OK (GrB_Vector_wait (u, GrB_MATERIALIZE)) ;
+
+                // a = A(0,:)'
+                OK (GrB_Vector_new (&a, GrB_INT32, n)) ;
+                OK (GrB_Col_extract (a, NULL, NULL, A, GrB_ALL, n, 0,
+                    GrB_DESC_T0)) ;
+
+                for (int k = 0 ; k < 6 ; k++)
+                {
+
+                    //----------------------------------------------------------
+                    // w1 = A*u with one thread, and w2 = A*u with 4 threads
+                    //----------------------------------------------------------
+
+                    GrB_Semiring semiring = semirings [k] ;
+                    OK (GrB_Vector_new (&w1, GrB_FP64, nrows)) ;
+                    OK (GrB_Vector_new (&w2, GrB_FP64, nrows)) ;
+                    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, 1)) ;
+                    OK (GrB_mxv (w1, NULL, NULL, semiring, A, u, NULL)) ;
+                    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, 4)) ;
+                    OK (GrB_mxv (w2, NULL, NULL, semiring, A, u, NULL)) ;
+                    check_vectors (w1, w2) ;
+
+                    //----------------------------------------------------------
+                    // s1 = 5 + A(0,:)*u, compared with w1 (0)
+                    //----------------------------------------------------------
+
+                    double x1 = 0, x2 = 0 ;
+                    OK (GrB_Scalar_new (&s1, GrB_FP64)) ;
+                    OK (GrB_Scalar_setElement_FP64 (s1, 5)) ;
+                    OK (GxB_innerProduct (s1, GrB_PLUS_FP64, semiring, a, u,
+                        NULL)) ;
+                    OK (GrB_Scalar_extractElement_FP64 (&x1, s1)) ;
+                    info = GrB_Vector_extractElement_FP64 (&x2, w1, 0) ;
+                    CHECK (x1 == ((info == GrB_NO_VALUE) ? 5 : (x2 + 5))) ;
+
+                    // s1 = A(0,:)*u, with no accum
+                    OK (GxB_innerProduct (s1, NULL, semiring, a, u, NULL)) ;
+                    GrB_Index nvals ;
+                    OK (GrB_Scalar_nvals (&nvals, s1)) ;
+                    CHECK (nvals == ((info == GrB_NO_VALUE) ? 0 : 1)) ;
+
+                    GrB_Vector_free (&w1) ;
+                    GrB_Vector_free (&w2) ;
+                    GrB_Scalar_free (&s1) ;
+                }
+
+                GrB_Matrix_free (&A) ;
+                GrB_Vector_free (&u) ;
+                GrB_Vector_free (&a) ;
+            }
+        }
+    }
+
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads_save)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, chunk_save)) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C, u*v'), compared with GrB_mxm
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&u, GrB_FP64, 50)) ;
+    OK (GrB_Vector_new (&v, GrB_FP64, 40)) ;
+    for (int k = 0 ; k < 20 ; k++)
+    {
+        OK (GrB_Vector_setElement_FP64 (u, (double) k, simple_rand ( ) % 50)) ;
+        OK (GrB_Vector_setElement_FP64 (v, (double) k, simple_rand ( ) % 40)) ;
+    }
+    OK (GrB_Matrix_new (&U, GrB_FP64, 50, 1)) ;
+    OK (GrB_Matrix_new (&V, GrB_FP64, 40, 1)) ;
+    OK (GrB_Col_assign (U, NULL, NULL, u, GrB_ALL, 50, 0, NULL)) ;
+    OK (GrB_Col_assign (V, NULL, NULL, v, GrB_ALL, 40, 0, NULL)) ;
+    OK (GrB_Matrix_new (&A, GrB_BOOL, 50, 40)) ;
+    for (GrB_Index k = 0 ; k < 50 ; k += 2)
+    {
+        OK (GrB_Matrix_setElement_BOOL (A, true, k, k % 40)) ;
+    }
+
+    for (int trial = 0 ; trial <= 2 ; trial++)
+    {
+        GrB_Matrix M = (trial == 0) ? NULL : A ;
+        GrB_BinaryOp accum = (trial == 2) ? GrB_PLUS_FP64 : NULL ;
+        OK (GrB_Matrix_new (&C1, GrB_FP64, 50, 40)) ;
+        OK (GrB_Matrix_new (&C2, GrB_FP64, 50, 40)) ;
+        OK (GrB_Matrix_setElement_FP64 (C1, 3, 2, 2)) ;
+        OK (GrB_Matrix_setElement_FP64 (C2, 3, 2, 2)) ;
+        OK (GxB_outerProduct (C1, M, accum, GrB_PLUS_TIMES_SEMIRING_FP64,
+            u, v, NULL)) ;
+        OK (GrB_mxm (C2, M, accum, GrB_PLUS_TIMES_SEMIRING_FP64, U, V,
+            GrB_DESC_T1)) ;
+        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+        GrB_Matrix_free (&C1) ;
+        GrB_Matrix_free (&C2) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Scalar_new (&s2, GrB_FP64)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, 50, 40)) ;
+    GrB_Info expected = GrB_NULL_POINTER ;
+    ERR (GxB_innerProduct (NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, u, u,
+        NULL)) ;
+    ERR (GxB_innerProduct (s2, NULL, NULL, u, u, NULL)) ;
+    ERR (GxB_innerProduct (s2, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, NULL, u,
+        NULL)) ;
+    ERR (GxB_outerProduct (NULL, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        u, v, NULL)) ;
+    ERR (GxB_outerProduct (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        u, NULL, NULL)) ;
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR (GxB_innerProduct (s2, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, u, v,
+        NULL)) ;
+    ERR (GxB_outerProduct (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        v, u, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&C1) ;
+    GrB_Matrix_free (&U) ;
+    GrB_Matrix_free (&V) ;
+    GrB_Vector_free (&u) ;
+    GrB_Vector_free (&v) ;
+    GrB_Scalar_free (&s2) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test39: all tests passed\n\n") ;
+}
+
@@ -0,0 +1,167 @@
+//------------------------------------------------------------------------------
+// GB_mex_test40: test GxB_MxmPlan
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M> = accum (C,A*B) is computed many times with the same plan, with the
+// values of A and B changing but not their patterns, and compared with
+// GrB_mxm.  The pattern of A is then changed, so the plan must be redone.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test40"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL, M = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GxB_MxmPlan plan = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+    int nthreads_save ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &nthreads_save)) ;
+
+    GrB_Semiring semirings [4] = { GrB_PLUS_TIMES_SEMIRING_FP64,
+        GrB_MIN_PLUS_SEMIRING_FP64, GxB_PLUS_PAIR_FP64,
+        GrB_MAX_TIMES_SEMIRING_FP64 } ;
+    GrB_Desc_Value methods [3] = { GxB_DEFAULT, GxB_AxB_GUSTAVSON,
+        GxB_AxB_HASH } ;
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    GrB_Index m = 200, k = 300, n = 250 ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, k)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, k, n)) ;
+    OK (GrB_Matrix_new (&M, GrB_BOOL, m, n)) ;
+    for (int e = 0 ; e < 2000 ; e++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 7),
+            simple_rand ( ) % m, simple_rand ( ) % k)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (simple_rand ( ) % 5),
+            simple_rand ( ) % k, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_BOOL (M, true,
+            simple_rand ( ) % m, simple_rand ( ) % n)) ;
+    }
+    // a few dense columns of B, to create fine tasks
+    for (GrB_Index i = 0 ; i < k ; i++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (B, 1, i, 3)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, 2, i, 7)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C,A*B), with and without the plan
+    //--------------------------------------------------------------------------
+
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+    {
+        OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads)) ;
+        for (int hyper = 0 ; hyper <= 1 ; hyper++)
+        {
+            OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL,
+                hyper ? GxB_HYPERSPARSE : GxB_SPARSE)) ;
+            OK (GxB_Matrix_Option_set (B, GxB_SPARSITY_CONTROL,
+                hyper ? GxB_HYPERSPARSE : GxB_SPARSE)) ;
+            for (int s = 0 ; s < 4 ; s++)
+            {
+                GrB_Semiring semiring = semirings [s] ;
+                for (int kmethod = 0 ; kmethod < 3 ; kmethod++)
+                {
+                    OK (GxB_Desc_set (desc, GxB_AxB_METHOD, methods [kmethod]));
+                    for (int trial = 0 ; trial <= 2 ; trial++)
+                    {
+                        GrB_Matrix Mask = (trial == 0) ? NULL : M ;
+                        GrB_BinaryOp accum = (trial == 2) ? GrB_PLUS_FP64 :NULL;
+                        OK (GxB_MxmPlan_new (&plan)) ;
+                        for (int iter = 0 ; iter < 3 ; iter++)
+                        {
+                            // change the values of A and B, not their pattern
+                            OK (GrB_Matrix_apply_BinaryOp2nd_FP64 (A, NULL,
+                                NULL, GrB_PLUS_FP64, A, 1, NULL)) ;
+                            OK (GrB_Matrix_apply_BinaryOp2nd_FP64 (B, NULL,
+                                NULL, GrB_MINUS_FP64, B, 1, NULL)) ;
+                            OK (GrB_Matrix_new (&C1, GrB_FP64, m, n)) ;
+                            OK (GrB_Matrix_new (&C2, GrB_FP64, m, n)) ;
+                            OK (GrB_Matrix_setElement_FP64 (C1, 3, 2, 2)) ;
+                            OK (GrB_Matrix_setElement_FP64 (C2, 3, 2, 2)) ;
+                            OK (GxB_MxmPlan_execute (C1, Mask, accum, semiring,
+                                A, B, desc, plan)) ;
+                            OK (GrB_mxm (C2, Mask, accum, semiring, A, B,
+                                desc)) ;
+                            CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                            GrB_Matrix_free (&C1) ;
+                            GrB_Matrix_free (&C2) ;
+                            if (iter == 1)
+                            {
+                                // change the pattern of A
+                                OK (GrB_Matrix_setElement_FP64 (A, 1,
+                                    simple_rand ( ) % m, simple_rand ( ) % k)) ;
+                                OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                            }
+                        }
+                        OK (GxB_MxmPlan_free (&plan)) ;
+                    }
+                }
+            }
+        }
+    }
+
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads_save)) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (GxB_MxmPlan_new (&plan)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, m, n)) ;
+    GrB_Info expected = GrB_NULL_POINTER ;
+    ERR (GxB_MxmPlan_new (NULL)) ;
+    ERR (GxB_MxmPlan_execute (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        A, B, NULL, NULL)) ;
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR (GxB_MxmPlan_execute (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        B, A, NULL, plan)) ;
+    OK (GrB_free (&plan)) ;
+    CHECK (plan == NULL) ;
+    OK (GxB_MxmPlan_free (&plan)) ;
+    OK (GxB_MxmPlan_free (NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&B) ;
+    GrB_Matrix_free (&M) ;
+    GrB_Matrix_free (&C1) ;
+    GrB_Descriptor_free (&desc) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test40: all tests passed\n\n") ;
+}
+
@@ -0,0 +1,122 @@
+//------------------------------------------------------------------------------
+// GB_mex_test41: test autotuning of the C=A*B method (GxB_AUTOTUNE)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M>=A'*B and C<M>=A*B are computed many times with autotuning enabled, so
+// that each method is tried and the fastest is then used.  Each result is
+// compared with the result computed with autotuning disabled.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test41"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL, M = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+    int32_t autotune = -1 ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &autotune, GxB_AUTOTUNE)) ;
+    CHECK (autotune == 0) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 300 ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&M, GrB_BOOL, n, n)) ;
+    for (int e = 0 ; e < 3000 ; e++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 7),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (simple_rand ( ) % 5),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_BOOL (M, true,
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // C<M>=A'*B, C<M>=A*B, C<!M>=A*B, and C=A*B, with and without autotuning
+    //--------------------------------------------------------------------------
+
+    for (int by_col = 0 ; by_col <= 1 ; by_col++)
+    {
+        int fmt = by_col ? GxB_BY_COL : GxB_BY_ROW ;
+        OK (GxB_Matrix_Option_set (A, GxB_FORMAT, fmt)) ;
+        OK (GxB_Matrix_Option_set (B, GxB_FORMAT, fmt)) ;
+        OK (GxB_Matrix_Option_set (M, GxB_FORMAT, fmt)) ;
+        for (int atrans = 0 ; atrans <= 1 ; atrans++)
+        {
+            for (int trial = 0 ; trial <= 2 ; trial++)
+            {
+                GrB_Matrix Mask = (trial == 2) ? NULL : M ;
+                GrB_Descriptor d = atrans ? GrB_DESC_T0 : NULL ;
+                if (trial == 1) d = atrans ? GrB_DESC_CT0 : GrB_DESC_C ;
+                for (int iter = 0 ; iter < 20 ; iter++)
+                {
+                    OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+                    OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+                    OK (GrB_Global_set_INT32 (GrB_GLOBAL, true, GxB_AUTOTUNE)) ;
+                    OK (GrB_mxm (C1, Mask, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+                        A, B, d)) ;
+                    OK (GrB_Global_set_INT32 (GrB_GLOBAL, false, GxB_AUTOTUNE));
+                    OK (GrB_mxm (C2, Mask, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+                        A, B, d)) ;
+                    CHECK (GB_mx_isequal (C1, C2, 1e-12)) ;
+                    GrB_Matrix_free (&C1) ;
+                    GrB_Matrix_free (&C2) ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // get/set
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set (GxB_AUTOTUNE, true)) ;
+    bool b = false ;
+    OK (GxB_Global_Option_get (GxB_AUTOTUNE, &b)) ;
+    CHECK (b) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_AUTOTUNE, false)) ;
+    OK (GxB_Global_Option_get_INT32 (GxB_AUTOTUNE, &autotune)) ;
+    CHECK (autotune == 0) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&B) ;
+    GrB_Matrix_free (&M) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test41: all tests passed\n\n") ;
+}
+
@@ -0,0 +1,141 @@
+//------------------------------------------------------------------------------
+// GB_mex_test42: test C+=A*B and C+=A'*B with C full (saxpy4 and dot4)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C+=A*B and C+=A'*B are computed in-place with C full, for the plus_times
+// and min_plus semirings on FP32, FP64, and INT64, which have AVX512F and
+// AVX2 variants of the saxpy4 and dot4 methods.  Each result is compared with
+// T=A*B (or T=A'*B) followed by C=C+T.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test42"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C0 = NULL, C1 = NULL, C2 = NULL, T = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+    printf ("avx2: %d avx512f: %d\n", GB_Global_cpu_features_avx2 ( ),
+        GB_Global_cpu_features_avx512f ( )) ;
+
+    GrB_Type types [3] = { GrB_FP32, GrB_FP64, GrB_INT64 } ;
+    GrB_Semiring semirings [2][3] =
+    {
+        { GrB_PLUS_TIMES_SEMIRING_FP32, GrB_PLUS_TIMES_SEMIRING_FP64,
+          GrB_PLUS_TIMES_SEMIRING_INT64 },
+        { GrB_MIN_PLUS_SEMIRING_FP32, GrB_MIN_PLUS_SEMIRING_FP64,
+          GrB_MIN_PLUS_SEMIRING_INT64 }
+    } ;
+    GrB_BinaryOp accums [2][3] =
+    {
+        { GrB_PLUS_FP32, GrB_PLUS_FP64, GrB_PLUS_INT64 },
+        { GrB_MIN_FP32, GrB_MIN_FP64, GrB_MIN_INT64 }
+    } ;
+
+    GrB_Index n = 100 ;
+
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        GrB_Type type = types [k] ;
+
+        //----------------------------------------------------------------------
+        // create the problem: A sparse, B full or bitmap, C0 full
+        //----------------------------------------------------------------------
+
+        OK (GrB_Matrix_new (&A, type, n, n)) ;
+        OK (GrB_Matrix_new (&B, type, n, n)) ;
+        OK (GrB_Matrix_new (&C0, type, n, n)) ;
+        for (int e = 0 ; e < 1000 ; e++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 7),
+                simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        }
+        for (GrB_Index i = 0 ; i < n ; i++)
+        {
+            for (GrB_Index j = 0 ; j < n ; j++)
+            {
+                OK (GrB_Matrix_setElement_FP64 (B,
+                    (double) (simple_rand ( ) % 5), i, j)) ;
+                OK (GrB_Matrix_setElement_FP64 (C0,
+                    (double) (simple_rand ( ) % 50), i, j)) ;
+            }
+        }
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_wait (C0, GrB_MATERIALIZE)) ;
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+
+        for (int by_col = 0 ; by_col <= 1 ; by_col++)
+        {
+            int fmt = by_col ? GxB_BY_COL : GxB_BY_ROW ;
+            OK (GxB_Matrix_Option_set (A, GxB_FORMAT, fmt)) ;
+            OK (GxB_Matrix_Option_set (B, GxB_FORMAT, fmt)) ;
+            OK (GxB_Matrix_Option_set (C0, GxB_FORMAT, fmt)) ;
+            for (int b_bitmap = 0 ; b_bitmap <= 1 ; b_bitmap++)
+            {
+                OK (GxB_Matrix_Option_set (B, GxB_SPARSITY_CONTROL,
+                    b_bitmap ? GxB_BITMAP : GxB_FULL)) ;
+                for (int s = 0 ; s < 2 ; s++)
+                {
+                    GrB_Semiring semiring = semirings [s][k] ;
+                    GrB_BinaryOp accum = accums [s][k] ;
+                    for (int atrans = 0 ; atrans <= 1 ; atrans++)
+                    {
+                        GrB_Descriptor d = atrans ? GrB_DESC_T0 : NULL ;
+
+                        // C1 += A*B or C1 += A'*B, in-place
+                        OK (GrB_Matrix_dup (&C1, C0)) ;
+                        OK (GrB_mxm (C1, NULL, accum, semiring, A, B, d)) ;
+
+                        // C2 = C0 + T where T = A*B or T = A'*B
+                        OK (GrB_Matrix_new (&T, type, n, n)) ;
+                        OK (GrB_Matrix_new (&C2, type, n, n)) ;
+                        OK (GrB_mxm (T, NULL, NULL, semiring, A, B, d)) ;
+                        OK (GrB_Matrix_eWiseAdd_BinaryOp (C2, NULL, NULL,
+                            accum, C0, T, NULL)) ;
+
+                        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                        GrB_Matrix_free (&C1) ;
+                        GrB_Matrix_free (&C2) ;
+                        GrB_Matrix_free (&T) ;
+                    }
+                }
+            }
+        }
+
+        GrB_Matrix_free (&A) ;
+        GrB_Matrix_free (&B) ;
+        GrB_Matrix_free (&C0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test42: all tests passed\n\n") ;
+}
+
@@ -0,0 +1,127 @@
+//------------------------------------------------------------------------------
+// GB_mex_test43: test C+=A'*B with dot4, with many columns in B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C+=A'*B is computed in-place with the dot4 method, where C is full, A is
+// sparse or hypersparse, and B is full with 1 to 100 columns, so that both the
+// wide panels of B (GB_DOT4_PANEL columns each) and the remaining narrow
+// panels are used.  Each result is compared with T=A'*B followed by C=C+T.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test43"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C0 = NULL, C1 = NULL, C2 = NULL, T = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    GrB_Semiring semirings [3] = { GrB_PLUS_TIMES_SEMIRING_FP64,
+        GrB_MAX_TIMES_SEMIRING_FP64, GrB_PLUS_MIN_SEMIRING_FP64 } ;
+    GrB_BinaryOp accums [3] = { GrB_PLUS_FP64, GrB_MAX_FP64, GrB_PLUS_FP64 } ;
+    int64_t bncols [6] = { 1, 3, 16, 21, 64, 100 } ;
+    GrB_Index m = 200, k = 300 ;
+
+    //--------------------------------------------------------------------------
+    // create A
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, k, m)) ;
+    for (int e = 0 ; e < 3000 ; e++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 7),
+            simple_rand ( ) % k, simple_rand ( ) % m)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+    for (int hyper = 0 ; hyper <= 1 ; hyper++)
+    {
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL,
+            hyper ? GxB_HYPERSPARSE : GxB_SPARSE)) ;
+        for (int kb = 0 ; kb < 6 ; kb++)
+        {
+
+            //------------------------------------------------------------------
+            // create B and C0, both full
+            //------------------------------------------------------------------
+
+            GrB_Index n = bncols [kb] ;
+            OK (GrB_Matrix_new (&B, GrB_FP64, k, n)) ;
+            OK (GrB_Matrix_new (&C0, GrB_FP64, m, n)) ;
+            for (GrB_Index j = 0 ; j < n ; j++)
+            {
+                for (GrB_Index i = 0 ; i < k ; i++)
+                {
+                    OK (GrB_Matrix_setElement_FP64 (B,
+                        (double) (simple_rand ( ) % 5), i, j)) ;
+                }
+                for (GrB_Index i = 0 ; i < m ; i++)
+                {
+                    OK (GrB_Matrix_setElement_FP64 (C0,
+                        (double) (simple_rand ( ) % 50), i, j)) ;
+                }
+            }
+            OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+            OK (GrB_Matrix_wait (C0, GrB_MATERIALIZE)) ;
+            OK (GxB_Matrix_Option_set (B, GxB_FORMAT, GxB_BY_COL)) ;
+            OK (GxB_Matrix_Option_set (C0, GxB_FORMAT, GxB_BY_COL)) ;
+            OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+
+            for (int s = 0 ; s < 3 ; s++)
+            {
+                // C1 += A'*B, in-place
+                OK (GrB_Matrix_dup (&C1, C0)) ;
+                OK (GrB_mxm (C1, NULL, accums [s], semirings [s], A, B,
+                    GrB_DESC_T0)) ;
+
+                // C2 = C0 + T where T = A'*B
+                OK (GrB_Matrix_new (&T, GrB_FP64, m, n)) ;
+                OK (GrB_Matrix_new (&C2, GrB_FP64, m, n)) ;
+                OK (GrB_mxm (T, NULL, NULL, semirings [s], A, B, GrB_DESC_T0)) ;
+                OK (GrB_Matrix_eWiseAdd_BinaryOp (C2, NULL, NULL, accums [s],
+                    C0, T, NULL)) ;
+
+                CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                GrB_Matrix_free (&C1) ;
+                GrB_Matrix_free (&C2) ;
+                GrB_Matrix_free (&T) ;
+            }
+
+            GrB_Matrix_free (&B) ;
+            GrB_Matrix_free (&C0) ;
+        }
+    }
+
+    GrB_Matrix_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test43: all tests passed\n\n") ;
+}
+
@@ -0,0 +1,236 @@
+//------------------------------------------------------------------------------
+// GB_mex_test44: test boolean C=A*B and C=A'*B with bit-packed B and C
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*B and C=A'*B are computed with A sparse or hypersparse, and B a bitmap
+// or full boolean matrix with 64 or more columns, as in a multi-source BFS,
+// so that GB_AxB_bitpack is used.  Each result is compared with the same
+// product computed for panels of 32 columns of B at a time (which is too few
+// for GB_AxB_bitpack), with the panels then concatenated.  All matrices are
+// held by column.  Finally, C=A'*B is computed with a hypersparse A with a huge
+// number of columns, which GB_AxB_bitpack must leave to GB_AxB_dot2.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test44"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NPANEL 32
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Matrix Tiles [NPANEL] ;
+    GrB_Index cols [NPANEL] ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    GrB_Semiring semirings [3] = { GrB_LOR_LAND_SEMIRING_BOOL,
+        GxB_ANY_PAIR_BOOL, GxB_LOR_PAIR_BOOL } ;
+    int64_t bncols [3] = { 64, 100, 200 } ;
+    GrB_Index n = 500 ;
+    int nthreads_max ;
+    OK (GxB_get (GxB_NTHREADS, &nthreads_max)) ;
+
+    //--------------------------------------------------------------------------
+    // create A, with some explicit false entries
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_BOOL, n, n)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    for (int e = 0 ; e < 4000 ; e++)
+    {
+        OK (GrB_Matrix_setElement_BOOL (A, (simple_rand ( ) % 8) != 0,
+            simple_rand ( ) % n, simple_rand ( ) % (n/2))) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+    for (int hyper = 0 ; hyper <= 1 ; hyper++)
+    {
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL,
+            hyper ? GxB_HYPERSPARSE : GxB_SPARSE)) ;
+
+        for (int kb = 0 ; kb < 3 ; kb++)
+        {
+
+            //------------------------------------------------------------------
+            // create B, a set of bncols [kb] frontiers
+            //------------------------------------------------------------------
+
+            GrB_Index bn = bncols [kb] ;
+            OK (GrB_Matrix_new (&B, GrB_BOOL, n, bn)) ;
+            OK (GxB_Matrix_Option_set (B, GxB_FORMAT, GxB_BY_COL)) ;
+            for (int e = 0 ; e < 20 * n ; e++)
+            {
+                OK (GrB_Matrix_setElement_BOOL (B, (simple_rand ( ) % 4) != 0,
+                    simple_rand ( ) % n, simple_rand ( ) % bn)) ;
+            }
+            OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+            for (int b_full = 0 ; b_full <= 1 ; b_full++)
+            {
+                if (b_full)
+                {
+                    // fill in the rest of B with false
+                    OK (GrB_Matrix_assign_BOOL (B, B, NULL, false, GrB_ALL, n,
+                        GrB_ALL, bn, GrB_DESC_SC)) ;
+                }
+                OK (GxB_Matrix_Option_set (B, GxB_SPARSITY_CONTROL,
+                    b_full ? GxB_FULL : GxB_BITMAP)) ;
+
+                for (int s = 0 ; s < 3 ; s++)
+                {
+                    GrB_Semiring semiring = semirings [s] ;
+                    for (int atrans = 0 ; atrans <= 1 ; atrans++)
+                    {
+                        GrB_Descriptor d = atrans ? GrB_DESC_T0 : NULL ;
+                        for (int nth = 1 ; nth <= 4 ; nth += 3)
+                        {
+                            OK (GxB_set (GxB_NTHREADS, nth)) ;
+
+                            // C1 = A*B or A'*B, with all of B at once
+                            OK (GrB_Matrix_new (&C1, GrB_BOOL, n, bn)) ;
+                            OK (GxB_Matrix_Option_set (C1, GxB_FORMAT,
+                                GxB_BY_COL)) ;
+                            OK (GrB_mxm (C1, NULL, NULL, semiring, A, B, d)) ;
+
+                            // C2 = [A*B(:,panel) ...], one panel at a time
+                            int ntiles = 0 ;
+                            for (GrB_Index j1 = 0 ; j1 < bn ; j1 += NPANEL)
+                            {
+                                GrB_Index nj = GB_IMIN (NPANEL, bn - j1) ;
+                                for (int j = 0 ; j < nj ; j++)
+                                {
+                                    cols [j] = j1 + j ;
+                                }
+                                GrB_Matrix Bj = NULL, Tj = NULL ;
+                                OK (GrB_Matrix_new (&Bj, GrB_BOOL, n, nj)) ;
+                                OK (GrB_Matrix_extract (Bj, NULL, NULL, B,
+                                    GrB_ALL, n, cols, nj, NULL)) ;
+                                OK (GrB_Matrix_new (&Tj, GrB_BOOL, n, nj)) ;
+                                OK (GxB_Matrix_Option_set (Tj, GxB_FORMAT,
+                                    GxB_BY_COL)) ;
+                                OK (GrB_mxm (Tj, NULL, NULL, semiring, A, Bj,
+                                    d)) ;
+                                Tiles [ntiles++] = Tj ;
+                                GrB_Matrix_free (&Bj) ;
+                            }
+                            OK (GrB_Matrix_new (&C2, GrB_BOOL, n, bn)) ;
+                            OK (GxB_Matrix_Option_set (C2, GxB_FORMAT,
+                                GxB_BY_COL)) ;
+                            OK (GxB_Matrix_concat (C2, Tiles, 1, ntiles,
+                                NULL)) ;
+                            for (int t = 0 ; t < ntiles ; t++)
+                            {
+                                GrB_Matrix_free (&(Tiles [t])) ;
+                            }
+
+                            OK (GxB_Matrix_Option_set (C1,
+                                GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+                            OK (GxB_Matrix_Option_set (C2,
+                                GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+                            CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                            GrB_Matrix_free (&C1) ;
+                            GrB_Matrix_free (&C2) ;
+                        }
+                        OK (GxB_set (GxB_NTHREADS, nthreads_max)) ;
+                    }
+                }
+            }
+            GrB_Matrix_free (&B) ;
+        }
+    }
+
+    GrB_Matrix_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // C=A'*B with a hypersparse A with a huge number of columns
+    //--------------------------------------------------------------------------
+
+    // C has 2^50 rows, so it can only be computed by GB_AxB_dot2, which
+    // computes just the rows of C for the few columns present in A
+    GrB_Index huge = ((GrB_Index) 1) << 50 ;
+    GrB_Index bn = 64 ;
+    OK (GrB_Matrix_new (&A, GrB_BOOL, n, huge)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_HYPERSPARSE)) ;
+    for (int e = 0 ; e < 400 ; e++)
+    {
+        OK (GrB_Matrix_setElement_BOOL (A, true, simple_rand ( ) % n,
+            (simple_rand ( ) % 20) * (huge / 20))) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_new (&B, GrB_BOOL, n, bn)) ;
+    OK (GxB_Matrix_Option_set (B, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GrB_Matrix_assign_BOOL (B, NULL, NULL, true, GrB_ALL, n, GrB_ALL, bn,
+        NULL)) ;
+    OK (GxB_Matrix_Option_set (B, GxB_SPARSITY_CONTROL, GxB_FULL)) ;
+
+    // C1 = A'*B, with all of B at once
+    OK (GrB_Matrix_new (&C1, GrB_BOOL, huge, bn)) ;
+    OK (GxB_Matrix_Option_set (C1, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GrB_mxm (C1, NULL, NULL, GxB_ANY_PAIR_BOOL, A, B, GrB_DESC_T0)) ;
+
+    // C2 = [A'*B(:,0:31) A'*B(:,32:63)]
+    int ntiles = 0 ;
+    for (GrB_Index j1 = 0 ; j1 < bn ; j1 += NPANEL)
+    {
+        for (int j = 0 ; j < NPANEL ; j++)
+        {
+            cols [j] = j1 + j ;
+        }
+        GrB_Matrix Bj = NULL, Tj = NULL ;
+        OK (GrB_Matrix_new (&Bj, GrB_BOOL, n, NPANEL)) ;
+        OK (GrB_Matrix_extract (Bj, NULL, NULL, B, GrB_ALL, n, cols, NPANEL,
+            NULL)) ;
+        OK (GrB_Matrix_new (&Tj, GrB_BOOL, huge, NPANEL)) ;
+        OK (GxB_Matrix_Option_set (Tj, GxB_FORMAT, GxB_BY_COL)) ;
+        OK (GrB_mxm (Tj, NULL, NULL, GxB_ANY_PAIR_BOOL, A, Bj, GrB_DESC_T0)) ;
+        Tiles [ntiles++] = Tj ;
+        GrB_Matrix_free (&Bj) ;
+    }
+    OK (GrB_Matrix_new (&C2, GrB_BOOL, huge, bn)) ;
+    OK (GxB_Matrix_Option_set (C2, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_concat (C2, Tiles, 1, ntiles, NULL)) ;
+    for (int t = 0 ; t < ntiles ; t++)
+    {
+        GrB_Matrix_free (&(Tiles [t])) ;
+    }
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, C1)) ;
+    CHECK (nvals > 0 && nvals <= 20 * bn) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+    GrB_Matrix_free (&C1) ;
+    GrB_Matrix_free (&C2) ;
+    GrB_Matrix_free (&B) ;
+    GrB_Matrix_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test44: all tests passed\n\n") ;
+}
+
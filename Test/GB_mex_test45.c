@@ -0,0 +1,251 @@
+//------------------------------------------------------------------------------
+// GB_mex_test45: test JIT kernel lookups from many user threads
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Several user threads, each with its own GxB_Context, compute C=A*B many
+// times with a set of semirings, so that JIT kernels are looked up in the
+// hash table without the critical section while other threads are loading or
+// compiling kernels and inserting them into the table.  Each result is
+// compared with the same result computed by a single user thread.  This is
+// then repeated with int16 inputs and fp32 semirings, so that no factory
+// kernel can be used, while another user thread repeatedly sets the JIT
+// control to GxB_JIT_OFF and back again, which evicts all the JIT kernels
+// while the other user threads are running them.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test45"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NSEMIRINGS 6
+#define NOUTER 4
+#define NTRIALS 20
+#define NTOGGLES 50
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, A16 = NULL, B16 = NULL ;
+    GrB_Matrix C0 [NSEMIRINGS] ;
+    GrB_Matrix C [NOUTER][NSEMIRINGS] ;
+    GrB_Index n = 50 ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    #ifdef _OPENMP
+    omp_set_max_active_levels (2) ;
+    #endif
+
+    GrB_Semiring semirings [NSEMIRINGS] = { GrB_PLUS_TIMES_SEMIRING_FP64,
+        GrB_MIN_PLUS_SEMIRING_FP64, GrB_MAX_TIMES_SEMIRING_FP64,
+        GrB_PLUS_MIN_SEMIRING_FP64, GrB_MAX_MIN_SEMIRING_FP64,
+        GrB_MIN_TIMES_SEMIRING_FP64 } ;
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+    for (int e = 0 ; e < 500 ; e++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 9),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (simple_rand ( ) % 9),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // compute the results with a single user thread
+    //--------------------------------------------------------------------------
+
+    for (int s = 0 ; s < NSEMIRINGS ; s++)
+    {
+        OK (GrB_Matrix_new (&(C0 [s]), GrB_FP64, n, n)) ;
+        OK (GrB_mxm (C0 [s], NULL, NULL, semirings [s], A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C0 [s], GrB_MATERIALIZE)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compute the results with many user threads
+    //--------------------------------------------------------------------------
+
+    // clear the JIT hash table, so that the user threads must load the
+    // kernels again while other user threads are looking them up
+    GxB_JIT_Control control ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, control)) ;
+
+    bool ok = true ;
+    #pragma omp parallel for num_threads (NOUTER) schedule (static, 1) \
+        reduction (&&:ok)
+    for (int t = 0 ; t < NOUTER ; t++)
+    {
+        GxB_Context Context = NULL ;
+        ok = ok && (GxB_Context_new (&Context) == GrB_SUCCESS) ;
+        ok = ok && (GxB_Context_set (Context, GxB_NTHREADS, 1)
+            == GrB_SUCCESS) ;
+        ok = ok && (GxB_Context_engage (Context) == GrB_SUCCESS) ;
+        for (int s = 0 ; s < NSEMIRINGS ; s++)
+        {
+            C [t][s] = NULL ;
+            ok = ok && (GrB_Matrix_new (&(C [t][s]), GrB_FP64, n, n)
+                == GrB_SUCCESS) ;
+        }
+        for (int trial = 0 ; trial < NTRIALS ; trial++)
+        {
+            for (int s = 0 ; s < NSEMIRINGS ; s++)
+            {
+                // each thread uses the semirings in a different order
+                int s2 = (s + t) % NSEMIRINGS ;
+                ok = ok && (GrB_mxm (C [t][s2], NULL, NULL, semirings [s2],
+                    A, B, NULL) == GrB_SUCCESS) ;
+                ok = ok && (GrB_Matrix_wait (C [t][s2], GrB_MATERIALIZE)
+                    == GrB_SUCCESS) ;
+            }
+        }
+        ok = ok && (GxB_Context_disengage (Context) == GrB_SUCCESS) ;
+        ok = ok && (GxB_Context_free (&Context) == GrB_SUCCESS) ;
+    }
+    CHECK (ok) ;
+
+    //--------------------------------------------------------------------------
+    // check the results
+    //--------------------------------------------------------------------------
+
+    for (int t = 0 ; t < NOUTER ; t++)
+    {
+        for (int s = 0 ; s < NSEMIRINGS ; s++)
+        {
+            CHECK (GB_mx_isequal (C0 [s], C [t][s], 0)) ;
+            GrB_Matrix_free (&(C [t][s])) ;
+        }
+    }
+
+    for (int s = 0 ; s < NSEMIRINGS ; s++)
+    {
+        GrB_Matrix_free (&(C0 [s])) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compute the results while the JIT is turned off and on again
+    //--------------------------------------------------------------------------
+
+    GrB_Semiring semirings32 [NSEMIRINGS] = { GrB_PLUS_TIMES_SEMIRING_FP32,
+        GrB_MIN_PLUS_SEMIRING_FP32, GrB_MAX_TIMES_SEMIRING_FP32,
+        GrB_PLUS_MIN_SEMIRING_FP32, GrB_MAX_MIN_SEMIRING_FP32,
+        GrB_MIN_TIMES_SEMIRING_FP32 } ;
+
+    OK (GrB_Matrix_new (&A16, GrB_INT16, n, n)) ;
+    OK (GrB_Matrix_new (&B16, GrB_INT16, n, n)) ;
+    OK (GrB_Matrix_apply (A16, NULL, NULL, GrB_IDENTITY_INT16, A, NULL)) ;
+    OK (GrB_Matrix_apply (B16, NULL, NULL, GrB_IDENTITY_INT16, B, NULL)) ;
+    OK (GrB_Matrix_wait (A16, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B16, GrB_MATERIALIZE)) ;
+
+    for (int s = 0 ; s < NSEMIRINGS ; s++)
+    {
+        OK (GrB_Matrix_new (&(C0 [s]), GrB_FP32, n, n)) ;
+        OK (GrB_mxm (C0 [s], NULL, NULL, semirings32 [s], A16, B16, NULL)) ;
+        OK (GrB_Matrix_wait (C0 [s], GrB_MATERIALIZE)) ;
+    }
+
+    ok = true ;
+    #pragma omp parallel for num_threads (NOUTER+1) schedule (static, 1) \
+        reduction (&&:ok)
+    for (int t = 0 ; t <= NOUTER ; t++)
+    {
+        if (t == NOUTER)
+        {
+            // turn the JIT off and on again, while the other threads are
+            // using JIT kernels
+            for (int toggle = 0 ; toggle < NTOGGLES ; toggle++)
+            {
+                ok = ok && (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)
+                    == GrB_SUCCESS) ;
+                ok = ok && (GxB_set (GxB_JIT_C_CONTROL, control)
+                    == GrB_SUCCESS) ;
+            }
+            continue ;
+        }
+        GxB_Context Context = NULL ;
+        ok = ok && (GxB_Context_new (&Context) == GrB_SUCCESS) ;
+        ok = ok && (GxB_Context_set (Context, GxB_NTHREADS, 1)
+            == GrB_SUCCESS) ;
+        ok = ok && (GxB_Context_engage (Context) == GrB_SUCCESS) ;
+        for (int s = 0 ; s < NSEMIRINGS ; s++)
+        {
+            C [t][s] = NULL ;
+            ok = ok && (GrB_Matrix_new (&(C [t][s]), GrB_FP32, n, n)
+                == GrB_SUCCESS) ;
+        }
+        for (int trial = 0 ; trial < NTRIALS ; trial++)
+        {
+            for (int s = 0 ; s < NSEMIRINGS ; s++)
+            {
+                int s2 = (s + t) % NSEMIRINGS ;
+                ok = ok && (GrB_mxm (C [t][s2], NULL, NULL, semirings32 [s2],
+                    A16, B16, NULL) == GrB_SUCCESS) ;
+                ok = ok && (GrB_Matrix_wait (C [t][s2], GrB_MATERIALIZE)
+                    == GrB_SUCCESS) ;
+            }
+        }
+        ok = ok && (GxB_Context_disengage (Context) == GrB_SUCCESS) ;
+        ok = ok && (GxB_Context_free (&Context) == GrB_SUCCESS) ;
+    }
+    CHECK (ok) ;
+
+    // the JIT control is restored
+    GxB_JIT_Control control2 ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control2)) ;
+    CHECK (control2 == control) ;
+
+    for (int t = 0 ; t < NOUTER ; t++)
+    {
+        for (int s = 0 ; s < NSEMIRINGS ; s++)
+        {
+            CHECK (GB_mx_isequal (C0 [s], C [t][s], 0)) ;
+            GrB_Matrix_free (&(C [t][s])) ;
+        }
+    }
+
+    for (int s = 0 ; s < NSEMIRINGS ; s++)
+    {
+        GrB_Matrix_free (&(C0 [s])) ;
+    }
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&B) ;
+    GrB_Matrix_free (&A16) ;
+    GrB_Matrix_free (&B16) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test45: all tests passed\n\n") ;
+}
+
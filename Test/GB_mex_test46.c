@@ -0,0 +1,191 @@
+//------------------------------------------------------------------------------
+// GB_mex_test46: test the JIT manifest and GxB_JIT_warmup
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A manifest is recorded while computing C=A*B with a few semirings, using one
+// JIT cache.  The JIT cache is then changed to another folder, and the
+// kernels in the manifest are compiled with GxB_JIT_warmup.  With the JIT
+// control set to GxB_JIT_LOAD (so no kernels may be compiled), each kernel in
+// the manifest must then be in the new cache, and the results must match.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_config.h"
+
+#define USAGE "GB_mex_test46"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NSEMIRINGS 3
+#define MANIFEST "/tmp/grb_test46_manifest.txt"
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL, B = NULL, C0 [NSEMIRINGS], C1 = NULL ;
+    GrB_Index n = 50 ;
+    char *save_cache, *s ;
+    char cache [1024], line [1024], name [1024], filename [2048] ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    GrB_Semiring semirings [NSEMIRINGS] = { GrB_PLUS_TIMES_SEMIRING_INT16,
+        GrB_MAX_MIN_SEMIRING_INT16, GrB_MIN_MAX_SEMIRING_INT16 } ;
+
+    GxB_JIT_Control control ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control)) ;
+    OK (GxB_get (GxB_JIT_CACHE_PATH, &s)) ;
+    save_cache = mxMalloc (strlen (s) + 2) ;
+    strcpy (save_cache, s) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_INT16, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_INT16, n, n)) ;
+    for (int e = 0 ; e < 500 ; e++)
+    {
+        OK (GrB_Matrix_setElement_INT32 (A, simple_rand ( ) % 9,
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_INT32 (B, simple_rand ( ) % 9,
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // record a manifest
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_CACHE_PATH, "/tmp/grb_test46_cache1")) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+    OK (GxB_set (GxB_JIT_MANIFEST, MANIFEST)) ;
+    OK (GxB_get (GxB_JIT_MANIFEST, &s)) ;
+    CHECK (MATCH (s, MANIFEST)) ;
+
+    for (int k = 0 ; k < NSEMIRINGS ; k++)
+    {
+        OK (GrB_Matrix_new (&(C0 [k]), GrB_INT16, n, n)) ;
+        OK (GrB_mxm (C0 [k], NULL, NULL, semirings [k], A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C0 [k], GrB_MATERIALIZE)) ;
+    }
+
+    // stop recording
+    OK (GxB_set (GxB_JIT_MANIFEST, "")) ;
+    OK (GxB_get (GxB_JIT_MANIFEST, &s)) ;
+    CHECK (MATCH (s, "")) ;
+
+    //--------------------------------------------------------------------------
+    // compile the kernels in another cache from the manifest
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_CACHE_PATH, "/tmp/grb_test46_cache2")) ;
+    OK (GxB_get (GxB_JIT_CACHE_PATH, &s)) ;
+    strncpy (cache, s, 1000) ;
+    OK (GxB_JIT_warmup (MANIFEST)) ;
+
+    // check that each kernel in the manifest is now in the cache
+    int nkernels = 0 ;
+    FILE *fp = fopen (MANIFEST, "r") ;
+    CHECK (fp != NULL) ;
+    while (fgets (line, 1000, fp) != NULL)
+    {
+        uint64_t hash ;
+        int64_t nbytes ;
+        if (sscanf (line, "GB_jit_manifest %" SCNx64 " %s %" SCNd64,
+            &hash, name, &nbytes) != 3)
+        {
+            continue ;
+        }
+        snprintf (filename, 2000, "%s/lib/%02x/%s%s%s", cache,
+            (int) (hash & 0xFF), GB_LIB_PREFIX, name, GB_LIB_SUFFIX) ;
+        FILE *f = fopen (filename, "r") ;
+        CHECK (f != NULL) ;
+        fclose (f) ;
+        // its source has been renamed into place
+        snprintf (filename, 2000, "%s/c/%02x/%s.c", cache,
+            (int) (hash & 0xFF), name) ;
+        f = fopen (filename, "r") ;
+        CHECK (f != NULL) ;
+        fclose (f) ;
+        snprintf (filename, 2000, "%s/c/%02x/%s.c.tmp", cache,
+            (int) (hash & 0xFF), name) ;
+        f = fopen (filename, "r") ;
+        CHECK (f == NULL) ;
+        nkernels++ ;
+    }
+    fclose (fp) ;
+    printf ("kernels in manifest: %d\n", nkernels) ;
+    #ifndef NJIT
+    CHECK (nkernels >= NSEMIRINGS) ;
+    #endif
+
+    // the kernels are already compiled, so this does nothing
+    OK (GxB_JIT_warmup (MANIFEST)) ;
+
+    //--------------------------------------------------------------------------
+    // load the kernels, with compilation disabled
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_LOAD)) ;
+    for (int k = 0 ; k < NSEMIRINGS ; k++)
+    {
+        OK (GrB_Matrix_new (&C1, GrB_INT16, n, n)) ;
+        OK (GrB_mxm (C1, NULL, NULL, semirings [k], A, B, NULL)) ;
+        CHECK (GB_mx_isequal (C0 [k], C1, 0)) ;
+        GrB_Matrix_free (&C1) ;
+        GrB_Matrix_free (&(C0 [k])) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_JIT_warmup (NULL)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_JIT_warmup ("/tmp/grb_test46_no_such_manifest.txt")) ;
+    fp = fopen ("/tmp/grb_test46_bad_manifest.txt", "w") ;
+    CHECK (fp != NULL) ;
+    fprintf (fp, "GB_jit_manifest 2c GB_jit__bad;rm 0\n") ;
+    fclose (fp) ;
+    ERR (GxB_JIT_warmup ("/tmp/grb_test46_bad_manifest.txt")) ;
+    ERR (GxB_set (GxB_JIT_MANIFEST, "/tmp/grb_test46_no_such_folder/m.txt")) ;
+    OK (GxB_get (GxB_JIT_MANIFEST, &s)) ;
+    CHECK (MATCH (s, "")) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_CACHE_PATH, save_cache)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, control)) ;
+    mxFree (save_cache) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&B) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test46: all tests passed\n\n") ;
+}
+
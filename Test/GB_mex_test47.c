@@ -0,0 +1,158 @@
+//------------------------------------------------------------------------------
+// GB_mex_test47: test GxB_JIT_pack and the JIT bundle
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*B is computed with a few semirings, so that their kernels are compiled
+// in the JIT cache, and then the kernels in the cache are packed into a
+// bundle with GxB_JIT_pack.  The JIT hash table is then cleared, and the
+// bundle is loaded by setting the cache path.  With the JIT control set to
+// GxB_JIT_LOAD (so no kernels may be compiled), the results computed by the
+// bundled kernels must match.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_config.h"
+
+#define USAGE "GB_mex_test47"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NSEMIRINGS 3
+#define CACHE "/tmp/grb_test47_cache"
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C0 [NSEMIRINGS], C1 = NULL ;
+    GrB_Index n = 50 ;
+    char *save_cache, *s ;
+    char cache [1024], line [1024], filename [2048] ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    GrB_Semiring semirings [NSEMIRINGS] = { GrB_PLUS_TIMES_SEMIRING_UINT16,
+        GrB_MAX_MIN_SEMIRING_UINT16, GrB_MIN_MAX_SEMIRING_UINT16 } ;
+
+    GxB_JIT_Control control ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control)) ;
+    OK (GxB_get (GxB_JIT_CACHE_PATH, &s)) ;
+    save_cache = mxMalloc (strlen (s) + 2) ;
+    strcpy (save_cache, s) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_UINT16, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_UINT16, n, n)) ;
+    for (int e = 0 ; e < 500 ; e++)
+    {
+        OK (GrB_Matrix_setElement_INT32 (A, simple_rand ( ) % 9,
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_INT32 (B, simple_rand ( ) % 9,
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // compile the kernels in the cache and pack them into a bundle
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_CACHE_PATH, CACHE)) ;
+    OK (GxB_get (GxB_JIT_CACHE_PATH, &s)) ;
+    strncpy (cache, s, 1000) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+
+    for (int k = 0 ; k < NSEMIRINGS ; k++)
+    {
+        OK (GrB_Matrix_new (&(C0 [k]), GrB_UINT16, n, n)) ;
+        OK (GrB_mxm (C0 [k], NULL, NULL, semirings [k], A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C0 [k], GrB_MATERIALIZE)) ;
+    }
+
+    OK (GxB_JIT_pack ( )) ;
+
+    #ifndef NJIT
+    // check the index of the bundle
+    int nkernels = 0 ;
+    snprintf (filename, 2000, "%s/lib/GB_jit_bundle.txt", cache) ;
+    FILE *fp = fopen (filename, "r") ;
+    CHECK (fp != NULL) ;
+    while (fgets (line, 1000, fp) != NULL)
+    {
+        CHECK (strncmp (line, "GB_jit__", 8) == 0) ;
+        nkernels++ ;
+    }
+    fclose (fp) ;
+    printf ("kernels in bundle: %d\n", nkernels) ;
+    CHECK (nkernels >= NSEMIRINGS) ;
+    snprintf (filename, 2000, "%s/lib/%sGB_jit_bundle%s", cache,
+        GB_LIB_PREFIX, GB_LIB_SUFFIX) ;
+    fp = fopen (filename, "r") ;
+    CHECK (fp != NULL) ;
+    fclose (fp) ;
+    #endif
+
+    //--------------------------------------------------------------------------
+    // load the bundle, with compilation disabled
+    //--------------------------------------------------------------------------
+
+    // clear the JIT hash table, and load the bundle by setting the cache path
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_LOAD)) ;
+    OK (GxB_set (GxB_JIT_CACHE_PATH, CACHE)) ;
+    for (int trial = 0 ; trial < 2 ; trial++)
+    {
+        for (int k = 0 ; k < NSEMIRINGS ; k++)
+        {
+            OK (GrB_Matrix_new (&C1, GrB_UINT16, n, n)) ;
+            OK (GrB_mxm (C1, NULL, NULL, semirings [k], A, B, NULL)) ;
+            CHECK (GB_mx_isequal (C0 [k], C1, 0)) ;
+            GrB_Matrix_free (&C1) ;
+        }
+        // the bundled kernels remain registered when the JIT is restarted
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_LOAD)) ;
+    }
+
+    // with the JIT control less than GxB_JIT_ON, no bundle is created
+    OK (GxB_JIT_pack ( )) ;
+
+    for (int k = 0 ; k < NSEMIRINGS ; k++)
+    {
+        GrB_Matrix_free (&(C0 [k])) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_CACHE_PATH, save_cache)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, control)) ;
+    mxFree (save_cache) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&B) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test47: all tests passed\n\n") ;
+}
+
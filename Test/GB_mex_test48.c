@@ -0,0 +1,170 @@
+//------------------------------------------------------------------------------
+// GB_mex_test48: test GxB_JIT_register
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*B is computed with a few semirings, and the kernels in the JIT cache are
+// packed into a bundle with GxB_JIT_pack.  The bundle is copied out of the
+// cache, the JIT cache is changed to another folder, and the JIT hash table is
+// cleared.  The copy of the bundle is then registered with GxB_JIT_register,
+// and the results computed with the JIT control set to GxB_JIT_RUN (so no
+// kernels may be loaded or compiled) must match.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_config.h"
+
+#define USAGE "GB_mex_test48"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NSEMIRINGS 3
+#define KERNELS "/tmp/grb_test48_kernels.so"
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL, B = NULL, C0 [NSEMIRINGS], C1 = NULL ;
+    GrB_Index n = 50 ;
+    char *save_cache, *s ;
+    char cache [1024], filename [2048], buf [4096] ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    GrB_Semiring semirings [NSEMIRINGS] = { GrB_PLUS_TIMES_SEMIRING_INT8,
+        GrB_MAX_MIN_SEMIRING_INT8, GrB_MIN_MAX_SEMIRING_INT8 } ;
+
+    GxB_JIT_Control control ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control)) ;
+    OK (GxB_get (GxB_JIT_CACHE_PATH, &s)) ;
+    save_cache = mxMalloc (strlen (s) + 2) ;
+    strcpy (save_cache, s) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_INT8, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_INT8, n, n)) ;
+    for (int e = 0 ; e < 500 ; e++)
+    {
+        OK (GrB_Matrix_setElement_INT32 (A, simple_rand ( ) % 5,
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_INT32 (B, simple_rand ( ) % 5,
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // compile the kernels and pack them into a bundle
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_CACHE_PATH, "/tmp/grb_test48_cache")) ;
+    OK (GxB_get (GxB_JIT_CACHE_PATH, &s)) ;
+    strncpy (cache, s, 1000) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+
+    for (int k = 0 ; k < NSEMIRINGS ; k++)
+    {
+        OK (GrB_Matrix_new (&(C0 [k]), GrB_INT8, n, n)) ;
+        OK (GrB_mxm (C0 [k], NULL, NULL, semirings [k], A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C0 [k], GrB_MATERIALIZE)) ;
+    }
+
+    OK (GxB_JIT_pack ( )) ;
+
+    //--------------------------------------------------------------------------
+    // copy the bundle out of the cache
+    //--------------------------------------------------------------------------
+
+    #ifndef NJIT
+    snprintf (filename, 2000, "%s/lib/%sGB_jit_bundle%s", cache,
+        GB_LIB_PREFIX, GB_LIB_SUFFIX) ;
+    FILE *fin = fopen (filename, "rb") ;
+    CHECK (fin != NULL) ;
+    FILE *fout = fopen (KERNELS, "wb") ;
+    CHECK (fout != NULL) ;
+    size_t nbytes ;
+    while ((nbytes = fread (buf, 1, 4096, fin)) > 0)
+    {
+        CHECK (fwrite (buf, 1, nbytes, fout) == nbytes) ;
+    }
+    fclose (fin) ;
+    fclose (fout) ;
+    #endif
+
+    //--------------------------------------------------------------------------
+    // register the bundle, with loading and compilation disabled
+    //--------------------------------------------------------------------------
+
+    // use another cache, and clear the JIT hash table
+    OK (GxB_set (GxB_JIT_CACHE_PATH, "/tmp/grb_test48_other_cache")) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_RUN)) ;
+
+    #ifndef NJIT
+    OK (GxB_JIT_register (KERNELS)) ;
+    // registering the same bundle again has no effect
+    OK (GxB_JIT_register (KERNELS)) ;
+    #endif
+
+    for (int k = 0 ; k < NSEMIRINGS ; k++)
+    {
+        OK (GrB_Matrix_new (&C1, GrB_INT8, n, n)) ;
+        OK (GrB_mxm (C1, NULL, NULL, semirings [k], A, B, NULL)) ;
+        CHECK (GB_mx_isequal (C0 [k], C1, 0)) ;
+        GrB_Matrix_free (&C1) ;
+        GrB_Matrix_free (&(C0 [k])) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_JIT_register (NULL)) ;
+    #ifndef NJIT
+    expected = GrB_INVALID_VALUE ;
+    #else
+    expected = GrB_NOT_IMPLEMENTED ;
+    #endif
+    ERR (GxB_JIT_register ("/tmp/grb_test48_no_such_library.so")) ;
+    // a library that is not a bundle
+    FILE *fp = fopen ("/tmp/grb_test48_not_a_library.so", "w") ;
+    CHECK (fp != NULL) ;
+    fprintf (fp, "not a library\n") ;
+    fclose (fp) ;
+    ERR (GxB_JIT_register ("/tmp/grb_test48_not_a_library.so")) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_CACHE_PATH, save_cache)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, control)) ;
+    mxFree (save_cache) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&B) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test48: all tests passed\n\n") ;
+}
+
@@ -0,0 +1,214 @@
+//------------------------------------------------------------------------------
+// GB_mex_test49: test the JIT profile
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The JIT profile is enabled, and C=A*B is computed with the JIT off, and
+// then several times with the JIT on.  A and B are int16 and the semiring is
+// fp32, so no factory kernel can be used: a generic kernel is used when the
+// JIT is off, and a JIT kernel when it is on.  The report must then list an
+// AxB kernel with the right number of calls.  Disabling the profile must clear
+// all the counts.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test49"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NCALLS 5
+
+//------------------------------------------------------------------------------
+// get_report: get the JIT profile report and scan it
+//------------------------------------------------------------------------------
+
+// Returns the largest number of calls to any AxB kernel, the total number of
+// calls to all kernels, and the number of generic mxm kernels used.
+
+static GrB_Info get_report
+(
+    int64_t *axb_calls,
+    int64_t *total_calls,
+    int64_t *generic_mxm,
+    bool *on
+)
+{
+    GrB_Info info ;
+    size_t len = 0 ;
+    (*axb_calls) = 0 ;
+    (*total_calls) = 0 ;
+    (*generic_mxm) = 0 ;
+    OK (GrB_Global_get_SIZE (GrB_GLOBAL, &len, GxB_JIT_PROFILE_REPORT)) ;
+    CHECK (len > 0) ;
+    char *report = mxMalloc (len) ;
+    OK (GrB_Global_get_String (GrB_GLOBAL, report, GxB_JIT_PROFILE_REPORT)) ;
+    CHECK (strlen (report) + 1 == len) ;
+    (*on) = (strstr (report, "# JIT profile: on") != NULL) ;
+
+    char *line = strtok (report, "\n") ;
+    while (line != NULL)
+    {
+        long ncalls ;
+        double run_time, load_time ;
+        char name [1024] ;
+        if (line [0] != '#')
+        {
+            // a JIT kernel: calls, run time, load time, and name
+            CHECK (sscanf (line, "%ld %lg %lg %1000s", &ncalls, &run_time,
+                &load_time, name) == 4) ;
+            CHECK (ncalls >= 0 && run_time >= 0 && load_time >= 0) ;
+            (*total_calls) += ncalls ;
+            if (strstr (name, "GB_jit__AxB") == name && ncalls > (*axb_calls))
+            {
+                (*axb_calls) = ncalls ;
+            }
+        }
+        else if (sscanf (line, "# %ld %1000s", &ncalls, name) == 2 &&
+            MATCH (name, "mxm"))
+        {
+            // a generic family
+            (*generic_mxm) = ncalls ;
+        }
+        line = strtok (NULL, "\n") ;
+    }
+    mxFree (report) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL ;
+    GrB_Index n = 50 ;
+    int64_t axb_calls, total_calls, generic_mxm ;
+    int32_t i ;
+    bool on ;
+    const char *s ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    GxB_JIT_Control control ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control)) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_INT16, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_INT16, n, n)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP32, n, n)) ;
+    for (int e = 0 ; e < 500 ; e++)
+    {
+        OK (GrB_Matrix_setElement_INT32 (A, simple_rand ( ) % 5,
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_INT32 (B, simple_rand ( ) % 5,
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // the profile is off by default
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &i, GxB_JIT_PROFILE)) ;
+    CHECK (i == 0) ;
+    OK (get_report (&axb_calls, &total_calls, &generic_mxm, &on)) ;
+    CHECK (!on) ;
+
+    //--------------------------------------------------------------------------
+    // enable the profile and use a generic kernel
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, true, GxB_JIT_PROFILE)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &i, GxB_JIT_PROFILE)) ;
+    CHECK (i == 1) ;
+    OK (get_report (&axb_calls, &total_calls, &generic_mxm, &on)) ;
+    CHECK (on) ;
+    CHECK (total_calls == 0) ;
+    CHECK (generic_mxm == 0) ;
+
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GrB_mxm (C, NULL, NULL, GrB_MAX_MIN_SEMIRING_FP32, A, B, NULL)) ;
+    OK (get_report (&axb_calls, &total_calls, &generic_mxm, &on)) ;
+    CHECK (generic_mxm > 0) ;
+
+    //--------------------------------------------------------------------------
+    // use a JIT kernel
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &i)) ;
+    if (i == GxB_JIT_ON)
+    {
+        for (int k = 0 ; k < NCALLS ; k++)
+        {
+            OK (GrB_mxm (C, NULL, NULL, GrB_MAX_MIN_SEMIRING_FP32, A, B,
+                NULL)) ;
+        }
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (get_report (&axb_calls, &total_calls, &generic_mxm, &on)) ;
+        CHECK (axb_calls >= NCALLS) ;
+    }
+
+    // the report from GxB_get is the same
+    OK (GxB_get (GxB_JIT_PROFILE_REPORT, &s)) ;
+    CHECK (s != NULL && strstr (s, "# JIT profile: on") != NULL) ;
+    OK (GxB_Global_Option_get_CHAR (GxB_JIT_PROFILE_REPORT, &s)) ;
+    CHECK (s != NULL && strstr (s, "# JIT profile: on") != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // disable the profile: all counts are cleared
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_PROFILE, false)) ;
+    OK (GxB_get (GxB_JIT_PROFILE, &on)) ;
+    CHECK (!on) ;
+    OK (get_report (&axb_calls, &total_calls, &generic_mxm, &on)) ;
+    CHECK (!on) ;
+    CHECK (axb_calls == 0) ;
+    CHECK (total_calls == 0) ;
+    CHECK (generic_mxm == 0) ;
+
+    // calls are not counted when the profile is off
+    OK (GrB_mxm (C, NULL, NULL, GrB_MAX_MIN_SEMIRING_FP32, A, B, NULL)) ;
+    OK (get_report (&axb_calls, &total_calls, &generic_mxm, &on)) ;
+    CHECK (total_calls == 0) ;
+
+    // the report cannot be set
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Global_set_String (GrB_GLOBAL, "stuff", GxB_JIT_PROFILE_REPORT)) ;
+    ERR (GxB_Global_Option_set_CHAR (GxB_JIT_PROFILE_REPORT, "stuff")) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_C_CONTROL, control)) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&B) ;
+    GrB_Matrix_free (&C) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test49: all tests passed\n\n") ;
+}
+
@@ -0,0 +1,350 @@
+//------------------------------------------------------------------------------
+// GB_mex_test50: test GxB_JIT_MAX_LOADED and GxB_JIT_CACHE_MAX_SIZE
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*B is computed with a set of semirings, first with no limits on the JIT,
+// and then with at most two JIT kernels loaded at a time, so that kernels are
+// repeatedly evicted and loaded again, by one user thread and then by several
+// at once.  The results must match, and the JIT profile must list no more
+// than two AxB kernels.  With one kernel loaded at a time, kernels are evicted
+// while other user threads are using other kernels, and the JIT must remain
+// enabled.  The size of the JIT cache is then limited to a single
+// byte, which leaves only the kernels still loaded in the cache.  A and B are
+// int16 and the semirings are fp32, so no factory kernel can be used.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_config.h"
+#ifndef NJIT
+#include <dirent.h>
+#endif
+
+#define USAGE "GB_mex_test50"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NSEMIRINGS 6
+#define NOUTER 4
+#define NTRIALS 4
+#define CACHE "/tmp/grb_test50_cache"
+
+//------------------------------------------------------------------------------
+// count_axb_loaded: count the AxB kernels in the JIT profile report
+//------------------------------------------------------------------------------
+
+static GrB_Info count_axb_loaded (int *nkernels)
+{
+    GrB_Info info ;
+    size_t len = 0 ;
+    (*nkernels) = 0 ;
+    OK (GrB_Global_get_SIZE (GrB_GLOBAL, &len, GxB_JIT_PROFILE_REPORT)) ;
+    char *report = mxMalloc (len) ;
+    OK (GrB_Global_get_String (GrB_GLOBAL, report, GxB_JIT_PROFILE_REPORT)) ;
+    char *line = strtok (report, "\n") ;
+    while (line != NULL)
+    {
+        if (line [0] != '#' && strstr (line, "GB_jit__AxB") != NULL)
+        {
+            (*nkernels)++ ;
+        }
+        line = strtok (NULL, "\n") ;
+    }
+    mxFree (report) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// count_axb_cached: count the compiled AxB kernels in the JIT cache
+//------------------------------------------------------------------------------
+
+static int count_axb_cached (void)
+{
+    int nkernels = 0 ;
+    #ifndef NJIT
+    char folder [1024] ;
+    for (int bucket = 0 ; bucket <= 0xFF ; bucket++)
+    {
+        snprintf (folder, 1000, "%s/lib/%02x", CACHE, bucket) ;
+        DIR *dir = opendir (folder) ;
+        if (dir == NULL) continue ;
+        struct dirent *f ;
+        while ((f = readdir (dir)) != NULL)
+        {
+            if (strstr (f->d_name, "GB_jit__AxB") != NULL)
+            {
+                nkernels++ ;
+            }
+        }
+        closedir (dir) ;
+    }
+    #endif
+    return (nkernels) ;
+}
+
+//------------------------------------------------------------------------------
+// mxm_threads: C [t][k] = A*B with each semiring, by NOUTER user threads
+//------------------------------------------------------------------------------
+
+static bool mxm_threads
+(
+    GrB_Matrix C [NOUTER][NSEMIRINGS],
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Semiring semirings [NSEMIRINGS]
+)
+{
+    GrB_Index n ;
+    if (GrB_Matrix_nrows (&n, A) != GrB_SUCCESS) return (false) ;
+    bool ok = true ;
+    #pragma omp parallel for num_threads (NOUTER) schedule (static, 1) \
+        reduction (&&:ok)
+    for (int t = 0 ; t < NOUTER ; t++)
+    {
+        GxB_Context Context = NULL ;
+        ok = ok && (GxB_Context_new (&Context) == GrB_SUCCESS) ;
+        ok = ok && (GxB_Context_set (Context, GxB_NTHREADS, 1)
+            == GrB_SUCCESS) ;
+        ok = ok && (GxB_Context_engage (Context) == GrB_SUCCESS) ;
+        for (int k = 0 ; k < NSEMIRINGS ; k++)
+        {
+            C [t][k] = NULL ;
+            ok = ok && (GrB_Matrix_new (&(C [t][k]), GrB_FP32, n, n)
+                == GrB_SUCCESS) ;
+        }
+        for (int trial = 0 ; trial < NTRIALS ; trial++)
+        {
+            for (int k = 0 ; k < NSEMIRINGS ; k++)
+            {
+                // each thread uses the semirings in a different order
+                int k2 = (k + t) % NSEMIRINGS ;
+                ok = ok && (GrB_mxm (C [t][k2], NULL, NULL, semirings [k2],
+                    A, B, NULL) == GrB_SUCCESS) ;
+                ok = ok && (GrB_Matrix_wait (C [t][k2], GrB_MATERIALIZE)
+                    == GrB_SUCCESS) ;
+            }
+        }
+        ok = ok && (GxB_Context_disengage (Context) == GrB_SUCCESS) ;
+        ok = ok && (GxB_Context_free (&Context) == GrB_SUCCESS) ;
+    }
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL ;
+    GrB_Matrix C0 [NSEMIRINGS] ;
+    GrB_Matrix C [NOUTER][NSEMIRINGS] ;
+    GrB_Scalar s = NULL ;
+    GrB_Index n = 50 ;
+    int32_t i ;
+    int64_t i64 ;
+    int nloaded ;
+    char *save_cache, *path ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    #ifdef _OPENMP
+    omp_set_max_active_levels (2) ;
+    #endif
+
+    GrB_Semiring semirings [NSEMIRINGS] = { GrB_PLUS_TIMES_SEMIRING_FP32,
+        GrB_MIN_PLUS_SEMIRING_FP32, GrB_MAX_TIMES_SEMIRING_FP32,
+        GrB_PLUS_MIN_SEMIRING_FP32, GrB_MAX_MIN_SEMIRING_FP32,
+        GrB_MIN_TIMES_SEMIRING_FP32 } ;
+
+    GxB_JIT_Control control ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control)) ;
+    OK (GxB_get (GxB_JIT_CACHE_PATH, &path)) ;
+    save_cache = mxMalloc (strlen (path) + 2) ;
+    strcpy (save_cache, path) ;
+
+    // use a new cache, and clear the JIT hash table
+    OK (GxB_set (GxB_JIT_CACHE_PATH, CACHE)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, true, GxB_JIT_PROFILE)) ;
+
+    //--------------------------------------------------------------------------
+    // the limits are off by default
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &i, GxB_JIT_MAX_LOADED)) ;
+    CHECK (i == 0) ;
+    OK (GrB_Scalar_new (&s, GrB_INT64)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_JIT_CACHE_MAX_SIZE)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&i64, s)) ;
+    CHECK (i64 == 0) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem and compute the results with no limits
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_INT16, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_INT16, n, n)) ;
+    for (int e = 0 ; e < 500 ; e++)
+    {
+        OK (GrB_Matrix_setElement_INT32 (A, simple_rand ( ) % 9,
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_INT32 (B, simple_rand ( ) % 9,
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    for (int k = 0 ; k < NSEMIRINGS ; k++)
+    {
+        OK (GrB_Matrix_new (&(C0 [k]), GrB_FP32, n, n)) ;
+        OK (GrB_mxm (C0 [k], NULL, NULL, semirings [k], A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C0 [k], GrB_MATERIALIZE)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // load at most two kernels at a time, with a single user thread
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, 2, GxB_JIT_MAX_LOADED)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &i, GxB_JIT_MAX_LOADED)) ;
+    CHECK (i == 2) ;
+    OK (count_axb_loaded (&nloaded)) ;
+    CHECK (nloaded <= 2) ;
+
+    for (int trial = 0 ; trial < NTRIALS ; trial++)
+    {
+        for (int k = 0 ; k < NSEMIRINGS ; k++)
+        {
+            OK (GrB_Matrix_new (&C1, GrB_FP32, n, n)) ;
+            OK (GrB_mxm (C1, NULL, NULL, semirings [k], A, B, NULL)) ;
+            CHECK (GB_mx_isequal (C0 [k], C1, 0)) ;
+            GrB_Matrix_free (&C1) ;
+            OK (count_axb_loaded (&nloaded)) ;
+            CHECK (nloaded <= 2) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // load at most two kernels at a time, with many user threads
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_MAX_LOADED, 1)) ;
+    OK (GxB_get (GxB_JIT_MAX_LOADED, &i)) ;
+    CHECK (i == 1) ;
+    OK (GxB_set (GxB_JIT_MAX_LOADED, 2)) ;
+
+    CHECK (mxm_threads (C, A, B, semirings)) ;
+
+    for (int t = 0 ; t < NOUTER ; t++)
+    {
+        for (int k = 0 ; k < NSEMIRINGS ; k++)
+        {
+            CHECK (GB_mx_isequal (C0 [k], C [t][k], 0)) ;
+            GrB_Matrix_free (&(C [t][k])) ;
+        }
+    }
+    OK (count_axb_loaded (&nloaded)) ;
+    CHECK (nloaded <= 2) ;
+
+    //--------------------------------------------------------------------------
+    // load one kernel at a time, with many user threads
+    //--------------------------------------------------------------------------
+
+    // Kernels are evicted while other user threads are using other kernels,
+    // so some kernels are always in use.  The evicted kernels and retired hash
+    // tables are still freed, and the JIT is not paused.
+
+    OK (GxB_set (GxB_JIT_MAX_LOADED, 1)) ;
+    for (int trial = 0 ; trial < NTRIALS ; trial++)
+    {
+        CHECK (mxm_threads (C, A, B, semirings)) ;
+        for (int t = 0 ; t < NOUTER ; t++)
+        {
+            for (int k = 0 ; k < NSEMIRINGS ; k++)
+            {
+                CHECK (GB_mx_isequal (C0 [k], C [t][k], 0)) ;
+                GrB_Matrix_free (&(C [t][k])) ;
+            }
+        }
+    }
+    OK (count_axb_loaded (&nloaded)) ;
+    CHECK (nloaded <= 1) ;
+    GxB_JIT_Control control2 ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control2)) ;
+    CHECK (control2 == GxB_JIT_ON) ;
+    OK (GxB_set (GxB_JIT_MAX_LOADED, 2)) ;
+
+    //--------------------------------------------------------------------------
+    // limit the size of the JIT cache
+    //--------------------------------------------------------------------------
+
+    // all kernels are in the cache, but only two are loaded
+    #ifndef NJIT
+    CHECK (count_axb_cached ( ) >= NSEMIRINGS) ;
+    #endif
+
+    // only the kernels still loaded remain in the cache
+    OK (GrB_Scalar_setElement_INT64 (s, 1)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_JIT_CACHE_MAX_SIZE)) ;
+    OK (GxB_get (GxB_JIT_CACHE_MAX_SIZE, &i64)) ;
+    CHECK (i64 == 1) ;
+    OK (GxB_Global_Option_get_INT64 (GxB_JIT_CACHE_MAX_SIZE, &i64)) ;
+    CHECK (i64 == 1) ;
+    OK (count_axb_loaded (&nloaded)) ;
+    CHECK (count_axb_cached ( ) <= nloaded) ;
+
+    // deleted kernels are compiled again when needed
+    for (int k = 0 ; k < NSEMIRINGS ; k++)
+    {
+        OK (GrB_Matrix_new (&C1, GrB_FP32, n, n)) ;
+        OK (GrB_mxm (C1, NULL, NULL, semirings [k], A, B, NULL)) ;
+        CHECK (GB_mx_isequal (C0 [k], C1, 0)) ;
+        GrB_Matrix_free (&C1) ;
+        OK (count_axb_loaded (&nloaded)) ;
+        CHECK (count_axb_cached ( ) <= nloaded) ;
+    }
+
+    // no limit
+    OK (GxB_set (GxB_JIT_CACHE_MAX_SIZE, (int64_t) 0)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_JIT_CACHE_MAX_SIZE)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&i64, s)) ;
+    CHECK (i64 == 0) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, 0, GxB_JIT_MAX_LOADED)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, false, GxB_JIT_PROFILE)) ;
+    OK (GxB_set (GxB_JIT_CACHE_PATH, save_cache)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, control)) ;
+    mxFree (save_cache) ;
+    for (int k = 0 ; k < NSEMIRINGS ; k++)
+    {
+        GrB_Matrix_free (&(C0 [k])) ;
+    }
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&B) ;
+    GrB_Scalar_free (&s) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test50: all tests passed\n\n") ;
+}
+
@@ -0,0 +1,446 @@
+//------------------------------------------------------------------------------
+// GB_mex_test51: test the JIT control and C flags of types, ops, and semirings
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_JIT_C_CONTROL and GxB_JIT_C_COMPILER_FLAGS are set and queried for a
+// user-defined type, binary operator, and semiring, and must be rejected for
+// built-in ones.  C=A*B is then computed with a semiring that uses the
+// user-defined mult51 operator, so that no factory kernel can be used.  With
+// the JIT disabled for the semiring or its operator, a generic kernel must be
+// used even though the global JIT control is on.  With an invalid C flag
+// given to the semiring, its kernel cannot be compiled (it never reaches the
+// JIT cache), which disables the compiler.  Finally, a kernel whose operator
+// can only be compiled with the C flags of its semiring is recorded in a
+// manifest, compiled in another cache with GxB_JIT_warmup, and packed into a
+// bundle with GxB_JIT_pack, both of which must use the flags of the kernel.
+// The results must match in all cases.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_config.h"
+
+#define USAGE "GB_mex_test51"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define MANIFEST "/tmp/grb_test51_manifest.txt"
+#define CACHE "/tmp/grb_test51_cache"
+
+void mult51 (double *z, const double *x, const double *y) ;
+void mult51 (double *z, const double *x, const double *y)
+{
+    (*z) = (*x) * (*y) + 1 ;
+}
+
+#define MULT51_DEFN                                                 \
+"void mult51 (double *z, const double *x, const double *y)      \n" \
+"{                                                              \n" \
+"    (*z) = (*x) * (*y) + 1 ;                                   \n" \
+"}"
+
+// mult51b can only be compiled if MULT51_ONE is defined by a C flag
+void mult51b (double *z, const double *x, const double *y) ;
+void mult51b (double *z, const double *x, const double *y)
+{
+    (*z) = (*x) * (*y) + 1 ;
+}
+
+#define MULT51B_DEFN                                                \
+"void mult51b (double *z, const double *x, const double *y)     \n" \
+"{                                                              \n" \
+"    (*z) = (*x) * (*y) + MULT51_ONE ;                          \n" \
+"}"
+
+//------------------------------------------------------------------------------
+// get_counts: get the # of calls to AxB JIT kernels and generic mxm kernels
+//------------------------------------------------------------------------------
+
+static GrB_Info get_counts
+(
+    int64_t *axb_calls,
+    int64_t *generic_mxm
+)
+{
+    GrB_Info info ;
+    size_t len = 0 ;
+    (*axb_calls) = 0 ;
+    (*generic_mxm) = 0 ;
+    OK (GrB_Global_get_SIZE (GrB_GLOBAL, &len, GxB_JIT_PROFILE_REPORT)) ;
+    char *report = mxMalloc (len) ;
+    OK (GrB_Global_get_String (GrB_GLOBAL, report, GxB_JIT_PROFILE_REPORT)) ;
+    char *line = strtok (report, "\n") ;
+    while (line != NULL)
+    {
+        long ncalls ;
+        double run_time, load_time ;
+        char name [1024] ;
+        if (line [0] != '#')
+        {
+            // a JIT kernel: calls, run time, load time, and name
+            CHECK (sscanf (line, "%ld %lg %lg %1000s", &ncalls, &run_time,
+                &load_time, name) == 4) ;
+            if (strstr (name, "GB_jit__AxB") == name)
+            {
+                (*axb_calls) += ncalls ;
+            }
+        }
+        else if (sscanf (line, "# %ld %1000s", &ncalls, name) == 2 &&
+            MATCH (name, "mxm"))
+        {
+            // a generic family
+            (*generic_mxm) = ncalls ;
+        }
+        line = strtok (NULL, "\n") ;
+    }
+    mxFree (report) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL, C0 = NULL, A32 = NULL ;
+    GrB_Type MyType = NULL ;
+    GrB_BinaryOp Mult = NULL, Mult2 = NULL ;
+    GrB_Semiring S = NULL, S2 = NULL ;
+    GrB_Index n = 50 ;
+    int64_t axb1, axb2, generic1, generic2 ;
+    int32_t i ;
+    size_t len ;
+    char flags [256], cache [1024], line [1024], name [1024] ;
+    char filename [2048], libname [2048] ;
+    const char *s ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    GxB_JIT_Control control ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control)) ;
+    int32_t profile ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &profile, GxB_JIT_PROFILE)) ;
+
+    //--------------------------------------------------------------------------
+    // create the type, operator, and semiring
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Type_new (&MyType, sizeof (double))) ;
+    OK (GxB_BinaryOp_new (&Mult, (GxB_binary_function) mult51,
+        GrB_FP64, GrB_FP64, GrB_FP64, "mult51", MULT51_DEFN)) ;
+    OK (GrB_Semiring_new (&S, GrB_PLUS_MONOID_FP64, Mult)) ;
+
+    //--------------------------------------------------------------------------
+    // set and get the JIT control
+    //--------------------------------------------------------------------------
+
+    // the JIT control is not set by default
+    OK (GrB_Type_get_INT32 (MyType, &i, GxB_JIT_C_CONTROL)) ;
+    CHECK (i == GxB_JIT_DEFAULT) ;
+    OK (GrB_BinaryOp_get_INT32 (Mult, &i, GxB_JIT_C_CONTROL)) ;
+    CHECK (i == GxB_JIT_DEFAULT) ;
+    OK (GrB_Semiring_get_INT32 (S, &i, GxB_JIT_C_CONTROL)) ;
+    CHECK (i == GxB_JIT_DEFAULT) ;
+    OK (GrB_Semiring_get_INT32 (GrB_PLUS_TIMES_SEMIRING_FP64, &i,
+        GxB_JIT_C_CONTROL)) ;
+    CHECK (i == GxB_JIT_DEFAULT) ;
+
+    OK (GrB_Type_set_INT32 (MyType, GxB_JIT_RUN, GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Type_get_INT32 (MyType, &i, GxB_JIT_C_CONTROL)) ;
+    CHECK (i == GxB_JIT_RUN) ;
+    OK (GrB_BinaryOp_set_INT32 (Mult, GxB_JIT_LOAD, GxB_JIT_C_CONTROL)) ;
+    OK (GrB_BinaryOp_get_INT32 (Mult, &i, GxB_JIT_C_CONTROL)) ;
+    CHECK (i == GxB_JIT_LOAD) ;
+    OK (GrB_Semiring_set_INT32 (S, 99, GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Semiring_get_INT32 (S, &i, GxB_JIT_C_CONTROL)) ;
+    CHECK (i == GxB_JIT_ASYNC) ;
+
+    OK (GrB_Type_set_INT32 (MyType, GxB_JIT_DEFAULT, GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Type_get_INT32 (MyType, &i, GxB_JIT_C_CONTROL)) ;
+    CHECK (i == GxB_JIT_DEFAULT) ;
+    OK (GrB_BinaryOp_set_INT32 (Mult, -42, GxB_JIT_C_CONTROL)) ;
+    OK (GrB_BinaryOp_get_INT32 (Mult, &i, GxB_JIT_C_CONTROL)) ;
+    CHECK (i == GxB_JIT_DEFAULT) ;
+    OK (GrB_Semiring_set_INT32 (S, GxB_JIT_DEFAULT, GxB_JIT_C_CONTROL)) ;
+    OK (GrB_Semiring_get_INT32 (S, &i, GxB_JIT_C_CONTROL)) ;
+    CHECK (i == GxB_JIT_DEFAULT) ;
+
+    //--------------------------------------------------------------------------
+    // set and get the JIT C flags
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Type_get_SIZE (MyType, &len, GxB_JIT_C_COMPILER_FLAGS)) ;
+    CHECK (len == 1) ;
+    OK (GrB_Type_get_String (MyType, flags, GxB_JIT_C_COMPILER_FLAGS)) ;
+    CHECK (MATCH (flags, "")) ;
+    OK (GrB_BinaryOp_get_SIZE (Mult, &len, GxB_JIT_C_COMPILER_FLAGS)) ;
+    CHECK (len == 1) ;
+    OK (GrB_Semiring_get_SIZE (S, &len, GxB_JIT_C_COMPILER_FLAGS)) ;
+    CHECK (len == 1) ;
+
+    OK (GrB_Type_set_String (MyType, "-O1", GxB_JIT_C_COMPILER_FLAGS)) ;
+    OK (GrB_Type_get_SIZE (MyType, &len, GxB_JIT_C_COMPILER_FLAGS)) ;
+    CHECK (len == 4) ;
+    OK (GrB_Type_get_String (MyType, flags, GxB_JIT_C_COMPILER_FLAGS)) ;
+    CHECK (MATCH (flags, "-O1")) ;
+
+    OK (GrB_BinaryOp_set_String (Mult, "-O2 -DMULT51",
+        GxB_JIT_C_COMPILER_FLAGS)) ;
+    OK (GrB_BinaryOp_get_SIZE (Mult, &len, GxB_JIT_C_COMPILER_FLAGS)) ;
+    CHECK (len == strlen ("-O2 -DMULT51") + 1) ;
+    OK (GrB_BinaryOp_get_String (Mult, flags, GxB_JIT_C_COMPILER_FLAGS)) ;
+    CHECK (MATCH (flags, "-O2 -DMULT51")) ;
+
+    // the flags can be changed at any time
+    OK (GrB_Semiring_set_String (S, "-O1", GxB_JIT_C_COMPILER_FLAGS)) ;
+    OK (GrB_Semiring_set_String (S, "-O3", GxB_JIT_C_COMPILER_FLAGS)) ;
+    OK (GrB_Semiring_get_String (S, flags, GxB_JIT_C_COMPILER_FLAGS)) ;
+    CHECK (MATCH (flags, "-O3")) ;
+
+    // an empty string clears the flags
+    OK (GrB_Type_set_String (MyType, "", GxB_JIT_C_COMPILER_FLAGS)) ;
+    OK (GrB_Type_get_SIZE (MyType, &len, GxB_JIT_C_COMPILER_FLAGS)) ;
+    CHECK (len == 1) ;
+    OK (GrB_BinaryOp_set_String (Mult, "", GxB_JIT_C_COMPILER_FLAGS)) ;
+    OK (GrB_BinaryOp_get_String (Mult, flags, GxB_JIT_C_COMPILER_FLAGS)) ;
+    CHECK (MATCH (flags, "")) ;
+    OK (GrB_Semiring_set_String (S, "", GxB_JIT_C_COMPILER_FLAGS)) ;
+    OK (GrB_Semiring_get_String (S, flags, GxB_JIT_C_COMPILER_FLAGS)) ;
+    CHECK (MATCH (flags, "")) ;
+
+    //--------------------------------------------------------------------------
+    // built-in objects cannot be modified
+    //--------------------------------------------------------------------------
+
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Type_set_INT32 (GrB_FP64, GxB_JIT_OFF, GxB_JIT_C_CONTROL)) ;
+    ERR (GrB_BinaryOp_set_INT32 (GrB_TIMES_FP64, GxB_JIT_OFF,
+        GxB_JIT_C_CONTROL)) ;
+    ERR (GrB_Semiring_set_INT32 (GrB_PLUS_TIMES_SEMIRING_FP64, GxB_JIT_OFF,
+        GxB_JIT_C_CONTROL)) ;
+    ERR (GrB_Type_set_String (GrB_FP64, "-O3", GxB_JIT_C_COMPILER_FLAGS)) ;
+    ERR (GrB_BinaryOp_set_String (GrB_TIMES_FP64, "-O3",
+        GxB_JIT_C_COMPILER_FLAGS)) ;
+    ERR (GrB_Semiring_set_String (GrB_PLUS_TIMES_SEMIRING_FP64, "-O3",
+        GxB_JIT_C_COMPILER_FLAGS)) ;
+
+    // no other INT32 field can be set
+    ERR (GrB_Type_set_INT32 (MyType, 1, GrB_SIZE)) ;
+    ERR (GrB_BinaryOp_set_INT32 (Mult, 1, GrB_NAME)) ;
+    ERR (GrB_Semiring_set_INT32 (S, 1, GrB_NAME)) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem and the result with the JIT off
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C0, GrB_FP64, n, n)) ;
+    for (int e = 0 ; e < 500 ; e++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 5),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (simple_rand ( ) % 5),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GrB_mxm (C0, NULL, NULL, S, A, B, NULL)) ;
+    OK (GrB_Matrix_wait (C0, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // disable the JIT for the semiring or its operator
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, true, GxB_JIT_PROFILE)) ;
+
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        if (k == 0)
+        {
+            OK (GrB_Semiring_set_INT32 (S, GxB_JIT_OFF, GxB_JIT_C_CONTROL)) ;
+        }
+        else if (k == 1)
+        {
+            OK (GrB_Semiring_set_INT32 (S, GxB_JIT_DEFAULT,
+                GxB_JIT_C_CONTROL)) ;
+            OK (GrB_BinaryOp_set_INT32 (Mult, GxB_JIT_PAUSE,
+                GxB_JIT_C_CONTROL)) ;
+        }
+        else
+        {
+            // the control of an object only limits the global control
+            OK (GrB_BinaryOp_set_INT32 (Mult, GxB_JIT_ON, GxB_JIT_C_CONTROL)) ;
+            OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_PAUSE)) ;
+        }
+        OK (get_counts (&axb1, &generic1)) ;
+        OK (GrB_mxm (C, NULL, NULL, S, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (get_counts (&axb2, &generic2)) ;
+        CHECK (generic2 > generic1) ;
+        CHECK (axb2 == axb1) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+    }
+
+    OK (GrB_BinaryOp_set_INT32 (Mult, GxB_JIT_DEFAULT, GxB_JIT_C_CONTROL)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+
+    //--------------------------------------------------------------------------
+    // compile a kernel with the C flags of the semiring
+    //--------------------------------------------------------------------------
+
+    OK (GxB_get (GxB_JIT_C_CONTROL, &i)) ;
+    if (i == GxB_JIT_ON)
+    {
+        // An invalid C flag for the semiring: its kernel cannot be compiled, so
+        // the generic kernel is used, and the compiler is disabled.  Since
+        // the kernel is never compiled, it is never found in the JIT cache.
+        OK (GrB_Semiring_set_String (S, "-O3 -include no_such_file_test51.h",
+            GxB_JIT_C_COMPILER_FLAGS)) ;
+        OK (get_counts (&axb1, &generic1)) ;
+        OK (GrB_mxm (C, NULL, NULL, S, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (get_counts (&axb2, &generic2)) ;
+        CHECK (generic2 > generic1) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+        OK (GxB_get (GxB_JIT_C_CONTROL, &i)) ;
+        CHECK (i == GxB_JIT_LOAD) ;
+
+        // Valid flags, for a kernel with fp32 inputs: its kernel is compiled
+        // (or loaded from the cache) and used.
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+        OK (GrB_Semiring_set_String (S, "-O3", GxB_JIT_C_COMPILER_FLAGS)) ;
+        OK (GrB_Matrix_new (&A32, GrB_FP32, n, n)) ;
+        OK (GrB_Matrix_assign (A32, NULL, NULL, A, GrB_ALL, n, GrB_ALL, n,
+            NULL)) ;
+        OK (get_counts (&axb1, &generic1)) ;
+        OK (GrB_mxm (C, NULL, NULL, S, A32, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (get_counts (&axb2, &generic2)) ;
+        CHECK (axb2 > axb1) ;
+        CHECK (generic2 == generic1) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+        OK (GxB_get (GxB_JIT_C_CONTROL, &i)) ;
+        CHECK (i == GxB_JIT_ON) ;
+
+        //----------------------------------------------------------------------
+        // warmup and pack a kernel that needs the C flags of its semiring
+        //----------------------------------------------------------------------
+
+        OK (GxB_get (GxB_JIT_CACHE_PATH, &s)) ;
+        char *save_cache = mxMalloc (strlen (s) + 2) ;
+        strcpy (save_cache, s) ;
+        OK (GxB_BinaryOp_new (&Mult2, (GxB_binary_function) mult51b,
+            GrB_FP64, GrB_FP64, GrB_FP64, "mult51b", MULT51B_DEFN)) ;
+        OK (GrB_Semiring_new (&S2, GrB_PLUS_MONOID_FP64, Mult2)) ;
+        OK (GrB_Semiring_set_String (S2, "-DMULT51_ONE=1",
+            GxB_JIT_C_COMPILER_FLAGS)) ;
+
+        // record the kernel in a manifest
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+        OK (GxB_set (GxB_JIT_MANIFEST, MANIFEST)) ;
+        OK (GrB_mxm (C, NULL, NULL, S2, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+        OK (GxB_set (GxB_JIT_MANIFEST, "")) ;
+
+        // remove the kernel from another cache
+        OK (GxB_set (GxB_JIT_CACHE_PATH, CACHE)) ;
+        OK (GxB_get (GxB_JIT_CACHE_PATH, &s)) ;
+        strncpy (cache, s, 1000) ;
+        int nkernels = 0 ;
+        FILE *fp = fopen (MANIFEST, "r") ;
+        CHECK (fp != NULL) ;
+        while (fgets (line, 1000, fp) != NULL)
+        {
+            uint64_t hash ;
+            int64_t nbytes ;
+            if (sscanf (line, "GB_jit_manifest %" SCNx64 " %s %" SCNd64,
+                &hash, name, &nbytes) == 3 && strstr (name, "mult51b") != NULL)
+            {
+                snprintf (libname, 2000, "%s/lib/%02x/%s%s%s", cache,
+                    (int) (hash & 0xFF), GB_LIB_PREFIX, name, GB_LIB_SUFFIX) ;
+                remove (libname) ;
+                nkernels++ ;
+            }
+        }
+        fclose (fp) ;
+        CHECK (nkernels == 1) ;
+
+        // compile the kernel with the C flags of its semiring
+        OK (GxB_JIT_warmup (MANIFEST)) ;
+        fp = fopen (libname, "r") ;
+        CHECK (fp != NULL) ;
+        fclose (fp) ;
+        remove (MANIFEST) ;
+
+        // load the kernel, with compilation disabled
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_LOAD)) ;
+        OK (get_counts (&axb1, &generic1)) ;
+        OK (GrB_mxm (C, NULL, NULL, S2, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (get_counts (&axb2, &generic2)) ;
+        CHECK (axb2 > axb1) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+
+        // pack the kernel, with the C flags of its semiring
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+        OK (GxB_JIT_pack ( )) ;
+        snprintf (filename, 2000, "%s/lib/GB_jit_bundle.txt", cache) ;
+        fp = fopen (filename, "r") ;
+        CHECK (fp != NULL) ;
+        nkernels = 0 ;
+        while (fgets (line, 1000, fp) != NULL)
+        {
+            if (strstr (line, "mult51b") != NULL) nkernels++ ;
+        }
+        fclose (fp) ;
+        CHECK (nkernels == 1) ;
+
+        OK (GxB_set (GxB_JIT_CACHE_PATH, save_cache)) ;
+        mxFree (save_cache) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, profile, GxB_JIT_PROFILE)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, control)) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&A32) ;
+    GrB_Matrix_free (&B) ;
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&C0) ;
+    GrB_Semiring_free (&S) ;
+    GrB_Semiring_free (&S2) ;
+    GrB_BinaryOp_free (&Mult) ;
+    GrB_BinaryOp_free (&Mult2) ;
+    GrB_Type_free (&MyType) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test51: all tests passed\n\n") ;
+}
+
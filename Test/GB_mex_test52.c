@@ -0,0 +1,251 @@
+//------------------------------------------------------------------------------
+// GB_mex_test52: test JIT kernels specialized for a fixed dimension
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*X and C+=A*X are computed with all matrices held by row, A sparse, and
+// X full with a few columns, as in a feature propagation.  A is int16 and the
+// semiring is fp32, so no factory kernel can be used.  With
+// GxB_JIT_SPECIALIZE_DIM large enough, the JIT kernels must be compiled for
+// the exact # of columns of X (their names include the dimension).  Each
+// result is compared with the same result computed with the JIT off.  The
+// entries are small integers, so the results are exact.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test52"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NWIDTHS 4
+
+//------------------------------------------------------------------------------
+// get_calls: get the # of calls to JIT kernels whose name starts with prefix
+//------------------------------------------------------------------------------
+
+static GrB_Info get_calls
+(
+    int64_t *calls,
+    const char *prefix
+)
+{
+    GrB_Info info ;
+    size_t len = 0 ;
+    (*calls) = 0 ;
+    OK (GrB_Global_get_SIZE (GrB_GLOBAL, &len, GxB_JIT_PROFILE_REPORT)) ;
+    char *report = mxMalloc (len) ;
+    OK (GrB_Global_get_String (GrB_GLOBAL, report, GxB_JIT_PROFILE_REPORT)) ;
+    char *line = strtok (report, "\n") ;
+    while (line != NULL)
+    {
+        long ncalls ;
+        double run_time, load_time ;
+        char name [1024] ;
+        if (line [0] != '#')
+        {
+            // a JIT kernel: calls, run time, load time, and name
+            CHECK (sscanf (line, "%ld %lg %lg %1000s", &ncalls, &run_time,
+                &load_time, name) == 4) ;
+            if (strstr (name, prefix) == name)
+            {
+                (*calls) += ncalls ;
+            }
+        }
+        line = strtok (NULL, "\n") ;
+    }
+    mxFree (report) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL, X = NULL, C = NULL, C0 = NULL ;
+    GrB_Index n = 200 ;
+    GrB_Index widths [NWIDTHS] = { 4, 16, 64, 100 } ;
+    int64_t calls1, calls2 ;
+    int32_t i ;
+    char prefix [256] ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    GxB_JIT_Control control ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control)) ;
+    int32_t profile ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &profile, GxB_JIT_PROFILE)) ;
+
+    //--------------------------------------------------------------------------
+    // set and get GxB_JIT_SPECIALIZE_DIM
+    //--------------------------------------------------------------------------
+
+    // no kernel is specialized by default
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &i, GxB_JIT_SPECIALIZE_DIM)) ;
+    CHECK (i == 0) ;
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, 16, GxB_JIT_SPECIALIZE_DIM)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &i, GxB_JIT_SPECIALIZE_DIM)) ;
+    CHECK (i == 16) ;
+    OK (GxB_set (GxB_JIT_SPECIALIZE_DIM, 1000)) ;
+    OK (GxB_get (GxB_JIT_SPECIALIZE_DIM, &i)) ;
+    CHECK (i == 256) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_SPECIALIZE_DIM, -4)) ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_SPECIALIZE_DIM, &i)) ;
+    CHECK (i == 0) ;
+
+    //--------------------------------------------------------------------------
+    // create A, with every row nonempty so that C is full
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_INT16, n, n)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_ROW)) ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        OK (GrB_Matrix_setElement_INT32 (A, 1 + simple_rand ( ) % 4, k,
+            simple_rand ( ) % n)) ;
+    }
+    for (int e = 0 ; e < 10 * n ; e++)
+    {
+        OK (GrB_Matrix_setElement_INT32 (A, simple_rand ( ) % 5,
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, true, GxB_JIT_PROFILE)) ;
+
+    for (int kw = 0 ; kw < NWIDTHS ; kw++)
+    {
+
+        //----------------------------------------------------------------------
+        // create X, a full matrix with w columns
+        //----------------------------------------------------------------------
+
+        GrB_Index w = widths [kw] ;
+        OK (GrB_Matrix_new (&X, GrB_FP32, n, w)) ;
+        OK (GxB_Matrix_Option_set (X, GxB_FORMAT, GxB_BY_ROW)) ;
+        OK (GrB_Matrix_assign_FP32 (X, NULL, NULL, 0, GrB_ALL, n, GrB_ALL, w,
+            NULL)) ;
+        for (int64_t k = 0 ; k < n ; k++)
+        {
+            for (int64_t j = 0 ; j < w ; j++)
+            {
+                OK (GrB_Matrix_setElement_FP32 (X,
+                    (float) (simple_rand ( ) % 5), k, j)) ;
+            }
+        }
+        OK (GrB_Matrix_wait (X, GrB_MATERIALIZE)) ;
+        int sparsity ;
+        OK (GxB_Matrix_Option_get (X, GxB_SPARSITY_STATUS, &sparsity)) ;
+        CHECK (sparsity == GxB_FULL) ;
+
+        OK (GrB_Matrix_new (&C0, GrB_FP32, n, w)) ;
+        OK (GxB_Matrix_Option_set (C0, GxB_FORMAT, GxB_BY_ROW)) ;
+        OK (GrB_Matrix_new (&C, GrB_FP32, n, w)) ;
+        OK (GxB_Matrix_Option_set (C, GxB_FORMAT, GxB_BY_ROW)) ;
+
+        for (int accum = 0 ; accum <= 1 ; accum++)
+        {
+            GrB_BinaryOp op = accum ? GrB_PLUS_FP32 : NULL ;
+
+            //------------------------------------------------------------------
+            // C0 = A*X or C0 += A*X with the JIT off
+            //------------------------------------------------------------------
+
+            OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+            OK (GrB_mxm (C0, NULL, op, GrB_PLUS_TIMES_SEMIRING_FP32, A, X,
+                NULL)) ;
+            OK (GrB_Matrix_wait (C0, GrB_MATERIALIZE)) ;
+
+            //------------------------------------------------------------------
+            // C = A*X or C += A*X with a kernel specialized for w columns
+            //------------------------------------------------------------------
+
+            OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+            OK (GxB_get (GxB_JIT_C_CONTROL, &i)) ;
+            if (i != GxB_JIT_ON) continue ;
+
+            OK (GrB_Global_set_INT32 (GrB_GLOBAL, 64, GxB_JIT_SPECIALIZE_DIM)) ;
+            snprintf (prefix, 256, "GB_jit__AxB_%s_d%d__",
+                accum ? "saxpy5" : "dot2n", (int) w) ;
+            OK (get_calls (&calls1, prefix)) ;
+            OK (GrB_mxm (C, NULL, op, GrB_PLUS_TIMES_SEMIRING_FP32, A, X,
+                NULL)) ;
+            OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+            OK (get_calls (&calls2, prefix)) ;
+            // a kernel is specialized only if X has no more than 64 columns
+            CHECK ((calls2 > calls1) == (w <= 64)) ;
+            CHECK (GB_mx_isequal (C, C0, 0)) ;
+
+            // the kernel is found in the JIT cache once it is unloaded
+            OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+            OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+            OK (get_calls (&calls1, prefix)) ;
+            OK (GrB_mxm (C, NULL, op, GrB_PLUS_TIMES_SEMIRING_FP32, A, X,
+                NULL)) ;
+            OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+            OK (get_calls (&calls2, prefix)) ;
+            CHECK ((calls2 > calls1) == (w <= 64)) ;
+
+            // undo the 2nd C += A*X, and check the result again
+            if (accum)
+            {
+                OK (GrB_mxm (C, NULL, GrB_MINUS_FP32,
+                    GrB_PLUS_TIMES_SEMIRING_FP32, A, X, NULL)) ;
+            }
+            CHECK (GB_mx_isequal (C, C0, 0)) ;
+
+            //------------------------------------------------------------------
+            // C = A*X or C += A*X with a kernel for any dimension
+            //------------------------------------------------------------------
+
+            OK (GrB_Global_set_INT32 (GrB_GLOBAL, 0, GxB_JIT_SPECIALIZE_DIM)) ;
+            OK (get_calls (&calls1, prefix)) ;
+            if (accum)
+            {
+                OK (GrB_mxm (C, NULL, GrB_MINUS_FP32,
+                    GrB_PLUS_TIMES_SEMIRING_FP32, A, X, NULL)) ;
+            }
+            OK (GrB_mxm (C, NULL, op, GrB_PLUS_TIMES_SEMIRING_FP32, A, X,
+                NULL)) ;
+            OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+            OK (get_calls (&calls2, prefix)) ;
+            CHECK (calls2 == calls1) ;
+            CHECK (GB_mx_isequal (C, C0, 0)) ;
+        }
+
+        GrB_Matrix_free (&X) ;
+        GrB_Matrix_free (&C) ;
+        GrB_Matrix_free (&C0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, 0, GxB_JIT_SPECIALIZE_DIM)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, profile, GxB_JIT_PROFILE)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, control)) ;
+    GrB_Matrix_free (&A) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test52: all tests passed\n\n") ;
+}
+
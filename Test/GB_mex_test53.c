@@ -0,0 +1,403 @@
+//------------------------------------------------------------------------------
+// GB_mex_test53: test user-defined operators given as object files
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A user-defined binary operator is created with a name but no definition, so
+// kernels that use it cannot be JIT'd.  Its function is then compiled into an
+// object file with the JIT C compiler and flags, and -flto, and given to the
+// operator with GxB_JIT_C_OBJECT, so that C=A*B with a semiring that uses the
+// operator is computed with a JIT kernel linked with the object file.  Each
+// result is compared with the same result computed with the JIT off.  The
+// kernel is then recorded in a manifest and compiled in another cache with
+// GxB_JIT_warmup, which must link it with the object file.  GxB_JIT_pack must
+// leave the kernel out of the bundle, but pack the kernels of an operator
+// given by its definition.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_config.h"
+#include <sys/stat.h>
+#include <utime.h>
+
+#define USAGE "GB_mex_test53"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define SOURCE "/tmp/grb_test53_op.c"
+#define OBJECT "/tmp/grb_test53_op.o"
+#define MANIFEST "/tmp/grb_test53_manifest.txt"
+#define CACHE "/tmp/grb_test53_cache"
+
+#define OP_DEFN                                                             \
+"void grb_test53_op (void *z, const void *x, const void *y)             \n" \
+"{                                                                      \n" \
+"    double a = (*((const double *) x)), b = (*((const double *) y)) ;  \n" \
+"    (*((double *) z)) = 2 * a - b ;                                    \n" \
+"}                                                                      \n"
+
+static void grb_test53_op (void *z, const void *x, const void *y)
+{
+    double a = (*((const double *) x)), b = (*((const double *) y)) ;
+    (*((double *) z)) = 2 * a - b ;
+}
+
+#define DEF_DEFN                                                            \
+"void grb_test53_def (void *z, const void *x, const void *y)            \n" \
+"{                                                                      \n" \
+"    double a = (*((const double *) x)), b = (*((const double *) y)) ;  \n" \
+"    (*((double *) z)) = 2 * a - b ;                                    \n" \
+"}                                                                      \n"
+
+static void grb_test53_def (void *z, const void *x, const void *y)
+{
+    double a = (*((const double *) x)), b = (*((const double *) y)) ;
+    (*((double *) z)) = 2 * a - b ;
+}
+
+//------------------------------------------------------------------------------
+// get_calls: get the # of calls to JIT kernels that use the operator
+//------------------------------------------------------------------------------
+
+static GrB_Info get_calls
+(
+    int64_t *calls
+)
+{
+    GrB_Info info ;
+    size_t len = 0 ;
+    (*calls) = 0 ;
+    OK (GrB_Global_get_SIZE (GrB_GLOBAL, &len, GxB_JIT_PROFILE_REPORT)) ;
+    char *report = mxMalloc (len) ;
+    OK (GrB_Global_get_String (GrB_GLOBAL, report, GxB_JIT_PROFILE_REPORT)) ;
+    char *line = strtok (report, "\n") ;
+    while (line != NULL)
+    {
+        long ncalls ;
+        double run_time, load_time ;
+        char name [1024] ;
+        if (line [0] != '#')
+        {
+            // a JIT kernel: calls, run time, load time, and name
+            CHECK (sscanf (line, "%ld %lg %lg %1000s", &ncalls, &run_time,
+                &load_time, name) == 4) ;
+            if (strstr (name, "grb_test53_op") != NULL)
+            {
+                (*calls) += ncalls ;
+            }
+        }
+        line = strtok (NULL, "\n") ;
+    }
+    mxFree (report) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL, C0 = NULL ;
+    GrB_BinaryOp op = NULL, def = NULL ;
+    GrB_Semiring semiring1 = NULL, semiring2 = NULL, semiring3 = NULL ;
+    GrB_Index n = 50 ;
+    int64_t calls1, calls2 ;
+    int32_t i ;
+    size_t len ;
+    char s [2048], cache [1024], line [1024], name [1024], filename [2048] ;
+    char *save_cache ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    GxB_JIT_Control control ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control)) ;
+    int32_t profile ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &profile, GxB_JIT_PROFILE)) ;
+    const char *c ;
+    OK (GxB_get (GxB_JIT_CACHE_PATH, &c)) ;
+    save_cache = mxMalloc (strlen (c) + 2) ;
+    strcpy (save_cache, c) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C0, GrB_FP64, n, n)) ;
+    for (int e = 0 ; e < 500 ; e++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 9),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (simple_rand ( ) % 9),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // create an operator with a name but no definition
+    //--------------------------------------------------------------------------
+
+    OK (GxB_BinaryOp_new (&op, grb_test53_op, GrB_FP64, GrB_FP64, GrB_FP64,
+        "grb_test53_op", NULL)) ;
+    OK (GrB_BinaryOp_get_SIZE (op, &len, GxB_JIT_C_OBJECT)) ;
+    CHECK (len == 1) ;
+    OK (GrB_BinaryOp_get_String (op, s, GxB_JIT_C_OBJECT)) ;
+    CHECK (MATCH (s, "")) ;
+    OK (GrB_Semiring_new (&semiring1, GrB_PLUS_MONOID_FP64, op)) ;
+
+    // built-in operators cannot be given an object file
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_BinaryOp_set_String (GrB_PLUS_FP64, OBJECT, GxB_JIT_C_OBJECT)) ;
+
+    // C0 = A*B with the JIT off
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GrB_mxm (C0, NULL, NULL, semiring1, A, B, NULL)) ;
+    OK (GrB_Matrix_wait (C0, GrB_MATERIALIZE)) ;
+
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &i)) ;
+    if (i == GxB_JIT_ON)
+    {
+
+        //----------------------------------------------------------------------
+        // without a definition, the kernel cannot be JIT'd
+        //----------------------------------------------------------------------
+
+        OK (GrB_Global_set_INT32 (GrB_GLOBAL, true, GxB_JIT_PROFILE)) ;
+        OK (GrB_mxm (C, NULL, NULL, semiring1, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (get_calls (&calls1)) ;
+        CHECK (calls1 == 0) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+
+        //----------------------------------------------------------------------
+        // compile the operator into an object file
+        //----------------------------------------------------------------------
+
+        FILE *fp = fopen (SOURCE, "w") ;
+        CHECK (fp != NULL) ;
+        fprintf (fp, "%s", OP_DEFN) ;
+        fclose (fp) ;
+        remove (OBJECT) ;
+        const char *compiler, *flags ;
+        OK (GxB_get (GxB_JIT_C_COMPILER_NAME, &compiler)) ;
+        OK (GxB_get (GxB_JIT_C_COMPILER_FLAGS, &flags)) ;
+        snprintf (s, 2048, "%s %s -flto -c '%s' -o '%s'", compiler, flags,
+            SOURCE, OBJECT) ;
+        CHECK (system (s) == 0) ;
+
+        //----------------------------------------------------------------------
+        // give the object file to the operator
+        //----------------------------------------------------------------------
+
+        OK (GrB_BinaryOp_set_String (op, OBJECT, GxB_JIT_C_OBJECT)) ;
+        OK (GrB_BinaryOp_get_SIZE (op, &len, GxB_JIT_C_OBJECT)) ;
+        CHECK (len == strlen (OBJECT) + 1) ;
+        OK (GrB_BinaryOp_get_String (op, s, GxB_JIT_C_OBJECT)) ;
+        CHECK (MATCH (s, OBJECT)) ;
+        OK (GrB_Semiring_new (&semiring2, GrB_PLUS_MONOID_FP64, op)) ;
+
+        // C = A*B with a JIT kernel linked with the object file
+        OK (GrB_mxm (C, NULL, NULL, semiring2, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (get_calls (&calls2)) ;
+        CHECK (calls2 > calls1) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+
+        // the kernel is found in the JIT cache once it is unloaded
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+        OK (GrB_mxm (C, NULL, NULL, semiring2, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (get_calls (&calls1)) ;
+        CHECK (calls1 > 0) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+
+        // the first semiring still cannot be JIT'd
+        OK (get_calls (&calls1)) ;
+        OK (GrB_mxm (C, NULL, NULL, semiring1, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (get_calls (&calls2)) ;
+        CHECK (calls2 == calls1) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+
+        //----------------------------------------------------------------------
+        // compile the kernel in another cache from a manifest
+        //----------------------------------------------------------------------
+
+        // record the kernel in a manifest, loading it from the cache
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+        OK (GxB_set (GxB_JIT_MANIFEST, MANIFEST)) ;
+        OK (GrB_mxm (C, NULL, NULL, semiring2, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (GxB_set (GxB_JIT_MANIFEST, "")) ;
+
+        // remove the kernels of the manifest from the other cache
+        OK (GxB_set (GxB_JIT_CACHE_PATH, CACHE)) ;
+        OK (GxB_get (GxB_JIT_CACHE_PATH, &c)) ;
+        strncpy (cache, c, 1000) ;
+        int nkernels = 0 ;
+        FILE *fm = fopen (MANIFEST, "r") ;
+        CHECK (fm != NULL) ;
+        while (fgets (line, 1000, fm) != NULL)
+        {
+            uint64_t hash ;
+            int64_t nbytes ;
+            if (sscanf (line, "GB_jit_manifest %" SCNx64 " %s %" SCNd64,
+                &hash, name, &nbytes) != 3)
+            {
+                continue ;
+            }
+            snprintf (s, 2000, "%s/lib/%02x/%s%s%s", cache,
+                (int) (hash & 0xFF), GB_LIB_PREFIX, name, GB_LIB_SUFFIX) ;
+            remove (s) ;
+            if (strstr (name, "grb_test53_op") != NULL)
+            {
+                // the kernel that links the object file
+                strcpy (filename, s) ;
+                nkernels++ ;
+            }
+        }
+        fclose (fm) ;
+        CHECK (nkernels == 1) ;
+
+        // compile the kernel, linking it with the object file
+        OK (GxB_JIT_warmup (MANIFEST)) ;
+        fm = fopen (filename, "r") ;
+        CHECK (fm != NULL) ;
+        fclose (fm) ;
+
+        // load the kernel, with compilation disabled
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_LOAD)) ;
+        OK (get_calls (&calls1)) ;
+        OK (GrB_mxm (C, NULL, NULL, semiring2, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (get_calls (&calls2)) ;
+        CHECK (calls2 > calls1) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+
+        //----------------------------------------------------------------------
+        // pack the cache into a bundle
+        //----------------------------------------------------------------------
+
+        // compile a kernel for an operator given by its definition
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+        OK (GxB_BinaryOp_new (&def, grb_test53_def, GrB_FP64, GrB_FP64,
+            GrB_FP64, "grb_test53_def", DEF_DEFN)) ;
+        OK (GrB_Semiring_new (&semiring3, GrB_PLUS_MONOID_FP64, def)) ;
+        OK (GrB_mxm (C, NULL, NULL, semiring3, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+
+        // only the kernel of the definition is packed
+        OK (GxB_JIT_pack ( )) ;
+        snprintf (filename, 2000, "%s/lib/GB_jit_bundle.txt", cache) ;
+        fm = fopen (filename, "r") ;
+        CHECK (fm != NULL) ;
+        nkernels = 0 ;
+        while (fgets (line, 1000, fm) != NULL)
+        {
+            CHECK (strstr (line, "grb_test53_op") == NULL) ;
+            if (strstr (line, "grb_test53_def") != NULL) nkernels++ ;
+        }
+        fclose (fm) ;
+        CHECK (nkernels == 1) ;
+        snprintf (filename, 2000, "%s/lib/%sGB_jit_bundle%s", cache,
+            GB_LIB_PREFIX, GB_LIB_SUFFIX) ;
+        fm = fopen (filename, "r") ;
+        CHECK (fm != NULL) ;
+        fclose (fm) ;
+        remove (MANIFEST) ;
+
+        // load the bundle by setting the cache path; the kernel that links
+        // the object file is loaded from its own library
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_LOAD)) ;
+        OK (GxB_set (GxB_JIT_CACHE_PATH, CACHE)) ;
+        OK (GrB_mxm (C, NULL, NULL, semiring3, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+        OK (get_calls (&calls1)) ;
+        OK (GrB_mxm (C, NULL, NULL, semiring2, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (get_calls (&calls2)) ;
+        CHECK (calls2 > calls1) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+
+        //----------------------------------------------------------------------
+        // check the object file path and the operator hash
+        //----------------------------------------------------------------------
+
+        // quotes and other shell characters are removed from the path
+        OK (GrB_BinaryOp_set_String (op, "/tmp/grb_test53'$(x).o",
+            GxB_JIT_C_OBJECT)) ;
+        OK (GrB_BinaryOp_get_String (op, s, GxB_JIT_C_OBJECT)) ;
+        CHECK (MATCH (s, "/tmp/grb_test53___x_.o")) ;
+
+        // the path and modification time of the object file are in the hash
+        OK (GrB_BinaryOp_set_String (op, OBJECT, GxB_JIT_C_OBJECT)) ;
+        uint64_t hash1 = op->hash ;
+        OK (GrB_BinaryOp_set_String (op, OBJECT, GxB_JIT_C_OBJECT)) ;
+        CHECK (op->hash == hash1) ;
+        struct stat st ;
+        CHECK (stat (OBJECT, &st) == 0) ;
+        struct utimbuf times ;
+        times.actime = st.st_atime ;
+        times.modtime = st.st_mtime + 10 ;
+        CHECK (utime (OBJECT, &times) == 0) ;
+        OK (GrB_BinaryOp_set_String (op, OBJECT, GxB_JIT_C_OBJECT)) ;
+        CHECK (op->hash != hash1) ;
+        CHECK (op->hash != UINT64_MAX) ;
+
+        // remove the object file from the operator
+        OK (GrB_BinaryOp_set_String (op, "", GxB_JIT_C_OBJECT)) ;
+        OK (GrB_BinaryOp_get_SIZE (op, &len, GxB_JIT_C_OBJECT)) ;
+        CHECK (len == 1) ;
+        remove (SOURCE) ;
+        remove (OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, profile, GxB_JIT_PROFILE)) ;
+    OK (GxB_set (GxB_JIT_CACHE_PATH, save_cache)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, control)) ;
+    mxFree (save_cache) ;
+    GrB_Semiring_free (&semiring1) ;
+    GrB_Semiring_free (&semiring2) ;
+    GrB_Semiring_free (&semiring3) ;
+    GrB_BinaryOp_free (&op) ;
+    GrB_BinaryOp_free (&def) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&B) ;
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&C0) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test53: all tests passed\n\n") ;
+}
+
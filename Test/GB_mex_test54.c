@@ -0,0 +1,280 @@
+//------------------------------------------------------------------------------
+// GB_mex_test54: test JIT kernels compiled in-process with libtcc
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_JIT_USE_LIBTCC is false by default, and it can be set to true only if
+// GraphBLAS was compiled with libtcc.  C=A*B is computed with a user-defined
+// operator, so that no factory kernel can be used.  If libtcc is available,
+// its JIT kernel is first compiled into an empty cache with the C compiler
+// replaced by one that always fails, so the kernel can only have been
+// compiled by libtcc.  The result is compared with the same result computed
+// with the JIT off.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_config.h"
+#ifndef NJIT
+#include <dirent.h>
+#endif
+
+#define USAGE "GB_mex_test54"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define CACHE "/tmp/grb_test54_cache"
+
+void mult54 (double *z, const double *x, const double *y) ;
+void mult54 (double *z, const double *x, const double *y)
+{
+    (*z) = 3 * (*x) - (*y) ;
+}
+
+#define MULT54_DEFN                                                 \
+"void mult54 (double *z, const double *x, const double *y)      \n" \
+"{                                                              \n" \
+"    (*z) = 3 * (*x) - (*y) ;                                   \n" \
+"}"
+
+//------------------------------------------------------------------------------
+// get_calls: get the # of calls to JIT kernels that use the mult54 operator
+//------------------------------------------------------------------------------
+
+static GrB_Info get_calls
+(
+    int64_t *calls
+)
+{
+    GrB_Info info ;
+    size_t len = 0 ;
+    (*calls) = 0 ;
+    OK (GrB_Global_get_SIZE (GrB_GLOBAL, &len, GxB_JIT_PROFILE_REPORT)) ;
+    char *report = mxMalloc (len) ;
+    OK (GrB_Global_get_String (GrB_GLOBAL, report, GxB_JIT_PROFILE_REPORT)) ;
+    char *line = strtok (report, "\n") ;
+    while (line != NULL)
+    {
+        long ncalls ;
+        double run_time, load_time ;
+        char name [1024] ;
+        if (line [0] != '#')
+        {
+            // a JIT kernel: calls, run time, load time, and name
+            CHECK (sscanf (line, "%ld %lg %lg %1000s", &ncalls, &run_time,
+                &load_time, name) == 4) ;
+            if (strstr (name, "mult54") != NULL)
+            {
+                (*calls) += ncalls ;
+            }
+        }
+        line = strtok (NULL, "\n") ;
+    }
+    mxFree (report) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// clear_mult54_cached: remove the kernels that use mult54 from the JIT cache
+//------------------------------------------------------------------------------
+
+static void clear_mult54_cached (void)
+{
+    #ifndef NJIT
+    char folder [1024], filename [2048] ;
+    for (int bucket = 0 ; bucket <= 0xFF ; bucket++)
+    {
+        snprintf (folder, 1000, "%s/lib/%02x", CACHE, bucket) ;
+        DIR *dir = opendir (folder) ;
+        if (dir == NULL) continue ;
+        struct dirent *f ;
+        while ((f = readdir (dir)) != NULL)
+        {
+            if (strstr (f->d_name, "mult54") != NULL)
+            {
+                snprintf (filename, 2000, "%s/%s", folder, f->d_name) ;
+                remove (filename) ;
+            }
+        }
+        closedir (dir) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL, C0 = NULL ;
+    GrB_BinaryOp Mult = NULL ;
+    GrB_Semiring S = NULL ;
+    GrB_Index n = 50 ;
+    int64_t calls1, calls2 ;
+    int32_t i ;
+    bool use_libtcc ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    GxB_JIT_Control control ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control)) ;
+    int32_t profile ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &profile, GxB_JIT_PROFILE)) ;
+
+    //--------------------------------------------------------------------------
+    // set and get GxB_JIT_USE_LIBTCC
+    //--------------------------------------------------------------------------
+
+    // libtcc is off by default
+    int32_t have_libtcc ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &i, GxB_JIT_USE_LIBTCC)) ;
+    CHECK (i == false) ;
+    have_libtcc = (GxB_set (GxB_JIT_USE_LIBTCC, true) == GrB_SUCCESS) ;
+    printf ("jit libtcc: %d\n", have_libtcc) ;
+
+    // libtcc can always be turned off
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, false, GxB_JIT_USE_LIBTCC)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &i, GxB_JIT_USE_LIBTCC)) ;
+    CHECK (i == false) ;
+    OK (GxB_get (GxB_JIT_USE_LIBTCC, &use_libtcc)) ;
+    CHECK (use_libtcc == false) ;
+
+    if (have_libtcc)
+    {
+        OK (GxB_set (GxB_JIT_USE_LIBTCC, true)) ;
+        OK (GxB_Global_Option_get_INT32 (GxB_JIT_USE_LIBTCC, &i)) ;
+        CHECK (i == true) ;
+    }
+    else
+    {
+        // libtcc cannot be used if GraphBLAS was not compiled with it
+        expected = GrB_NOT_IMPLEMENTED ;
+        ERR (GrB_Global_set_INT32 (GrB_GLOBAL, true, GxB_JIT_USE_LIBTCC)) ;
+        ERR (GxB_set (GxB_JIT_USE_LIBTCC, true)) ;
+        ERR (GxB_Global_Option_set_INT32 (GxB_JIT_USE_LIBTCC, true)) ;
+        OK (GxB_get (GxB_JIT_USE_LIBTCC, &use_libtcc)) ;
+        CHECK (use_libtcc == false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // create the problem and the result with the JIT off
+    //--------------------------------------------------------------------------
+
+    OK (GxB_BinaryOp_new (&Mult, (GxB_binary_function) mult54,
+        GrB_FP64, GrB_FP64, GrB_FP64, "mult54", MULT54_DEFN)) ;
+    OK (GrB_Semiring_new (&S, GrB_PLUS_MONOID_FP64, Mult)) ;
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C0, GrB_FP64, n, n)) ;
+    for (int e = 0 ; e < 500 ; e++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 9),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (simple_rand ( ) % 9),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GrB_mxm (C0, NULL, NULL, S, A, B, NULL)) ;
+    OK (GrB_Matrix_wait (C0, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // C = A*B with a kernel that can only be compiled by libtcc
+    //--------------------------------------------------------------------------
+
+    if (have_libtcc)
+    {
+        char *s, *save_cache, *save_compiler ;
+        OK (GxB_get (GxB_JIT_CACHE_PATH, &s)) ;
+        save_cache = mxMalloc (strlen (s) + 2) ;
+        strcpy (save_cache, s) ;
+        OK (GxB_get (GxB_JIT_C_COMPILER_NAME, &s)) ;
+        save_compiler = mxMalloc (strlen (s) + 2) ;
+        strcpy (save_compiler, s) ;
+
+        OK (GxB_set (GxB_JIT_CACHE_PATH, CACHE)) ;
+        clear_mult54_cached ( ) ;
+        OK (GxB_set (GxB_JIT_C_COMPILER_NAME, "false")) ;
+        OK (GxB_set (GxB_JIT_USE_LIBTCC, true)) ;
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+        OK (GrB_Global_set_INT32 (GrB_GLOBAL, true, GxB_JIT_PROFILE)) ;
+
+        OK (get_calls (&calls1)) ;
+        CHECK (calls1 == 0) ;
+        OK (GrB_mxm (C, NULL, NULL, S, A, B, NULL)) ;
+        OK (get_calls (&calls2)) ;
+        CHECK (calls2 > 0) ;
+        OK (GxB_get (GxB_JIT_C_CONTROL, &i)) ;
+        CHECK (i == GxB_JIT_ON) ;
+
+        OK (GxB_set (GxB_JIT_C_COMPILER_NAME, save_compiler)) ;
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+        OK (GxB_set (GxB_JIT_CACHE_PATH, save_cache)) ;
+        mxFree (save_cache) ;
+        mxFree (save_compiler) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C = A*B with a kernel compiled by libtcc, or the C compiler otherwise
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &i)) ;
+    if (i == GxB_JIT_ON)
+    {
+        OK (GrB_Global_set_INT32 (GrB_GLOBAL, true, GxB_JIT_PROFILE)) ;
+        OK (get_calls (&calls1)) ;
+        OK (GrB_mxm (C, NULL, NULL, S, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (get_calls (&calls2)) ;
+        CHECK (calls2 > calls1) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+
+        // the kernel is found in the JIT cache once it is unloaded
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+        OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+        OK (GrB_mxm (C, NULL, NULL, S, A, B, NULL)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (get_calls (&calls1)) ;
+        CHECK (calls1 > 0) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, false, GxB_JIT_USE_LIBTCC)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, profile, GxB_JIT_PROFILE)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, control)) ;
+    GrB_Semiring_free (&S) ;
+    GrB_BinaryOp_free (&Mult) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&B) ;
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&C0) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test54: all tests passed\n\n") ;
+}
+
@@ -0,0 +1,187 @@
+//------------------------------------------------------------------------------
+// GB_mex_test55: test the memory pool
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_MEMORY_POOL_MAX_SIZE is set and queried, and then C=A*B, D=A+B, and a
+// GrB_wait on a matrix with pending tuples are computed many times with the
+// memory pool enabled, as in an iterative method.  The freed blocks must be
+// placed in the pool and reused, the pool must never exceed its max size,
+// and each result must match the same result computed with the pool disabled.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test55"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NITER 4
+
+//------------------------------------------------------------------------------
+// compute: C=A*B, D=A+B, and E = a matrix built with setElement and GrB_wait
+//------------------------------------------------------------------------------
+
+static GrB_Info compute
+(
+    GrB_Matrix C,
+    GrB_Matrix D,
+    GrB_Matrix E,
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Index n
+)
+{
+    GrB_Info info ;
+    OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, NULL)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (D, NULL, NULL, GrB_PLUS_FP64, A, B,
+        NULL)) ;
+    OK (GrB_Matrix_wait (D, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_clear (E)) ;
+    for (int64_t k = 0 ; k < 4 * n ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (E, (double) k, (k * 7) % n,
+            (k * 13) % n)) ;
+    }
+    OK (GrB_Matrix_wait (E, GrB_MATERIALIZE)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL, D = NULL, E = NULL,
+        C0 = NULL, D0 = NULL, E0 = NULL ;
+    GrB_Scalar s = NULL ;
+    GrB_Index n = 200 ;
+    int64_t i64, pool_size ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    //--------------------------------------------------------------------------
+    // set and get GxB_MEMORY_POOL_MAX_SIZE
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Scalar_new (&s, GrB_INT64)) ;
+
+    // the pool is disabled by default
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_MAX_SIZE)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&i64, s)) ;
+    CHECK (i64 == 0) ;
+    OK (GxB_get (GxB_MEMORY_POOL_SIZE, &i64)) ;
+    CHECK (i64 == 0) ;
+
+    OK (GrB_Scalar_setElement_INT64 (s, 1000000)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_MAX_SIZE)) ;
+    OK (GxB_get (GxB_MEMORY_POOL_MAX_SIZE, &i64)) ;
+    CHECK (i64 == 1000000) ;
+    OK (GxB_set (GxB_MEMORY_POOL_MAX_SIZE, (int64_t) -1)) ;
+    OK (GxB_Global_Option_get_INT64 (GxB_MEMORY_POOL_MAX_SIZE, &i64)) ;
+    CHECK (i64 == 0) ;
+
+    // the size of the pool cannot be set
+    OK (GrB_Scalar_setElement_INT64 (s, 1000)) ;
+    info = GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_SIZE) ;
+    CHECK (info == GrB_INVALID_VALUE) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem and the results with the pool disabled
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+    for (int e = 0 ; e < 10 * n ; e++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 9),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (simple_rand ( ) % 9),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    OK (GrB_Matrix_new (&C0, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&D0, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&E0, GrB_FP64, n, n)) ;
+    OK (compute (C0, D0, E0, A, B, n)) ;
+    OK (GxB_get (GxB_MEMORY_POOL_SIZE, &pool_size)) ;
+    CHECK (pool_size == 0) ;
+
+    //--------------------------------------------------------------------------
+    // compute the results many times with the pool enabled
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_MEMORY_POOL_MAX_SIZE, (int64_t) 4000000)) ;
+    for (int iter = 0 ; iter < NITER ; iter++)
+    {
+        OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_new (&D, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_new (&E, GrB_FP64, n, n)) ;
+        OK (compute (C, D, E, A, B, n)) ;
+        CHECK (GB_mx_isequal (C, C0, 0)) ;
+        CHECK (GB_mx_isequal (D, D0, 0)) ;
+        CHECK (GB_mx_isequal (E, E0, 0)) ;
+        GrB_Matrix_free (&C) ;
+        GrB_Matrix_free (&D) ;
+        GrB_Matrix_free (&E) ;
+        // the freed blocks are now in the pool
+        OK (GxB_get (GxB_MEMORY_POOL_SIZE, &pool_size)) ;
+        printf ("iter %d: pool size %ld\n", iter, (long) pool_size) ;
+        CHECK (pool_size > 0 && pool_size <= 4000000) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // shrink and then disable the pool
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_MEMORY_POOL_MAX_SIZE, (int64_t) 1000)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_SIZE)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&pool_size, s)) ;
+    CHECK (pool_size <= 1000) ;
+
+    OK (GxB_set (GxB_MEMORY_POOL_MAX_SIZE, (int64_t) 0)) ;
+    OK (GxB_Global_Option_get_INT64 (GxB_MEMORY_POOL_SIZE, &pool_size)) ;
+    CHECK (pool_size == 0) ;
+
+    // with the pool disabled, nothing is placed in it
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+    OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, NULL)) ;
+    CHECK (GB_mx_isequal (C, C0, 0)) ;
+    GrB_Matrix_free (&C) ;
+    OK (GxB_get (GxB_MEMORY_POOL_SIZE, &pool_size)) ;
+    CHECK (pool_size == 0) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GrB_Scalar_free (&s) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&B) ;
+    GrB_Matrix_free (&C0) ;
+    GrB_Matrix_free (&D0) ;
+    GrB_Matrix_free (&E0) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test55: all tests passed\n\n") ;
+}
+
@@ -0,0 +1,182 @@
+//------------------------------------------------------------------------------
+// GB_mex_test56: test the Werk arena of a Context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_CONTEXT_WERK_MAX_SIZE is set and queried, and then a matrix is split
+// into many tiles and concatenated back together, many times.  GB_split and
+// GB_concat each push a werkspace of size O(# of tiles), which is too large
+// for the Werk stack.  With the Werk arena enabled, the arena must grow to
+// hold it, and the results must match the same result computed without it.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test56"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NTILES 3000
+#define NITER 4
+
+//------------------------------------------------------------------------------
+// split_and_concat: split A into NTILES-by-1 tiles, and concatenate into C
+//------------------------------------------------------------------------------
+
+static GrB_Info split_and_concat
+(
+    GrB_Matrix C,
+    GrB_Matrix A,
+    GrB_Matrix *Tiles,
+    GrB_Index *Tile_nrows,
+    GrB_Index *Tile_ncols
+)
+{
+    GrB_Info info ;
+    OK (GxB_Matrix_split (Tiles, NTILES, 1, Tile_nrows, Tile_ncols, A, NULL)) ;
+    OK (GxB_Matrix_concat (C, Tiles, NTILES, 1, NULL)) ;
+    for (int k = 0 ; k < NTILES ; k++)
+    {
+        GrB_Matrix_free (&(Tiles [k])) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, C = NULL, *Tiles = NULL ;
+    GrB_Scalar s = NULL ;
+    GxB_Context Context = NULL ;
+    GrB_Index *Tile_nrows = NULL, Tile_ncols [1] = { 2 } ;
+    int64_t i64, werk_size ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    //--------------------------------------------------------------------------
+    // set and get GxB_CONTEXT_WERK_MAX_SIZE
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Scalar_new (&s, GrB_INT64)) ;
+    OK (GxB_Context_new (&Context)) ;
+
+    // the arena is disabled by default
+    OK (GxB_Context_get_Scalar (Context, s, GxB_CONTEXT_WERK_MAX_SIZE)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&i64, s)) ;
+    CHECK (i64 == 0) ;
+    OK (GxB_Context_get (Context, GxB_CONTEXT_WERK_SIZE, &werk_size)) ;
+    CHECK (werk_size == 0) ;
+
+    OK (GrB_Scalar_setElement_INT64 (s, 1000000)) ;
+    OK (GxB_Context_set_Scalar (Context, s, GxB_CONTEXT_WERK_MAX_SIZE)) ;
+    OK (GxB_Context_get (Context, GxB_CONTEXT_WERK_MAX_SIZE, &i64)) ;
+    CHECK (i64 == 1000000) ;
+    OK (GxB_Context_set_INT (Context, -1, GxB_CONTEXT_WERK_MAX_SIZE)) ;
+    OK (GxB_Context_get (Context, GxB_CONTEXT_WERK_MAX_SIZE, &i64)) ;
+    CHECK (i64 == 0) ;
+
+    // GxB_CONTEXT_WORLD has no arena
+    info = GxB_Context_set (GxB_CONTEXT_WORLD, GxB_CONTEXT_WERK_MAX_SIZE,
+        (int64_t) 1000000) ;
+    CHECK (info == GrB_INVALID_VALUE) ;
+    OK (GxB_Context_get (GxB_CONTEXT_WORLD, GxB_CONTEXT_WERK_MAX_SIZE, &i64)) ;
+    CHECK (i64 == 0) ;
+
+    // the size of the arena cannot be set
+    info = GxB_Context_set_Scalar (Context, s, GxB_CONTEXT_WERK_SIZE) ;
+    CHECK (info == GrB_INVALID_VALUE) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = NTILES ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, 2)) ;
+    for (int e = 0 ; e < n ; e++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 9),
+            simple_rand ( ) % n, simple_rand ( ) % 2)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    Tiles = mxMalloc (NTILES * sizeof (GrB_Matrix)) ;
+    Tile_nrows = mxMalloc (NTILES * sizeof (GrB_Index)) ;
+    for (int k = 0 ; k < NTILES ; k++)
+    {
+        Tiles [k] = NULL ;
+        Tile_nrows [k] = 1 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // split and concatenate A many times, with the arena enabled
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Context_set (Context, GxB_CONTEXT_WERK_MAX_SIZE,
+        (int64_t) 1000000)) ;
+    OK (GxB_Context_engage (Context)) ;
+    for (int iter = 0 ; iter < NITER ; iter++)
+    {
+        OK (GrB_Matrix_new (&C, GrB_FP64, n, 2)) ;
+        OK (split_and_concat (C, A, Tiles, Tile_nrows, Tile_ncols)) ;
+        CHECK (GB_mx_isequal (C, A, 0)) ;
+        GrB_Matrix_free (&C) ;
+        // the arena has grown to hold the werkspace of GB_split and GB_concat
+        OK (GxB_Context_get (Context, GxB_CONTEXT_WERK_SIZE, &werk_size)) ;
+        printf ("iter %d: werk size %ld\n", iter, (long) werk_size) ;
+        CHECK (werk_size >= (NTILES+1) * sizeof (int64_t)) ;
+    }
+    OK (GxB_Context_disengage (Context)) ;
+    OK (GxB_Context_fprint (Context, "Context", GxB_COMPLETE, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // shrink the arena
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Scalar_setElement_INT64 (s, 1000)) ;
+    OK (GxB_Context_set_Scalar (Context, s, GxB_CONTEXT_WERK_MAX_SIZE)) ;
+    OK (GxB_Context_get_Scalar (Context, s, GxB_CONTEXT_WERK_SIZE)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&werk_size, s)) ;
+    CHECK (werk_size == 0) ;
+
+    // the werkspace can never fit in the arena, so it is allocated by malloc
+    // and the arena is not reallocated
+    OK (GxB_Context_engage (Context)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, 2)) ;
+    OK (split_and_concat (C, A, Tiles, Tile_nrows, Tile_ncols)) ;
+    CHECK (GB_mx_isequal (C, A, 0)) ;
+    GrB_Matrix_free (&C) ;
+    OK (GxB_Context_disengage (Context)) ;
+    OK (GxB_Context_get (Context, GxB_CONTEXT_WERK_SIZE, &werk_size)) ;
+    CHECK (werk_size == 0) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    mxFree (Tiles) ;
+    mxFree (Tile_nrows) ;
+    GrB_Scalar_free (&s) ;
+    GrB_Matrix_free (&A) ;
+    GxB_Context_free (&Context) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test56: all tests passed\n\n") ;
+}
+
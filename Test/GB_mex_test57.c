@@ -0,0 +1,176 @@
+//------------------------------------------------------------------------------
+// GB_mex_test57: test huge pages and parallel first-touch
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_HUGE_PAGES is set and queried, and then C=A+B and C=A*B are computed
+// with large matrices, with all of their large arrays placed on huge pages and
+// touched in parallel.  The arrays of an existing matrix are then moved with
+// GrB_set (A, true, GxB_HUGE_PAGES).  All results must match the same results
+// computed with huge pages disabled.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test57"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// compute: C=A+B and D=A*B
+//------------------------------------------------------------------------------
+
+static GrB_Info compute
+(
+    GrB_Matrix C,
+    GrB_Matrix D,
+    GrB_Matrix A,
+    GrB_Matrix B
+)
+{
+    GrB_Info info ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (C, NULL, NULL, GrB_PLUS_FP64, A, B,
+        NULL)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    OK (GrB_mxm (D, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, NULL)) ;
+    OK (GrB_Matrix_wait (D, GrB_MATERIALIZE)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL, D = NULL, C0 = NULL, D0 = NULL,
+        A0 = NULL ;
+    GrB_Vector v = NULL, v0 = NULL ;
+    GrB_Scalar s = NULL ;
+    GrB_Index n = 1000 ;
+    int64_t i64 ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    //--------------------------------------------------------------------------
+    // set and get GxB_HUGE_PAGES
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Scalar_new (&s, GrB_INT64)) ;
+
+    // huge pages are disabled by default
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_HUGE_PAGES)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&i64, s)) ;
+    CHECK (i64 == 0) ;
+
+    OK (GrB_Scalar_setElement_INT64 (s, 1000000)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_HUGE_PAGES)) ;
+    OK (GxB_get (GxB_HUGE_PAGES, &i64)) ;
+    CHECK (i64 == 1000000) ;
+    OK (GxB_set (GxB_HUGE_PAGES, (int64_t) -1)) ;
+    OK (GxB_Global_Option_get_INT64 (GxB_HUGE_PAGES, &i64)) ;
+    CHECK (i64 == 0) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem and the results with huge pages disabled
+    //--------------------------------------------------------------------------
+
+    // A and B have 500K entries each, so A->i and A->x are 4MB each
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+    for (int e = 0 ; e < 500 * n ; e++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 9),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (simple_rand ( ) % 9),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    OK (GrB_Matrix_new (&C0, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&D0, GrB_FP64, n, n)) ;
+    OK (compute (C0, D0, A, B)) ;
+
+    //--------------------------------------------------------------------------
+    // compute the results with huge pages enabled
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_HUGE_PAGES, (int64_t) 1000000)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&D, GrB_FP64, n, n)) ;
+    OK (compute (C, D, A, B)) ;
+    CHECK (GB_mx_isequal (C, C0, 0)) ;
+    CHECK (GB_mx_isequal (D, D0, 0)) ;
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&D) ;
+
+    // a large bitmap vector, with a 4MB bitmap
+    OK (GrB_Vector_new (&v, GrB_FP64, 4 * n * n)) ;
+    OK (GrB_Vector_setElement_FP64 (v, 3, 7)) ;
+    OK (GrB_Vector_set_INT32 (v, GxB_BITMAP, GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Vector_wait (v, GrB_MATERIALIZE)) ;
+    OK (GrB_Vector_dup (&v0, v)) ;
+    GrB_Vector_free (&v) ;
+    OK (GxB_set (GxB_HUGE_PAGES, (int64_t) 0)) ;
+    OK (GrB_Vector_new (&v, GrB_FP64, 4 * n * n)) ;
+    OK (GrB_Vector_setElement_FP64 (v, 3, 7)) ;
+    OK (GrB_Vector_set_INT32 (v, GxB_BITMAP, GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Vector_wait (v, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal ((GrB_Matrix) v, (GrB_Matrix) v0, 0)) ;
+
+    //--------------------------------------------------------------------------
+    // move the arrays of existing matrices to huge pages
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_dup (&A0, A)) ;
+    OK (GrB_Matrix_set_INT32 (A, true, GxB_HUGE_PAGES)) ;
+    CHECK (GB_mx_isequal (A, A0, 0)) ;
+    OK (GrB_Vector_set_INT32 (v, true, GxB_HUGE_PAGES)) ;
+    CHECK (GB_mx_isequal ((GrB_Matrix) v, (GrB_Matrix) v0, 0)) ;
+
+    // the setting is not kept in the matrix
+    info = GrB_Matrix_get_INT32 (A, (int32_t *) &i64, GxB_HUGE_PAGES) ;
+    CHECK (info == GrB_INVALID_VALUE) ;
+
+    // the moved matrix gives the same results
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&D, GrB_FP64, n, n)) ;
+    OK (compute (C, D, A, B)) ;
+    CHECK (GB_mx_isequal (C, C0, 0)) ;
+    CHECK (GB_mx_isequal (D, D0, 0)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GrB_Scalar_free (&s) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&A0) ;
+    GrB_Matrix_free (&B) ;
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&D) ;
+    GrB_Matrix_free (&C0) ;
+    GrB_Matrix_free (&D0) ;
+    GrB_Vector_free (&v) ;
+    GrB_Vector_free (&v0) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test57: all tests passed\n\n") ;
+}
+
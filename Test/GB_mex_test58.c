@@ -0,0 +1,283 @@
+//------------------------------------------------------------------------------
+// GB_mex_test58: test concurrent setElement
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Many user threads call GrB_Matrix_setElement on the same matrix at the same
+// time, with GxB_PENDING_SHARDS set for the matrix.  Each thread sets entries
+// in its own set of rows, so that the result is the same as when the same
+// tuples are set by a single thread.  Tuples are set more than once by the
+// same thread, so the last one must win.  Matrices that start as bitmap,
+// iso, or with prior pending tuples of another operator are also tested.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test58"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NTHREADS 8
+#define NTUPLES 200000
+
+static GrB_Index Ilist [NTUPLES], Jlist [NTUPLES] ;
+static double Xlist [NTUPLES] ;
+
+//------------------------------------------------------------------------------
+// set_tuples: set all the tuples in A, with one or many user threads
+//------------------------------------------------------------------------------
+
+// Thread t sets the tuples e = t, t+NTHREADS, t+2*NTHREADS, ... in order.
+// All of its tuples have Ilist [e] % NTHREADS == t.
+
+static bool set_tuples (GrB_Matrix A, int nthreads)
+{
+    bool ok = true ;
+    #pragma omp parallel for num_threads (nthreads) schedule (static, 1) \
+        reduction (&&:ok)
+    for (int t = 0 ; t < NTHREADS ; t++)
+    {
+        for (int64_t e = t ; e < NTUPLES ; e += NTHREADS)
+        {
+            ok = ok && (GrB_Matrix_setElement_FP64 (A, Xlist [e], Ilist [e],
+                Jlist [e]) == GrB_SUCCESS) ;
+        }
+    }
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, C = NULL, C0 = NULL ;
+    GrB_Vector v = NULL, v0 = NULL ;
+    GrB_Index n = 2000, nvals ;
+    int32_t nshards ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    #ifdef _OPENMP
+    omp_set_max_active_levels (2) ;
+    #endif
+
+    //--------------------------------------------------------------------------
+    // create the tuples
+    //--------------------------------------------------------------------------
+
+    for (int64_t e = 0 ; e < NTUPLES ; e++)
+    {
+        int64_t t = e % NTHREADS ;
+        // only a few rows for each thread, so many tuples are duplicates
+        Ilist [e] = (simple_rand ( ) % (n / (4*NTHREADS))) * NTHREADS + t ;
+        Jlist [e] = simple_rand ( ) % n ;
+        Xlist [e] = (double) (simple_rand ( ) % 1000) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get and set GxB_PENDING_SHARDS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_get_INT32 (A, &nshards, GxB_PENDING_SHARDS)) ;
+    CHECK (nshards == 0) ;
+    OK (GrB_Matrix_set_INT32 (A, NTHREADS, GxB_PENDING_SHARDS)) ;
+    OK (GrB_Matrix_get_INT32 (A, &nshards, GxB_PENDING_SHARDS)) ;
+    CHECK (nshards == NTHREADS) ;
+    info = GrB_Matrix_set_INT32 (A, -1, GxB_PENDING_SHARDS) ;
+    CHECK (info == GrB_INVALID_VALUE) ;
+
+    // invalid indices
+    info = GrB_Matrix_setElement_FP64 (A, 1, n, 0) ;
+    CHECK (info == GrB_INVALID_INDEX) ;
+    info = GrB_Matrix_setElement_FP64 (A, 1, 0, n) ;
+    CHECK (info == GrB_INVALID_INDEX) ;
+
+    //--------------------------------------------------------------------------
+    // the result with a single user thread
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&C0, GrB_FP64, n, n)) ;
+    CHECK (set_tuples (C0, 1)) ;
+    OK (GrB_Matrix_wait (C0, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // concurrent setElement into an empty matrix
+    //--------------------------------------------------------------------------
+
+    CHECK (set_tuples (A, NTHREADS)) ;
+    OK (GxB_Matrix_fprint (A, "A with shards", GxB_SHORT, NULL)) ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    CHECK (A->Shards == NULL && !A->shards_anchored) ;
+    CHECK (nvals == GB_nnz (C0)) ;
+    CHECK (GB_mx_isequal (A, C0, 0)) ;
+
+    // again, with all tuples already present in A
+    CHECK (set_tuples (A, NTHREADS)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, C0, 0)) ;
+    GrB_Matrix_free (&A) ;
+
+    // fewer shards than threads
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_set_INT32 (A, 3, GxB_PENDING_SHARDS)) ;
+    CHECK (set_tuples (A, NTHREADS)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, C0, 0)) ;
+    GrB_Matrix_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // concurrent setElement into a bitmap matrix
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_set_INT32 (A, GxB_BITMAP, GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (A, NTHREADS, GxB_PENDING_SHARDS)) ;
+    CHECK (set_tuples (A, NTHREADS)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, C0, 0)) ;
+    CHECK (set_tuples (A, NTHREADS)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, C0, 0)) ;
+    GrB_Matrix_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // concurrent setElement into an iso matrix
+    //--------------------------------------------------------------------------
+
+    // C = iso matrix with all entries equal to 1, then the tuples
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, 1, k, (k * 7) % n)) ;
+        OK (GrB_Matrix_setElement_FP64 (C, 1, k, (k * 7) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    CHECK (A->iso) ;
+    CHECK (set_tuples (C, 1)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+
+    OK (GrB_Matrix_set_INT32 (A, NTHREADS, GxB_PENDING_SHARDS)) ;
+    CHECK (set_tuples (A, NTHREADS)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, C, 0)) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // prior pending tuples with the PLUS operator, and a later assignment
+    //--------------------------------------------------------------------------
+
+    // C(0,0) += 5, then the tuples, then C(1,1) += 3
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_set_INT32 (A, NTHREADS, GxB_PENDING_SHARDS)) ;
+
+    GrB_Index I0 [1] = { 0 }, I1 [1] = { 1 } ;
+    OK (GrB_Matrix_assign_FP64 (C, NULL, GrB_PLUS_FP64, 5, I0, 1, I0, 1,
+        NULL)) ;
+    CHECK (set_tuples (C, 1)) ;
+    OK (GrB_Matrix_assign_FP64 (C, NULL, GrB_PLUS_FP64, 3, I1, 1, I1, 1,
+        NULL)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+
+    OK (GrB_Matrix_assign_FP64 (A, NULL, GrB_PLUS_FP64, 5, I0, 1, I0, 1,
+        NULL)) ;
+    CHECK (set_tuples (A, NTHREADS)) ;
+    OK (GrB_Matrix_assign_FP64 (A, NULL, GrB_PLUS_FP64, 3, I1, 1, I1, 1,
+        NULL)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, C, 0)) ;
+
+    // turning the shards off finishes the matrix
+    CHECK (set_tuples (A, NTHREADS)) ;
+    OK (GrB_Matrix_set_INT32 (A, 0, GxB_PENDING_SHARDS)) ;
+    CHECK (A->Pending == NULL && A->Shards == NULL) ;
+    CHECK (set_tuples (C, 1)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, C, 0)) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // tuples that overwrite entries already in A, and removeElement
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_dup (&A, C0)) ;
+    OK (GrB_Matrix_dup (&C, C0)) ;
+    OK (GrB_Matrix_set_INT32 (A, NTHREADS, GxB_PENDING_SHARDS)) ;
+    for (int64_t e = 0 ; e < NTUPLES ; e += 7)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, -Xlist [e], Ilist [e], Jlist [e])) ;
+        OK (GrB_Matrix_setElement_FP64 (C, -Xlist [e], Ilist [e], Jlist [e])) ;
+    }
+    for (int64_t e = 0 ; e < NTUPLES ; e += 101)
+    {
+        OK (GrB_Matrix_removeElement (A, Ilist [e], Jlist [e])) ;
+        OK (GrB_Matrix_removeElement (C, Ilist [e], Jlist [e])) ;
+        OK (GrB_Matrix_setElement_FP64 (A, 1, Ilist [e+1], Jlist [e+1])) ;
+        OK (GrB_Matrix_setElement_FP64 (C, 1, Ilist [e+1], Jlist [e+1])) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, C, 0)) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // concurrent setElement into a vector
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&v, GrB_INT32, n)) ;
+    OK (GrB_Vector_new (&v0, GrB_INT32, n)) ;
+    OK (GrB_Vector_set_INT32 (v, NTHREADS, GxB_PENDING_SHARDS)) ;
+    bool ok = true ;
+    #pragma omp parallel for num_threads (NTHREADS) schedule (static, 1) \
+        reduction (&&:ok)
+    for (int t = 0 ; t < NTHREADS ; t++)
+    {
+        for (int64_t e = t ; e < NTUPLES ; e += NTHREADS)
+        {
+            ok = ok && (GrB_Vector_setElement_INT32 (v, (int32_t) Xlist [e],
+                Ilist [e]) == GrB_SUCCESS) ;
+        }
+    }
+    CHECK (ok) ;
+    for (int64_t e = 0 ; e < NTUPLES ; e++)
+    {
+        OK (GrB_Vector_setElement_INT32 (v0, (int32_t) Xlist [e], Ilist [e])) ;
+    }
+    OK (GrB_Vector_wait (v, GrB_MATERIALIZE)) ;
+    OK (GrB_Vector_wait (v0, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal ((GrB_Matrix) v, (GrB_Matrix) v0, 0)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix_free (&C0) ;
+    GrB_Vector_free (&v) ;
+    GrB_Vector_free (&v0) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test58: all tests passed\n\n") ;
+}
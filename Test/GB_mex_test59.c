@@ -0,0 +1,277 @@
+//------------------------------------------------------------------------------
+// GB_mex_test59: test GrB_wait with GxB_BACKGROUND
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix with pending tuples and zombies is finished in the background, and
+// then used by methods that only read it, that modify it, that overwrite it,
+// or that free it, while the background thread may still be running.  Each
+// result is compared with a matrix C that is given the same entries, but
+// finished with GrB_MATERIALIZE.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test59"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// set_entries: add zombies and then pending tuples to A and C
+//------------------------------------------------------------------------------
+
+static bool set_entries (GrB_Matrix A, GrB_Matrix C, int64_t n, int64_t nz)
+{
+    for (int64_t k = 0 ; k < nz ; k++)
+    {
+        GrB_Index i = simple_rand ( ) % n ;
+        GrB_Index j = simple_rand ( ) % n ;
+        double x = (double) (simple_rand ( ) % 1000) ;
+        if (GrB_Matrix_setElement_FP64 (A, x, i, j) != GrB_SUCCESS ||
+            GrB_Matrix_setElement_FP64 (C, x, i, j) != GrB_SUCCESS)
+        {
+            return (false) ;
+        }
+        if (k == nz / 2)
+        {
+            // remove some entries, which finishes A and C, and makes zombies
+            for (int64_t t = 0 ; t < nz / 10 ; t++)
+            {
+                i = simple_rand ( ) % n ;
+                j = simple_rand ( ) % n ;
+                if (GrB_Matrix_removeElement (A, i, j) != GrB_SUCCESS ||
+                    GrB_Matrix_removeElement (C, i, j) != GrB_SUCCESS)
+                {
+                    return (false) ;
+                }
+            }
+        }
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, C = NULL, B = NULL ;
+    GrB_Vector v = NULL, v0 = NULL ;
+    GrB_Index n = 1000, nvals ;
+    double x ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    //--------------------------------------------------------------------------
+    // background wait of a matrix with nothing to do
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+    CHECK (A->Background == NULL) ;
+    OK (GrB_Matrix_free (&A)) ;
+
+    //--------------------------------------------------------------------------
+    // sparse and hypersparse matrices
+    //--------------------------------------------------------------------------
+
+    for (int sparsity = GxB_HYPERSPARSE ; sparsity <= GxB_SPARSE ; sparsity++)
+    {
+        OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_set_INT32 (A, sparsity, GxB_SPARSITY_CONTROL)) ;
+        OK (GrB_Matrix_set_INT32 (C, sparsity, GxB_SPARSITY_CONTROL)) ;
+
+        // GrB_Matrix_nvals and GrB_wait install the result
+        CHECK (set_entries (A, C, n, 20000)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_nvals (&nvals, A)) ;
+        CHECK (A->Background == NULL) ;
+        CHECK (!GB_ANY_PENDING_WORK (A)) ;
+        CHECK (nvals == GB_nnz (C)) ;
+        CHECK (GB_mx_isequal (A, C, 0)) ;
+
+        // methods that only read A do not wait for the background thread
+        CHECK (set_entries (A, C, n, 20000)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GxB_Matrix_fprint (A, "A in the background", GxB_SILENT, NULL)) ;
+        OK (GrB_Matrix_wait (A, GrB_COMPLETE)) ;
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        CHECK (A->Background == NULL) ;
+        CHECK (GB_mx_isequal (A, C, 0)) ;
+
+        // setElement, removeElement, and assign modify A
+        CHECK (set_entries (A, C, n, 20000)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GrB_Matrix_setElement_FP64 (A, 42, 3, 4)) ;
+        OK (GrB_Matrix_setElement_FP64 (C, 42, 3, 4)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GrB_Matrix_removeElement (A, 3, 4)) ;
+        OK (GrB_Matrix_removeElement (C, 3, 4)) ;
+        CHECK (set_entries (A, C, n, 20000)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        GrB_Index I1 [1] = { 7 } ;
+        OK (GrB_Matrix_assign_FP64 (A, NULL, GrB_PLUS_FP64, 1, GrB_ALL, n,
+            I1, 1, NULL)) ;
+        OK (GrB_Matrix_assign_FP64 (C, NULL, GrB_PLUS_FP64, 1, GrB_ALL, n,
+            I1, 1, NULL)) ;
+        OK (GrB_Matrix_extractElement_FP64 (&x, A, 3, 7)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (A, C, 0)) ;
+
+        // A is used as an input and overwritten as an output
+        CHECK (set_entries (A, C, n, 20000)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_apply (B, NULL, NULL, GrB_AINV_FP64, A, NULL)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GrB_Matrix_apply (A, NULL, NULL, GrB_AINV_FP64, A, NULL)) ;
+        OK (GrB_Matrix_apply (C, NULL, NULL, GrB_AINV_FP64, C, NULL)) ;
+        CHECK (GB_mx_isequal (A, C, 0)) ;
+        CHECK (set_entries (B, C, n, 20000)) ;
+        OK (GrB_Matrix_wait (B, GxB_BACKGROUND)) ;
+        OK (GrB_Matrix_apply (B, NULL, NULL, GrB_IDENTITY_FP64, C, NULL)) ;
+        CHECK (B->Background == NULL) ;
+        CHECK (GB_mx_isequal (B, C, 0)) ;
+
+        // resize, reshape, GrB_set, and unpack modify A in-place
+        OK (GrB_Matrix_free (&C)) ;
+        OK (GrB_Matrix_dup (&C, A)) ;
+        CHECK (set_entries (A, C, n, 20000)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GrB_Matrix_resize (A, n+10, n+20)) ;
+        OK (GrB_Matrix_resize (C, n+10, n+20)) ;
+        CHECK (A->Background == NULL) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (A, C, 0)) ;
+        CHECK (set_entries (A, C, n, 20000)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GrB_Matrix_resize (A, n, n)) ;
+        OK (GrB_Matrix_resize (C, n, n)) ;
+        CHECK (A->Background == NULL) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (A, C, 0)) ;
+
+        CHECK (set_entries (A, C, n, 20000)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GxB_Matrix_reshape (A, true, n/2, 2*n, NULL)) ;
+        OK (GxB_Matrix_reshape (C, true, n/2, 2*n, NULL)) ;
+        CHECK (GB_mx_isequal (A, C, 0)) ;
+        OK (GxB_Matrix_reshape (A, true, n, n, NULL)) ;
+        OK (GxB_Matrix_reshape (C, true, n, n, NULL)) ;
+
+        CHECK (set_entries (A, C, n, 20000)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GrB_Matrix_set_INT32 (A, 1, GxB_HUGE_PAGES)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        CHECK (A->Background == NULL) ;
+        CHECK (GB_mx_isequal (A, C, 0)) ;
+        CHECK (set_entries (A, C, n, 20000)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GrB_Matrix_set_INT32 (A, GrB_COLMAJOR,
+            GrB_STORAGE_ORIENTATION_HINT)) ;
+        OK (GrB_Matrix_set_INT32 (C, GrB_COLMAJOR,
+            GrB_STORAGE_ORIENTATION_HINT)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (A, C, 0)) ;
+        CHECK (set_entries (A, C, n, 20000)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GrB_Matrix_set_INT32 (A, GrB_ROWMAJOR,
+            GrB_STORAGE_ORIENTATION_HINT)) ;
+        OK (GrB_Matrix_set_INT32 (C, GrB_ROWMAJOR,
+            GrB_STORAGE_ORIENTATION_HINT)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (A, C, 0)) ;
+
+        CHECK (set_entries (A, C, n, 20000)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        GrB_Index *Ap = NULL, *Aj = NULL, Ap_size, Aj_size, Ax_size ;
+        void *Ax = NULL ;
+        bool iso, jumbled ;
+        OK (GxB_Matrix_unpack_CSR (A, &Ap, &Aj, &Ax, &Ap_size, &Aj_size,
+            &Ax_size, &iso, &jumbled, NULL)) ;
+        CHECK (A->Background == NULL) ;
+        OK (GxB_Matrix_pack_CSR (A, &Ap, &Aj, &Ax, Ap_size, Aj_size,
+            Ax_size, iso, jumbled, NULL)) ;
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (A, C, 0)) ;
+
+        // A is freed while the background thread may still be running
+        CHECK (set_entries (A, C, n, 20000)) ;
+        OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+        OK (GrB_Matrix_free (&A)) ;
+        OK (GrB_Matrix_free (&B)) ;
+        OK (GrB_Matrix_free (&C)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // a matrix with shards of pending tuples
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_set_INT32 (A, 4, GxB_PENDING_SHARDS)) ;
+    CHECK (set_entries (A, C, n, 20000)) ;
+    OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+    CHECK (A->Shards == NULL && !A->shards_anchored) ;
+    CHECK (set_entries (A, C, n, 20000)) ;
+    OK (GrB_Matrix_wait (A, GxB_BACKGROUND)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, C, 0)) ;
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&C)) ;
+
+    //--------------------------------------------------------------------------
+    // vectors
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&v, GrB_INT32, n)) ;
+    OK (GrB_Vector_new (&v0, GrB_INT32, n)) ;
+    for (int64_t k = 0 ; k < 2000 ; k++)
+    {
+        GrB_Index i = simple_rand ( ) % n ;
+        OK (GrB_Vector_setElement_INT32 (v, (int32_t) k, i)) ;
+        OK (GrB_Vector_setElement_INT32 (v0, (int32_t) k, i)) ;
+    }
+    OK (GrB_Vector_removeElement (v, 0)) ;
+    OK (GrB_Vector_removeElement (v0, 0)) ;
+    OK (GrB_Vector_wait (v, GxB_BACKGROUND)) ;
+    OK (GrB_Vector_wait (v0, GrB_MATERIALIZE)) ;
+    OK (GrB_Vector_nvals (&nvals, v)) ;
+    CHECK (nvals == GB_nnz ((GrB_Matrix) v0)) ;
+    CHECK (GB_mx_isequal ((GrB_Matrix) v, (GrB_Matrix) v0, 0)) ;
+    OK (GrB_Vector_setElement_INT32 (v, 1, 1)) ;
+    OK (GrB_Vector_wait (v, GxB_BACKGROUND)) ;
+    OK (GrB_Vector_free (&v)) ;
+    OK (GrB_Vector_free (&v0)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test59: all tests passed\n\n") ;
+}
@@ -0,0 +1,219 @@
+//------------------------------------------------------------------------------
+// GB_mex_test60: test JIT kernels compiled in the background
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// With the JIT control set to GxB_JIT_ASYNC and an empty cache, C=A*B is
+// computed repeatedly until its JIT kernel has been compiled in the background
+// and loaded.  The C compiler is then replaced with one that always fails, so
+// that the next kernel cannot be compiled.  The failure must be detected, and
+// the JIT control changed to GxB_JIT_LOAD.  A is int16 and the semirings are
+// fp32, so no factory kernel can be used.  Each result is compared with the
+// same result computed with the JIT off.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_config.h"
+#ifndef NJIT
+#include <dirent.h>
+#include <unistd.h>
+#endif
+
+#define USAGE "GB_mex_test60"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define CACHE "/tmp/grb_test60_cache"
+#define MAX_WAIT 1200       // wait at most 1200 * 0.1 seconds for a kernel
+
+//------------------------------------------------------------------------------
+// count_axb_loaded: count the AxB kernels in the JIT profile report
+//------------------------------------------------------------------------------
+
+static GrB_Info count_axb_loaded (int *nkernels)
+{
+    GrB_Info info ;
+    size_t len = 0 ;
+    (*nkernels) = 0 ;
+    OK (GrB_Global_get_SIZE (GrB_GLOBAL, &len, GxB_JIT_PROFILE_REPORT)) ;
+    char *report = mxMalloc (len) ;
+    OK (GrB_Global_get_String (GrB_GLOBAL, report, GxB_JIT_PROFILE_REPORT)) ;
+    char *line = strtok (report, "\n") ;
+    while (line != NULL)
+    {
+        if (line [0] != '#' && strstr (line, "GB_jit__AxB") != NULL)
+        {
+            (*nkernels)++ ;
+        }
+        line = strtok (NULL, "\n") ;
+    }
+    mxFree (report) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// clear_axb_cached: remove the AxB kernels from the JIT cache
+//------------------------------------------------------------------------------
+
+static void clear_axb_cached (void)
+{
+    #ifndef NJIT
+    char folder [1024], filename [2048] ;
+    for (int bucket = 0 ; bucket <= 0xFF ; bucket++)
+    {
+        for (int kind = 0 ; kind <= 1 ; kind++)
+        {
+            snprintf (folder, 1000, "%s/%s/%02x", CACHE,
+                (kind == 0) ? "lib" : "c", bucket) ;
+            DIR *dir = opendir (folder) ;
+            if (dir == NULL) continue ;
+            struct dirent *f ;
+            while ((f = readdir (dir)) != NULL)
+            {
+                if (strstr (f->d_name, "GB_jit__AxB") != NULL)
+                {
+                    snprintf (filename, 2000, "%s/%s", folder, f->d_name) ;
+                    remove (filename) ;
+                }
+            }
+            closedir (dir) ;
+        }
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL, C0 = NULL ;
+    GrB_Index n = 50 ;
+    int nloaded ;
+    bool use_cmake ;
+    char *save_cache, *save_compiler, *s ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    simple_rand_seed (1) ;
+
+    GrB_Semiring semirings [2] = { GrB_PLUS_TIMES_SEMIRING_FP32,
+        GrB_MIN_PLUS_SEMIRING_FP32 } ;
+
+    GxB_JIT_Control control, control2 ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control)) ;
+    OK (GxB_get (GxB_JIT_USE_CMAKE, &use_cmake)) ;
+    OK (GxB_get (GxB_JIT_CACHE_PATH, &s)) ;
+    save_cache = mxMalloc (strlen (s) + 2) ;
+    strcpy (save_cache, s) ;
+    OK (GxB_get (GxB_JIT_C_COMPILER_NAME, &s)) ;
+    save_compiler = mxMalloc (strlen (s) + 2) ;
+    strcpy (save_compiler, s) ;
+
+    //--------------------------------------------------------------------------
+    // create the problem
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_INT16, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_INT16, n, n)) ;
+    for (int e = 0 ; e < 500 ; e++)
+    {
+        OK (GrB_Matrix_setElement_INT32 (A, simple_rand ( ) % 9,
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_INT32 (B, simple_rand ( ) % 9,
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP32, n, n)) ;
+    OK (GrB_Matrix_new (&C0, GrB_FP32, n, n)) ;
+
+    // use a new cache with no AxB kernels, and clear the JIT hash table
+    OK (GxB_set (GxB_JIT_CACHE_PATH, CACHE)) ;
+    clear_axb_cached ( ) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GxB_set (GxB_JIT_USE_CMAKE, false)) ;
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, true, GxB_JIT_PROFILE)) ;
+
+    #ifndef NJIT
+
+    //--------------------------------------------------------------------------
+    // compile a kernel in the background
+    //--------------------------------------------------------------------------
+
+    OK (GrB_mxm (C0, NULL, NULL, semirings [0], A, B, NULL)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ASYNC)) ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control2)) ;
+    CHECK (control2 == GxB_JIT_ASYNC) ;
+
+    nloaded = 0 ;
+    for (int k = 0 ; k < MAX_WAIT && nloaded == 0 ; k++)
+    {
+        // the generic kernel is used until the JIT kernel is ready
+        OK (GrB_mxm (C, NULL, NULL, semirings [0], A, B, NULL)) ;
+        CHECK (GB_mx_isequal (C0, C, 0)) ;
+        OK (count_axb_loaded (&nloaded)) ;
+        if (nloaded == 0) usleep (100000) ;
+    }
+    CHECK (nloaded == 1) ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &control2)) ;
+    CHECK (control2 == GxB_JIT_ASYNC) ;
+
+    //--------------------------------------------------------------------------
+    // fail to compile a kernel in the background
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GrB_mxm (C0, NULL, NULL, semirings [1], A, B, NULL)) ;
+    OK (GxB_set (GxB_JIT_C_COMPILER_NAME, "false")) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ASYNC)) ;
+
+    control2 = GxB_JIT_ASYNC ;
+    for (int k = 0 ; k < MAX_WAIT && control2 == GxB_JIT_ASYNC ; k++)
+    {
+        // the generic kernel is used, and the failure is eventually detected
+        OK (GrB_mxm (C, NULL, NULL, semirings [1], A, B, NULL)) ;
+        CHECK (GB_mx_isequal (C0, C, 0)) ;
+        OK (GxB_get (GxB_JIT_C_CONTROL, &control2)) ;
+        if (control2 == GxB_JIT_ASYNC) usleep (100000) ;
+    }
+    CHECK (control2 == GxB_JIT_LOAD) ;
+    OK (count_axb_loaded (&nloaded)) ;
+    CHECK (nloaded == 0) ;
+
+    #endif
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_set_INT32 (GrB_GLOBAL, false, GxB_JIT_PROFILE)) ;
+    OK (GxB_set (GxB_JIT_C_COMPILER_NAME, save_compiler)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GxB_set (GxB_JIT_CACHE_PATH, save_cache)) ;
+    OK (GxB_set (GxB_JIT_USE_CMAKE, use_cmake)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, control)) ;
+    mxFree (save_cache) ;
+    mxFree (save_compiler) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&B) ;
+    GrB_Matrix_free (&C) ;
+    GrB_Matrix_free (&C0) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test60: all tests passed\n\n") ;
+}
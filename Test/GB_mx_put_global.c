@@ -31,6 +31,14 @@ void GB_mx_put_global
 
     GB_cover_put (cover) ;
 
+    //--------------------------------------------------------------------------
+    // free the memory pool
+    //--------------------------------------------------------------------------
+
+    // MATLAB frees all memory from mxMalloc when the mexFunction returns, so
+    // no blocks can be kept in the memory pool between mexFunctions.
+    GB_memory_pool_flush ( ) ;
+
     //--------------------------------------------------------------------------
     // check nmemtable and nmalloc
     //--------------------------------------------------------------------------
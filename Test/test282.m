@@ -0,0 +1,12 @@
+function test282
+%TEST282 test GxB_mxm_reduce and GxB_mxm_reduce_Vector
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing GxB_mxm_reduce and GxB_mxm_reduce_Vector\n') ;
+
+GB_mex_test37 ;
+
+fprintf ('\ntest282: all tests passed\n') ;
+
@@ -0,0 +1,11 @@
+function test283
+%TEST283 test GxB_fusedmm
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing GxB_fusedmm\n') ;
+
+GB_mex_test38 ;
+
+fprintf ('\ntest283: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test284
+%TEST284 test GxB_innerProduct and GxB_outerProduct
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing GxB_innerProduct and GxB_outerProduct\n') ;
+
+GB_mex_test39 ;
+
+fprintf ('\ntest284: all tests passed\n') ;
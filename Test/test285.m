@@ -0,0 +1,11 @@
+function test285
+%TEST285 test GxB_MxmPlan
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing GxB_MxmPlan\n') ;
+
+GB_mex_test40 ;
+
+fprintf ('\ntest285: all tests passed\n') ;
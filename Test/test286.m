@@ -0,0 +1,11 @@
+function test286
+%TEST286 test autotuning of C=A*B (GxB_AUTOTUNE)
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing autotuning of C=A*B (GxB_AUTOTUNE)\n') ;
+
+GB_mex_test41 ;
+
+fprintf ('\ntest286: all tests passed\n') ;
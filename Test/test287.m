@@ -0,0 +1,11 @@
+function test287
+%TEST287 test C+=A*B and C+=A'*B with C full (saxpy4 and dot4)
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing C+=A*B and C+=A''*B with C full (saxpy4 and dot4)\n') ;
+
+GB_mex_test42 ;
+
+fprintf ('\ntest287: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test288
+%TEST288 test C+=A'*B (dot4) with many columns in B
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing C+=A''*B (dot4) with many columns in B\n') ;
+
+GB_mex_test43 ;
+
+fprintf ('\ntest288: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test289
+%TEST289 test boolean C=A*B and C=A'*B with bit-packed B and C
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing boolean C=A*B and C=A''*B with bit-packed B and C\n') ;
+
+GB_mex_test44 ;
+
+fprintf ('\ntest289: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test290
+%TEST290 test JIT kernel lookups from many user threads
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing JIT kernel lookups from many user threads\n') ;
+
+GB_mex_test45 ;
+
+fprintf ('\ntest290: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test291
+%TEST291 test the JIT manifest and GxB_JIT_warmup
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing the JIT manifest and GxB_JIT_warmup\n') ;
+
+GB_mex_test46 ;
+
+fprintf ('\ntest291: all tests passed\n') ;
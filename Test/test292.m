@@ -0,0 +1,11 @@
+function test292
+%TEST292 test GxB_JIT_pack and the JIT bundle
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing GxB_JIT_pack and the JIT bundle\n') ;
+
+GB_mex_test47 ;
+
+fprintf ('\ntest292: all tests passed\n') ;
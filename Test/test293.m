@@ -0,0 +1,11 @@
+function test293
+%TEST293 test GxB_JIT_register
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing GxB_JIT_register\n') ;
+
+GB_mex_test48 ;
+
+fprintf ('\ntest293: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test294
+%TEST294 test the JIT profile
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing GxB_JIT_PROFILE\n') ;
+
+GB_mex_test49 ;
+
+fprintf ('\ntest294: all tests passed\n') ;
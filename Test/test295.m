@@ -0,0 +1,11 @@
+function test295
+%TEST295 test GxB_JIT_MAX_LOADED and GxB_JIT_CACHE_MAX_SIZE
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing GxB_JIT_MAX_LOADED and GxB_JIT_CACHE_MAX_SIZE\n') ;
+
+GB_mex_test50 ;
+
+fprintf ('\ntest295: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test296
+%TEST296 test the JIT control and C flags of types, operators, and semirings
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing the JIT control and C flags of objects\n') ;
+
+GB_mex_test51 ;
+
+fprintf ('\ntest296: all tests passed\n') ;
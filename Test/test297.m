@@ -0,0 +1,11 @@
+function test297
+%TEST297 test JIT kernels specialized for a fixed dimension
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing JIT kernels specialized for a fixed dimension\n') ;
+
+GB_mex_test52 ;
+
+fprintf ('\ntest297: all tests passed\n') ;
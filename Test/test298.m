@@ -0,0 +1,11 @@
+function test298
+%TEST298 test user-defined operators given as object files
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing user-defined operators given as object files\n') ;
+
+GB_mex_test53 ;
+
+fprintf ('\ntest298: all tests passed\n') ;
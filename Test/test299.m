@@ -0,0 +1,11 @@
+function test299
+%TEST299 test JIT kernels compiled in-process with libtcc
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing JIT kernels compiled in-process with libtcc\n') ;
+
+GB_mex_test54 ;
+
+fprintf ('\ntest299: all tests passed\n') ;
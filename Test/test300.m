@@ -0,0 +1,11 @@
+function test300
+%TEST300 test the memory pool
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing the memory pool\n') ;
+
+GB_mex_test55 ;
+
+fprintf ('\ntest300: all tests passed\n') ;
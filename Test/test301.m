@@ -0,0 +1,11 @@
+function test301
+%TEST301 test the Werk arena of a Context
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing the Werk arena of a Context\n') ;
+
+GB_mex_test56 ;
+
+fprintf ('\ntest301: all tests passed\n') ;
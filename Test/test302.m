@@ -0,0 +1,11 @@
+function test302
+%TEST302 test huge pages and parallel first-touch
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing huge pages and parallel first-touch\n') ;
+
+GB_mex_test57 ;
+
+fprintf ('\ntest302: all tests passed\n') ;
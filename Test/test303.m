@@ -0,0 +1,11 @@
+function test303
+%TEST303 test concurrent setElement
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing concurrent setElement\n') ;
+
+GB_mex_test58 ;
+
+fprintf ('\ntest303: all tests passed\n') ;
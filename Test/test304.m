@@ -0,0 +1,11 @@
+function test304
+%TEST304 test GrB_wait with GxB_BACKGROUND
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing background wait\n') ;
+
+GB_mex_test59 ;
+
+fprintf ('\ntest304: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test305
+%TEST305 test JIT kernels compiled in the background
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('\n--- testing background JIT compilation\n') ;
+
+GB_mex_test60 ;
+
+fprintf ('\ntest305: all tests passed\n') ;
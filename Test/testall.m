@@ -99,6 +99,30 @@ malloc_debugging = stat ;
 %----------------------------------------
 
 logstat ('test281'    ,t, j4  , f1  ) ; % test user-defined idx unop, no JIT
+logstat ('test282'    ,t, j4  , f1  ) ; % test GxB_mxm_reduce and _Vector
+logstat ('test283'    ,t, j4  , f1  ) ; % test GxB_fusedmm
+logstat ('test284'    ,t, j4  , f1  ) ; % test GxB_innerProduct and outerProduct
+logstat ('test285'    ,t, j4  , f1  ) ; % test GxB_MxmPlan
+logstat ('test286'    ,t, j4  , f1  ) ; % test GxB_AUTOTUNE
+logstat ('test287'    ,t, j4  , f1  ) ; % test saxpy4 and dot4, AVX variants
+logstat ('test288'    ,t, j4  , f1  ) ; % test dot4 with wide panels of B
+logstat ('test289'    ,t, j4  , f1  ) ; % test bit-packed boolean C=A*B
+logstat ('test290'    ,t, j4  , f1  ) ; % test JIT lookups from many user threads
+logstat ('test291'    ,t, j4  , f1  ) ; % test JIT manifest and GxB_JIT_warmup
+logstat ('test292'    ,t, j4  , f1  ) ; % test GxB_JIT_pack and JIT bundle
+logstat ('test293'    ,t, j4  , f1  ) ; % test GxB_JIT_register
+logstat ('test294'    ,t, j4  , f1  ) ; % test the JIT profile
+logstat ('test295'    ,t, j4  , f1  ) ; % test JIT kernel and cache limits
+logstat ('test296'    ,t, j4  , f1  ) ; % test JIT options of types and ops
+logstat ('test297'    ,t, j4  , f1  ) ; % test JIT kernels of fixed dimension
+logstat ('test298'    ,t, j4  , f1  ) ; % test operators given as object files
+logstat ('test299'    ,t, j4  , f1  ) ; % test JIT kernels compiled with libtcc
+logstat ('test300'    ,t, j4  , f1  ) ; % test the memory pool
+logstat ('test301'    ,t, j4  , f1  ) ; % test the Werk arena of a Context
+logstat ('test302'    ,t, j4  , f1  ) ; % test huge pages and first-touch
+logstat ('test303'    ,t, j4  , f1  ) ; % test concurrent setElement
+logstat ('test304'    ,t, j4  , f1  ) ; % test background wait
+logstat ('test305'    ,t, j4  , f1  ) ; % test background JIT compilation
 logstat ('test201'    ,t, j4  , f1  ) ; % test iso reduce to vector and scalar
 logstat ('test169'    ,t, j0  , f1  ) ; % C<M>=A+B with many formats
 logstat ('test250'    ,t, j44 , f10 ) ; % JIT tests, set/get, other tests
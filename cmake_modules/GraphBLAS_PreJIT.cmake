@@ -29,10 +29,16 @@ foreach ( PSRC ${PRE1} )
         list ( APPEND PREPRO "JIT_AP2  (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__apply_unop" )
         list ( APPEND PREPRO "JIT_AP0  (" ${F} ")\n" )
+    elseif ( ${F} MATCHES "^GB_jit__AxB_dot2_fine_" )
+        list ( APPEND PREPRO "JIT_DO2F (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__AxB_dot2_" )
         list ( APPEND PREPRO "JIT_DOT2 (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__AxB_dot2n_" )
         list ( APPEND PREPRO "JIT_DO2N (" ${F} ")\n" )
+    elseif ( ${F} MATCHES "^GB_jit__AxB_dot3_rowreduce_" )
+        list ( APPEND PREPRO "JIT_DO3V (" ${F} ")\n" )
+    elseif ( ${F} MATCHES "^GB_jit__AxB_dot3_reduce_" )
+        list ( APPEND PREPRO "JIT_DO3R (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__AxB_dot3_" )
         list ( APPEND PREPRO "JIT_DOT3 (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__AxB_dot4_" )